@@ -157,6 +157,11 @@ scriptUnlocker(this)
 
 	dllManager = new BackendDllManager(this);
 
+#if HISE_INCLUDE_SNEX && SNEX_MIR_BACKEND && SNEX_ENABLE_CODE_CACHE
+	if (!inUnitTestMode() && snex::jit::CodeCache::getDefaultCache() == nullptr)
+		snex::jit::CodeCache::setDefaultCache(new snex::jit::CodeCache(ProjectHandler::getAppDataDirectory(nullptr).getChildFile("snex_code_cache")));
+#endif
+
 	if(getCurrentFileHandler().getRootFolder().isDirectory())
 		refreshExpansionType();
 
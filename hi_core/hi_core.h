@@ -285,6 +285,15 @@ Enable this to add a glitch detector to some performance crititcal functions
 #define USE_GLITCH_DETECTION 0
 #endif
 
+/** Config: HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+
+Enable this to record every allocation and lock acquisition in the audio callback (see AudioThreadViolationTracker).
+This replaces the global operator new / delete, so don't use it for release builds.
+*/
+#ifndef HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+#define HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER 0
+#endif
+
 /** Config: ENABLE_PLOTTER
 
 Set this to 0 to deactivate the plotter data collection
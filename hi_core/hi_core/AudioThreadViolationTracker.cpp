@@ -0,0 +1,438 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+struct AudioThreadViolationState
+{
+	bool isAudioThread;
+	int suspendCounter;
+	const Processor* currentProcessor;
+};
+
+// This must be constant initialised because the operator new might be called before any static initialisation.
+static thread_local AudioThreadViolationState audioThreadViolationState = { false, 0, nullptr };
+
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+
+/** The part of the state that is forwarded to the RealtimeWorkerGroup threads while they execute the tasks of an audio thread. */
+struct WorkerThreadState
+{
+	bool isAudioThread;
+	const Processor* currentProcessor;
+
+	static void capture(RealtimeWorkerGroup::ThreadState& s)
+	{
+		static_assert(sizeof(WorkerThreadState) <= sizeof(s.data), "state too big");
+
+		WorkerThreadState ws = { audioThreadViolationState.isAudioThread, audioThreadViolationState.currentProcessor };
+		memcpy(s.data, &ws, sizeof(WorkerThreadState));
+	}
+
+	static void swap(RealtimeWorkerGroup::ThreadState& s)
+	{
+		WorkerThreadState ws;
+		memcpy(&ws, s.data, sizeof(WorkerThreadState));
+
+		std::swap(ws.isAudioThread, audioThreadViolationState.isAudioThread);
+		std::swap(ws.currentProcessor, audioThreadViolationState.currentProcessor);
+
+		memcpy(s.data, &ws, sizeof(WorkerThreadState));
+	}
+
+	struct Registration
+	{
+		Registration()
+		{
+			RealtimeWorkerGroup::setThreadStateFunctions(WorkerThreadState::capture, WorkerThreadState::swap);
+		}
+	};
+};
+
+static WorkerThreadState::Registration workerThreadStateRegistration;
+
+#endif
+
+AudioThreadViolationTracker::ScopedAudioThread::ScopedAudioThread():
+	wasAudioThread(audioThreadViolationState.isAudioThread)
+{
+	audioThreadViolationState.isAudioThread = true;
+}
+
+AudioThreadViolationTracker::ScopedAudioThread::~ScopedAudioThread()
+{
+	audioThreadViolationState.isAudioThread = wasAudioThread;
+}
+
+AudioThreadViolationTracker::ScopedProcessor::ScopedProcessor(const Processor* p):
+	previousProcessor(audioThreadViolationState.currentProcessor)
+{
+	audioThreadViolationState.currentProcessor = p;
+}
+
+AudioThreadViolationTracker::ScopedProcessor::~ScopedProcessor()
+{
+	audioThreadViolationState.currentProcessor = previousProcessor;
+}
+
+AudioThreadViolationTracker::ScopedSuspender::ScopedSuspender()
+{
+	++audioThreadViolationState.suspendCounter;
+}
+
+AudioThreadViolationTracker::ScopedSuspender::~ScopedSuspender()
+{
+	--audioThreadViolationState.suspendCounter;
+}
+
+String AudioThreadViolationTracker::Violation::toString() const
+{
+	String s;
+
+	s << getViolationTypeName(type) << " in " << processorId;
+	s << " (" << description << "): " << String(numOccurrences) << "x";
+
+	return s;
+}
+
+AudioThreadViolationTracker& AudioThreadViolationTracker::getInstance()
+{
+	static AudioThreadViolationTracker instance;
+	return instance;
+}
+
+bool AudioThreadViolationTracker::isAudioThread() noexcept
+{
+	return audioThreadViolationState.isAudioThread && audioThreadViolationState.suspendCounter == 0;
+}
+
+void AudioThreadViolationTracker::onAllocation(void* callSite) noexcept
+{
+	if (isAudioThread())
+		getInstance().recordViolation(ViolationType::Allocation, 0, callSite, nullptr);
+}
+
+void AudioThreadViolationTracker::onDeallocation(void* callSite) noexcept
+{
+	if (isAudioThread())
+		getInstance().recordViolation(ViolationType::Deallocation, 0, callSite, nullptr);
+}
+
+void AudioThreadViolationTracker::onLock(int lockType) noexcept
+{
+	if (isAudioThread())
+		getInstance().recordViolation(ViolationType::LockAcquisition, lockType, nullptr, nullptr);
+}
+
+void AudioThreadViolationTracker::onIllegalOperation(AudioThreadGuard::Handler& handler, int operationType) noexcept
+{
+	if (isAudioThread())
+		getInstance().recordViolation(ViolationType::IllegalOperation, operationType, nullptr, &handler);
+}
+
+void AudioThreadViolationTracker::clear()
+{
+	SpinLock::ScopedLockType sl(violationLock);
+	violations.clearQuick();
+}
+
+int AudioThreadViolationTracker::getNumViolations(ViolationType t) const
+{
+	SpinLock::ScopedLockType sl(violationLock);
+
+	int numViolations = 0;
+
+	for (const auto& v : violations)
+	{
+		if (v.type == t)
+			numViolations += v.numOccurrences;
+	}
+
+	return numViolations;
+}
+
+int AudioThreadViolationTracker::getNumViolations() const
+{
+	int numViolations = 0;
+
+	for (int i = 0; i < (int)ViolationType::numViolationTypes; i++)
+		numViolations += getNumViolations((ViolationType)i);
+
+	return numViolations;
+}
+
+String AudioThreadViolationTracker::createReport(int maxNumEntries, int maxNumStackFrames) const
+{
+	Array<Violation> sorted;
+
+	{
+		SpinLock::ScopedLockType sl(violationLock);
+		sorted.addArray(violations);
+	}
+
+	struct Sorter
+	{
+		static int compareElements(const Violation& first, const Violation& second)
+		{
+			if (first.numOccurrences > second.numOccurrences)
+				return -1;
+
+			if (first.numOccurrences < second.numOccurrences)
+				return 1;
+
+			return 0;
+		}
+	};
+
+	Sorter sorter;
+	sorted.sort(sorter, true);
+
+	NewLine nl;
+	String report;
+
+	report << "Audio thread violations: " << String(getNumViolations()) << " at " << String(sorted.size()) << " locations" << nl;
+
+	for (int i = 0; i < jmin(maxNumEntries, sorted.size()); i++)
+	{
+		const auto& v = sorted.getReference(i);
+
+		report << "#" << String(i + 1) << ": " << v.toString() << nl;
+
+		int numFrames = 0;
+
+		for (const auto& frame : StringArray::fromLines(v.stackTrace))
+		{
+			// skip the frames of the tracker and empty lines
+			if (frame.trim().isEmpty() || frame.contains("AudioThreadViolationTracker") || frame.contains("getStackBacktrace"))
+				continue;
+
+			report << "    " << frame.trim() << nl;
+
+			if (++numFrames >= maxNumStackFrames)
+				break;
+		}
+	}
+
+	if (sorted.size() > maxNumEntries)
+		report << "(" << String(sorted.size() - maxNumEntries) << " more locations omitted)" << nl;
+
+	return report;
+}
+
+Result AudioThreadViolationTracker::renderOfflineAndCheck(MainController* mc, double sampleRate, int blockSize, int numBlocks)
+{
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+	auto p = dynamic_cast<AudioProcessor*>(mc);
+
+	if (p == nullptr)
+		return Result::fail("The MainController is not an AudioProcessor");
+
+	p->prepareToPlay(sampleRate, blockSize);
+
+	AudioSampleBuffer buffer(jmax(2, p->getTotalNumOutputChannels()), blockSize);
+
+	MidiBuffer noteOn, noteOff, midi;
+
+	noteOn.addEvent(MidiMessage::noteOn(1, 64, 1.0f), 0);
+	noteOff.addEvent(MidiMessage::noteOff(1, 64), blockSize / 2);
+
+	auto& tracker = getInstance();
+	tracker.clear();
+
+	for (int i = 0; i < numBlocks; i++)
+	{
+		buffer.clear();
+
+		if (i == 0)
+			midi = noteOn;
+		else if (i == numBlocks / 2)
+			midi = noteOff;
+		else
+			midi.clear();
+
+		p->processBlock(buffer, midi);
+	}
+
+	if (tracker.getNumViolations() > 0)
+		return Result::fail(tracker.createReport());
+
+	return Result::ok();
+#else
+	ignoreUnused(mc, sampleRate, blockSize, numBlocks);
+	return Result::fail("You need to set HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER in order to check the audio thread");
+#endif
+}
+
+void AudioThreadViolationTracker::recordViolation(ViolationType t, int operationType, void* callSite, AudioThreadGuard::Handler* handler)
+{
+	// Everything below will allocate so we need to make sure that it doesn't end up here again...
+	ScopedSuspender ss;
+
+	auto p = audioThreadViolationState.currentProcessor;
+
+	SpinLock::ScopedLockType sl(violationLock);
+
+	for (auto& v : violations)
+	{
+		if (v.type == t && v.operationType == operationType && v.callSite == callSite && v.processor == p)
+		{
+			v.numOccurrences++;
+			return;
+		}
+	}
+
+	Violation v;
+
+	v.type = t;
+	v.operationType = operationType;
+	v.callSite = callSite;
+	v.processor = p;
+	v.processorId = p != nullptr ? p->getId() : "Unknown processor";
+	v.stackTrace = SystemStats::getStackBacktrace();
+	v.numOccurrences = 1;
+
+	switch (t)
+	{
+	case ViolationType::Allocation:			v.description = "operator new"; break;
+	case ViolationType::Deallocation:		v.description = "operator delete"; break;
+	case ViolationType::LockAcquisition:	v.description = LockHelpers::getLockName((LockHelpers::Type)operationType).toString(); break;
+	case ViolationType::IllegalOperation:	v.description = handler != nullptr ? handler->getOperationName(operationType) : String(operationType); break;
+	default:								break;
+	}
+
+	violations.add(v);
+}
+
+String AudioThreadViolationTracker::getViolationTypeName(ViolationType t)
+{
+	switch (t)
+	{
+	case ViolationType::Allocation:			return "Allocation";
+	case ViolationType::Deallocation:		return "Deallocation";
+	case ViolationType::LockAcquisition:	return "Lock";
+	case ViolationType::IllegalOperation:	return "Illegal operation";
+	default:								return {};
+	}
+}
+
+} // namespace hise
+
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+
+// The replacements for the global operator new / delete. They just forward to malloc / free
+// after reporting the call site to the tracker if the current thread is the audio thread.
+
+#if JUCE_MSVC
+#include <intrin.h>
+#define HISE_ALLOCATION_CALL_SITE _ReturnAddress()
+#else
+#define HISE_ALLOCATION_CALL_SITE __builtin_return_address(0)
+#endif
+
+void* operator new(std::size_t size)
+{
+	hise::AudioThreadViolationTracker::onAllocation(HISE_ALLOCATION_CALL_SITE);
+
+	if (auto ptr = std::malloc(size != 0 ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+	hise::AudioThreadViolationTracker::onAllocation(HISE_ALLOCATION_CALL_SITE);
+
+	if (auto ptr = std::malloc(size != 0 ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	hise::AudioThreadViolationTracker::onAllocation(HISE_ALLOCATION_CALL_SITE);
+	return std::malloc(size != 0 ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	hise::AudioThreadViolationTracker::onAllocation(HISE_ALLOCATION_CALL_SITE);
+	return std::malloc(size != 0 ? size : 1);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if (ptr != nullptr)
+		hise::AudioThreadViolationTracker::onDeallocation(HISE_ALLOCATION_CALL_SITE);
+
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	if (ptr != nullptr)
+		hise::AudioThreadViolationTracker::onDeallocation(HISE_ALLOCATION_CALL_SITE);
+
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	if (ptr != nullptr)
+		hise::AudioThreadViolationTracker::onDeallocation(HISE_ALLOCATION_CALL_SITE);
+
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	if (ptr != nullptr)
+		hise::AudioThreadViolationTracker::onDeallocation(HISE_ALLOCATION_CALL_SITE);
+
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+#undef HISE_ALLOCATION_CALL_SITE
+
+#endif
@@ -0,0 +1,183 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#ifndef AUDIOTHREADVIOLATIONTRACKER_H_INCLUDED
+#define AUDIOTHREADVIOLATIONTRACKER_H_INCLUDED
+
+namespace hise {
+using namespace juce;
+
+class Processor;
+class MainController;
+
+/** Records every heap allocation, deallocation and lock acquisition that happens inside the audio callback.
+
+	The AudioThreadGuard only catches the operations that are explicitely instrumented (HeapBlock, String, etc.).
+	This class goes one step further and hooks the global operator new / delete as well as the LockHelpers::SafeLock
+	so you can prove that ModulatorSynthChain::renderNextBlockWithModulators() and everything below it is real-time safe.
+
+	Every violation is stored along with the Processor that was rendering at that time and a stack backtrace of the first
+	occurrence. Identical violations (same type, processor and call site) are merged so you'll end up with a list that you
+	can sort by the number of occurrences using createReport().
+
+	In order to use it, set HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER to 1. This will replace the global operator new / delete
+	of the entire binary, so don't ship a plugin with this flag enabled. 
+*/
+class AudioThreadViolationTracker
+{
+public:
+
+	enum class ViolationType
+	{
+		Allocation = 0,
+		Deallocation,
+		LockAcquisition,
+		IllegalOperation,
+		numViolationTypes
+	};
+
+	/** Marks the current thread as audio thread for the lifetime of this object.
+
+		This is created in MainController::processBlockCommon() after the process lock was acquired so that everything
+		that happens inside prepareToPlay() is excluded. The RealtimeWorkerGroup threads inherit this state (and the
+		ScopedProcessor) while they execute the tasks of an audio thread.
+	*/
+	struct ScopedAudioThread
+	{
+		ScopedAudioThread();
+		~ScopedAudioThread();
+
+	private:
+
+		const bool wasAudioThread;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedAudioThread);
+	};
+
+	/** Sets the processor that will be reported as owner of all violations in the current thread during the lifetime of this object. */
+	struct ScopedProcessor
+	{
+		ScopedProcessor(const Processor* p);
+		~ScopedProcessor();
+
+	private:
+
+		const Processor* previousProcessor;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedProcessor);
+	};
+
+	/** Temporarily stops recording violations in the current thread (eg. if you want to print something to the console). */
+	struct ScopedSuspender
+	{
+		ScopedSuspender();
+		~ScopedSuspender();
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedSuspender);
+	};
+
+	struct Violation
+	{
+		String toString() const;
+
+		ViolationType type;
+		int operationType;
+		void* callSite;
+		const Processor* processor;
+
+		String description;
+		String processorId;
+		String stackTrace;
+		int numOccurrences;
+	};
+
+	static AudioThreadViolationTracker& getInstance();
+
+	/** Returns true if the current thread is within a ScopedAudioThread. */
+	static bool isAudioThread() noexcept;
+
+	/** Called by the global operator new. */
+	static void onAllocation(void* callSite) noexcept;
+
+	/** Called by the global operator delete. */
+	static void onDeallocation(void* callSite) noexcept;
+
+	/** Called by the LockHelpers::SafeLock before acquiring the lock. */
+	static void onLock(int lockType) noexcept;
+
+	/** Called by the KillStateHandler whenever the AudioThreadGuard catches an illegal operation. */
+	static void onIllegalOperation(AudioThreadGuard::Handler& handler, int operationType) noexcept;
+
+	/** Removes all recorded violations. */
+	void clear();
+
+	/** Returns the total number of occurrences for the given type. */
+	int getNumViolations(ViolationType t) const;
+
+	/** Returns the total number of occurrences for all types. */
+	int getNumViolations() const;
+
+	/** Creates a report with all violations sorted by the number of their occurrences. */
+	String createReport(int maxNumEntries=20, int maxNumStackFrames=16) const;
+
+	/** Renders the current preset of the MainController offline and checks that there was no violation after prepareToPlay().
+	
+		It sends a note on at the start and a note off after the half of the given blocks so that the voice start, the release
+		and the voice reset are included. If anything happened on the audio thread, the result will contain the report.
+	*/
+	static Result renderOfflineAndCheck(MainController* mc, double sampleRate=44100.0, int blockSize=512, int numBlocks=200);
+
+private:
+
+	AudioThreadViolationTracker() = default;
+
+	void recordViolation(ViolationType t, int operationType, void* callSite, AudioThreadGuard::Handler* handler);
+
+	static String getViolationTypeName(ViolationType t);
+
+	SpinLock violationLock;
+	Array<Violation> violations;
+
+	JUCE_DECLARE_NON_COPYABLE(AudioThreadViolationTracker);
+};
+
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+#define ENABLE_AUDIO_THREAD_VIOLATION_TRACKING() AudioThreadViolationTracker::ScopedAudioThread satvt
+#define ADD_AUDIO_THREAD_VIOLATION_SCOPE(processor) AudioThreadViolationTracker::ScopedProcessor satvp(processor)
+#else
+#define ENABLE_AUDIO_THREAD_VIOLATION_TRACKING()
+#define ADD_AUDIO_THREAD_VIOLATION_SCOPE(processor)
+#endif
+
+} // namespace hise
+
+#endif  // AUDIOTHREADVIOLATIONTRACKER_H_INCLUDED
@@ -67,6 +67,10 @@ public:
 		testAlignment<16>(128);
 		testAlignment<1>(128);
 		testAlignment<32>(32);
+		testEventBufferMerge();
+		testOverflowPolicies();
+		testTypeIterator();
+		benchmarkEventBuffer();
 	}
 
 private:
@@ -777,6 +781,219 @@ private:
 		
 	}
 
+	static HiseEvent createEventWithTimestamp(HiseEvent::Type t, int noteNumber, int timestamp)
+	{
+		HiseEvent e(t, (uint8)noteNumber, 64, 1);
+		e.setTimeStamp(timestamp);
+		return e;
+	}
+
+	void testEventBufferMerge()
+	{
+		beginTest("Testing bulk merge of event buffers");
+
+		for (int i = 0; i < 20; i++)
+		{
+			HiseEventBuffer a, b, expected;
+
+			const int numA = r.nextInt(HISE_EVENT_BUFFER_SIZE / 2);
+			const int numB = r.nextInt(HISE_EVENT_BUFFER_SIZE / 2);
+
+			for (int j = 0; j < numA; j++)
+				a.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOn, 1, r.nextInt(512)));
+
+			for (int j = 0; j < numB; j++)
+				b.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOff, 2, r.nextInt(512)));
+
+			expected.copyFrom(a);
+
+			for (const auto& e : b)
+				expected.addEvent(e);
+
+			a.addEvents(b);
+
+			expectEquals(a.getNumUsed(), numA + numB, "Merged size");
+			expect(a.timeStampsAreSorted(), "Merged timestamps are sorted");
+			expect(a == expected, "Merge matches sequential insertion");
+		}
+
+		HiseEventBuffer source, below;
+
+		for (int i = 0; i < 64; i++)
+			source.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, i, i * 8));
+
+		below.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOn, 1, 100));
+
+		source.moveEventsBelow(below, 256);
+
+		expectEquals(source.getNumUsed(), 32, "Remaining events after moveEventsBelow");
+		expectEquals(below.getNumUsed(), 33, "Moved events");
+		expect(below.timeStampsAreSorted(), "Target is sorted");
+		expectEquals(source.getMinTimeStamp(), 256, "First remaining timestamp");
+	}
+
+	void testOverflowPolicies()
+	{
+		beginTest("Testing overflow policies");
+
+		{
+			HiseEventBuffer b;
+
+			for (int i = 0; i < HISE_EVENT_BUFFER_SIZE + 10; i++)
+				b.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, 1, i));
+
+			expectEquals(b.getNumUsed(), HISE_EVENT_BUFFER_SIZE, "Buffer is full");
+			expectEquals(b.getNumDroppedEvents(), 10, "Dropped events");
+			expectEquals(b.getMaxTimeStamp(), HISE_EVENT_BUFFER_SIZE - 1, "The new events are dropped");
+		}
+
+		{
+			HiseEventBuffer b;
+			b.setOverflowPolicy(HiseEventBuffer::OverflowPolicy::KeepNoteEvents);
+
+			for (int i = 0; i < HISE_EVENT_BUFFER_SIZE; i++)
+				b.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, 1, i));
+
+			b.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOn, 60, 20));
+			b.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, 1, 20));
+
+			HiseEventBuffer::Iterator it(b, HiseEventBuffer::NoteEventMask);
+			auto noteOn = it.getNextConstEventPointer();
+
+			expect(noteOn != nullptr && noteOn->getNoteNumber() == 60, "Note on was inserted");
+			expectEquals(b.getNumUsed(), HISE_EVENT_BUFFER_SIZE, "Buffer is still full");
+			expectEquals(b.getNumDroppedEvents(), 2, "One controller removed, one rejected");
+		}
+
+		{
+			HiseEventBuffer b, spill;
+			b.setOverflowPolicy(HiseEventBuffer::OverflowPolicy::SpillToBuffer, &spill);
+
+			for (int i = 0; i < HISE_EVENT_BUFFER_SIZE; i++)
+				b.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, 1, i + 10));
+
+			b.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOn, 60, 0));
+			b.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOff, 60, 100000));
+
+			expectEquals(b.getNumUsed(), HISE_EVENT_BUFFER_SIZE, "Buffer is full");
+			expectEquals(spill.getNumUsed(), 2, "Spilled events");
+			expectEquals(b.getMinTimeStamp(), 0, "Early event was inserted");
+			expect(spill.getEvent(1).isNoteOff(), "Late event was spilled");
+			expectEquals(b.getNumDroppedEvents(), 0, "No dropped events");
+		}
+	}
+
+	void testTypeIterator()
+	{
+		beginTest("Testing filtered iterator");
+
+		HiseEventBuffer b;
+
+		int numNotes = 0;
+
+		for (int i = 0; i < 200; i++)
+		{
+			auto t = (i % 3 == 0) ? HiseEvent::Type::NoteOn : (i % 3 == 1 ? HiseEvent::Type::Controller : HiseEvent::Type::PitchBend);
+
+			if (t == HiseEvent::Type::NoteOn)
+				numNotes++;
+
+			b.addEvent(createEventWithTimestamp(t, i % 127, i));
+		}
+
+		HiseEventBuffer::Iterator it(b, HiseEventBuffer::NoteEventMask);
+
+		int numFound = 0;
+
+		while (auto e = it.getNextConstEventPointer())
+		{
+			expect(e->isNoteOn(), "Only note events");
+			numFound++;
+		}
+
+		expectEquals(numFound, numNotes, "Number of note events");
+
+		auto mask = HiseEventBuffer::getTypeMask(HiseEvent::Type::Controller) | HiseEventBuffer::getTypeMask(HiseEvent::Type::PitchBend);
+		HiseEventBuffer::Iterator it2(b, mask);
+
+		numFound = 0;
+
+		HiseEvent e;
+		int pos;
+
+		while (it2.getNextEvent(e, pos))
+		{
+			expect(!e.isNoteOn(), "Only CC & pitchbend");
+			numFound++;
+		}
+
+		expectEquals(numFound, 200 - numNotes, "Number of CC events");
+	}
+
+	void benchmarkEventBuffer()
+	{
+		beginTest("Benchmarking event buffer operations");
+
+		static constexpr int NumRuns = 200;
+		const int numEvents = HISE_EVENT_BUFFER_SIZE / 2;
+
+		HeapBlock<int> timestamps(numEvents);
+
+		for (int i = 0; i < numEvents; i++)
+			timestamps[i] = r.nextInt(512);
+
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int run = 0; run < NumRuns; run++)
+		{
+			HiseEventBuffer b;
+
+			for (int i = 0; i < numEvents; i++)
+				b.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, 1, timestamps[i]));
+		}
+
+		auto randomInsertTime = Time::getMillisecondCounterHiRes() - start;
+
+		start = Time::getMillisecondCounterHiRes();
+
+		for (int run = 0; run < NumRuns; run++)
+		{
+			HiseEventBuffer b;
+
+			for (int i = 0; i < numEvents; i++)
+				b.addEvent(createEventWithTimestamp(HiseEvent::Type::Controller, 1, i));
+		}
+
+		auto sortedInsertTime = Time::getMillisecondCounterHiRes() - start;
+
+		HiseEventBuffer a, other;
+
+		for (int i = 0; i < numEvents; i++)
+		{
+			a.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOn, 1, timestamps[i]));
+			other.addEvent(createEventWithTimestamp(HiseEvent::Type::NoteOff, 1, timestamps[numEvents - 1 - i]));
+		}
+
+		start = Time::getMillisecondCounterHiRes();
+
+		for (int run = 0; run < NumRuns; run++)
+		{
+			HiseEventBuffer b;
+			b.copyFrom(a);
+			b.addEvents(other);
+		}
+
+		auto mergeTime = Time::getMillisecondCounterHiRes() - start;
+
+		String msg;
+		msg << String(NumRuns) << " runs with " << String(numEvents) << " events: ";
+		msg << "random insert: " << String(randomInsertTime, 2) << " ms, ";
+		msg << "sorted insert: " << String(sortedInsertTime, 2) << " ms, ";
+		msg << "bulk merge: " << String(mergeTime, 2) << " ms";
+
+		logMessage(msg);
+	}
+
 	Random r;
 
 	void testStartOffset()
@@ -161,6 +161,7 @@ Array<juce::Identifier> HiseSettings::Scripting::getAllIds()
 
 	ids.add(EnableCallstack);
 	ids.add(EnableOptimizations);
+	ids.add(EnableBytecode);
 	ids.add(GlobalScriptPath);
 	ids.add(CompileTimeout);
 	ids.add(CodeFontSize);
@@ -561,6 +562,12 @@ Array<juce::Identifier> HiseSettings::SnexWorkbench::getAllIds()
 		D("> This setting is baked into a plugin when you compile it");
 		P_();
 
+		P(HiseSettings::Scripting::EnableBytecode);
+		D("Compiles the callbacks and inline functions to bytecode that is executed by a register based interpreter instead of walking the syntax tree.");
+		D("The results are identical, so you can turn this off in order to compare the execution times of the callbacks.");
+		D("> Compiled plugins use the `HISE_USE_SCRIPT_BYTECODE` preprocessor instead (which is disabled by default)");
+		P_();
+
 		P(HiseSettings::Scripting::EnableMousePositioning);
 		D("Sets the default value of whether the interface designer should allow dragging UI components with the mouse");
 		D("> This was always enabled, but on larger projects it's easy to accidentally drag UI elements when you really just wanted to select them so this gives you the option to remove the dragging.");
@@ -903,6 +910,7 @@ juce::StringArray HiseSettings::Data::getOptionsFor(const Identifier& id)
 		id == Other::EnableAutosave ||
 		id == Scripting::EnableDebugMode ||
 		id == Scripting::EnableOptimizations ||
+		id == Scripting::EnableBytecode ||
 		id == Other::AudioThreadGuardEnabled ||
 		id == Other::UseOpenGL ||
         id == Other::AutoShowWorkspace ||
@@ -1161,6 +1169,7 @@ var HiseSettings::Data::getDefaultSetting(const Identifier& id) const
 	else if (id == Scripting::CodeFontSize)			return 17.0;
 	else if (id == Scripting::EnableCallstack)		return "No";
 	else if (id == Scripting::EnableOptimizations)	return "No";
+	else if (id == Scripting::EnableBytecode)		return "No";
 	else if (id == Scripting::EnableMousePositioning) return "Yes";
 	else if (id == Scripting::CompileTimeout)		return 5.0;
 	else if (id == Scripting::SaveConnectedFilesOnCompile) return "No";
@@ -1316,7 +1325,7 @@ void HiseSettings::Data::settingWasChanged(const Identifier& id, const var& newV
 		mc->getAutoSaver().updateAutosaving();
 	else if (id == Other::AudioThreadGuardEnabled)
 		mc->getKillStateHandler().enableAudioThreadGuard(newValue);
-	else if (id == Scripting::EnableOptimizations)
+	else if (id == Scripting::EnableOptimizations || id == Scripting::EnableBytecode)
 		mc->compileAllScripts();
 	else if (id == Scripting::EnableDebugMode)
 		newValue ? mc->getDebugLogger().startLogging() : mc->getDebugLogger().stopLogging();
@@ -151,6 +151,7 @@ DECLARE_ID(GlobalScriptPath);
 DECLARE_ID(CompileTimeout);
 DECLARE_ID(CodeFontSize);
 DECLARE_ID(EnableOptimizations);
+DECLARE_ID(EnableBytecode);
 DECLARE_ID(EnableDebugMode);
 DECLARE_ID(WarnIfUndefinedParameters);
 DECLARE_ID(SaveConnectedFilesOnCompile);
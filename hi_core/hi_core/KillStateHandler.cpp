@@ -666,9 +666,13 @@ void MainController::KillStateHandler::addThreadIdToAudioThreadList()
     if(MessageManager::getInstance()->isThisTheMessageThread())
         return;
     
-	auto threadId = Thread::getCurrentThreadId();
+	addThreadIdToAudioThreadList(Thread::getCurrentThreadId());
+}
 
-	audioThreads.insert(threadId);
+void MainController::KillStateHandler::addThreadIdToAudioThreadList(void* threadId)
+{
+	if (threadId != nullptr)
+		audioThreads.insert(threadId);
 }
 
 void MainController::KillStateHandler::removeThreadIdFromAudioThreadList()
@@ -709,6 +713,10 @@ void MainController::KillStateHandler::initAudioThreadId()
 
 void MainController::KillStateHandler::warn(int operationType)
 {
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+	AudioThreadViolationTracker::onIllegalOperation(*this, operationType);
+#endif
+
 	if (guardEnabled)
 	{
 		String errorMessage = "Illegal call in audio thread detected: \n";
@@ -247,6 +247,10 @@ LockHelpers::SafeLock::SafeLock(const MainController* mc_, Type t, bool useRealL
 
 	if (useRealLock && !mc->getKillStateHandler().currentThreadHoldsLock(type))
 	{
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+		AudioThreadViolationTracker::onLock((int)type);
+#endif
+
 		try
 		{
 			lock = &getLockChecked(mc, type);
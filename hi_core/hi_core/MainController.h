@@ -1300,6 +1300,9 @@ public:
 
 		void addThreadIdToAudioThreadList();
 
+		/** Adds the given thread to the audio thread list. The list is not thread safe, so call this only from the audio thread or with the audio lock. */
+		void addThreadIdToAudioThreadList(void* threadId);
+
 		void removeThreadIdFromAudioThreadList();
 
 		bool test() const noexcept override;
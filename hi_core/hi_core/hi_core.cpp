@@ -60,6 +60,7 @@
 #include "GlobalScriptCompileBroadcaster.cpp"
 #include "MainControllerHelpers.cpp"
 #include "LockHelpers.cpp"
+#include "AudioThreadViolationTracker.cpp"
 #include "LockfreeDispatcher.cpp"
 #include "MainController.cpp"
 #include "MainControllerSubClasses.cpp"
@@ -96,6 +96,7 @@
 #include "GlobalScriptCompileBroadcaster.h"
 #include "MainControllerHelpers.h"
 #include "LockHelpers.h"
+#include "AudioThreadViolationTracker.h"
 #include "MainController.h"
 #include "Console.h"
 
@@ -590,6 +590,16 @@ void Processor::setIsOnAir(bool shouldBeOnAir)
 
 	onAir = shouldBeOnAir;
 
+	if (shouldBeOnAir)
+	{
+		// A new module might add dependencies between the child synths of a container
+		for (auto p = parentProcessor.get(); p != nullptr; p = p->parentProcessor.get())
+		{
+			if (auto c = dynamic_cast<ModulatorSynthChain*>(p))
+				c->invalidateParallelRenderTasks();
+		}
+	}
+
 	for (int i = 0; i < getNumChildProcessors(); i++)
 	{
 		getChildProcessor(i)->setIsOnAir(shouldBeOnAir);
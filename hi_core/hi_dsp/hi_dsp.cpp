@@ -55,6 +55,7 @@
 #include "modules/MidiPlayer.cpp"
 #include "modules/EffectProcessor.cpp"
 #include "modules/EffectProcessorChain.cpp"
+#include "modules/VoiceAllocator.cpp"
 #include "modules/ModulatorSynth.cpp"
 #include "modules/ModulatorSynthChain.cpp"
 #include "modules/ModulatorSynthGroup.cpp"
@@ -100,6 +100,7 @@ class ProcessorEditor;
 #include "modules/EffectProcessor.h"
 #include "modules/EffectProcessorChain.h"
 
+#include "modules/VoiceAllocator.h"
 #include "modules/ModulatorSynth.h"
 #include "modules/ModulatorSynthChain.h"
 #include "modules/ModulatorSynthGroup.h"
@@ -148,6 +148,17 @@ bool EffectProcessorChain::hasTailingMasterEffects() const noexcept
 	return resetCounter > 0;
 }
 
+bool EffectProcessorChain::hasActivePolyEffects() const noexcept
+{
+	for (int i = 0; i < voiceEffects.size(); i++)
+	{
+		if (!voiceEffects[i]->isBypassed())
+			return true;
+	}
+
+	return false;
+}
+
 bool EffectProcessorChain::hasTailingPolyEffects() const
 {
 	for (int i = 0; i < voiceEffects.size(); i++)
@@ -270,6 +281,7 @@ void EffectProcessorChain::renderMasterEffects(AudioSampleBuffer &b)
 	for(auto mfx: masterEffects)
 	{
 		ScopedAnalyser sa(getMainController(), mfx, b, b.getNumSamples());
+		ADD_AUDIO_THREAD_VIOLATION_SCOPE(mfx);
 
 		if(!mfx->isSoftBypassed())
 			mfx->renderWholeBuffer(b);
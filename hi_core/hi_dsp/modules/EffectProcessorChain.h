@@ -92,6 +92,8 @@ public:
 
 	bool hasTailingPolyEffects() const;
 
+	bool hasActivePolyEffects() const noexcept;
+
 	void killMasterEffects();
 
 	void updateSoftBypassState();
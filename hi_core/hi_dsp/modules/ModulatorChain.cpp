@@ -132,9 +132,11 @@ void ModulatorChain::ModChainWithBuffer::setScratchBufferFunction(
 
 void ModulatorChain::ModChainWithBuffer::setConstantVoiceValueInternal(int voiceIndex, float newValue)
 {
-	lastConstantVoiceValue = newValue;
+	auto& s = getRenderState();
+
+	s.lastConstantVoiceValue = newValue;
 	currentConstantVoiceValues[voiceIndex] = newValue;
-	currentConstantValue = newValue;
+	s.currentConstantValue = newValue;
 }
 
 const Chain::Handler* ModulatorChain::getHandler() const
@@ -341,14 +343,16 @@ void ModulatorChain::ModChainWithBuffer::applyMonophonicValuesToVoiceInternal(fl
 
 void ModulatorChain::ModChainWithBuffer::setDisplayValueInternal(int voiceIndex, int startSample, int numSamples)
 {
+	auto& s = getRenderState();
+
 	if (c->polyManager.getLastStartedVoice() == voiceIndex)
 	{
 		float displayValue;
 
-		if (currentVoiceData == nullptr)
+		if (s.currentVoiceData == nullptr)
 			displayValue = getConstantModulationValue();
 		else
-			displayValue = currentVoiceData[startSample];
+			displayValue = s.currentVoiceData[startSample];
 
 		if (c->getMode() == Modulation::PanMode)
 		{
@@ -358,8 +362,8 @@ void ModulatorChain::ModChainWithBuffer::setDisplayValueInternal(int voiceIndex,
 
 		c->setOutputValue(displayValue);
 
-		if(currentVoiceData != nullptr)
-			c->pushPlotterValues(currentVoiceData, startSample, numSamples);
+		if(s.currentVoiceData != nullptr)
+			c->pushPlotterValues(s.currentVoiceData, startSample, numSamples);
 	}
 }
 
@@ -386,6 +390,7 @@ ModulatorChain::ModChainWithBuffer::~ModChainWithBuffer()
 	c = nullptr;
 
 	modBuffer.clear();
+	workerBufferData.free();
 }
 
 void ModulatorChain::ModChainWithBuffer::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -393,7 +398,71 @@ void ModulatorChain::ModChainWithBuffer::prepareToPlay(double sampleRate, int sa
 	c->prepareToPlay(sampleRate, samplesPerBlock);
 
 	if (type == Type::Normal)
+	{
 		modBuffer.setMaxSize(samplesPerBlock);
+		maxSamplesPerBlock = samplesPerBlock;
+		setNumWorkerBuffers(numWorkerBuffers);
+	}
+}
+
+void ModulatorChain::ModChainWithBuffer::setNumWorkerBuffers(int numWorkers)
+{
+	numWorkerBuffers = jlimit(1, HISE_MAX_REALTIME_WORKERS, numWorkers);
+
+	if (type == Type::Normal && numWorkerBuffers > 1 && maxSamplesPerBlock > 0)
+	{
+		// The first worker uses the voice values & scratch buffer of the modBuffer
+		auto numPerBuffer = dsp::SIMDRegister<float>::SIMDRegisterSize + maxSamplesPerBlock;
+		workerBufferData.calloc((numWorkerBuffers - 1) * 2 * numPerBuffer);
+	}
+	else
+	{
+		workerBufferData.free();
+	}
+
+	updateRenderStatePointers();
+}
+
+ModulatorChain::ModChainWithBuffer::VoiceRenderState& ModulatorChain::ModChainWithBuffer::getRenderState() noexcept
+{
+	auto index = RealtimeWorkerGroup::getCurrentWorkerIndex();
+
+	// If the chain is not rendered concurrently (eg. a whole child synth is rendered
+	// on a worker thread), it uses the default state.
+	return renderStates[index < numWorkerBuffers ? index : 0];
+}
+
+const ModulatorChain::ModChainWithBuffer::VoiceRenderState& ModulatorChain::ModChainWithBuffer::getRenderState() const noexcept
+{
+	auto index = RealtimeWorkerGroup::getCurrentWorkerIndex();
+	return renderStates[index < numWorkerBuffers ? index : 0];
+}
+
+void ModulatorChain::ModChainWithBuffer::updateRenderStatePointers()
+{
+	renderStates[0].voiceValues = modBuffer.voiceValues;
+	renderStates[0].scratchBuffer = modBuffer.scratchBuffer;
+
+	auto numPerBuffer = dsp::SIMDRegister<float>::SIMDRegisterSize + maxSamplesPerBlock;
+
+	for (int i = 1; i < HISE_MAX_REALTIME_WORKERS; i++)
+	{
+		auto& s = renderStates[i];
+
+		if (workerBufferData != nullptr && i < numWorkerBuffers)
+		{
+			auto start = workerBufferData.get() + (i - 1) * 2 * numPerBuffer;
+			s.voiceValues = dsp::SIMDRegister<float>::getNextSIMDAlignedPtr(start);
+			s.scratchBuffer = dsp::SIMDRegister<float>::getNextSIMDAlignedPtr(start + numPerBuffer);
+		}
+		else
+		{
+			s.voiceValues = nullptr;
+			s.scratchBuffer = nullptr;
+		}
+
+		s.currentVoiceData = nullptr;
+	}
 }
 
 void ModulatorChain::ModChainWithBuffer::handleHiseEvent(const HiseEvent& m)
@@ -450,21 +519,53 @@ void ModulatorChain::ModChainWithBuffer::startVoice(int voiceIndex)
 
 void ModulatorChain::ModChainWithBuffer::expandVoiceValuesToAudioRate(int voiceIndex, int startSample, int numSamples)
 {
-	if (currentVoiceData != nullptr)
+	auto& s = getRenderState();
+
+	s.rampExpansionPending = false;
+
+	if (s.currentVoiceData != nullptr)
 	{
-		polyExpandChecker = true;
+		s.polyExpandChecker = true;
+
+#if HISE_USE_CONTROLRATE_DOWNSAMPLING
+		// We can only defer the expansion if the data is in our own voice buffer
+		// (the monophonic values might be shared between voices).
+		if (s.currentVoiceData == s.voiceValues)
+		{
+			auto ramp = ModBufferExpansion::getRamp(s.currentVoiceData, startSample, numSamples, currentRampValues[voiceIndex]);
+
+			if (ramp.isConstant())
+			{
+				currentRampValues[voiceIndex] = ramp.startValue;
+				s.currentConstantValue = ramp.startValue;
+				s.currentVoiceData = nullptr;
+				return;
+			}
 
-		if (!ModBufferExpansion::expand(currentVoiceData, startSample, numSamples, currentRampValues[voiceIndex]))
+			if (ramp.isLinear())
+			{
+				s.pendingRamp = ramp;
+				s.pendingRampOffset = startSample;
+				s.rampExpansionPending = true;
+				s.currentConstantValue = 1.0f;
+
+				currentRampValues[voiceIndex] = ramp.getEndValue();
+				return;
+			}
+		}
+#endif
+
+		if (!ModBufferExpansion::expand(s.currentVoiceData, startSample, numSamples, currentRampValues[voiceIndex]))
 		{
 			// Don't use the dynamic data for further processing...
 
-			currentConstantValue = currentRampValues[voiceIndex];
+			s.currentConstantValue = currentRampValues[voiceIndex];
 
-			currentVoiceData = nullptr;
+			s.currentVoiceData = nullptr;
 		}
 		else
 		{
-			currentConstantValue = 1.0f;
+			s.currentConstantValue = 1.0f;
 		}
 	}
 }
@@ -484,6 +585,38 @@ void ModulatorChain::ModChainWithBuffer::expandMonophonicValuesToAudioRate(int s
 	}
 }
 
+void ModulatorChain::ModChainWithBuffer::expandPendingRamp() const
+{
+	auto& s = getRenderState();
+
+	if (s.rampExpansionPending)
+	{
+		s.pendingRamp.expand(s.voiceValues + s.pendingRampOffset);
+		s.rampExpansionPending = false;
+	}
+}
+
+ModulationRamp ModulatorChain::ModChainWithBuffer::getRampForVoiceValues() const
+{
+	auto& s = getRenderState();
+
+	if (s.rampExpansionPending)
+		return s.pendingRamp;
+
+	ModulationRamp r;
+	r.startValue = s.currentConstantValue;
+	r.shape = s.currentVoiceData != nullptr ? ModulationRamp::Shape::Dynamic : ModulationRamp::Shape::Constant;
+	return r;
+}
+
+float ModulatorChain::ModChainWithBuffer::getLastVoiceValue(int voiceIndex) const noexcept
+{
+	if (!isPositiveAndBelow(voiceIndex, NUM_POLYPHONIC_VOICES))
+		return 0.0f;
+
+	return currentConstantVoiceValues[voiceIndex] * currentRampValues[voiceIndex];
+}
+
 void ModulatorChain::ModChainWithBuffer::setCurrentRampValueForVoice(int voiceIndex, float value) noexcept
 {
 	if (voiceIndex >= 0 && voiceIndex < NUM_POLYPHONIC_VOICES)
@@ -537,6 +670,12 @@ void ModulatorChain::ModChainWithBuffer::calculateMonophonicModulationValues(int
 	}
 }
 
+void ModulatorChain::ModChainWithBuffer::setCurrentMonophonicValueFromBuffer(int startSample)
+{
+	if (!c->isVoiceStartChain && c->hasMonophonicTimeModulationMods())
+		currentMonoValue = modBuffer.monoValues[startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR];
+}
+
 
 
 void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoice(int voiceIndex, int startSample, int numSamples)
@@ -546,14 +685,18 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 		return;
 	}
 
+	auto& s = getRenderState();
+
 	jassert(voiceIndex >= 0);
 	jassert(modBuffer.isInitialised());
 
+	s.rampExpansionPending = false;
+
 	c->polyManager.setCurrentVoice(voiceIndex);
 
 	const bool useMonophonicData = options.includeMonophonicValues && c->hasMonophonicTimeModulationMods();
 
-	auto voiceData = modBuffer.voiceValues;
+	auto voiceData = s.voiceValues;
 	const auto monoData = modBuffer.monoValues;
 
 	jassert(startSample % HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR == 0);
@@ -599,10 +742,10 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 
 			while (auto mod = iter.next())
 			{
-				mod->render(voiceIndex, voiceData, modBuffer.scratchBuffer, startSample_cr, numSamples_cr);
+				mod->render(voiceIndex, voiceData, s.scratchBuffer, startSample_cr, numSamples_cr);
 
 				if (scratchBufferFunction)
-					scratchBufferFunction(voiceIndex, mod, modBuffer.scratchBuffer, startSample_cr, numSamples_cr);
+					scratchBufferFunction(voiceIndex, mod, s.scratchBuffer, startSample_cr, numSamples_cr);
 			}
 
 			if (useMonophonicData)
@@ -610,10 +753,10 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 				applyMonophonicValuesToVoiceInternal(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
 			}
 
-			currentVoiceData = voiceData;
+			s.currentVoiceData = voiceData;
 			
 #if JUCE_DEBUG
-			polyExpandChecker = false;
+			s.polyExpandChecker = false;
 #endif
 		}
 		else if (useMonophonicData)
@@ -621,16 +764,16 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 			applyMonophonicValuesToVoiceInternal(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
 
 			
-			currentVoiceData = voiceData;
+			s.currentVoiceData = voiceData;
 
 #if JUCE_DEBUG
-			polyExpandChecker = false;
+			s.polyExpandChecker = false;
 #endif
 		}
 		else
 		{
 			// Set it to nullptr, and let the module use the constant value instead...
-			currentVoiceData = nullptr;
+			s.currentVoiceData = nullptr;
 		}
 	}
 	else if (useMonophonicData)
@@ -643,7 +786,7 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 		{
 			// Use the default logic for pan
 			FloatVectorOperations::copy(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
-			currentVoiceData = voiceData;
+			s.currentVoiceData = voiceData;
 		}
 		else
 		{
@@ -662,28 +805,28 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 				*wp++ = value * value;
 			}
 
-			currentVoiceData = voiceData;
+			s.currentVoiceData = voiceData;
 		}
 
 		
 
 #else
 		if (options.voiceValuesReadOnly)
-			currentVoiceData = monoData;
+			s.currentVoiceData = monoData;
 		else
 		{
 			FloatVectorOperations::copy(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
-			currentVoiceData = voiceData;
+			s.currentVoiceData = voiceData;
 		}
 #endif
 
 #if JUCE_DEBUG
-		polyExpandChecker = false;
+		s.polyExpandChecker = false;
 #endif
 	}
 	else
 	{
-		currentVoiceData = nullptr;
+		s.currentVoiceData = nullptr;
 
 		setConstantVoiceValueInternal(voiceIndex, 1.0f);
 	}
@@ -706,26 +849,36 @@ void ModulatorChain::ModChainWithBuffer::applyMonophonicModulationValues(AudioSa
 
 const float* ModulatorChain::ModChainWithBuffer::getReadPointerForVoiceValues(int startSample) const
 {
+	auto& s = getRenderState();
+
 	// You need to expand the modulation values to audio rate before calling this method.
 	// Either call setExpandAudioRate(true) in the constructor, or manually expand them
-	jassert(currentVoiceData == nullptr || polyExpandChecker);
+	jassert(s.currentVoiceData == nullptr || s.polyExpandChecker);
+
+	expandPendingRamp();
 
-	return currentVoiceData != nullptr ? currentVoiceData + startSample : nullptr;
+	return s.currentVoiceData != nullptr ? s.currentVoiceData + startSample : nullptr;
 }
 
 float* ModulatorChain::ModChainWithBuffer::getWritePointerForVoiceValues(int startSample)
 {
+	auto& s = getRenderState();
+
 	jassert(!options.voiceValuesReadOnly);
 
 	// You need to expand the modulation values to audio rate before calling this method.
 	// Either call setExpandAudioRate(true) in the constructor, or manually expand them
-	jassert(currentVoiceData == nullptr || polyExpandChecker);
+	jassert(s.currentVoiceData == nullptr || s.polyExpandChecker);
 
-	return currentVoiceData != nullptr ? const_cast<float*>(currentVoiceData) + startSample : nullptr;
+	expandPendingRamp();
+
+	return s.currentVoiceData != nullptr ? const_cast<float*>(s.currentVoiceData) + startSample : nullptr;
 }
 
 float* ModulatorChain::ModChainWithBuffer::getWritePointerForManualExpansion(int startSample)
 {
+	auto& s = getRenderState();
+
 	// You have already expanded the values...
 	//jassert(currentVoiceData != nullptr || !polyExpandChecker);
 
@@ -734,9 +887,9 @@ float* ModulatorChain::ModChainWithBuffer::getWritePointerForManualExpansion(int
 
 	int startSample_cr = startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
 
-	manualExpansionPending = true;
+	s.manualExpansionPending = true;
 
-	return currentVoiceData != nullptr ? const_cast<float*>(currentVoiceData) + startSample_cr : nullptr;
+	return s.currentVoiceData != nullptr ? const_cast<float*>(s.currentVoiceData) + startSample_cr : nullptr;
 }
 
 const float* ModulatorChain::ModChainWithBuffer::getMonophonicModulationValues(int startSample) const
@@ -754,29 +907,36 @@ const float* ModulatorChain::ModChainWithBuffer::getMonophonicModulationValues(i
 
 float ModulatorChain::ModChainWithBuffer::getConstantModulationValue() const
 {
-	return currentConstantValue;
+	return getRenderState().currentConstantValue;
 }
 
 float ModulatorChain::ModChainWithBuffer::getModValueForVoiceWithOffset(int startSample) const
 {
-	return currentVoiceData != nullptr ? currentVoiceData[startSample] : currentConstantValue;
+	auto& s = getRenderState();
+
+	if (s.rampExpansionPending)
+		return s.pendingRamp.getValue(startSample - s.pendingRampOffset);
+
+	return s.currentVoiceData != nullptr ? s.currentVoiceData[startSample] : s.currentConstantValue;
 }
 
 float ModulatorChain::ModChainWithBuffer::getOneModulationValue(int startSample) const
 {
+	auto& s = getRenderState();
+
 	// If you set this, you probably don't need this method...
 	jassert(!options.expandToAudioRate);
 
-	if (currentVoiceData == nullptr)
+	if (s.currentVoiceData == nullptr)
 		return getConstantModulationValue();
 
 	const int downsampledOffset = startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
-	return currentVoiceData[downsampledOffset];
+	return s.currentVoiceData[downsampledOffset];
 }
 
 float* ModulatorChain::ModChainWithBuffer::getScratchBuffer()
 {
-	return modBuffer.scratchBuffer;
+	return getRenderState().scratchBuffer;
 }
 
 void ModulatorChain::ModChainWithBuffer::setAllowModificationOfVoiceValues(bool mightBeOverwritten)
@@ -792,8 +952,12 @@ void ModulatorChain::ModChainWithBuffer::setIncludeMonophonicValuesInVoiceRender
 
 void ModulatorChain::ModChainWithBuffer::clear()
 {
-	currentVoiceData = nullptr;
-	currentConstantValue = c->getInitialValue();
+	for (auto& s : renderStates)
+	{
+		s.currentVoiceData = nullptr;
+		s.rampExpansionPending = false;
+		s.currentConstantValue = c->getInitialValue();
+	}
 }
 
 ModulatorChain::ModulatorChain(MainController *mc, const String &uid, int numVoices, Mode m, Processor *p): 
@@ -1511,6 +1675,57 @@ bool ModBufferExpansion::isEqual(float rampStart, const float* data, int numElem
 	return (range.contains(rampStart) || range.getEnd() == rampStart) && range.getLength() < 0.001f;
 }
 
+ModulationRamp ModBufferExpansion::getRamp(const float* modulationData, int startSample, int numSamples, float rampStart)
+{
+	const int startSample_cr = startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
+	const int numSamples_cr = numSamples / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
+
+	auto data = modulationData + startSample_cr;
+
+	ModulationRamp r;
+	r.startValue = rampStart;
+	r.numSamples = numSamples;
+
+	if (numSamples_cr == 0)
+		return r;
+
+	if (isEqual(rampStart, data, numSamples_cr))
+	{
+		r.startValue = data[0];
+		return r;
+	}
+
+	// The expansion interpolates between the control rate values starting
+	// with rampStart, so if every value is on the line between rampStart and
+	// the last value, the audio rate values will be a linear ramp.
+	const float delta_cr = (data[numSamples_cr - 1] - rampStart) / (float)numSamples_cr;
+
+	for (int i = 0; i < numSamples_cr - 1; i++)
+	{
+		if (std::abs(data[i] - (rampStart + delta_cr * (float)(i + 1))) > 1e-5f)
+		{
+			r.shape = ModulationRamp::Shape::Dynamic;
+			return r;
+		}
+	}
+
+	r.shape = ModulationRamp::Shape::Linear;
+	r.delta = delta_cr / (float)HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
+	return r;
+}
+
+void ModulationRamp::expand(float* data) const noexcept
+{
+	if (isConstant())
+	{
+		FloatVectorOperations::fill(data, startValue, numSamples);
+		return;
+	}
+
+	for (int i = 0; i < numSamples; i++)
+		data[i] = getValue(i);
+}
+
 bool ModBufferExpansion::expand(const float* modulationData, int startSample, int numSamples, float& rampStart)
 {
 	const int startSample_cr = startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
@@ -39,6 +39,40 @@ namespace hise { using namespace juce;
 #define HISE_NUM_MODULATORS_PER_CHAIN 32
 #endif
 
+/** A compact description of the modulation values of a sub block.
+*
+*	Most of the time the modulation values are either constant (eg. an envelope in its sustain phase)
+*	or a linear ramp (eg. a smoothed voice start value), so instead of expanding them to audio rate
+*	the ModChainWithBuffer passes this object to the consumer which can apply it directly.
+*/
+struct ModulationRamp
+{
+	enum class Shape
+	{
+		Constant,
+		Linear,
+		Dynamic
+	};
+
+	bool isConstant() const noexcept { return shape == Shape::Constant; }
+	bool isLinear() const noexcept { return shape == Shape::Linear; }
+	bool isDynamic() const noexcept { return shape == Shape::Dynamic; }
+
+	/** Returns the value at the given audio rate sample position. */
+	float getValue(int samplePosition) const noexcept { return startValue + delta * (float)samplePosition; }
+
+	/** Returns the value after the last sample of the block (the start value of the next block). */
+	float getEndValue() const noexcept { return getValue(numSamples); }
+
+	/** Writes the numSamples values of the ramp into the given buffer. */
+	void expand(float* data) const noexcept;
+
+	Shape shape = Shape::Constant;
+	float startValue = 1.0f;
+	float delta = 0.0f;
+	int numSamples = 0;
+};
+
 /** A chain of Modulators that can be processed serially.
 *
 *	@ingroup modulator
@@ -155,6 +189,12 @@ public:
 		*/
 		void calculateMonophonicModulationValues(int startSample, int numSamples);
 
+		/** Sets the current monophonic value to the calculated value at the given sample.
+		*
+		*	Call this if the monophonic values were calculated in multiple segments before the voice rendering.
+		*/
+		void setCurrentMonophonicValueFromBuffer(int startSample);
+
 		/** Call this to calculate the monophonic values.
 		*
 		*	Normally you don't need to use this method, as the synth / effect will take care of that.
@@ -223,8 +263,23 @@ public:
 		/** Returns the first value in the modulation data or the constant value. */
 		float getOneModulationValue(int startSample) const;
 
+		/** Returns a descriptor of the current voice modulation values.
+		*
+		*	If the values were detected to be constant or a linear ramp when they were expanded to audio rate,
+		*	the expansion is deferred until somebody calls getReadPointerForVoiceValues(), so if you can apply
+		*	the ramp directly (eg. with AudioSampleBuffer::applyGainRamp()), use this method first and only
+		*	fetch the audio rate values if the shape is dynamic.
+		*/
+		ModulationRamp getRampForVoiceValues() const;
+
 		float getModValueForVoiceWithOffset(int startSample) const;
 
+		/** Returns the last calculated modulation value of the given voice (the constant voice value multiplied with the last dynamic value).
+		*
+		*	This doesn't need the voice to be rendered, so it can be used to compare the levels of the voices of a gain chain.
+		*/
+		float getLastVoiceValue(int voiceIndex) const noexcept;
+
 		/** Returns the scratch buffer. The scratch buffer is a aligned float array that's most likely in the cache,
 		*   but using this is rather hacky, so don't use it if there's another option. 
 		*/
@@ -275,6 +330,14 @@ public:
 
 		void setScratchBufferFunction(const std::function<void(int, Modulator* m, float*, int, int)>& f);
 
+		/** Allocates the voice buffers for the given amount of realtime workers. 
+		
+			This is required if you want to calculate the voice modulation values concurrently on multiple threads.
+		*/
+		void setNumWorkerBuffers(int numWorkers);
+
+		int getNumWorkerBuffers() const noexcept { return numWorkerBuffers; }
+
 	private:
 
 		std::function<void(int, Modulator* m, float*, int, int)> scratchBufferFunction;
@@ -285,30 +348,54 @@ public:
 
 		void setConstantVoiceValueInternal(int voiceIndex, float newValue);
 
+		void expandPendingRamp() const;
+
 		ScopedPointer<ModulatorChain> c;
 
 		Type type;
 
 		Buffer modBuffer;
 
-		bool monoExpandChecker = false;
-		bool polyExpandChecker = false;
+		/** The state of the current voice. There is one state for each realtime worker so that
+			the voices can be rendered concurrently (the first one is used by the audio thread). */
+		struct VoiceRenderState
+		{
+			float* voiceValues = nullptr;
+			float* scratchBuffer = nullptr;
+			float const* currentVoiceData = nullptr;
 
-		bool manualExpansionPending = false;
+			float currentConstantValue = 1.0f;
+			float lastConstantVoiceValue = 1.0f;
 
-		
+			bool polyExpandChecker = false;
+			bool manualExpansionPending = false;
+
+			/** The linear ramp of the current sub block that was not yet written to the voice values. */
+			ModulationRamp pendingRamp;
+			int pendingRampOffset = 0;
+			mutable bool rampExpansionPending = false;
+		};
+
+		VoiceRenderState& getRenderState() noexcept;
+		const VoiceRenderState& getRenderState() const noexcept;
+
+		void updateRenderStatePointers();
+
+		bool monoExpandChecker = false;
 
 		Options options;
 		
-		float currentConstantValue = 1.0f;
-
 		float currentMonoValue = 1.0f;
-		float lastConstantVoiceValue = 1.0f;
 		float currentConstantVoiceValues[NUM_POLYPHONIC_VOICES];
 		float currentRampValues[NUM_POLYPHONIC_VOICES];
 		
 		float currentMonophonicRampValue;
-		float const* currentVoiceData = nullptr;
+
+		VoiceRenderState renderStates[HISE_MAX_REALTIME_WORKERS];
+
+		HeapBlock<float> workerBufferData;
+		int numWorkerBuffers = 1;
+		int maxSamplesPerBlock = 0;
 
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModChainWithBuffer);
 	};
@@ -566,6 +653,13 @@ struct ModBufferExpansion
 	*
 	*/
 	static bool expand(const float* modulationData, int startSample, int numSamples, float& rampStart);
+
+	/** Checks whether the control rate data found in modulationData + startSample is constant or a linear ramp
+	*	that starts at rampStart and returns the descriptor of the audio rate values.
+	*
+	*	If it returns a dynamic ramp, you need to expand the values with expand().
+	*/
+	static ModulationRamp getRamp(const float* modulationData, int startSample, int numSamples, float rampStart);
 };
 
 /**	Allows creation of TimeVariantModulators.
@@ -49,6 +49,53 @@ SET_DOCUMENTATION(ModulatorSynth)
 		"the effect chain of this module");
 }
 
+struct ModulatorSynth::ParallelVoiceRenderer
+{
+	ParallelVoiceRenderer(ModulatorSynth& parent_) :
+		parent(parent_)
+	{}
+
+	void prepare(int numChannels, int samplesPerBlock)
+	{
+		const int numWorkers = workers->getNumWorkers();
+
+		for (auto& mb : parent.modChains)
+			mb.setNumWorkerBuffers(numWorkers);
+
+		ProcessorHelpers::increaseBufferIfNeeded(workerBuffers, samplesPerBlock);
+		workerBuffers.setSize(numChannels * numWorkers, workerBuffers.getNumSamples());
+	}
+
+	bool isPrepared(int numChannels) const noexcept
+	{
+		return workerBuffers.getNumChannels() == numChannels * workers->getNumWorkers();
+	}
+
+	SharedResourcePointer<RealtimeWorkerGroup> workers;
+	AudioSampleBuffer workerBuffers;
+	audio_spin_mutex voiceLock;
+
+	// set during the concurrent voice rendering so that the voices can lock the shared state
+	bool active = false;
+
+	ModulatorSynth& parent;
+};
+
+ModulatorSynth::ScopedVoiceRenderLock::ScopedVoiceRenderLock(ModulatorSynth* s)
+{
+	if (s->parallelVoiceRenderer != nullptr && s->parallelVoiceRenderer->active)
+	{
+		mutex = &s->parallelVoiceRenderer->voiceLock;
+		mutex->lock();
+	}
+}
+
+ModulatorSynth::ScopedVoiceRenderLock::~ScopedVoiceRenderLock()
+{
+	if (mutex != nullptr)
+		mutex->unlock();
+}
+
 ModulatorSynth::ModulatorSynth(MainController *mc, const String &id, int numVoices) :
 Synthesiser(),
 Processor(mc, id, numVoices),
@@ -78,6 +125,9 @@ bypassState(false)
 
 	setVoiceLimit(numVoices);
 
+	for (auto& f : useScratchBufferForArtificialPitch)
+		f = false;
+
 	for (int i = 0; i < 4; i++)
 	{
 		nextTimerCallbackTimes[i] = 0.0;
@@ -104,6 +154,8 @@ bypassState(false)
 
 ModulatorSynth::~ModulatorSynth()
 {
+	parallelVoiceRenderer = nullptr;
+
 	deleteAllVoices();
 	
 	midiProcessorChain = nullptr;
@@ -129,6 +181,15 @@ ValueTree ModulatorSynth::exportAsValueTree() const
 
 	v.setProperty("IconColour", iconColour.toString(), nullptr);
 
+	if (isUsingParallelVoiceRendering())
+		v.setProperty("ParallelVoiceRendering", true, nullptr);
+
+	if (eventSplitMode != EventSplitMode::EveryEvent)
+		v.setProperty("EventSplitMode", (int)eventSplitMode, nullptr);
+
+	if (voiceStealingMode != VoiceStealingMode::Oldest)
+		v.setProperty("VoiceStealingMode", VoiceAllocator::getStealingModeNames()[(int)voiceStealingMode], nullptr);
+
 	return v;
 }
 
@@ -143,6 +204,12 @@ void ModulatorSynth::restoreFromValueTree(const ValueTree &v)
 
 	iconColour = Colour::fromString(v.getProperty("IconColour", Colours::transparentBlack.toString()).toString());
 
+	setUseParallelVoiceRendering(v.getProperty("ParallelVoiceRendering", false));
+	setEventSplitMode((EventSplitMode)jlimit(0, (int)EventSplitMode::numEventSplitModes - 1, (int)v.getProperty("EventSplitMode", 0)));
+
+	auto stealingModeIndex = VoiceAllocator::getStealingModeNames().indexOf(v.getProperty("VoiceStealingMode", "").toString());
+	setVoiceStealingMode(stealingModeIndex != -1 ? (VoiceStealingMode)stealingModeIndex : VoiceStealingMode::Oldest);
+
 	Processor::restoreFromValueTree(v);
 }
 
@@ -293,7 +360,7 @@ void ModulatorSynth::setKillRetriggeredNote(bool shouldBeKilled)
 
 float* ModulatorSynth::getPitchValuesForVoice() const
 {
-	if (useScratchBufferForArtificialPitch)
+	if (useScratchBufferForArtificialPitch[RealtimeWorkerGroup::getCurrentWorkerIndex()])
 		return modChains[BasicChains::PitchChain].getScratchBuffer();
 		
 	return modChains[BasicChains::PitchChain].getWritePointerForVoiceValues(0);
@@ -301,7 +368,7 @@ float* ModulatorSynth::getPitchValuesForVoice() const
 
 void ModulatorSynth::overwritePitchValues(const float* modDataValues, int startSample, int numSamples)
 {
-	useScratchBufferForArtificialPitch = true;
+	useScratchBufferForArtificialPitch[RealtimeWorkerGroup::getCurrentWorkerIndex()] = true;
 
 	auto destination = modChains[BasicChains::PitchChain].getScratchBuffer();
 
@@ -323,6 +390,11 @@ float ModulatorSynth::getConstantGainModValue() const
 	return modChains[BasicChains::GainChain].getConstantModulationValue();
 }
 
+ModulationRamp ModulatorSynth::getVoiceGainRamp() const
+{
+	return modChains[BasicChains::GainChain].getRampForVoiceValues();
+}
+
 float ModulatorSynth::getConstantVoicePitchModulationValueDeleteSoon() const
 {
 	// Is applied to uptimeDelta already...
@@ -531,6 +603,7 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 	jassert(isOnAir());
 
     ADD_GLITCH_DETECTOR(this, DebugLogger::Location::SynthRendering);
+	ADD_AUDIO_THREAD_VIOLATION_SCOPE(this);
     
 	int numSamples = outputBuffer.getNumSamples();
 
@@ -553,39 +626,96 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 	HiseEvent m;
 	int midiEventPos;
 
-	while (numSamples > 0)
+	int numVoicePasses = 0;
+
+	if (eventSplitMode == EventSplitMode::VoiceEventsOnly)
 	{
-		if (!eventIterator.getNextEvent(m, midiEventPos, true, false))
+		// The voices are only rendered up to the next event that changes the voice state. 
+		// All other events are processed at their timestamp between the calculation of the
+		// monophonic modulation values, so they still end up sample accurate in the mod buffers.
+		int monoPos = 0;
+
+		auto renderUpTo = [&](int endSample)
 		{
-			preVoiceRendering(startSample, numSamples);
-			renderVoice(startSample, numSamples);
-			postVoiceRendering(startSample, numSamples);
+			if (endSample > monoPos)
+			{
+				preVoiceRendering(monoPos, endSample - monoPos);
+				monoPos = endSample;
+			}
 
-			break;
-		}
+			if (endSample > startSample)
+			{
+				// the mono values were calculated piecewise, so the last segment might start after startSample
+				for (auto& mb : modChains)
+					mb.setCurrentMonophonicValueFromBuffer(startSample);
+
+				renderVoice(startSample, endSample - startSample);
+				postVoiceRendering(startSample, endSample - startSample);
+				startSample = endSample;
+				numVoicePasses++;
+			}
+		};
 
-		const int samplesToNextMidiMessage = jmin(numSamples, midiEventPos - startSample);
+		while (eventIterator.getNextEvent(m, midiEventPos, true, false))
+		{
+			const int eventPos = jlimit(startSample, numSamplesFixed, midiEventPos);
 
-		jassert(startSample % HISE_EVENT_RASTER == 0);
-		jassert(midiEventPos % HISE_EVENT_RASTER == 0);
-		jassert(samplesToNextMidiMessage % HISE_EVENT_RASTER == 0);
+			jassert(eventPos % HISE_EVENT_RASTER == 0);
 
-		if (samplesToNextMidiMessage > 0)
-		{
-			preVoiceRendering(startSample, samplesToNextMidiMessage);
-			renderVoice(startSample, samplesToNextMidiMessage);
-			postVoiceRendering(startSample, samplesToNextMidiMessage);
-			
+			if (isVoiceEvent(m))
+			{
+				renderUpTo(eventPos);
+			}
+			else if (eventPos > monoPos)
+			{
+				preVoiceRendering(monoPos, eventPos - monoPos);
+				monoPos = eventPos;
+			}
+
+			handleHiseEvent(m);
 		}
 
-		handleHiseEvent(m);
+		renderUpTo(numSamplesFixed);
+	}
+	else
+	{
+		while (numSamples > 0)
+		{
+			if (!eventIterator.getNextEvent(m, midiEventPos, true, false))
+			{
+				preVoiceRendering(startSample, numSamples);
+				renderVoice(startSample, numSamples);
+				postVoiceRendering(startSample, numSamples);
+				numVoicePasses++;
+
+				break;
+			}
+
+			const int samplesToNextMidiMessage = jmin(numSamples, midiEventPos - startSample);
+
+			jassert(startSample % HISE_EVENT_RASTER == 0);
+			jassert(midiEventPos % HISE_EVENT_RASTER == 0);
+			jassert(samplesToNextMidiMessage % HISE_EVENT_RASTER == 0);
+
+			if (samplesToNextMidiMessage > 0)
+			{
+				preVoiceRendering(startSample, samplesToNextMidiMessage);
+				renderVoice(startSample, samplesToNextMidiMessage);
+				postVoiceRendering(startSample, samplesToNextMidiMessage);
+				numVoicePasses++;
+			}
+
+			handleHiseEvent(m);
+
+			startSample += samplesToNextMidiMessage;
+			numSamples -= samplesToNextMidiMessage;
+		}
 
-		startSample += samplesToNextMidiMessage;
-		numSamples -= samplesToNextMidiMessage;
+		while (eventIterator.getNextEvent(m, midiEventPos, true, false))
+			handleHiseEvent(m);
 	}
 
-	while (eventIterator.getNextEvent(m, midiEventPos, true, false))
-		handleHiseEvent(m);
+	numSubBlockSplits.store(jmax(0, numVoicePasses - 1));
 
 	AudioSampleBuffer thisInternalBuffer(internalBuffer.getArrayOfWritePointers(), internalBuffer.getNumChannels(), numSamplesFixed);
 
@@ -631,18 +761,143 @@ void ModulatorSynth::renderVoice(int startSample, int numThisTime)
     
 	clearPendingRemoveVoices();
 
-	for (auto v : activeVoices)
+	if (!renderVoicesConcurrently(startSample, numThisTime))
 	{
-		jassert(!v->isInactive());
+		renderVoiceBatch(startSample, numThisTime);
+
+		for (auto v : activeVoices)
+		{
+			jassert(!v->isInactive());
 
-		calculateModulationValuesForVoice(v, startSample, numThisTime);
+			calculateModulationValuesForVoice(v, startSample, numThisTime);
 
-		v->renderNextBlock(internalBuffer, startSample, numThisTime);
+			v->renderNextBlock(internalBuffer, startSample, numThisTime);
+		}
 	}
 
 	clearPendingRemoveVoices();
 };
 
+bool ModulatorSynth::renderVoicesConcurrently(int startSample, int numThisTime)
+{
+	if (parallelVoiceRenderer == nullptr || activeVoices.size() < 2 || isInGroup())
+		return false;
+
+	if (!supportsParallelVoiceRendering() || effectChain->hasActivePolyEffects())
+		return false;
+
+	auto& pr = *parallelVoiceRenderer;
+	const int numChannels = internalBuffer.getNumChannels();
+
+	if (!pr.isPrepared(numChannels) || pr.workerBuffers.getNumSamples() < startSample + numThisTime)
+		return false;
+
+	// Copy the voice list because the voices might be removed from the active list during rendering
+	ModulatorSynthVoice* voices[NUM_POLYPHONIC_VOICES];
+	const int numVoicesToRender = jmin(NUM_POLYPHONIC_VOICES, activeVoices.size());
+
+	for (int i = 0; i < numVoicesToRender; i++)
+		voices[i] = activeVoices[i];
+
+	// Each task renders a fixed range of voices into its own buffer so the sum is deterministic
+	const int numTasks = jmin(numVoicesToRender, pr.workers->getNumWorkers());
+
+	auto f = [&](int taskIndex)
+	{
+		AudioSampleBuffer taskBuffer(pr.workerBuffers.getArrayOfWritePointers() + taskIndex * numChannels, numChannels, startSample + numThisTime);
+		taskBuffer.clear(startSample, numThisTime);
+
+		const int start = taskIndex * numVoicesToRender / numTasks;
+		const int end = (taskIndex + 1) * numVoicesToRender / numTasks;
+
+		for (int i = start; i < end; i++)
+		{
+			auto v = voices[i];
+
+			jassert(!v->isInactive());
+
+			{
+				// The modulators are not thread safe
+				ScopedVoiceRenderLock sl(this);
+				calculateModulationValuesForVoice(v, startSample, numThisTime);
+			}
+
+			v->renderNextBlock(taskBuffer, startSample, numThisTime);
+		}
+	};
+
+	pr.active = true;
+	pr.workers->execute(numTasks, f);
+	pr.active = false;
+
+	for (int t = 0; t < numTasks; t++)
+	{
+		for (int c = 0; c < numChannels; c++)
+			FloatVectorOperations::add(internalBuffer.getWritePointer(c, startSample), pr.workerBuffers.getReadPointer(t * numChannels + c, startSample), numThisTime);
+	}
+
+	return true;
+}
+
+void ModulatorSynth::setUseParallelVoiceRendering(bool shouldRenderVoicesConcurrently)
+{
+	if (shouldRenderVoicesConcurrently == isUsingParallelVoiceRendering())
+		return;
+
+	ScopedPointer<ParallelVoiceRenderer> newRenderer;
+
+	if (shouldRenderVoicesConcurrently)
+		newRenderer = new ParallelVoiceRenderer(*this);
+
+	{
+		LockHelpers::SafeLock sl(getMainController(), LockHelpers::Type::AudioLock, isOnAir());
+
+		if (newRenderer != nullptr && getLargestBlockSize() > 0)
+			newRenderer->prepare(internalBuffer.getNumChannels(), getLargestBlockSize());
+
+		if (newRenderer == nullptr)
+		{
+			for (auto& mb : modChains)
+				mb.setNumWorkerBuffers(1);
+		}
+
+		std::swap(newRenderer, parallelVoiceRenderer);
+	}
+}
+
+void ModulatorSynth::setEventSplitMode(EventSplitMode newMode)
+{
+	jassert(newMode != EventSplitMode::numEventSplitModes);
+
+	if (newMode != EventSplitMode::numEventSplitModes)
+		eventSplitMode = newMode;
+}
+
+void ModulatorSynth::setVoiceStealingMode(VoiceStealingMode newMode)
+{
+	jassert(newMode != VoiceStealingMode::numStealingModes);
+
+	if (newMode != VoiceStealingMode::numStealingModes)
+		voiceStealingMode = newMode;
+}
+
+bool ModulatorSynth::isVoiceEvent(const HiseEvent& e)
+{
+	if (e.isController())
+	{
+		// The pedals change the voice state (eg. releasing the sustain pedal stops the sustained voices)
+		auto number = e.getControllerNumber();
+		return number == 64 || number == 66 || number == 67;
+	}
+
+	return e.isNoteOnOrOff() || e.isAllNotesOff() || e.isVolumeFade() || e.isPitchFade();
+}
+
+bool ModulatorSynth::isUsingParallelVoiceRendering() const noexcept
+{
+	return parallelVoiceRenderer != nullptr;
+}
+
 	
 void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v, int startSample, int numThisTime)
 {
@@ -659,7 +914,9 @@ void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v,
 
 	v->applyConstantPitchFactor(getConstantPitchModValue());
 
-	useScratchBufferForArtificialPitch = false;
+	auto& useArtificialPitch = useScratchBufferForArtificialPitch[RealtimeWorkerGroup::getCurrentWorkerIndex()];
+
+	useArtificialPitch = false;
 
 	if (v->isPitchFadeActive())
 	{
@@ -669,7 +926,7 @@ void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v,
 		{
 			bufferToUse = modChains[BasicChains::PitchChain].getScratchBuffer();
 			FloatVectorOperations::fill(bufferToUse + startSample, 1.0f, numThisTime);
-			useScratchBufferForArtificialPitch = true;
+			useArtificialPitch = true;
 		}
 
 		v->applyScriptPitchFactors(bufferToUse + startSample, numThisTime);
@@ -935,6 +1192,10 @@ void ModulatorSynth::startVoiceWithHiseEvent(ModulatorSynthVoice* voice, Synthes
 
 	Synthesiser::startVoice(static_cast<SynthesiserVoice*>(voice), sound, e.getChannel(), e.getNoteNumber(), e.getFloatVelocity());
 
+	// The voice might have been reset during the start (eg. if the sample couldn't be played)
+	if (!voice->isInactive())
+		voiceAllocator.voiceStarted(voice->getVoiceIndex(), e.getNoteNumber());
+
 	voice->saveStartUptimeDelta();
 }
 
@@ -988,6 +1249,8 @@ void ModulatorSynth::prepareToPlay(double newSampleRate, int samplesPerBlock)
  			static_cast<ModulatorSynthVoice*>(getVoice(i))->prepareToPlay(newSampleRate, samplesPerBlock);
 		}
 
+		syncVoiceAllocator();
+
 		vuMerger.limitFromBlockSizeToFrameRate(newSampleRate, samplesPerBlock);
 
 		Synthesiser::setCurrentPlaybackSampleRate(newSampleRate);
@@ -1003,6 +1266,9 @@ void ModulatorSynth::prepareToPlay(double newSampleRate, int samplesPerBlock)
 
 		effectChain->prepareToPlay(newSampleRate, samplesPerBlock);
 
+		if (parallelVoiceRenderer != nullptr)
+			parallelVoiceRenderer->prepare(internalBuffer.getNumChannels(), samplesPerBlock);
+
 		setKillFadeOutTime(killFadeTime);
 
 		updateShouldHaveEnvelope();
@@ -1093,6 +1359,7 @@ void ModulatorSynth::flagVoiceAsRemoved(ModulatorSynthVoice* v)
 	jassert(v->isInactive());
 
 	pendingRemoveVoices.insert(v);
+	voiceAllocator.voiceRemoved(v->getVoiceIndex());
 }
 
 void ModulatorSynth::finaliseModChains()
@@ -1248,6 +1515,8 @@ void ModulatorSynth::noteOn(const HiseEvent &m)
 	if (numSoundsToStart == 0)
 		return;
 
+	noteNumberToStart = m.getNoteNumber();
+
 	// Make room for the sounds
 	handleVoiceLimit(numSoundsToStart);
 
@@ -1378,6 +1647,8 @@ void ModulatorSynthVoice::resetVoice()
 {
 	LOG_SYNTH_EVENT("Reset Note for " + getOwnerSynth()->getId() + " with index " + String(voiceIndex));
 
+	ModulatorSynth::ScopedVoiceRenderLock sl(getOwnerSynth());
+
 	clearCurrentNote();
 
 	ModulatorSynth *os = getOwnerSynth();
@@ -1450,6 +1721,22 @@ int ModulatorSynthVoice::getVoiceIndex() const
 
 void ModulatorSynthVoice::applyGainModulation(int startSample, int numSamples, bool copyLeftChannel)
 {
+	// If the gain modulation is a linear ramp we can apply it without expanding the values
+	auto ramp = getOwnerSynth()->getVoiceGainRamp();
+
+	if (ramp.isLinear() && ramp.numSamples == numSamples)
+	{
+		const int numChannels = copyLeftChannel ? 1 : 2;
+
+		for (int i = 0; i < numChannels; i++)
+			voiceBuffer.applyGainRamp(i, startSample, numSamples, ramp.startValue, ramp.getEndValue());
+
+		if (copyLeftChannel)
+			FloatVectorOperations::copy(voiceBuffer.getWritePointer(1, startSample), voiceBuffer.getReadPointer(0, startSample), numSamples);
+
+		return;
+	}
+
 	if (copyLeftChannel)
 	{
 		if (auto modValues = getOwnerSynth()->getVoiceGainValues())
@@ -1461,7 +1748,7 @@ void ModulatorSynthVoice::applyGainModulation(int startSample, int numSamples, b
 			const float gainMod = getOwnerSynth()->getConstantGainModValue();
 
 			if(gainMod != 1.0f)
-				FloatVectorOperations::multiply(voiceBuffer.getWritePointer(0, startSample), modValues + startSample, numSamples);
+				FloatVectorOperations::multiply(voiceBuffer.getWritePointer(0, startSample), gainMod, numSamples);
 		}
 
 		FloatVectorOperations::copy(voiceBuffer.getWritePointer(1, startSample), voiceBuffer.getReadPointer(0, startSample), numSamples);
@@ -1492,6 +1779,7 @@ void ModulatorSynthVoice::stopNote(float, bool)
     
 	ModulatorSynth *os = getOwnerSynth();
 	isTailing = true;
+	os->getVoiceAllocator().voiceReleased(voiceIndex);
 	os->preStopVoice(voiceIndex);
 	checkRelease();
 };
@@ -1504,6 +1792,17 @@ void ModulatorSynth::handleRetriggeredNote(ModulatorSynthVoice *voice)
 
 ModulatorSynthVoice* ModulatorSynth::getFreeVoice(SynthesiserSound* s, int midiChannel, int midiNoteNumber)
 {
+	syncVoiceAllocator();
+
+	if (auto fv = getVoiceFromAllocator(voiceAllocator.getFreeVoice()))
+	{
+		if (fv->isInactive() && fv->canPlaySound(s))
+		{
+			LOG_SYNTH_EVENT("Found free voice with index " + String(fv->getVoiceIndex()));
+			return fv;
+		}
+	}
+
 	auto v = findFreeVoice(s, midiChannel, midiNoteNumber, false);
 
 	if (v != nullptr)
@@ -1518,14 +1817,11 @@ ModulatorSynthVoice* ModulatorSynth::getFreeVoice(SynthesiserSound* s, int midiC
 
 juce::SynthesiserVoice* ModulatorSynth::findVoiceToSteal(SynthesiserSound* soundToPlay, int midiChannel, int midiNoteNumber) const
 {
-	for (auto v: activeVoices)
+	// return voices that are being killed
+	if (auto v = getVoiceFromAllocator(voiceAllocator.getKilledVoice(false)))
 	{
-		// return voices that are being killed
-		if (v->isBeingKilled())
-		{
-			DBG("Already killing: Found voice " + String(v->getVoiceIndex()) + " to steal");
-			return v;
-		}
+		DBG("Already killing: Found voice " + String(v->getVoiceIndex()) + " to steal");
+		return v;
 	}
 
 	return Synthesiser::findVoiceToSteal(soundToPlay, midiChannel, midiNoteNumber);
@@ -1555,106 +1851,59 @@ void ModulatorSynth::killAllVoicesWithNoteNumber(int noteNumber)
 	
 int ModulatorSynth::killLastVoice(bool allowTailOff/*=true*/)
 {
-	ModulatorSynthVoice *oldestUnkilledMessage = nullptr;
-	double oldestUptime = DBL_MAX;
-
-	// This variable will count additional voice kills
-	// that happen when a sibling voice is killed along with 
-	// its to-be killed sibling...
-	
-	int numVoicesKilled = 0;
+	syncVoiceAllocator();
 
-	for (auto v: activeVoices)
+	auto getVoiceGain = [this](int voiceIndex)
 	{
-		if (v->isInactive())
-			continue;
-
-		if (!v->isTailingOff())
-			continue;
+		return modChains[BasicChains::GainChain].getLastVoiceValue(voiceIndex);
+	};
 
-		// If there's a voice already being killed and we need to 
+	// Skip voices that went out of sync (this shouldn't happen)
+	for (int numTries = 0; numTries < NUM_POLYPHONIC_VOICES; numTries++)
+	{
+		// If there's a released voice already being killed and we need to 
 		// make room for another voice kill, force-kill it and its siblings
-		if (!allowTailOff && v->isBeingKilled())
+		if (!allowTailOff)
 		{
-			LOG_SYNTH_EVENT("Force-kill voice " + String(v->getVoiceIndex()));
-			numVoicesKilled += killVoiceAndSiblings(v, false);
-
-			if (numVoicesKilled > 0)
+			if (auto v = getVoiceFromAllocator(voiceAllocator.getKilledVoice(true)))
 			{
-				// job is done, return
-				return numVoicesKilled;
-			}
-			else
-			{
-				allowTailOff = true;
-			}
-		}
-		else
-		{
-			const double voiceUptime = v->getVoiceUptime();
-
-			if (!v->isBeingKilled() && voiceUptime < oldestUptime)
-			{
-				oldestUptime = voiceUptime;
-				oldestUnkilledMessage = v;
+				LOG_SYNTH_EVENT("Force-kill voice " + String(v->getVoiceIndex()));
+				return killVoiceAndSiblings(v, false);
 			}
 		}
-	}
 
-	if (oldestUnkilledMessage != nullptr)
-	{
-		return killVoiceAndSiblings(oldestUnkilledMessage, allowTailOff);
-	}
-
-	oldestUnkilledMessage = nullptr;
-	oldestUptime = DBL_MAX;
-
-	// Now the same again for all notes
-	for (auto v: activeVoices)
-	{
-		if (v->isInactive())
-			continue;
+		auto voiceIndex = voiceAllocator.getVoiceToSteal(voiceStealingMode, noteNumberToStart, getVoiceGain);
 
-		// If there's a voice already being killed and we need to 
-		// make room for another voice kill, force-kill it and its siblings
-		if (!allowTailOff && v->isBeingKilled())
+		// Force-kill a held voice that is being killed before killing another voice
+		if (!allowTailOff && !voiceAllocator.isReleased(voiceIndex))
 		{
-			numVoicesKilled += killVoiceAndSiblings(v, false);
+			if (auto v = getVoiceFromAllocator(voiceAllocator.getKilledVoice(false)))
+				return killVoiceAndSiblings(v, false);
+		}
 
-			if (numVoicesKilled > 0)
-			{
-				// job is done, return
-				return numVoicesKilled;
-			}
-			else
+		if (auto v = getVoiceFromAllocator(voiceIndex))
+		{
+			if (v->isInactive())
 			{
-				allowTailOff = true;
+				jassertfalse;
+				voiceAllocator.voiceRemoved(voiceIndex);
+				continue;
 			}
-		}
-		else
-		{
-			const double voiceUptime = v->getVoiceUptime();
 
-			if (!v->isBeingKilled() && voiceUptime < oldestUptime)
+			if (v->isBeingKilled())
 			{
-				oldestUptime = voiceUptime;
-				oldestUnkilledMessage = v;
+				voiceAllocator.voiceKilled(voiceIndex);
+				continue;
 			}
-		}
-	}
 
-	if (oldestUnkilledMessage != nullptr)
-	{
-		return killVoiceAndSiblings(oldestUnkilledMessage, allowTailOff);
-	}
+			return killVoiceAndSiblings(v, allowTailOff);
+		}
 
-	// Just forcekill the first voice that is active...
-	for (auto v : activeVoices)
-	{
-		if (v->isBeingKilled())
-		{
+		// Just forcekill the first voice that is being killed...
+		if (auto v = getVoiceFromAllocator(voiceAllocator.getKilledVoice(false)))
 			return killVoiceAndSiblings(v, false);
-		}
+
+		break;
 	}
 	
 	return 0;
@@ -1739,8 +1988,14 @@ int ModulatorSynth::killVoiceAndSiblings(ModulatorSynthVoice* v, bool allowTailO
 
 	int numVoicesKilled = 0;
 
-	for (auto av: activeVoices)
+	// Siblings are started by the same event, so we only need to check the voices with the same note number
+	for (auto i = voiceAllocator.getFirstVoiceForNote(e.getNoteNumber()); i != -1;)
 	{
+		auto av = getVoiceFromAllocator(i);
+
+		// resetting the voice removes it from the list
+		i = voiceAllocator.getNextVoiceForNote(i);
+
 		// Skip the note
 		if (av == v)
 			continue;
@@ -1791,6 +2046,7 @@ void ModulatorSynth::deleteAllVoices()
 	pendingRemoveVoices.clear();
 	lastStartedVoice = nullptr;
 	clearVoices();
+	voiceAllocator.reset(0);
 }
 
 void ModulatorSynth::resetAllVoices()
@@ -1806,7 +2062,7 @@ void ModulatorSynth::resetAllVoices()
         lastStartedVoice = nullptr;
         activeVoices.clearQuick();
         pendingRemoveVoices.clearQuick();
-        
+        voiceAllocator.reset(getNumVoices());
     }
     
 	effectChain->resetMasterEffects();
@@ -1912,9 +2168,14 @@ hise::ModulatorSynthVoice* ModulatorSynth::getVoiceToStart(const HiseEvent& m)
 
 	const bool retriggerWithDifferentChannels = getMainController()->getMacroManager().getMidiControlAutomationHandler()->getMPEData().isMpeEnabled();
 
-	for (int j = 0; j < voices.size(); j++)
+	syncVoiceAllocator();
+
+	// Only the active voices with the same note number can be retriggered
+	for (auto i = voiceAllocator.getFirstVoiceForNote(m.getNoteNumber()); i != -1;)
 	{
-		ModulatorSynthVoice* const voice = static_cast<ModulatorSynthVoice*>(voices.getUnchecked(j));
+		ModulatorSynthVoice* const voice = getVoiceFromAllocator(i);
+
+		i = voiceAllocator.getNextVoiceForNote(i);
 
 		if (voice->getCurrentlyPlayingNote() == m.getNoteNumber() // Use the untransposed number for detecting repeated notes
 			&& (retriggerWithDifferentChannels || voice->isPlayingChannel(m.getChannel()))
@@ -1922,14 +2183,64 @@ hise::ModulatorSynthVoice* ModulatorSynth::getVoiceToStart(const HiseEvent& m)
 		{
 			handleRetriggeredNote(voice);
 		}
+	}
 
-		if (v == nullptr && voice->isInactive())
-			v = voice;
+	if (v == nullptr)
+	{
+		if (auto fv = getVoiceFromAllocator(voiceAllocator.getFreeVoice()))
+		{
+			if (fv->isInactive())
+				v = fv;
+		}
+	}
+
+	if (v == nullptr)
+	{
+		for (auto voice : voices)
+		{
+			if (static_cast<ModulatorSynthVoice*>(voice)->isInactive())
+			{
+				v = static_cast<ModulatorSynthVoice*>(voice);
+				break;
+			}
+		}
 	}
 
 	return v;
 }
 
+void ModulatorSynth::syncVoiceAllocator()
+{
+	if (voiceAllocator.getNumVoices() == voices.size())
+		return;
+
+	voiceAllocator.reset(voices.size());
+
+	for (int i = 0; i < voices.size(); i++)
+	{
+		auto v = static_cast<ModulatorSynthVoice*>(voices.getUnchecked(i));
+
+		if (v->isInactive())
+			continue;
+
+		voiceAllocator.voiceStarted(i, v->getCurrentHiseEvent().getNoteNumber());
+
+		if (v->isTailingOff())
+			voiceAllocator.voiceReleased(i);
+
+		if (v->isBeingKilled())
+			voiceAllocator.voiceKilled(i);
+	}
+}
+
+ModulatorSynthVoice* ModulatorSynth::getVoiceFromAllocator(int voiceIndex) const
+{
+	if (isPositiveAndBelow(voiceIndex, voices.size()))
+		return static_cast<ModulatorSynthVoice*>(voices.getUnchecked(voiceIndex));
+
+	return nullptr;
+}
+
 ModulatorSynthVoice::ModulatorSynthVoice(ModulatorSynth* ownerSynth_):
 	SynthesiserVoice(),
 	ownerSynth(ownerSynth_),
@@ -2028,6 +2339,7 @@ void ModulatorSynthVoice::killVoice()
 {
 	//stopNote(true);
 	killThisVoice = true;	
+	getOwnerSynth()->getVoiceAllocator().voiceKilled(voiceIndex);
 }
 
 bool const ModulatorSynthVoice::shouldBeKilled() const
@@ -220,6 +220,80 @@ public:
 
 	void clearPendingRemoveVoices();
 
+	// ===================================================================================================================
+
+	/** Enables rendering the active voices concurrently on the realtime worker threads.
+	*
+	*	Each worker calculates the voice modulation into its own buffers and renders the voices into its own
+	*	output buffer. The output buffers are summed in a fixed order, so the result doesn't depend on the thread timing.
+	*	It only has an effect if supportsParallelVoiceRendering() returns true and there are no polyphonic effects.
+	*
+	*	The modulators are not thread safe, so the modulation of the voices is still calculated one after another
+	*	(the workers lock each other out during calculateModulationValuesForVoice()). Only the rendering of the
+	*	voice itself runs concurrently, so this helps most if the voices are expensive compared to their modulation.
+	*/
+	void setUseParallelVoiceRendering(bool shouldRenderVoicesConcurrently);
+
+	bool isUsingParallelVoiceRendering() const noexcept;
+
+	/** Defines where the audio block is split for the events of the current buffer. */
+	enum class EventSplitMode
+	{
+		EveryEvent, ///< renders the voices up to each event (default).
+		VoiceEventsOnly, ///< only splits the voice rendering at note-ons, note-offs, fade events and the sustain, sostenuto and soft pedals.
+		numEventSplitModes
+	};
+
+	/** Sets the event split mode.
+	*
+	*	With EventSplitMode::VoiceEventsOnly, dense controller / pitchbend streams don't fragment the voice rendering anymore:
+	*	the monophonic modulation values are still calculated up to each event so the CC / pitch changes end up sample accurate
+	*	in the modulation buffers, but the polyphonic modulation and the voices are rendered in whole blocks between the voice events.
+	*/
+	void setEventSplitMode(EventSplitMode newMode);
+
+	EventSplitMode getEventSplitMode() const noexcept { return eventSplitMode; }
+
+	/** Returns the number of times the voice rendering was split in the last audio callback. */
+	int getNumSubBlockSplits() const noexcept { return numSubBlockSplits.load(); }
+
+	/** Returns true if the event changes the state of the voices and requires the voice rendering to be split. */
+	static bool isVoiceEvent(const HiseEvent& e);
+
+	using VoiceStealingMode = VoiceAllocator::StealingMode;
+
+	/** Sets the policy that picks the voice that is killed when the voice limit is reached. */
+	void setVoiceStealingMode(VoiceStealingMode newMode);
+
+	VoiceStealingMode getVoiceStealingMode() const noexcept { return voiceStealingMode; }
+
+	/** Returns the index of the free and active voices. Call this only from the audio thread. */
+	VoiceAllocator& getVoiceAllocator() noexcept { return voiceAllocator; }
+
+	/** Override this and return true if the voices of this synth don't access any shared data except for the modulation chains. */
+	virtual bool supportsParallelVoiceRendering() const { return false; }
+
+	/** Override this to render the active voices with a single call before the serial voice loop.
+	*
+	*	It is called after the monophonic modulation is calculated, but before the voice modulation. The voice loop
+	*	still calls renderNextBlock() for each voice, so the voices must skip their own rendering for this block.
+	*/
+	virtual void renderVoiceBatch(int startSample, int numThisTime) { ignoreUnused(startSample, numThisTime); }
+
+	/** Locks the shared voice state if the voices are currently rendered concurrently. 
+	*
+	*	Use this whenever a voice needs to access shared data (eg. the modulators or the voice list) during rendering.
+	*/
+	struct ScopedVoiceRenderLock
+	{
+		ScopedVoiceRenderLock(ModulatorSynth* s);
+		~ScopedVoiceRenderLock();
+
+	private:
+
+		audio_spin_mutex* mutex = nullptr;
+	};
+
 	/** This method is called to handle all modulatorchains after the voice rendering and handles the GUI metering. It assumes stereo mode.
 	*
 	*	The rendered buffer is supplied as reference to be able to apply changes here after all voices are rendered (eg. gain).
@@ -286,7 +360,7 @@ public:
 	*/
 	void killAllVoicesWithNoteNumber(int noteNumber);
 
-	/** Kills the voice that is playing for the longest time. */
+	/** Kills the voice that is picked by the current voice stealing mode (by default the voice that is playing for the longest time). */
 	int killLastVoice(bool allowTailOff=true);
 
 	
@@ -410,6 +484,9 @@ public:
 
 	float getConstantGainModValue() const;
 
+	/** Returns the descriptor of the gain modulation for the current voice. */
+	ModulationRamp getVoiceGainRamp() const;
+
 
 	float getConstantVoicePitchModulationValueDeleteSoon() const;
 
@@ -514,6 +591,11 @@ private:
 	// kills or resets all voices that have the same start event. */
 	int killVoiceAndSiblings(ModulatorSynthVoice* v, bool allowTailOff);
 
+	// rebuilds the voice allocator if the voice amount has changed
+	void syncVoiceAllocator();
+
+	ModulatorSynthVoice* getVoiceFromAllocator(int voiceIndex) const;
+
 
 	// ===================================================================================================================
 
@@ -529,8 +611,23 @@ private:
 	int internalVoiceLimit;
 
 	// If this is true, the script fade things have changed the pitch modulation data
-	// and it must be used.
-	bool useScratchBufferForArtificialPitch = false;
+	// and it must be used (one flag for each realtime worker).
+	bool useScratchBufferForArtificialPitch[HISE_MAX_REALTIME_WORKERS];
+
+	struct ParallelVoiceRenderer;
+
+	bool renderVoicesConcurrently(int startSample, int numThisTime);
+
+	ScopedPointer<ParallelVoiceRenderer> parallelVoiceRenderer;
+
+	EventSplitMode eventSplitMode = EventSplitMode::EveryEvent;
+	std::atomic<int> numSubBlockSplits = { 0 };
+
+	VoiceAllocator voiceAllocator;
+	VoiceStealingMode voiceStealingMode = VoiceStealingMode::Oldest;
+
+	// the (untransposed) note number of the note that is about to be started
+	int noteNumberToStart = -1;
 
 	
 
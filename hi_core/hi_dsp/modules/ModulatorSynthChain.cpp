@@ -32,6 +32,104 @@
 
 namespace hise { using namespace juce;
 
+struct ModulatorSynthChain::ParallelChildRenderer
+{
+	/** A range of child synths that are either rendered concurrently or serially. */
+	struct Stage
+	{
+		int startIndex = 0;
+		int numChildren = 0;
+		bool concurrent = false;
+	};
+
+	ParallelChildRenderer(ModulatorSynthChain& parent_) :
+		parent(parent_)
+	{}
+
+	void prepare(int numChannels, int samplesPerBlock)
+	{
+		const int numChildren = jmax(1, parent.synths.size());
+
+		ProcessorHelpers::increaseBufferIfNeeded(childBuffers, samplesPerBlock);
+		childBuffers.setSize(numChannels * numChildren, childBuffers.getNumSamples());
+
+		stages.ensureStorageAllocated(numChildren);
+		dirty.store(true);
+	}
+
+	bool isPrepared(int numChannels, int numSamples) const noexcept
+	{
+		return childBuffers.getNumChannels() >= numChannels * parent.synths.size() &&
+			   childBuffers.getNumSamples() >= numSamples;
+	}
+
+	/** Checks whether the processor or one of its children reads or writes data of other synths on the audio thread. */
+	static bool hasCrossSynthDependencies(Processor* p)
+	{
+		if (dynamic_cast<GlobalModulatorContainer*>(p) != nullptr ||
+			dynamic_cast<GlobalModulator*>(p) != nullptr ||
+			dynamic_cast<SendContainer*>(p) != nullptr ||
+			dynamic_cast<SendEffect*>(p) != nullptr)
+			return true;
+
+		// Any script processor can access the global script state on the audio thread and scriptnode
+		// networks (also the compiled ones) can use global cables or send nodes
+		if (dynamic_cast<JavascriptProcessor*>(p) != nullptr ||
+			dynamic_cast<scriptnode::DspNetwork::Holder*>(p) != nullptr ||
+			dynamic_cast<HardcodedSwappableEffect*>(p) != nullptr)
+			return true;
+
+		for (int i = 0; i < p->getNumChildProcessors(); i++)
+		{
+			if (hasCrossSynthDependencies(p->getChildProcessor(i)))
+				return true;
+		}
+
+		return false;
+	}
+
+	/** Groups the child synths into stages. This doesn't allocate, so it can be called on the audio thread. */
+	void rebuildStages()
+	{
+		stages.clearQuick();
+
+		// The voice indexes are shared between all children
+		const bool childrenAreIndependent = parent.getUniformVoiceHandler() == nullptr;
+
+		for (int i = 0; i < parent.synths.size(); i++)
+		{
+			const bool concurrent = childrenAreIndependent && !hasCrossSynthDependencies(parent.synths[i]);
+
+			if (concurrent && !stages.isEmpty() && stages.getReference(stages.size() - 1).concurrent)
+				stages.getReference(stages.size() - 1).numChildren++;
+			else
+				stages.add({ i, 1, concurrent });
+		}
+
+		dirty.store(false);
+	}
+
+	/** Adds the worker threads to the audio thread list so that the thread checks recognize them.
+	
+		The list is not thread safe, so this must be called by the thread that creates the renderer
+		while holding the audio lock (and not by the workers themselves).
+	*/
+	void registerWorkerThreads()
+	{
+		auto& ksh = parent.getMainController()->getKillStateHandler();
+
+		for (int i = 1; i < workers->getNumWorkers(); i++)
+			ksh.addThreadIdToAudioThreadList(workers->getWorkerThreadId(i));
+	}
+
+	SharedResourcePointer<RealtimeWorkerGroup> workers;
+	AudioSampleBuffer childBuffers;
+	Array<Stage> stages;
+	std::atomic<bool> dirty = { true };
+
+	ModulatorSynthChain& parent;
+};
+
 ModulatorSynthChain::ModulatorSynthChain(MainController *mc, const String &id, int numVoices_) :
 	MacroControlBroadcaster(this),
 	ModulatorSynth(mc, id, numVoices_),
@@ -72,6 +170,8 @@ ModulatorSynthChain::ModulatorSynthChain(MainController *mc, const String &id, i
 
 ModulatorSynthChain::~ModulatorSynthChain()
 {
+	parallelChildRenderer = nullptr;
+
 	getHandler()->clear();
 
 	modChains.clear();
@@ -170,6 +270,9 @@ void ModulatorSynthChain::prepareToPlay(double newSampleRate, int samplesPerBloc
 	for (auto s: synths)
 		s->prepareToPlay(newSampleRate, samplesPerBlock);
 
+	if (parallelChildRenderer != nullptr)
+		parallelChildRenderer->prepare(internalBuffer.getNumChannels(), samplesPerBlock);
+
 	if (ownedUniformVoiceHandler != nullptr)
         ownedUniformVoiceHandler->rebuildChildSynthList();
 }
@@ -193,7 +296,7 @@ void ModulatorSynthChain::numSourceChannelsChanged()
 
 	ModulatorSynth::numSourceChannelsChanged();
 
-	
+	prepareParallelChildRenderer();
 }
 
 void ModulatorSynthChain::numDestinationChannelsChanged()
@@ -216,6 +319,10 @@ ValueTree ModulatorSynthChain::exportAsValueTree() const
 
 		v.addChild(getMainController()->getMacroManager().getMidiControlAutomationHandler()->getMPEData().exportAsValueTree(), -1, nullptr);
 	}
+
+	if (isUsingParallelChildRendering())
+		v.setProperty("ParallelChildRendering", true, nullptr);
+
 	return v;
 }
 
@@ -248,6 +355,7 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 	if (isSoftBypassed()) return;
 
 	ADD_GLITCH_DETECTOR(this, DebugLogger::Location::SynthChainRendering);
+	ADD_AUDIO_THREAD_VIOLATION_SCOPE(this);
 
     auto isRoot = getMainController()->getMainSynthChain() == this;
     
@@ -326,13 +434,11 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 	ScopedAnalyser sa(getMainController(), this, internalBuffer, buffer.getNumSamples());
 
 	// Process the Synths and add store their output in the internal buffer
-	for (int i = 0; i < synths.size(); i++)
-    {
-		ScopedAnalyser sa(getMainController(), synths[i], internalBuffer, internalBuffer.getNumSamples());
-
-        if (!synths[i]->isSoftBypassed())
-            synths[i]->renderNextBlockWithModulators(internalBuffer, eventBuffer);
-    }
+	if (!renderChildSynthsConcurrently(numSamples))
+	{
+		for (int i = 0; i < synths.size(); i++)
+			renderChildSynth(i, internalBuffer);
+	}
 
 	HiseEventBuffer::Iterator eventIterator(eventBuffer);
 
@@ -387,12 +493,118 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 }
 
 
+void ModulatorSynthChain::renderChildSynth(int childIndex, AudioSampleBuffer& b)
+{
+	auto s = synths[childIndex];
+
+	ScopedAnalyser sa(getMainController(), s, b, b.getNumSamples());
+
+	if (!s->isSoftBypassed())
+		s->renderNextBlockWithModulators(b, eventBuffer);
+}
+
+bool ModulatorSynthChain::renderChildSynthsConcurrently(int numSamples)
+{
+	if (parallelChildRenderer == nullptr || synths.size() < 2)
+		return false;
+
+	auto& pr = *parallelChildRenderer;
+	const int numChannels = internalBuffer.getNumChannels();
+
+	if (!pr.isPrepared(numChannels, numSamples))
+		return false;
+
+	if (pr.dirty.load())
+		pr.rebuildStages();
+
+	for (const auto& stage : pr.stages)
+	{
+		if (!stage.concurrent || stage.numChildren == 1)
+		{
+			for (int i = 0; i < stage.numChildren; i++)
+				renderChildSynth(stage.startIndex + i, internalBuffer);
+
+			continue;
+		}
+
+		auto f = [&](int taskIndex)
+		{
+			const int childIndex = stage.startIndex + taskIndex;
+
+			AudioSampleBuffer childBuffer(pr.childBuffers.getArrayOfWritePointers() + childIndex * numChannels, numChannels, numSamples);
+			childBuffer.clear();
+
+			renderChildSynth(childIndex, childBuffer);
+		};
+
+		pr.workers->execute(stage.numChildren, f);
+
+		// Merge the child buffers in their original order so that the result doesn't depend on the thread timing
+		for (int i = 0; i < stage.numChildren; i++)
+		{
+			const int childIndex = stage.startIndex + i;
+
+			for (int c = 0; c < numChannels; c++)
+				FloatVectorOperations::add(internalBuffer.getWritePointer(c), pr.childBuffers.getReadPointer(childIndex * numChannels + c), numSamples);
+		}
+	}
+
+	return true;
+}
+
+void ModulatorSynthChain::setUseParallelChildRendering(bool shouldRenderChildSynthsConcurrently)
+{
+	if (shouldRenderChildSynthsConcurrently == isUsingParallelChildRendering())
+		return;
+
+	ScopedPointer<ParallelChildRenderer> newRenderer;
+
+	if (shouldRenderChildSynthsConcurrently)
+		newRenderer = new ParallelChildRenderer(*this);
+
+	{
+		LockHelpers::SafeLock sl(getMainController(), LockHelpers::Type::AudioLock, isOnAir());
+
+		if (newRenderer != nullptr)
+		{
+			newRenderer->registerWorkerThreads();
+
+			if (getLargestBlockSize() > 0)
+				newRenderer->prepare(internalBuffer.getNumChannels(), getLargestBlockSize());
+		}
+
+		std::swap(newRenderer, parallelChildRenderer);
+	}
+}
+
+bool ModulatorSynthChain::isUsingParallelChildRendering() const noexcept
+{
+	return parallelChildRenderer != nullptr;
+}
+
+void ModulatorSynthChain::invalidateParallelRenderTasks() noexcept
+{
+	if (parallelChildRenderer != nullptr)
+		parallelChildRenderer->dirty.store(true);
+}
+
+void ModulatorSynthChain::prepareParallelChildRenderer()
+{
+	if (parallelChildRenderer == nullptr || getLargestBlockSize() <= 0)
+		return;
+
+	LockHelpers::SafeLock sl(getMainController(), LockHelpers::Type::AudioLock, isOnAir());
+	parallelChildRenderer->prepare(getMatrix().getNumSourceChannels(), getLargestBlockSize());
+}
+
 void ModulatorSynthChain::restoreFromValueTree(const ValueTree &v)
 {
 	packageName = v.getProperty("packageName", "");
 
 	ModulatorSynth::restoreFromValueTree(v);
 
+	setUseParallelChildRendering(v.getProperty("ParallelChildRendering", false));
+
 	if (!getMainController()->shouldSkipCompiling())
 	{
 		ValueTree autoData = v.getChildWithName("MidiAutomation");
@@ -703,6 +915,9 @@ void ModulatorSynthChain::ModulatorSynthChainHandler::add(Processor *newProcesso
 		LOCK_PROCESSING_CHAIN(synth);
 		ms->setIsOnAir(synth->isOnAir());
 		synth->synths.insert(index, ms);
+
+		if (synth->parallelChildRenderer != nullptr && bs > 0)
+			synth->parallelChildRenderer->prepare(synth->internalBuffer.getNumChannels(), bs);
 	}
 
 	notifyListeners(Listener::ProcessorAdded, newProcessor);
@@ -718,6 +933,7 @@ void ModulatorSynthChain::ModulatorSynthChainHandler::remove(Processor *processo
 		LOCK_PROCESSING_CHAIN(synth);
 		processorToBeRemoved->setIsOnAir(false);
 		synth->synths.removeObject(dynamic_cast<ModulatorSynth*>(processorToBeRemoved), false);
+		synth->invalidateParallelRenderTasks();
 	}
 
 	if (removeSynth)
@@ -170,6 +170,20 @@ public:
 	*/
 	void renderNextBlockWithModulators(AudioSampleBuffer &buffer, const HiseEventBuffer &inputMidiBuffer) override;;
 
+	/** Enables rendering the child synths concurrently on the realtime worker threads.
+	*
+	*	The child synths are grouped into stages: consecutive children without cross-synth dependencies are rendered
+	*	concurrently into their own buffers, which are then added to the output in their original order. Children that
+	*	depend on other synths (global modulators, send containers, any script processor or scriptnode network) are
+	*	rendered serially between the stages.
+	*/
+	void setUseParallelChildRendering(bool shouldRenderChildSynthsConcurrently);
+
+	bool isUsingParallelChildRendering() const noexcept;
+
+	/** Tells the chain that a module was added somewhere below it, so the dependencies of the child synths must be checked again. */
+	void invalidateParallelRenderTasks() noexcept;
+
 	int getVoiceAmount() const;;
 
 	int getNumActiveVoices() const override;
@@ -223,6 +237,16 @@ public:
 	
 private:
 
+	struct ParallelChildRenderer;
+
+	bool renderChildSynthsConcurrently(int numSamples);
+
+	void renderChildSynth(int childIndex, AudioSampleBuffer& b);
+
+	void prepareParallelChildRenderer();
+
+	ScopedPointer<ParallelChildRenderer> parallelChildRenderer;
+
 	ScopedPointer<UniformVoiceHandler> ownedUniformVoiceHandler;
 
 	HiseEvent::ChannelFilterData activeChannels;
@@ -0,0 +1,301 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise { using namespace juce;
+
+VoiceAllocator::VoiceAllocator()
+{
+	reset(0);
+}
+
+void VoiceAllocator::reset(int newNumVoices)
+{
+	jassert(newNumVoices <= NUM_POLYPHONIC_VOICES);
+
+	numVoices = jlimit(0, NUM_POLYPHONIC_VOICES, newNumVoices);
+	numFree = 0;
+	heapSize = 0;
+	numKilled = 0;
+	startCounter = 0;
+
+	for (auto& f : firstVoiceForNote)
+		f = -1;
+
+	for (auto& v : voices)
+		v = {};
+
+	// Add them in reverse order so that the voice with the lowest index is used first
+	for (int i = numVoices - 1; i >= 0; i--)
+		addToFreeList(i);
+}
+
+bool VoiceAllocator::isFree(int voiceIndex) const noexcept
+{
+	return isPositiveAndBelow(voiceIndex, numVoices) && voices[voiceIndex].freePosition != -1;
+}
+
+void VoiceAllocator::voiceStarted(int voiceIndex, int noteNumber)
+{
+	if (!isPositiveAndBelow(voiceIndex, numVoices))
+		return;
+
+	auto& v = voices[voiceIndex];
+
+	// Remove it from any list in case a voice is restarted without being reset
+	removeFromFreeList(voiceIndex);
+	removeFromKilledList(voiceIndex);
+	removeFromNoteList(voiceIndex);
+	heapRemove(voiceIndex);
+
+	v.startIndex = ++startCounter;
+	v.released = false;
+
+	heapInsert(voiceIndex);
+	addToNoteList(voiceIndex, noteNumber);
+}
+
+void VoiceAllocator::voiceReleased(int voiceIndex)
+{
+	if (!isPositiveAndBelow(voiceIndex, numVoices))
+		return;
+
+	auto& v = voices[voiceIndex];
+
+	if (v.released || v.freePosition != -1)
+		return;
+
+	v.released = true;
+
+	// Released voices have a higher priority, so it can only move up
+	if (v.heapPosition != -1)
+		siftUp(v.heapPosition);
+}
+
+void VoiceAllocator::voiceKilled(int voiceIndex)
+{
+	if (!isPositiveAndBelow(voiceIndex, numVoices) || voices[voiceIndex].heapPosition == -1)
+		return;
+
+	heapRemove(voiceIndex);
+	addToKilledList(voiceIndex);
+}
+
+void VoiceAllocator::voiceRemoved(int voiceIndex)
+{
+	if (!isPositiveAndBelow(voiceIndex, numVoices))
+		return;
+
+	heapRemove(voiceIndex);
+	removeFromKilledList(voiceIndex);
+	removeFromNoteList(voiceIndex);
+
+	voices[voiceIndex].released = false;
+
+	if (voices[voiceIndex].freePosition == -1)
+		addToFreeList(voiceIndex);
+}
+
+int VoiceAllocator::getKilledVoice(bool releasedOnly) const noexcept
+{
+	for (int i = 0; i < numKilled; i++)
+	{
+		auto v = killedVoices[i];
+
+		if (!releasedOnly || voices[v].released)
+			return v;
+	}
+
+	return -1;
+}
+
+bool VoiceAllocator::hasHigherStealingPriority(int first, int second) const noexcept
+{
+	const auto& a = voices[first];
+	const auto& b = voices[second];
+
+	if (a.released != b.released)
+		return a.released;
+
+	return a.startIndex < b.startIndex;
+}
+
+void VoiceAllocator::addToFreeList(int voiceIndex)
+{
+	jassert(voices[voiceIndex].freePosition == -1);
+
+	voices[voiceIndex].freePosition = numFree;
+	freeVoices[numFree++] = voiceIndex;
+}
+
+void VoiceAllocator::removeFromFreeList(int voiceIndex)
+{
+	auto pos = voices[voiceIndex].freePosition;
+
+	if (pos == -1)
+		return;
+
+	auto last = freeVoices[--numFree];
+	freeVoices[pos] = last;
+	voices[last].freePosition = pos;
+	voices[voiceIndex].freePosition = -1;
+}
+
+void VoiceAllocator::addToKilledList(int voiceIndex)
+{
+	jassert(voices[voiceIndex].killedPosition == -1);
+
+	voices[voiceIndex].killedPosition = numKilled;
+	killedVoices[numKilled++] = voiceIndex;
+}
+
+void VoiceAllocator::removeFromKilledList(int voiceIndex)
+{
+	auto pos = voices[voiceIndex].killedPosition;
+
+	if (pos == -1)
+		return;
+
+	auto last = killedVoices[--numKilled];
+	killedVoices[pos] = last;
+	voices[last].killedPosition = pos;
+	voices[voiceIndex].killedPosition = -1;
+}
+
+void VoiceAllocator::addToNoteList(int voiceIndex, int noteNumber)
+{
+	if (!isPositiveAndBelow(noteNumber, 128))
+		return;
+
+	auto& v = voices[voiceIndex];
+
+	v.noteNumber = noteNumber;
+	v.prevForNote = -1;
+	v.nextForNote = firstVoiceForNote[noteNumber];
+
+	if (v.nextForNote != -1)
+		voices[v.nextForNote].prevForNote = voiceIndex;
+
+	firstVoiceForNote[noteNumber] = voiceIndex;
+}
+
+void VoiceAllocator::removeFromNoteList(int voiceIndex)
+{
+	auto& v = voices[voiceIndex];
+
+	if (v.noteNumber == -1)
+		return;
+
+	if (v.prevForNote != -1)
+		voices[v.prevForNote].nextForNote = v.nextForNote;
+	else
+		firstVoiceForNote[v.noteNumber] = v.nextForNote;
+
+	if (v.nextForNote != -1)
+		voices[v.nextForNote].prevForNote = v.prevForNote;
+
+	v.noteNumber = -1;
+	v.nextForNote = -1;
+	v.prevForNote = -1;
+}
+
+void VoiceAllocator::heapInsert(int voiceIndex)
+{
+	jassert(voices[voiceIndex].heapPosition == -1);
+
+	voices[voiceIndex].heapPosition = heapSize;
+	heap[heapSize++] = voiceIndex;
+	siftUp(heapSize - 1);
+}
+
+void VoiceAllocator::heapRemove(int voiceIndex)
+{
+	auto pos = voices[voiceIndex].heapPosition;
+
+	if (pos == -1)
+		return;
+
+	--heapSize;
+
+	if (pos != heapSize)
+	{
+		heapSwap(pos, heapSize);
+		siftDown(pos);
+		siftUp(pos);
+	}
+
+	voices[voiceIndex].heapPosition = -1;
+}
+
+void VoiceAllocator::heapSwap(int firstPosition, int secondPosition)
+{
+	std::swap(heap[firstPosition], heap[secondPosition]);
+	voices[heap[firstPosition]].heapPosition = firstPosition;
+	voices[heap[secondPosition]].heapPosition = secondPosition;
+}
+
+void VoiceAllocator::siftUp(int position)
+{
+	while (position > 0)
+	{
+		auto parent = (position - 1) / 2;
+
+		if (!hasHigherStealingPriority(heap[position], heap[parent]))
+			break;
+
+		heapSwap(position, parent);
+		position = parent;
+	}
+}
+
+void VoiceAllocator::siftDown(int position)
+{
+	for (;;)
+	{
+		auto best = position;
+		auto left = 2 * position + 1;
+		auto right = left + 1;
+
+		if (left < heapSize && hasHigherStealingPriority(heap[left], heap[best]))
+			best = left;
+
+		if (right < heapSize && hasHigherStealingPriority(heap[right], heap[best]))
+			best = right;
+
+		if (best == position)
+			break;
+
+		heapSwap(position, best);
+		position = best;
+	}
+}
+
+} // namespace hise
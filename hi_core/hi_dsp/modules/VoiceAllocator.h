@@ -0,0 +1,201 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#ifndef VOICEALLOCATOR_H_INCLUDED
+#define VOICEALLOCATOR_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** Keeps track of the free and active voices of a ModulatorSynth so that starting and stealing voices doesn't need to iterate over all voices.
+*
+*	It only stores voice indexes and is updated by the ModulatorSynth whenever a voice is started, released, killed or reset:
+*
+*	- the free voices are kept on a stack, so finding a free voice is O(1)
+*	- the active voices that are not being killed are kept in a binary heap ordered by their stealing priority (released voices first, then the oldest voice)
+*	- the voices that are fading out because they were killed are kept in a separate list
+*	- the active voices of each note number are kept in a linked list, so retriggered notes and sibling voices can be found by looking only at the voices that play the same note
+*
+*	All arrays have a fixed size of NUM_POLYPHONIC_VOICES, so none of the methods allocate and it can be used in the audio thread.
+*/
+class VoiceAllocator
+{
+public:
+
+	/** The policy that picks the voice that is killed when the voice limit is reached. */
+	enum class StealingMode
+	{
+		Oldest, ///< kills the oldest voice and prefers voices that are already released (default).
+		Quietest, ///< kills the voice with the lowest gain modulation value.
+		SameNoteFirst, ///< kills the oldest voice that plays the same note number and uses Oldest if there is none.
+		numStealingModes
+	};
+
+	static StringArray getStealingModeNames() { return { "Oldest", "Quietest", "SameNoteFirst" }; }
+
+	VoiceAllocator();
+
+	/** Clears all lists and marks the voices with the index [0...numVoices) as free. */
+	void reset(int numVoices);
+
+	int getNumVoices() const noexcept { return numVoices; }
+
+	/** Returns the voice that was freed most recently or -1 if all voices are active. */
+	int getFreeVoice() const noexcept { return numFree > 0 ? freeVoices[numFree - 1] : -1; }
+
+	bool isFree(int voiceIndex) const noexcept;
+
+	/** Call this when the voice was started with the given note number. */
+	void voiceStarted(int voiceIndex, int noteNumber);
+
+	/** Call this when the voice received a note off and is tailing off. */
+	void voiceReleased(int voiceIndex);
+
+	/** Call this when the voice is being killed with a fade out. */
+	void voiceKilled(int voiceIndex);
+
+	/** Call this when the voice was reset and can be used again. */
+	void voiceRemoved(int voiceIndex);
+
+	/** Returns the number of active voices that are not being killed. */
+	int getNumStealableVoices() const noexcept { return heapSize; }
+
+	/** Returns the active voice with the highest stealing priority or -1. */
+	int getOldestVoice() const noexcept { return heapSize > 0 ? heap[0] : -1; }
+
+	/** Returns a voice that is being killed. If releasedOnly is true, it only returns voices that were released before they were killed. */
+	int getKilledVoice(bool releasedOnly) const noexcept;
+
+	bool isReleased(int voiceIndex) const noexcept { return isPositiveAndBelow(voiceIndex, numVoices) && voices[voiceIndex].released; }
+
+	/** Returns true if the first voice should be stolen before the second voice. */
+	bool hasHigherStealingPriority(int first, int second) const noexcept;
+
+	/** Returns the first active voice that plays the given note number or -1. Use getNextVoiceForNote() to iterate over the others. */
+	int getFirstVoiceForNote(int noteNumber) const noexcept
+	{
+		return isPositiveAndBelow(noteNumber, 128) ? firstVoiceForNote[noteNumber] : -1;
+	}
+
+	int getNextVoiceForNote(int voiceIndex) const noexcept { return voices[voiceIndex].nextForNote; }
+
+	/** Returns the voice that should be stolen for a new note with the given stealing mode.
+	*
+	*	The gain function is only used for StealingMode::Quietest and must return the current gain of the voice with the given index.
+	*/
+	template <typename GainFunction> int getVoiceToSteal(StealingMode m, int noteNumber, const GainFunction& getGain) const
+	{
+		if (m == StealingMode::Quietest)
+		{
+			int quietestVoice = -1;
+			float lowestGain = std::numeric_limits<float>::max();
+
+			for (int i = 0; i < heapSize; i++)
+			{
+				auto v = heap[i];
+				auto gain = getGain(v);
+
+				if (quietestVoice == -1 || gain < lowestGain || (gain == lowestGain && hasHigherStealingPriority(v, quietestVoice)))
+				{
+					lowestGain = gain;
+					quietestVoice = v;
+				}
+			}
+
+			return quietestVoice;
+		}
+
+		if (m == StealingMode::SameNoteFirst)
+		{
+			int sameNoteVoice = -1;
+
+			for (auto v = getFirstVoiceForNote(noteNumber); v != -1; v = getNextVoiceForNote(v))
+			{
+				if (voices[v].heapPosition != -1 && (sameNoteVoice == -1 || hasHigherStealingPriority(v, sameNoteVoice)))
+					sameNoteVoice = v;
+			}
+
+			if (sameNoteVoice != -1)
+				return sameNoteVoice;
+		}
+
+		return getOldestVoice();
+	}
+
+private:
+
+	struct VoiceInfo
+	{
+		uint32 startIndex = 0;
+		int heapPosition = -1;
+		int freePosition = -1;
+		int killedPosition = -1;
+		int nextForNote = -1;
+		int prevForNote = -1;
+		int noteNumber = -1;
+		bool released = false;
+	};
+
+	void addToFreeList(int voiceIndex);
+	void removeFromFreeList(int voiceIndex);
+
+	void addToKilledList(int voiceIndex);
+	void removeFromKilledList(int voiceIndex);
+
+	void addToNoteList(int voiceIndex, int noteNumber);
+	void removeFromNoteList(int voiceIndex);
+
+	void heapInsert(int voiceIndex);
+	void heapRemove(int voiceIndex);
+	void heapSwap(int firstPosition, int secondPosition);
+	void siftUp(int position);
+	void siftDown(int position);
+
+	VoiceInfo voices[NUM_POLYPHONIC_VOICES];
+
+	int freeVoices[NUM_POLYPHONIC_VOICES];
+	int heap[NUM_POLYPHONIC_VOICES];
+	int killedVoices[NUM_POLYPHONIC_VOICES];
+	int firstVoiceForNote[128];
+
+	int numVoices = 0;
+	int numFree = 0;
+	int heapSize = 0;
+	int numKilled = 0;
+
+	uint32 startCounter = 0;
+
+	JUCE_DECLARE_NON_COPYABLE(VoiceAllocator);
+};
+
+} // namespace hise
+
+#endif  // VOICEALLOCATOR_H_INCLUDED
@@ -57,7 +57,7 @@ public:
 	{
 		DryGain = 0, ///< the gain of the unprocessed input
 		WetGain, ///< the gain of the convoluted input
-		Latency, ///< you can change the latency (unused)
+		Latency, ///< the block size of the first background stage (0 = automatic). Lower values render more of the impulse response on the worker threads, higher values on the audio thread.
 		ImpulseLength, ///< the Impulse length (deprecated, use the SampleArea of the AudioSampleBufferComponent to change the impulse response)
 		ProcessInput, ///< if this attribute is set, the engine will fade out in a short time and reset itself.
 		UseBackgroundThread, ///< if true, then the tail of the impulse response will be rendered on a background thread to save cycles on the audio thread.
@@ -244,6 +244,8 @@ public:
 
 	WaveSynth(MainController *mc, const String &id, int numVoices);;
 
+	bool supportsParallelVoiceRendering() const override { return true; }
+
 	void restoreFromValueTree(const ValueTree &v) override;;
 
 	ValueTree exportAsValueTree() const override;
@@ -227,6 +227,8 @@ void ModulatorSampler::setReversed(bool shouldBeReversed)
                 sound->setReversed(shouldBeReversed);
             }
 
+            // Reversed sounds can't be played from the mapped monolith
+            s->refreshMappedStreamingState();
             s->refreshMemoryUsage();
 
             return SafeFunctionCall::OK;
@@ -434,6 +436,9 @@ void ModulatorSampler::restoreFromValueTree(const ValueTree &v)
 
 	setTimestretchOptions(newOptions);
 
+	setInterpolationMode(SamplerInterpolation::getModeFromName(v.getProperty("InterpolationMode", "").toString()));
+	setAdaptivePreloadEnabled(v.getProperty("AdaptivePreload", false));
+
 	for (int i = 0; i < 8; i++)
 		loadTable(getTableUnchecked(i), "Group" + String(i) + "Table");
 
@@ -471,6 +476,12 @@ ValueTree ModulatorSampler::exportAsValueTree() const
 	if (currentTimestretchOptions)
 		v.addChild(currentTimestretchOptions.exportAsValueTree(), -1, nullptr);
 
+	if (interpolationMode != SamplerInterpolation::getDefaultMode())
+		v.setProperty("InterpolationMode", SamplerInterpolation::getModeNames()[(int)interpolationMode], nullptr);
+
+	if (adaptivePreload)
+		v.setProperty("AdaptivePreload", true, nullptr);
+
 	for (int i = 0; i < 8; i++)
 	{
 		saveTable(getTableUnchecked(i), "Group" + String(i) + "Table");
@@ -654,10 +665,39 @@ void ModulatorSampler::refreshStreamingBuffers()
 		SynthesiserVoice *v = getVoice(i);
 		static_cast<ModulatorSamplerVoice*>(v)->resetVoice();
 		static_cast<ModulatorSamplerVoice*>(v)->setLoaderBufferSize(bufferSize * preloadScaleFactor);
+		static_cast<ModulatorSamplerVoice*>(v)->setMappedStreamingOnly(mappedStreamingOnly);
 		static_cast<ModulatorSamplerVoice*>(v)->setEnablePlayFromPurge(enablePlayFromPurge);
 	}
 }
 
+void ModulatorSampler::refreshMappedStreamingState()
+{
+	jassert_processor_idle;
+
+	// If every sound can be played from the mapped monolith, the streaming buffers of the voices can be shrunk
+	bool allSoundsMapped = getNumSounds() > 0;
+
+	ModulatorSampler::SoundIterator mappedIter(this);
+
+	while (auto sound = mappedIter.getNextSound())
+	{
+		for (int j = 0; j < getNumMicPositions(); j++)
+		{
+			auto s = sound->getReferenceToSound(j);
+
+			if (s != nullptr && !s->isPurged() && !s->isEntireSampleLoaded())
+				allSoundsMapped &= s->canStreamFromMappedData();
+		}
+	}
+
+	if (allSoundsMapped != mappedStreamingOnly)
+	{
+		mappedStreamingOnly = allSoundsMapped;
+		refreshStreamingBuffers();
+		refreshMemoryUsage();
+	}
+}
+
 void ModulatorSampler::deleteSound(int index)
 {
 	if (auto s = getSound(index))
@@ -821,8 +861,11 @@ void ModulatorSampler::refreshMemoryUsage(bool fastMode)
         }
 	}
 
+	// the buffers are shrunk to the minimum size if every sound is played from the mapped monolith
+	const int64 bufferSizeToUse = mappedStreamingOnly ? (int64)getLargestBlockSize() * MAX_SAMPLER_PITCH : (int64)bufferSize;
+
 	const int64 streamBufferSizePerVoice = 2 *				// two buffers
-		bufferSize *		// buffer size per buffer
+		bufferSizeToUse *		// buffer size per buffer
 		(sampleMap->isMonolith() ? 2 : 4) *  // bytes per sample
 		2 * numChannels;				// number of channels
 
@@ -877,6 +920,7 @@ void ModulatorSampler::setVoiceAmountInternal()
 			}
 
 			static_cast<ModulatorSamplerVoice*>(getVoice(i))->setTimestretchOptions(currentTimestretchOptions);
+			static_cast<ModulatorSamplerVoice*>(getVoice(i))->setInterpolationMode(interpolationMode);
 		};
 	}
 
@@ -1047,6 +1091,29 @@ void ModulatorSampler::setTimestretchOptions(const TimestretchOptions& newOption
 	killAllVoicesAndCall(f, true);
 }
 
+void ModulatorSampler::setInterpolationMode(SamplerInterpolation::Mode newMode)
+{
+	if (newMode == interpolationMode)
+		return;
+
+	interpolationMode = newMode;
+
+	if (interpolationMode == SamplerInterpolation::Mode::Sinc)
+		SamplerInterpolation::initialiseSincTable();
+
+	auto f = [](Processor* p)
+	{
+		auto s = static_cast<ModulatorSampler*>(p);
+
+		for (auto v : s->voices)
+			dynamic_cast<ModulatorSamplerVoice*>(v)->setInterpolationMode(s->interpolationMode);
+
+		return SafeFunctionCall::OK;
+	};
+
+	killAllVoicesAndCall(f, true);
+}
+
 double ModulatorSampler::getCurrentTimestretchRatio() const
 {
 	if (currentTimestretchOptions.mode == TimestretchOptions::TimestretchMode::Disabled)
@@ -1792,6 +1859,19 @@ bool ModulatorSampler::preloadAllSamples()
 
 	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
 
+	StreamingSamplerSound::PreloadTimings timings;
+	const auto startTime = Time::getMillisecondCounterHiRes();
+
+	const auto throughput = threadPool->getThroughputStats();
+	adaptivePreloadMemorySaved.store(0);
+
+#if HISE_USE_PARALLEL_PRELOADING
+	std::vector<PreloadTask> tasks;
+	tasks.reserve((size_t)numToLoad);
+
+	const auto focusKeys = getPreloadFocusKeys();
+#endif
+
 	while (auto sound = sIter.getNextSound())
 	{
 		if (threadPool->threadShouldExit())
@@ -1799,39 +1879,68 @@ bool ModulatorSampler::preloadAllSamples()
 
 		sound->checkFileReference();
 
-		if (getNumMicPositions() == 1)
-		{
-			auto s = sound->getReferenceToSound().get();
+		const auto keyPitchRatio = adaptivePreload ? sound->getMaxPitchRatio() : 1.0;
 
-			progress = (double)currentIndex++ / (double)numToLoad;
+#if HISE_USE_PARALLEL_PRELOADING
+		const auto priority = getPreloadPriority(sound.get(), focusKeys);
+#endif
 
-			if (!preloadSample(s, preloadSizeToUse))
-				return false;
-		}
-		else
+		for (int j = 0; j < getNumMicPositions(); j++)
 		{
-			for (int j = 0; j < getNumMicPositions(); j++)
+			const bool isEnabled = getNumMicPositions() == 1 || getChannelData(j).enabled;
+
+			if (auto s = sound->getReferenceToSound(j))
 			{
-				const bool isEnabled = getChannelData(j).enabled;
+				if (isEnabled)
+				{
+#if HISE_USE_PARALLEL_PRELOADING
+					tasks.push_back({ s, priority, keyPitchRatio });
+#else
+					progress = (double)currentIndex++ / (double)numToLoad;
 
-				progress = (double)currentIndex++ / (double)numToLoad;
+					const auto sizeForSound = getPreloadSizeForSound(s.get(), keyPitchRatio, preloadSizeToUse, throughput);
 
-				if (auto s = sound->getReferenceToSound(j))
-				{
-					if (isEnabled)
-					{
-						if (!preloadSample(s.get(), preloadSizeToUse))
-							return false;
-					}
-					else
-						s->setPurged(true);
+					if (!preloadSample(s.get(), sizeForSound, &timings))
+						return false;
+
+					addAdaptivePreloadSaving(s.get(), preloadSizeToUse, sizeForSound);
+#endif
+					continue;
 				}
+				else
+					s->setPurged(true);
 			}
+
+			progress = (double)currentIndex++ / (double)numToLoad;
 		}
 
+#if !HISE_USE_PARALLEL_PRELOADING
 		sound->setReversed(isReversed);
+#endif
 	}
 
+#if HISE_USE_PARALLEL_PRELOADING
+	if (!preloadSamplesInParallel(tasks, preloadSizeToUse, throughput, currentIndex, numToLoad, timings))
+		return false;
+
+	ModulatorSampler::SoundIterator reverseIter(this);
+
+	while (auto sound = reverseIter.getNextSound())
+		sound->setReversed(isReversed);
+#endif
+
+	String preloadInfo;
+	preloadInfo << "Preloaded " << String(timings.getNumSounds()) << " samples in " << String(Time::getMillisecondCounterHiRes() - startTime, 1) << " ms";
+	preloadInfo << " (" << timings.toString() << ")";
+
+	if (adaptivePreload)
+		preloadInfo << "\nAdaptive preloading saved " << String((double)adaptivePreloadMemorySaved.load() / 1024.0 / 1024.0, 1) << " MB";
+
+	debugToConsole(this, preloadInfo);
+	getMainController()->getSampleManager().setCurrentPreloadMessage(getId() + ": " + timings.toString());
+
+	refreshMappedStreamingState();
+
 	refreshMemoryUsage();
 	setShouldUpdateUI(true);
 	setHasPendingSampleLoad(false);
@@ -1841,34 +1950,234 @@ bool ModulatorSampler::preloadAllSamples()
 }
 
 
-bool ModulatorSampler::preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse)
+bool ModulatorSampler::preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse, StreamingSamplerSound::PreloadTimings* timings)
 {
 	jassert(s != nullptr);
 
-	String fileName = s->getFileName(false);
-
 	try
 	{
-		s->setPreloadSize(s->hasActiveState() ? preloadSizeToUse : 0, true);
+		s->setPreloadSize(s->hasActiveState() ? preloadSizeToUse : 0, true, timings);
 		s->closeFileHandle();
 		return true;
 	}
 	catch (StreamingSamplerSound::LoadingError l)
 	{
-		String x;
-		x << "Error at preloading sample " << l.fileName << ": " << l.errorDescription;
-		getMainController()->getDebugLogger().logMessage(x);
+		reportPreloadError(l);
+		return false;
+	}
+}
+
+void ModulatorSampler::reportPreloadError(const StreamingSamplerSound::LoadingError& l)
+{
+	String x;
+	x << "Error at preloading sample " << l.fileName << ": " << l.errorDescription;
+	getMainController()->getDebugLogger().logMessage(x);
 
 #if USE_FRONTEND
-		getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, x);
+	getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, x);
 #else
-		debugError(this, x);
+	debugError(this, x);
 #endif
+}
 
-		return false;
+void ModulatorSampler::setAdaptivePreloadEnabled(bool shouldBeEnabled)
+{
+	if (adaptivePreload == shouldBeEnabled)
+		return;
+
+	adaptivePreload = shouldBeEnabled;
+
+	if (adaptivePreload)
+		adaptivePreloadUpdater.reset(new AdaptivePreloadUpdater(*this));
+	else
+	{
+		adaptivePreloadUpdater = nullptr;
+		adaptivePreloadMemorySaved.store(0);
+	}
+
+	if (getNumSounds() != 0)
+		refreshPreloadSizes();
+}
+
+int ModulatorSampler::getPreloadSizeForSound(StreamingSamplerSound* s, double keyPitchRatio, int staticPreloadSize, const SampleThreadPool::ThroughputStats& throughput)
+{
+	if (!adaptivePreload || staticPreloadSize <= 0)
+		return staticPreloadSize;
+
+	const auto sampleRate = getSampleRate();
+
+	if (sampleRate <= 0.0)
+		return staticPreloadSize;
+
+	const auto fileSampleRate = s->getSampleRate();
+	const auto sampleRateRatio = fileSampleRate > 0.0 ? fileSampleRate / sampleRate : 1.0;
+	const auto maxPitchRatio = jlimit(1.0, (double)MAX_SAMPLER_PITCH, keyPitchRatio * sampleRateRatio);
+
+	const int bytesPerFrame = 2 * (s->isMonolithic() ? (int)sizeof(int16) : (int)sizeof(float));
+	const int numWorkers = getMainController()->getSampleManager().getGlobalSampleThreadPool()->getNumWorkerThreads();
+
+	auto minSize = throughput.getMinimumPreloadSize(bufferSize, bytesPerFrame, sampleRate, maxPitchRatio, realVoiceAmount, numWorkers, getLargestBlockSize());
+
+	// Use the static preload size until we have enough measurements
+	if (minSize < 0)
+		return staticPreloadSize;
+
+	// Don't let a few slow reads (eg. a cold disk cache) grow the preload buffers without limit
+	return jlimit(MinAdaptivePreloadSize, staticPreloadSize * 4, minSize);
+}
+
+int64 ModulatorSampler::getEstimatedPreloadBytes(const StreamingSamplerSound* s, int preloadSize)
+{
+	if (preloadSize == 0)
+		return 0;
+
+	const auto numSamples = jmin((int64)s->getSampleLength(), (int64)jmax(2048, preloadSize + s->getSampleStartModulation()));
+	const int bytesPerSample = s->isMonolithic() ? (int)sizeof(int16) : (int)sizeof(float);
+
+	return numSamples * (s->isStereo() ? 2 : 1) * bytesPerSample;
+}
+
+void ModulatorSampler::addAdaptivePreloadSaving(const StreamingSamplerSound* s, int staticPreloadSize, int usedPreloadSize)
+{
+	if (staticPreloadSize == usedPreloadSize || !s->hasActiveState())
+		return;
+
+	const auto delta = getEstimatedPreloadBytes(s, staticPreloadSize) - getEstimatedPreloadBytes(s, usedPreloadSize);
+	adaptivePreloadMemorySaved.fetch_add(delta);
+}
+
+ModulatorSampler::AdaptivePreloadUpdater::AdaptivePreloadUpdater(ModulatorSampler& s) :
+	sampler(s)
+{
+	startTimer(UpdateIntervalMilliseconds);
+}
+
+void ModulatorSampler::AdaptivePreloadUpdater::timerCallback()
+{
+	auto pool = sampler.getMainController()->getSampleManager().getGlobalSampleThreadPool();
+	const auto stats = pool->getThroughputStats();
+
+	const auto sampleRate = sampler.getSampleRate();
+
+	if (sampleRate <= 0.0 || sampler.getNumSounds() == 0)
+		return;
+
+	// Use the size of a sound that is played at the original pitch as reference
+	const auto currentSize = stats.getMinimumPreloadSize(sampler.bufferSize, 2 * sizeof(float), sampleRate, 1.0, sampler.realVoiceAmount, pool->getNumWorkerThreads(), sampler.getLargestBlockSize());
+
+	if (currentSize <= 0)
+		return;
+
+	int64 numMissedDeadlines = 0;
+
+	for (int i = 0; i < pool->getNumWorkerThreads(); i++)
+		numMissedDeadlines += pool->getWorkerStats(i).numMissedDeadlines;
+
+	const bool missedDeadlines = numMissedDeadlines > lastNumMissedDeadlines;
+	lastNumMissedDeadlines = numMissedDeadlines;
+
+	// The samples were loaded with the static preload size until there were enough measurements
+	const auto ratio = lastAppliedSize != 0 ? (double)currentSize / (double)lastAppliedSize : 0.0;
+
+	// Only reload if the requirement changed significantly and the sampler isn't playing
+	const bool shouldUpdate = lastAppliedSize == 0 || ratio > 1.25 || ratio < 0.75 || (missedDeadlines && ratio > 1.0);
+
+	if (shouldUpdate && sampler.getNumActiveVoices() == 0 && !sampler.hasPendingSampleLoad())
+	{
+		lastAppliedSize = currentSize;
+		sampler.refreshPreloadSizes();
 	}
 }
 
+Range<int> ModulatorSampler::getPreloadFocusKeys() const
+{
+	// We don't know how wide the keyboard is, so just assume four octaves from the lowest visible key
+	auto lowestKey = jlimit(0, 127, const_cast<MainController*>(getMainController())->getKeyboardState().getLowestKeyToDisplay());
+	return Range<int>(lowestKey, jmin(128, lowestKey + 48));
+}
+
+int ModulatorSampler::getPreloadPriority(ModulatorSamplerSound* sound, Range<int> focusKeys)
+{
+	auto noteRange = sound->getNoteRange();
+	auto velocityRange = sound->getVelocityRange();
+
+	int keyDistance = 0;
+
+	if (!noteRange.intersects(focusKeys))
+	{
+		keyDistance = noteRange.getStart() >= focusKeys.getEnd() ? noteRange.getStart() - focusKeys.getEnd() + 1
+															   : focusKeys.getStart() - noteRange.getEnd() + 1;
+	}
+
+	int velocityDistance = 0;
+
+	if (!velocityRange.contains(64))
+		velocityDistance = velocityRange.getStart() > 64 ? velocityRange.getStart() - 64 : 64 - velocityRange.getEnd() + 1;
+
+	const int rrGroup = jlimit(0, 255, sound->getRRGroup() - 1);
+
+	// Visible keys first, then the velocity layers around the middle, then the key distance and the RR group
+	return ((keyDistance > 0 ? 1 : 0) << 24) | (jlimit(0, 127, velocityDistance) << 16) | (jlimit(0, 127, keyDistance) << 8) | rrGroup;
+}
+
+bool ModulatorSampler::preloadSamplesInParallel(std::vector<PreloadTask>& tasks, int preloadSizeToUse, const SampleThreadPool::ThroughputStats& throughput, int numAlreadyLoaded, int numToLoad, StreamingSamplerSound::PreloadTimings& timings)
+{
+	std::stable_sort(tasks.begin(), tasks.end(), [](const PreloadTask& a, const PreloadTask& b)
+	{
+		return a.priority < b.priority;
+	});
+
+	auto& progress = getMainController()->getSampleManager().getPreloadProgress();
+	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
+
+	std::atomic<int> numLoaded = { numAlreadyLoaded };
+	std::atomic<bool> cancelled = { false };
+
+	SpinLock errorLock;
+	std::unique_ptr<StreamingSamplerSound::LoadingError> error;
+
+	// The HLAC decoder threads are idle while we're preloading, so we can borrow them here
+	SharedResourcePointer<hlac::ParallelBlockDecodingPool> loadingPool;
+
+	loadingPool->processChunks((int)tasks.size(), [&](int taskIndex)
+	{
+		if (cancelled.load() || threadPool->threadShouldExit())
+		{
+			cancelled.store(true);
+			return;
+		}
+
+		const auto& t = tasks[(size_t)taskIndex];
+		auto s = t.sound.get();
+
+		try
+		{
+			const auto sizeForSound = getPreloadSizeForSound(s, t.keyPitchRatio, preloadSizeToUse, throughput);
+
+			s->setPreloadSize(s->hasActiveState() ? sizeForSound : 0, true, &timings);
+			s->closeFileHandle();
+
+			addAdaptivePreloadSaving(s, preloadSizeToUse, sizeForSound);
+		}
+		catch (StreamingSamplerSound::LoadingError& l)
+		{
+			SpinLock::ScopedLockType sl(errorLock);
+
+			if (error == nullptr)
+				error.reset(new StreamingSamplerSound::LoadingError(l));
+
+			cancelled.store(true);
+		}
+
+		progress = (double)(++numLoaded) / (double)numToLoad;
+	});
+
+	if (error != nullptr)
+		reportPreloadError(*error);
+
+	return !cancelled.load();
+}
+
 ModulatorSampler::ScopedUpdateDelayer::ScopedUpdateDelayer(ModulatorSampler* s) :
 	sampler(s),
 	prevValue(s->delayUpdate)
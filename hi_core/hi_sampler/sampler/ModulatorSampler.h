@@ -370,6 +370,12 @@ public:
 	/** This resets the streaming buffer size of the voices. Call this whenever you change the voice amount. */
 	void refreshStreamingBuffers();
 
+	/** Checks whether all sounds can be played from the memory mapped monolith and resizes the streaming buffers if that changed.
+	*
+	*	Call this whenever a sound property changes that affects StreamingSamplerSound::canStreamFromMappedData().
+	*/
+	void refreshMappedStreamingState();
+
 	/** Deletes the sound from the sampler.
 	*
 	*	It removes the sound from the sampler and if no reference is left in the global sample pool deletes the sample and frees the storage.
@@ -484,7 +490,7 @@ public:
 	/** This function will be called on a background thread and preloads all samples. */
 	bool preloadAllSamples();
 
-	bool preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse);
+	bool preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse, StreamingSamplerSound::PreloadTimings* timings=nullptr);
 
 	bool saveSampleMap() const;
 
@@ -750,6 +756,25 @@ public:
 
 	double getCurrentTimestretchRatio() const;
 
+	/** Sets the resampling algorithm of all voices. This kills all voices. */
+	void setInterpolationMode(SamplerInterpolation::Mode newMode);
+
+	SamplerInterpolation::Mode getInterpolationMode() const noexcept { return interpolationMode; }
+
+	/** Enables the adaptive preloading.
+	*
+	*	If enabled, the preload size of each sound is calculated from the measured disk performance, the buffer size,
+	*	the voice amount and the maximum pitch ratio of the sound. The sizes are updated in the background if the
+	*	disk performance changes (but only if no voice is playing). The PreloadSize attribute is used until there are
+	*	enough measurements and the adaptive size will never exceed four times this value.
+	*/
+	void setAdaptivePreloadEnabled(bool shouldBeEnabled);
+
+	bool isAdaptivePreloadEnabled() const noexcept { return adaptivePreload; }
+
+	/** Returns the amount of bytes that the adaptive preloading saved compared to the static preload size. This can be negative if it needs more memory. */
+	int64 getMemorySavedByAdaptivePreload() const noexcept { return adaptivePreloadMemorySaved.load(); }
+
 	PolyHandler& getSyncVoiceHandler() { return syncVoiceHandler; }
 	
 private:
@@ -763,6 +788,11 @@ private:
 
 	TimestretchOptions timestretchOptions;
 
+	SamplerInterpolation::Mode interpolationMode = SamplerInterpolation::getDefaultMode();
+
+	// true if all sounds are played directly from the memory mapped monolith
+	bool mappedStreamingOnly = false;
+
 	int lockVelocity = -1;
 	int lockRRGroup = -1;
 
@@ -784,6 +814,50 @@ private:
 		return !getMainController()->getKillStateHandler().isAudioRunning();
 	}
 
+	struct PreloadTask
+	{
+		StreamingSamplerSound::Ptr sound;
+		int priority;
+		double keyPitchRatio;
+	};
+
+	/** Reloads the preload buffers if the measured disk performance changes. */
+	struct AdaptivePreloadUpdater : public Timer
+	{
+		AdaptivePreloadUpdater(ModulatorSampler& s);
+
+		void timerCallback() override;
+
+		static constexpr int UpdateIntervalMilliseconds = 5000;
+
+		ModulatorSampler& sampler;
+		int lastAppliedSize = 0;
+		int64 lastNumMissedDeadlines = 0;
+	};
+
+	static constexpr int MinAdaptivePreloadSize = 4096;
+
+	int getPreloadSizeForSound(StreamingSamplerSound* s, double keyPitchRatio, int staticPreloadSize, const SampleThreadPool::ThroughputStats& throughput);
+
+	static int64 getEstimatedPreloadBytes(const StreamingSamplerSound* s, int preloadSize);
+
+	void addAdaptivePreloadSaving(const StreamingSamplerSound* s, int staticPreloadSize, int usedPreloadSize);
+
+	bool adaptivePreload = false;
+	std::atomic<int64> adaptivePreloadMemorySaved = { 0 };
+	std::unique_ptr<AdaptivePreloadUpdater> adaptivePreloadUpdater;
+
+	void reportPreloadError(const StreamingSamplerSound::LoadingError& l);
+
+	/** Returns the key range that is visible on the keyboard. Sounds in this range are preloaded first. */
+	Range<int> getPreloadFocusKeys() const;
+
+	/** Returns a sort key for the preloading order (lower values are loaded first). */
+	static int getPreloadPriority(ModulatorSamplerSound* sound, Range<int> focusKeys);
+
+	/** Preloads the given sounds on multiple threads in the order of their priority. */
+	bool preloadSamplesInParallel(std::vector<PreloadTask>& tasks, int preloadSizeToUse, const SampleThreadPool::ThroughputStats& throughput, int numAlreadyLoaded, int numToLoad, StreamingSamplerSound::PreloadTimings& timings);
+
 	
 
 
@@ -1852,6 +1852,9 @@ void SampleMap::Notifier::handleHeavyweightPropertyChangesIdle(Array<AsyncProper
 		}
 	}
 
+	if (!changesThisTime.isEmpty())
+		parent.getSampler()->refreshMappedStreamingState();
+
 	MessageManager::callAsync([changesThisTime, this]()
 	{
 		for (const auto& c : changesThisTime)
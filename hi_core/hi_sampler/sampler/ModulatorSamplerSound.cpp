@@ -781,9 +781,15 @@ void ModulatorSamplerSound::updateInternalData(const Identifier& id, const var&
 		{
 			auto s = refPtr.get();
 
-			if(s != nullptr)
+			if (s != nullptr)
+			{
 				s->updateAsyncInternalData(id, newValue);
 
+				// The loop, sample range or purge state decide whether the sound can be played from the mapped monolith
+				if (auto sampler = s->parentMap != nullptr ? s->parentMap->getSampler() : nullptr)
+					sampler->refreshMappedStreamingState();
+			}
+
 			return SafeFunctionCall::OK;
 		};
 
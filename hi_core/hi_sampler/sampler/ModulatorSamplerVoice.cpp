@@ -213,7 +213,13 @@ void ModulatorSamplerVoice::calculateBlock(int startSample, int numSamples)
 
 	getOwnerSynth()->effectChain->renderVoice(voiceIndex, voiceBuffer, startIndex, samplesInBlock);
 
-	if (auto modValues = getOwnerSynth()->getVoiceGainValues())
+	auto gainRamp = getOwnerSynth()->getVoiceGainRamp();
+
+	if (gainRamp.isLinear() && gainRamp.numSamples == samplesInBlock)
+	{
+		voiceBuffer.applyGainRamp(startIndex, samplesInBlock, gainRamp.startValue, gainRamp.getEndValue());
+	}
+	else if (auto modValues = getOwnerSynth()->getVoiceGainValues())
 	{
 		FloatVectorOperations::multiply(voiceBuffer.getWritePointer(0, startIndex), modValues + startIndex, samplesInBlock);
 		FloatVectorOperations::multiply(voiceBuffer.getWritePointer(1, startIndex), modValues + startIndex, samplesInBlock);
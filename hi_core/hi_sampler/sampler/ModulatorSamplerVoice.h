@@ -123,6 +123,16 @@ public:
 		wrappedVoice.setTimestretchRatio(r);
 	}
 
+	virtual void setInterpolationMode(SamplerInterpolation::Mode m)
+	{
+		wrappedVoice.setInterpolationMode(m);
+	}
+
+	virtual void setMappedStreamingOnly(bool shouldBeMappedOnly)
+	{
+		wrappedVoice.loader.setMappedStreamingOnly(shouldBeMappedOnly);
+	}
+
 protected:
 
 	struct PlayFromPurger : public SampleThreadPool::Job
@@ -227,6 +237,18 @@ public:
 			v->setTimestretchRatio(ratio);
 	}
 
+	void setInterpolationMode(SamplerInterpolation::Mode m) override
+	{
+		for (auto v : wrappedVoices)
+			v->setInterpolationMode(m);
+	}
+
+	void setMappedStreamingOnly(bool shouldBeMappedOnly) override
+	{
+		for (auto v : wrappedVoices)
+			v->loader.setMappedStreamingOnly(shouldBeMappedOnly);
+	}
+
 private:
 
 	OwnedArray<StreamingSamplerVoice> wrappedVoices;
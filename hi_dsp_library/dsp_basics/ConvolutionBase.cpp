@@ -161,6 +161,15 @@ double MultithreadedConvolver::getResampleFactor(double sampleRate, double impul
 	}
 }
 
+int MultithreadedConvolver::getFirstTailBlockSize(int headSize, int latency)
+{
+	if (latency > 0)
+		return jmax(headSize, nextPowerOfTwo(latency));
+
+	// a few head blocks, but keep the audio thread work and the shortest deadline reasonable
+	return jlimit(jmax(headSize, 1024), jmax(headSize, 8192), headSize * 8);
+}
+
 MultithreadedConvolver::Ptr ConvolutionEffectBase::createNewEngine(audiofft::ImplementationType fftType)
 {
     MultithreadedConvolver::Ptr newConvolver = new MultithreadedConvolver(fftType);
@@ -613,7 +622,7 @@ bool ConvolutionEffectBase::reloadInternal()
 		applyHighFrequencyDamping(scratchBuffer, resampledLength, cutoffFrequency, sampleRate);
 
 	headSize = nextPowerOfTwo(headSize);
-	const auto fullTailLength = jmax(headSize, nextPowerOfTwo(resampledLength - headSize));
+	const auto firstTailBlockSize = MultithreadedConvolver::getFirstTailBlockSize(headSize, latency);
 
 	MultithreadedConvolver::Ptr s1, s2;
 
@@ -633,8 +642,13 @@ bool ConvolutionEffectBase::reloadInternal()
 
 	s1 = createNewEngine(currentType);
 	s2 = createNewEngine(currentType);
-	s1->init(headSize, jmin<int>(8192, fullTailLength), scratchBuffer.getReadPointer(0), resampledLength);
-	s2->init(headSize, jmin<int>(8192, fullTailLength), scratchBuffer.getReadPointer(1), resampledLength);
+
+	// Warm up the engines on this thread, the worker queues only accept jobs from the audio thread
+	s1->setUseBackgroundThread(nullptr);
+	s2->setUseBackgroundThread(nullptr);
+
+	s1->init(headSize, firstTailBlockSize, scratchBuffer.getReadPointer(0), resampledLength);
+	s2->init(headSize, firstTailBlockSize, scratchBuffer.getReadPointer(1), resampledLength);
 
     s1->cleanPipeline();
     s2->cleanPipeline();
@@ -646,6 +660,10 @@ bool ConvolutionEffectBase::reloadInternal()
     scratchBuffer.clear();
     
     s2->process(scratchBuffer.getReadPointer(0), scratchBuffer.getWritePointer(1), jmin(scratchBuffer.getNumSamples(), 2048));
+
+	auto tToUse = useBackgroundThread && !nonRealtime ? &backgroundThread : nullptr;
+	s1->setUseBackgroundThread(tToUse);
+	s2->setUseBackgroundThread(tToUse);
     
     
 	{
@@ -106,20 +106,124 @@ private:
 	Smoother smoother;
 };
 
-class MultithreadedConvolver : public fftconvolver::TwoStageFFTConvolver,
+class MultithreadedConvolver : public fftconvolver::MultiStageFFTConvolver,
                                public ReferenceCountedObject
 {
 public:
     
     using Ptr = ReferenceCountedObjectPtr<MultithreadedConvolver>;
     
+	/** A pool of worker threads that render the tail stages of the convolvers.
+
+		There is only one pool that is shared by all convolution effects, so the number of threads
+		doesn't grow with the number of effects. Every worker has its own queue and a new job is pushed
+		to the worker with the least pending work, so that a small stage with a short deadline doesn't
+		have to wait until a large stage is rendered.
+	*/
+	class WorkerPool
+	{
+	public:
+
+		struct Job
+		{
+			MultithreadedConvolver::Ptr convolver;
+			std::atomic<int>* numPendingJobs = nullptr;
+			int stageIndex = -1;
+			int workload = 0;
+		};
+
+		class Worker : public Thread
+		{
+		public:
+
+			Worker(int index) :
+			  Thread("Convolution Worker " + String(index + 1)),
+			  queue(512)
+			{}
+
+			~Worker()
+			{
+				stopThread(1000);
+				queue.callForEveryElementInQueue([](Job&) { return true; });
+			}
+
+			void run() override
+			{
+				while (!threadShouldExit())
+				{
+					queue.callForEveryElementInQueue([this](Job& j)
+					{
+						if (threadShouldExit())
+							return false;
+
+						j.convolver->doBackgroundProcessing((size_t)j.stageIndex);
+						j.convolver->pending[j.stageIndex].store(false);
+						pendingWork -= j.workload;
+
+						// Release the convolver before the owner is notified, it might be deleted right after that
+						j.convolver = nullptr;
+						j.numPendingJobs->fetch_sub(1);
+
+						return true;
+					});
+
+					wait(500);
+				}
+			}
+
+			std::atomic<int> pendingWork = { 0 };
+			hise::LockfreeQueue<Job> queue;
+		};
+
+		WorkerPool()
+		{
+			for (int i = 0; i < HISE_NUM_CONVOLUTION_THREADS; i++)
+				workers.add(new Worker(i));
+		}
+
+		void startIfNotRunning()
+		{
+			ScopedLock sl(startLock);
+
+			for (auto w : workers)
+			{
+				if (!w->isThreadRunning())
+					w->startThread(10);
+			}
+		}
+
+		void addJob(const Job& j)
+		{
+			// The queues have a single producer, but the effects might be processed on different threads
+			SpinLock::ScopedLockType sl(pushLock);
+
+			Worker* bestWorker = nullptr;
+
+			for (auto w : workers)
+			{
+				if (bestWorker == nullptr || w->pendingWork.load() < bestWorker->pendingWork.load())
+					bestWorker = w;
+			}
+
+			bestWorker->pendingWork += j.workload;
+			bestWorker->queue.push(j);
+			bestWorker->notify();
+		}
+
+	private:
+
+		CriticalSection startLock;
+		SpinLock pushLock;
+		OwnedArray<Worker> workers;
+	};
+
+	/** Sends the tail stages of its convolvers to the shared WorkerPool and deletes the unused convolvers. */
 	class BackgroundThread : public Thread
 	{
 	public:
 
 		BackgroundThread() :
-          Thread("Convolution Background Thread"),
-          queue(512)
+          Thread("Convolution Background Thread")
 		{}
 
         ~BackgroundThread()
@@ -128,29 +232,16 @@ public:
             jassert(numRegisteredConvolvers == 0);
             
             stopThread(1000);
-            queue.callForEveryElementInQueue({});
-            
+
+			// the workers are shared, so wait until they are done with the jobs of this thread
+			while (isBusy())
+				Thread::sleep(1);
         }
         
 		void run() override
 		{
 			while (!threadShouldExit())
 			{
-                {
-                    ScopedValueSetter<bool> svs(currentlyRendering, true);
-                    
-                    queue.callForEveryElementInQueue([this](MultithreadedConvolver::Ptr c)
-                    {
-                        if (threadShouldExit())
-                            return false;
-                        
-                        c->doBackgroundProcessing();
-                        c->pending.store(false);
-                        
-                        return true;
-                    });
-                }
-                
                 ReferenceCountedArray<MultithreadedConvolver> copy;
                 
                 if(!soonToBeDeleted.isEmpty())
@@ -165,10 +256,25 @@ public:
 			}
 		};
 
-        void addConvolverJob(MultithreadedConvolver::Ptr c)
+		/** Starts this thread and the workers if they are not running yet. */
+		void startIfNotRunning()
+		{
+			if (!isThreadRunning())
+				startThread(10);
+
+			workerPool->startIfNotRunning();
+		}
+
+        void addConvolverJob(MultithreadedConvolver::Ptr c, int stageIndex)
         {
-            queue.push(c);
-            notify();
+			WorkerPool::Job j;
+			j.convolver = c;
+			j.numPendingJobs = &numPendingJobs;
+			j.stageIndex = stageIndex;
+			j.workload = (int)c->getTailWorkload((size_t)stageIndex);
+
+			numPendingJobs++;
+			workerPool->addJob(j);
         }
         
         void addConvolverToBeDeleted(MultithreadedConvolver::Ptr c)
@@ -177,12 +283,13 @@ public:
             soonToBeDeleted.add(c);
         }
         
-		bool isBusy() const { return currentlyRendering; }
-		bool currentlyRendering = false;
+		/** Returns true if a worker still renders a job of this thread. */
+		bool isBusy() const { return numPendingJobs.load() > 0; }
 		
         int numRegisteredConvolvers = 0;
         
-        hise::LockfreeQueue<MultithreadedConvolver::Ptr> queue;
+		SharedResourcePointer<WorkerPool> workerPool;
+		std::atomic<int> numPendingJobs = { 0 };
         
         SpinLock deleteLock;
         
@@ -193,36 +300,39 @@ public:
 public:
 
 	MultithreadedConvolver(audiofft::ImplementationType fftType) :
-		TwoStageFFTConvolver(fftType),
+		MultiStageFFTConvolver(fftType),
 		backgroundThread(nullptr)
-	{};
+	{
+		for (auto& p : pending)
+			p.store(false);
+	};
 
 	virtual ~MultithreadedConvolver()
 	{
-        jassert(!pending);
+		jassert(std::none_of(std::begin(pending), std::end(pending), [](const std::atomic<bool>& p) { return p.load(); }));
         
         if(backgroundThread != nullptr)
             backgroundThread->numRegisteredConvolvers--;
 	};
 
-	void startBackgroundProcessing() override
+	void startBackgroundProcessing(size_t stageIndex) override
 	{
-        pending.store(true);
+        pending[stageIndex].store(true);
         
 		if (backgroundThread != nullptr)
 		{
-            backgroundThread->addConvolverJob(this);
+            backgroundThread->addConvolverJob(this, (int)stageIndex);
 		}
 		else
 		{
-			doBackgroundProcessing();
-            pending.store(false);
+			doBackgroundProcessing(stageIndex);
+            pending[stageIndex].store(false);
 		}
 	}
 
-	void waitForBackgroundProcessing() override
+	void waitForBackgroundProcessing(size_t stageIndex) override
 	{
-        while (pending.load())
+        while (pending[stageIndex].load())
             jassertfalse;
 	}
 
@@ -230,6 +340,14 @@ public:
 
 	static double getResampleFactor(double sampleRate, double impulseSampleRate);
 
+	/** Returns the block size of the first tail stage for the given head size and latency setting.
+
+		The latency is the time that the first background stage has to render its block.
+		A lower value moves more of the impulse response to the worker threads, a higher
+		value renders more of it on the audio thread. Zero picks a default.
+	*/
+	static int getFirstTailBlockSize(int headSize, int latency);
+
 	void setUseBackgroundThread(BackgroundThread* newThreadToUse, bool forceUpdate = false)
 	{
 		if (backgroundThread != newThreadToUse || forceUpdate)
@@ -242,8 +360,8 @@ public:
             if(backgroundThread != nullptr)
                 backgroundThread->numRegisteredConvolvers++;
             
-            if (backgroundThread != nullptr && !backgroundThread->isThreadRunning())
-                backgroundThread->startThread(10);
+            if (backgroundThread != nullptr)
+                backgroundThread->startIfNotRunning();
         }
 	}
 
@@ -254,7 +372,7 @@ public:
 
 private:
 
-    std::atomic<bool> pending = { false };
+    std::atomic<bool> pending[MaxTailStages];
     
     BackgroundThread* backgroundThread = nullptr;
 };
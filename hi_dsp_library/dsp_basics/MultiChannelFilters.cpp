@@ -60,6 +60,79 @@ double FilterLimits::limitGain(double gain)
 	return limit(FilterLimitValues::lowGain, FilterLimitValues::highGain, gain);
 }
 
+FilterHelpers::ChannelLanes::ChannelLanes(AudioSampleBuffer& b, int startSample, int numSamples_) :
+	numChannels(jmin(b.getNumChannels(), NUM_MAX_CHANNELS)),
+	numSamples(numSamples_)
+{
+	for (int c = 0; c < numChannels; c++)
+		data[c] = b.getWritePointer(c, startSample);
+}
+
+FilterParameterRamp::FilterParameterRamp(double initialFrequency, double initialQ, double initialGain)
+{
+	setCurrentAndTargetValue(Frequency, initialFrequency);
+	setCurrentAndTargetValue(Q, initialQ);
+	setCurrentAndTargetValue(Gain, initialGain);
+
+	// the unused lane
+	setCurrentAndTargetValue(numParameters, 0.0);
+}
+
+void FilterParameterRamp::reset(double sampleRate, double rampLengthSeconds)
+{
+	jassert(sampleRate > 0 && rampLengthSeconds >= 0);
+	stepsToTarget = (int)std::floor(rampLengthSeconds * sampleRate);
+
+	for (int i = 0; i < NumLanes; i++)
+		setCurrentAndTargetValue(i, target[i]);
+}
+
+void FilterParameterRamp::setValue(Parameter p, double newValue, bool force)
+{
+	if (force)
+	{
+		setCurrentAndTargetValue(p, newValue);
+		return;
+	}
+
+	if (newValue == target[p])
+		return;
+
+	if (stepsToTarget <= 0)
+	{
+		setCurrentAndTargetValue(p, newValue);
+		return;
+	}
+
+	target[p] = newValue;
+	countdown[p] = (double)stepsToTarget;
+	delta[p] = (target[p] - current[p]) / countdown[p];
+}
+
+void FilterParameterRamp::setValueWithoutSmoothing(Parameter p, double newValue)
+{
+	setCurrentAndTargetValue(p, newValue);
+}
+
+void FilterParameterRamp::tick()
+{
+	// The countdown is stored as double so that the loop only contains
+	// double operations and can be compiled to packed SIMD instructions.
+	for (int i = 0; i < NumLanes; i++)
+	{
+		countdown[i] = jmax(0.0, countdown[i] - 1.0);
+		current[i] = countdown[i] > 0.0 ? current[i] + delta[i] : target[i];
+	}
+}
+
+void FilterParameterRamp::setCurrentAndTargetValue(int index, double newValue)
+{
+	current[index] = newValue;
+	target[index] = newValue;
+	delta[index] = 0.0;
+	countdown[index] = 0.0;
+}
+
 
 template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::setType(int newType)
@@ -77,9 +150,7 @@ void MultiChannelFilter<FilterSubType>::setSampleRate(double newSampleRate)
 {
 	sampleRate = newSampleRate;
 
-	frequency.reset(newSampleRate / 64.0, smoothingTimeSeconds);
-	q.reset(newSampleRate / 64.0, smoothingTimeSeconds);
-	gain.reset(newSampleRate / 64.0, smoothingTimeSeconds);
+	parameters.reset(newSampleRate / 64.0, smoothingTimeSeconds);
 
 	reset();
 	clearCoefficients();
@@ -106,21 +177,21 @@ template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::setFrequency(double newFrequency)
 {
 	targetFreq = FilterLimits::limitFrequency(newFrequency);
-	frequency.setValue(targetFreq, !processed);
+	parameters.setValue(FilterParameterRamp::Frequency, targetFreq, !processed);
 }
 
 template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::setQ(double newQ)
 {
 	targetQ = FilterLimits::limitQ(newQ);
-	q.setValue(targetQ, !processed);
+	parameters.setValue(FilterParameterRamp::Q, targetQ, !processed);
 }
 
 template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::setGain(double newGain)
 {
 	targetGain = FilterLimits::limitGain(newGain);
-	gain.setValue(targetGain, !processed);
+	parameters.setValue(FilterParameterRamp::Gain, targetGain, !processed);
 }
 
 template <class FilterSubType>
@@ -190,9 +261,9 @@ template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::reset(int unused/*=0*/)
 {
 	ignoreUnused(unused);
-	frequency.setValueWithoutSmoothing(targetFreq);
-	gain.setValueWithoutSmoothing(targetGain);
-	q.setValueWithoutSmoothing(targetQ);
+	parameters.setValueWithoutSmoothing(FilterParameterRamp::Frequency, targetFreq);
+	parameters.setValueWithoutSmoothing(FilterParameterRamp::Gain, targetGain);
+	parameters.setValueWithoutSmoothing(FilterParameterRamp::Q, targetQ);
 
 	processed = false;
 
@@ -235,6 +306,34 @@ void MultiChannelFilter<FilterSubType>::render(FilterHelpers::RenderData& r)
 	internalFilter.processSamples(r.b, r.startSample, r.numSamples);
 }
 
+template <class FilterSubType>
+void MultiChannelFilter<FilterSubType>::processBlock(AudioSampleBuffer& b, int startSample, int numSamples)
+{
+	if (numChannels != b.getNumChannels())
+		setNumChannels(b.getNumChannels());
+
+	processed = true;
+
+	while (numSamples > 0)
+	{
+		// The first frame of each chunk does the same as processFrame()...
+		if (--frameCounter <= 0)
+		{
+			frameCounter = 64;
+			updateEvery64Frame();
+		}
+
+		// ... and the next frameCounter - 1 frames will not update the coefficients.
+		auto numThisTime = jmin(frameCounter, numSamples);
+
+		internalFilter.processSamples(b, startSample, numThisTime);
+
+		frameCounter -= numThisTime - 1;
+		startSample += numThisTime;
+		numSamples -= numThisTime;
+	}
+}
+
 template <class FilterSubType>
 double MultiChannelFilter<FilterSubType>::limit(double value, double minValue, double maxValue)
 {
@@ -266,9 +365,11 @@ void MultiChannelFilter<FilterSubType>::clearCoefficients()
 template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::updateEvery64Frame()
 {
-	auto thisFreq = FilterLimits::limitFrequency(frequency.getNextValue());
-	auto thisGain = gain.getNextValue();
-	auto thisQ = FilterLimits::limitQ(q.getNextValue());
+	parameters.tick();
+
+	auto thisFreq = FilterLimits::limitFrequency(parameters.getCurrentValue(FilterParameterRamp::Frequency));
+	auto thisGain = parameters.getCurrentValue(FilterParameterRamp::Gain);
+	auto thisQ = FilterLimits::limitQ(parameters.getCurrentValue(FilterParameterRamp::Q));
 
 	dirty |= compareAndSet(currentFreq, thisFreq);
 	dirty |= compareAndSet(currentGain, thisGain);
@@ -284,13 +385,13 @@ void MultiChannelFilter<FilterSubType>::updateEvery64Frame()
 template <class FilterSubType>
 void MultiChannelFilter<FilterSubType>::update(FilterHelpers::RenderData& renderData)
 {
-	
+	parameters.tick();
 
-	const auto f = renderData.applyModValue(frequency.getNextValue());
+	const auto f = renderData.applyModValue(parameters.getCurrentValue(FilterParameterRamp::Frequency));
 
 	auto thisFreq = FilterLimits::limitFrequency(f);
-	auto thisGain = renderData.gainModValue * gain.getNextValue();
-	auto thisQ = FilterLimits::limitQ(q.getNextValue() * renderData.qModValue);
+	auto thisGain = renderData.gainModValue * parameters.getCurrentValue(FilterParameterRamp::Gain);
+	auto thisQ = FilterLimits::limitQ(parameters.getCurrentValue(FilterParameterRamp::Q) * renderData.qModValue);
 
 	dirty |= compareAndSet(currentFreq, thisFreq);
 	dirty |= compareAndSet(currentGain, thisGain);
@@ -305,9 +406,7 @@ void MultiChannelFilter<FilterSubType>::update(FilterHelpers::RenderData& render
 
 template <class FilterSubType>
 MultiChannelFilter<FilterSubType>::MultiChannelFilter() :
-	frequency(1000.0),
-	q(1.0),
-	gain(1.0),
+	parameters(1000.0, 1.0, 1.0),
 	currentFreq(1000.0),
 	currentQ(1.0),
 	currentGain(1.0)
@@ -359,7 +458,8 @@ Array<hise::FilterHelpers::CoefficientType> MoogFilterSubType::getCoefficientTyp
 
 void MoogFilterSubType::reset(int numChannels)
 {
-	memset(data, 0, sizeof(double)*numChannels * 8);
+	for (int i = 0; i < 8; i++)
+		memset(data + i * NUM_MAX_CHANNELS, 0, sizeof(double) * numChannels);
 }
 
 void MoogFilterSubType::setMode(int newMode)
@@ -387,27 +487,44 @@ void MoogFilterSubType::updateCoefficients(double sampleRate, double frequency,
 
 void MoogFilterSubType::processSamples(AudioSampleBuffer& buffer, int startSample, int numSamples)
 {
-	for (int c = 0; c < buffer.getNumChannels(); c++)
-	{
-		float* d = buffer.getWritePointer(c, startSample);
+	FilterHelpers::ChannelLanes l(buffer, startSample, numSamples);
+	l.dispatch([this, &l](auto c) { processLanes<decltype(c)::value>(l); });
+}
 
-		for (int i = 0; i < numSamples; i++)
+template <int NumChannels> void MoogFilterSubType::processLanes(FilterHelpers::ChannelLanes& l)
+{
+	const int numLanes = l.getNumLanes<NumChannels>();
+
+	// Work on local copies so that the compiler knows that the state doesn't alias the audio data.
+	double s[8][NUM_MAX_CHANNELS];
+
+	for (int i = 0; i < 8; i++)
+		memcpy(s[i], data + i * NUM_MAX_CHANNELS, sizeof(double) * numLanes);
+
+	const double inGain = 0.35013 * fss;
+
+	for (int i = 0; i < l.numSamples; i++)
+	{
+		for (int c = 0; c < numLanes; c++)
 		{
-			double input = (double)d[i];
-
-			input -= out4[c] * fb;
-			input *= 0.35013 * fss;
-			out1[c] = input + 0.3 * in1[c] + invF * out1[c];
-			in1[c] = input;
-			out2[c] = out1[c] + 0.3 * in2[c] + invF * out2[c];
-			in2[c] = out1[c];
-			out3[c] = out2[c] + 0.3 * in3[c] + invF * out3[c];
-			in3[c] = out2[c];
-			out4[c] = out3[c] + 0.3 * in4[c] + invF * out4[c];
-			in4[c] = out3[c];
-			d[i] = 2.0f * (float)out4[c];
+			double input = (double)l.data[c][i];
+
+			input -= s[Out4][c] * fb;
+			input *= inGain;
+			s[Out1][c] = input + 0.3 * s[In1][c] + invF * s[Out1][c];
+			s[In1][c] = input;
+			s[Out2][c] = s[Out1][c] + 0.3 * s[In2][c] + invF * s[Out2][c];
+			s[In2][c] = s[Out1][c];
+			s[Out3][c] = s[Out2][c] + 0.3 * s[In3][c] + invF * s[Out3][c];
+			s[In3][c] = s[Out2][c];
+			s[Out4][c] = s[Out3][c] + 0.3 * s[In4][c] + invF * s[Out4][c];
+			s[In4][c] = s[Out3][c];
+			l.data[c][i] = 2.0f * (float)s[Out4][c];
 		}
 	}
+
+	for (int i = 0; i < 8; i++)
+		memcpy(data + i * NUM_MAX_CHANNELS, s[i], sizeof(double) * numLanes);
 }
 
 void MoogFilterSubType::processFrame(float* frameData, int numChannels)
@@ -697,11 +814,6 @@ void StaticBiquadSubType::updateCoefficients(double sampleRate, double frequency
 	case ResoLow:		currentCoefficients = IIRCoefficients::makeLowPass(sampleRate, frequency, q); break;
 	default:							jassertfalse; break;
 	}
-
-	for (int i = 0; i < numChannels; i++)
-	{
-		filters[i].setCoefficients(currentCoefficients);
-	}
 }
 
 void StaticBiquadSubType::setType(int newType)
@@ -710,32 +822,79 @@ void StaticBiquadSubType::setType(int newType)
 	reset(numChannels);
 }
 
+StaticBiquadSubType::StaticBiquadSubType()
+{
+	memset(v1, 0, sizeof(float)*NUM_MAX_CHANNELS);
+	memset(v2, 0, sizeof(float)*NUM_MAX_CHANNELS);
+}
+
 void StaticBiquadSubType::reset(int numNewChannels)
 {
 	numChannels = numNewChannels;
 
-	for (int i = 0; i < numChannels; i++)
-	{
-		filters[i].reset();
-	}
+	memset(v1, 0, sizeof(float)*numChannels);
+	memset(v2, 0, sizeof(float)*numChannels);
 }
 
 void StaticBiquadSubType::processSamples(AudioSampleBuffer& b, int startSample, int numSamples)
 {
-	int channelAmount = b.getNumChannels();
+	FilterHelpers::ChannelLanes l(b, startSample, numSamples);
+	l.dispatch([this, &l](auto c) { processLanes<decltype(c)::value>(l); });
+}
+
+template <int NumChannels> void StaticBiquadSubType::processLanes(FilterHelpers::ChannelLanes& l)
+{
+	const int numLanes = l.getNumLanes<NumChannels>();
+
+	const auto c0 = currentCoefficients.coefficients[0];
+	const auto c1 = currentCoefficients.coefficients[1];
+	const auto c2 = currentCoefficients.coefficients[2];
+	const auto c3 = currentCoefficients.coefficients[3];
+	const auto c4 = currentCoefficients.coefficients[4];
 
-	for (int i = 0; i < channelAmount; i++)
+	float lv1[NUM_MAX_CHANNELS];
+	float lv2[NUM_MAX_CHANNELS];
+
+	memcpy(lv1, v1, sizeof(float)*numLanes);
+	memcpy(lv2, v2, sizeof(float)*numLanes);
+
+	for (int i = 0; i < l.numSamples; i++)
+	{
+		for (int c = 0; c < numLanes; c++)
+		{
+			auto in = l.data[c][i];
+			auto out = c0 * in + lv1[c];
+			l.data[c][i] = out;
+
+			lv1[c] = c1 * in - c3 * out + lv2[c];
+			lv2[c] = c2 * in - c4 * out;
+		}
+	}
+
+	// Same as IIRFilter::processSamples(), the state is only snapped to zero at the end of the block
+	for (int c = 0; c < numLanes; c++)
 	{
-		float* d = b.getWritePointer(i, startSample);
-		filters[i].processSamples(d, numSamples);
+		JUCE_SNAP_TO_ZERO(lv1[c]);
+		JUCE_SNAP_TO_ZERO(lv2[c]);
+		v1[c] = lv1[c];
+		v2[c] = lv2[c];
 	}
 }
 
 void StaticBiquadSubType::processFrame(float* d, int channels)
 {
+	const auto& co = currentCoefficients.coefficients;
+
 	for (int i = 0; i < channels; i++)
 	{
-		d[i] = filters[i].processSingleSampleRaw(d[i]);
+		auto in = d[i];
+		auto out = co[0] * in + v1[i];
+
+		JUCE_SNAP_TO_ZERO(out);
+
+		v1[i] = co[1] * in - co[3] * out + v2[i];
+		v2[i] = co[2] * in - co[4] * out;
+		d[i] = out;
 	}
 }
 
@@ -863,7 +1022,8 @@ juce::StringArray LadderSubType::getModes() const
 
 void LadderSubType::reset(int newNumChannels)
 {
-	memset(buf, 0, sizeof(float) * newNumChannels * 4);
+	for (int i = 0; i < 4; i++)
+		memset(buf[i], 0, sizeof(float) * newNumChannels);
 }
 
 void LadderSubType::setType(int /*t*/)
@@ -873,14 +1033,34 @@ void LadderSubType::setType(int /*t*/)
 
 void LadderSubType::processSamples(AudioSampleBuffer& b, int startSample, int numSamples)
 {
-	for (int c = 0; c < b.getNumChannels(); c++)
+	FilterHelpers::ChannelLanes l(b, startSample, numSamples);
+	l.dispatch([this, &l](auto c) { processLanes<decltype(c)::value>(l); });
+}
+
+template <int NumChannels> void LadderSubType::processLanes(FilterHelpers::ChannelLanes& l)
+{
+	const int numLanes = l.getNumLanes<NumChannels>();
+
+	float s[4][NUM_MAX_CHANNELS];
+
+	for (int i = 0; i < 4; i++)
+		memcpy(s[i], buf[i], sizeof(float) * numLanes);
+
+	for (int i = 0; i < l.numSamples; i++)
 	{
-		for (int i = 0; i < numSamples; i++)
+		for (int c = 0; c < numLanes; c++)
 		{
-			float* d = b.getWritePointer(c, i + startSample);
-			*d = processSample(*d, c);
+			const float in = l.data[c][i] - (s[3][c] * res);
+			s[0][c] = ((in - s[0][c]) * cut) + s[0][c];
+			s[1][c] = ((s[0][c] - s[1][c]) * cut) + s[1][c];
+			s[2][c] = ((s[1][c] - s[2][c]) * cut) + s[2][c];
+			s[3][c] = ((s[2][c] - s[3][c]) * cut) + s[3][c];
+			l.data[c][i] = 2.0f * s[3][c];
 		}
 	}
+
+	for (int i = 0; i < 4; i++)
+		memcpy(buf[i], s[i], sizeof(float) * numLanes);
 }
 
 void LadderSubType::processFrame(float* d, int numChannels)
@@ -903,16 +1083,14 @@ void LadderSubType::updateCoefficients(double sampleRate, double frequency, doub
 
 float LadderSubType::processSample(float input, int channel)
 {
-	float* buffer = buf[channel];
-
-	float resoclip = buffer[3];
+	float resoclip = buf[3][channel];
 
 	const float in = input - (resoclip * res);
-	buffer[0] = ((in - buffer[0]) * cut) + buffer[0];
-	buffer[1] = ((buffer[0] - buffer[1]) * cut) + buffer[1];
-	buffer[2] = ((buffer[1] - buffer[2]) * cut) + buffer[2];
-	buffer[3] = ((buffer[2] - buffer[3]) * cut) + buffer[3];
-	return 2.0f * buffer[3];
+	buf[0][channel] = ((in - buf[0][channel]) * cut) + buf[0][channel];
+	buf[1][channel] = ((buf[0][channel] - buf[1][channel]) * cut) + buf[1][channel];
+	buf[2][channel] = ((buf[1][channel] - buf[2][channel]) * cut) + buf[2][channel];
+	buf[3][channel] = ((buf[2][channel] - buf[3][channel]) * cut) + buf[3][channel];
+	return 2.0f * buf[3][channel];
 }
 
 DEFINE_MULTI_CHANNEL_FILTER(LadderSubType);
@@ -994,121 +1172,74 @@ void StateVariableFilterSubType::updateCoefficients(double sampleRate, double fr
 
 void StateVariableFilterSubType::processSamples(AudioSampleBuffer& buffer, int startSample, int numSamples)
 {
-	auto numChannels = buffer.getNumChannels();
-
-	switch (type)
-	{
-	case LP:
-	{
-		for (int c = 0; c < numChannels; c++)
-		{
-			float* d = buffer.getWritePointer(c, startSample);
-
-			for (int i = 0; i < numSamples; i++)
-			{
-				float v0 = d[i];
-				float v1z = z1_A[c];
-				float v2z = v2[c];
-				float v3 = v0 + v0z[c] - 2.0f * v2z;
-				z1_A[c] += g1 * v3 - g2 * v1z;
-				v2[c] += g3 * v3 + g4 * v1z;
-				v0z[c] = v0;
-				d[i] = v2[c];
-			}
-		}
-
-		break;
-	}
-	case BP:
-	{
-		for (int c = 0; c < numChannels; c++)
-		{
-			float* d = buffer.getWritePointer(c, startSample);
-
-			for (int i = 0; i < numSamples; i++)
-			{
-				float v0 = d[i];
-				float v1z = z1_A[c];
-				float v2z = v2[c];
-				float v3 = v0 + v0z[c] - 2.0f * v2z;
-				z1_A[c] += g1 * v3 - g2 * v1z;
-				v2[c] += g3 * v3 + g4 * v1z;
-				v0z[c] = v0;
-				d[i] = z1_A[c];
-			}
-		}
+	FilterHelpers::ChannelLanes l(buffer, startSample, numSamples);
+	l.dispatch([this, &l](auto c) { processLanes<decltype(c)::value>(l); });
+}
 
-		break;
-	}
+template <int NumChannels> void StateVariableFilterSubType::processLanes(FilterHelpers::ChannelLanes& l)
+{
+	const int numLanes = l.getNumLanes<NumChannels>();
 
-	case HP:
-	{
-		for (int c = 0; c < numChannels; c++)
-		{
-			float* d = buffer.getWritePointer(c, startSample);
+	float s0[NUM_MAX_CHANNELS];
+	float s1[NUM_MAX_CHANNELS];
+	float s2[NUM_MAX_CHANNELS];
 
-			for (int i = 0; i < numSamples; i++)
-			{
-				float v0 = d[i];
-				float v1z = z1_A[c];
-				float v2z = v2[c];
-				float v3 = v0 + v0z[c] - 2.0f * v2z;
-				z1_A[c] += g1 * v3 - g2 * v1z;
-				v2[c] += g3 * v3 + g4 * v1z;
-				v0z[c] = v0;
-				d[i] = v0 - k * z1_A[c] - v2[c];
-			}
-		}
+	memcpy(s0, v0z, sizeof(float)*numLanes);
+	memcpy(s1, z1_A, sizeof(float)*numLanes);
+	memcpy(s2, v2, sizeof(float)*numLanes);
 
-		break;
-	}
-	case FilterType::ALLPASS:
+	if (type == FilterType::ALLPASS)
 	{
-		for (int c = 0; c < numChannels; c++)
+		for (int i = 0; i < l.numSamples; i++)
 		{
-			float* d = buffer.getWritePointer(c, startSample);
-
-			for (int i = 0; i < numSamples; ++i)
+			for (int c = 0; c < numLanes; c++)
 			{
-				const float input = d[i];
-				const float HP = (input - x1 * z1_A[c] - v2[c]) * x2;
-				const float BP = HP * gCoeff + z1_A[c];
-				const float LP = BP * gCoeff + v2[c];
+				const float input = l.data[c][i];
+				const float HP = (input - x1 * s1[c] - s2[c]) * x2;
+				const float BP = HP * gCoeff + s1[c];
+				const float LP = BP * gCoeff + s2[c];
 
-				z1_A[c] = gCoeff * HP + BP;
-				v2[c] = gCoeff * BP + LP;
+				s1[c] = gCoeff * HP + BP;
+				s2[c] = gCoeff * BP + LP;
 
-				const float AP = input - (4.0f * RCoeff * BP);
-				d[i] = AP;
+				l.data[c][i] = input - (4.0f * RCoeff * BP);
 			}
 		}
-		break;
 	}
-	case NOTCH:
+	else
 	{
-		for (int c = 0; c < numChannels; c++)
+		// The other modes share the same state update and only differ in
+		// the output, so we mix the input, band and low outputs without a branch.
+		float inputGain = 0.0f, bandGain = 0.0f, lowGain = 0.0f;
+
+		switch (type)
 		{
-			float* d = buffer.getWritePointer(c, startSample);
+		case LP:	lowGain = 1.0f; break;
+		case BP:	bandGain = 1.0f; break;
+		case HP:	inputGain = 1.0f; bandGain = -k; lowGain = -1.0f; break;
+		case NOTCH: inputGain = 1.0f; bandGain = -k; break;
+		default:	jassertfalse; break;
+		}
 
-			for (int i = 0; i < numSamples; i++)
+		for (int i = 0; i < l.numSamples; i++)
+		{
+			for (int c = 0; c < numLanes; c++)
 			{
-				float v0 = d[i];
-				float v1z = z1_A[c];
-				float v2z = v2[c];
-				float v3 = v0 + v0z[c] - 2.0f * v2z;
-				z1_A[c] += g1 * v3 - g2 * v1z;
-				v2[c] += g3 * v3 + g4 * v1z;
-				v0z[c] = v0;
-				d[i] = v0 - k * z1_A[c];
+				float v0 = l.data[c][i];
+				float v1z = s1[c];
+				float v2z = s2[c];
+				float v3 = v0 + s0[c] - 2.0f * v2z;
+				s1[c] += g1 * v3 - g2 * v1z;
+				s2[c] += g3 * v3 + g4 * v1z;
+				s0[c] = v0;
+				l.data[c][i] = inputGain * v0 + bandGain * s1[c] + lowGain * s2[c];
 			}
 		}
-
-		break;
-	}
-	default:
-		jassertfalse;
-		break;
 	}
+
+	memcpy(v0z, s0, sizeof(float)*numLanes);
+	memcpy(z1_A, s1, sizeof(float)*numLanes);
+	memcpy(v2, s2, sizeof(float)*numLanes);
 }
 
 void StateVariableFilterSubType::processFrame(float* d, int numChannels)
@@ -1169,7 +1300,7 @@ void StateVariableFilterSubType::processFrame(float* d, int numChannels)
 		for (int c = 0; c < numChannels; c++)
 		{
 			const float input = d[c];
-			const float HP = (input - x1 * z1_A[c] - v2[c]) / x2;
+			const float HP = (input - x1 * z1_A[c] - v2[c]) * x2;
 			const float BP = HP * gCoeff + z1_A[c];
 			const float LP = BP * gCoeff + v2[c];
 
@@ -121,6 +121,83 @@ public:
 		double gainModValue = 1.0;
 		double qModValue = 1.0;
 	};
+
+	/** The channels of a block that is processed by the vectorised kernels of the filter subtypes.
+
+		The kernels iterate over the samples in the outer loop and over the channels in the inner
+		loop so that the channels of a frame become SIMD lanes. For mono and stereo signals the
+		channel amount is passed into the kernel as compile time constant so that the compiler
+		can unroll the lane loop.
+	*/
+	struct ChannelLanes
+	{
+		ChannelLanes(AudioSampleBuffer& b, int startSample, int numSamples_);
+
+		/** Calls the kernel with a std::integral_constant of the channel amount (zero means dynamic). */
+		template <typename KernelType> void dispatch(const KernelType& k)
+		{
+			switch (numChannels)
+			{
+			case 1:  k(std::integral_constant<int, 1>()); break;
+			case 2:  k(std::integral_constant<int, 2>()); break;
+			default: k(std::integral_constant<int, 0>()); break;
+			}
+		}
+
+		/** Returns the lane amount for the given compile time channel amount. */
+		template <int NumChannels> int getNumLanes() const
+		{
+			return NumChannels != 0 ? NumChannels : numChannels;
+		}
+
+		float* data[NUM_MAX_CHANNELS];
+		int numChannels = 0;
+		int numSamples = 0;
+	};
+};
+
+/** Smoothes the frequency, Q and gain of a MultiChannelFilter.
+
+	This behaves exactly like three LinearSmoothedValue<double> objects, but the values are
+	stored in lane arrays so that advancing all parameters is a single vectorised operation.
+*/
+struct FilterParameterRamp
+{
+	enum Parameter
+	{
+		Frequency,
+		Q,
+		Gain,
+		numParameters
+	};
+
+	static constexpr int NumLanes = 4;
+
+	FilterParameterRamp(double initialFrequency, double initialQ, double initialGain);
+
+	/** Sets the ramp length and jumps to the target values. */
+	void reset(double sampleRate, double rampLengthSeconds);
+
+	/** Sets a new target value. If force is true, it will jump to the value without smoothing. */
+	void setValue(Parameter p, double newValue, bool force);
+
+	void setValueWithoutSmoothing(Parameter p, double newValue);
+
+	/** Advances all parameters by one step. */
+	void tick();
+
+	double getCurrentValue(Parameter p) const { return current[p]; }
+
+private:
+
+	void setCurrentAndTargetValue(int index, double newValue);
+
+	double current[NumLanes];
+	double target[NumLanes];
+	double delta[NumLanes];
+	double countdown[NumLanes];
+
+	int stepsToTarget = 0;
 };
 
 /** A base class for filters with multiple channels.
@@ -161,6 +238,14 @@ public:
 	StringArray getModes() const;
 	void render(FilterHelpers::RenderData& r);
 
+	/** Processes the block with the same coefficient updates as calling processFrame() for every frame.
+
+		The frames between two coefficient updates are rendered with the block kernel of the
+		filter subtype, so this is the preferred method if you need the 64 frame update rate
+		(eg. if you cascade multiple filters that must stay in sync with a frame based filter).
+	*/
+	void processBlock(AudioSampleBuffer& b, int startSample, int numSamples);
+
 private:
 
 	FilterSubType internalFilter;
@@ -176,9 +261,7 @@ private:
 
 	double smoothingTimeSeconds = 0.03;
 	double sampleRate = 44100.0;
-	LinearSmoothedValue<double> frequency = 10000.0;
-	LinearSmoothedValue<double> q = 1.0;
-	LinearSmoothedValue<double> gain = 1.0;
+	FilterParameterRamp parameters;
 
 	double currentFreq;
 	double currentGain;
@@ -297,6 +380,8 @@ public:
 
 private:
 
+	template <int NumChannels> void processLanes(FilterHelpers::ChannelLanes& l);
+
 	enum Index
 	{
 		In1 = 0,
@@ -428,6 +513,8 @@ public:
 
 	FilterCoefficientData getCoefficients(double, double, double) const { return {}; }
 
+	StaticBiquadSubType();
+
 	void setType(int newType);
 	void reset(int numNewChannels);
 	void processSamples(AudioSampleBuffer& b, int startSample, int numSamples);
@@ -436,10 +523,17 @@ public:
 
 private:
 
+	template <int NumChannels> void processLanes(FilterHelpers::ChannelLanes& l);
+
 	int numChannels = NUM_MAX_CHANNELS;
 
-	IIRCoefficients currentCoefficients;
-	IIRFilter filters[NUM_MAX_CHANNELS];
+	// Starts as pass-through until the first coefficient update (like an inactive IIRFilter).
+	IIRCoefficients currentCoefficients = IIRCoefficients(1.0, 0.0, 0.0, 1.0, 0.0, 0.0);
+
+	// The transposed direct form II state of every channel.
+	float v1[NUM_MAX_CHANNELS];
+	float v2[NUM_MAX_CHANNELS];
+
 	FilterType biquadType;
 };
 
@@ -533,8 +627,12 @@ public:
 
 private:
 
+	template <int NumChannels> void processLanes(FilterHelpers::ChannelLanes& l);
+
 	float processSample(float input, int channel);
-	float buf[NUM_MAX_CHANNELS][4];
+
+	// The four stages are stored as separate channel arrays so that the channels can be vectorised.
+	float buf[4][NUM_MAX_CHANNELS];
 
 	float cut;
 	float res;
@@ -655,6 +753,8 @@ public:
 
 private:
 
+	template <int NumChannels> void processLanes(FilterHelpers::ChannelLanes& l);
+
 	FilterType type;
 
 	float v0z[NUM_MAX_CHANNELS];
@@ -738,6 +738,50 @@ public:
 		this->updateBuffer(thisState.data.uptime, d.getNumSamples());
 	}
 
+	/** Renders the ramp for all voices of the batch at once. */
+	void processVoiceBatch(VoiceBatch& b)
+	{
+		constexpr int NumLanes = VoiceBatch::NumLanes;
+
+		auto on = b.gather<int>(state, [](const State& s) { return (int)s.enabled; });
+		auto startUptime = b.gather<double>(state, [](const State& s) { return s.data.uptime; });
+		auto delta = b.gather<double>(state, [](const State& s) { return s.data.uptimeDelta; });
+		auto loopStart = b.gather<double>(state, [](const State& s) { return s.loopStart; });
+
+		auto up = startUptime;
+
+		for (int c = 0; c < b.getNumChannels(); c++)
+		{
+			up = startUptime;
+			auto frames = b.getFrames(c);
+
+			for (int i = 0; i < b.getNumSamples(); i++)
+			{
+				auto& f = frames[i];
+
+				for (int l = 0; l < NumLanes; l++)
+				{
+					up[l] = up[l] > 1.0 ? loopStart[l] : up[l];
+					f[l] = on[l] ? f[l] + (float)up[l] : f[l];
+					up[l] += delta[l];
+				}
+			}
+		}
+
+		for (int l = 0; l < b.getNumActiveLanes(); l++)
+		{
+			auto& s = state.getWithIndex(b.getVoiceIndex(l));
+
+			if (on[l])
+			{
+				s.data.uptime = up[l];
+				s.modValue.setModValue(up[l]);
+			}
+
+			this->updateBuffer(s.data.uptime, b.getNumSamples());
+		}
+	}
+
 	bool handleModulation(double& v)
 	{
 		return state.get().modValue.getChangedValue(v);
@@ -1143,62 +1187,87 @@ public:
 
 	void reset()
 	{
-		for (auto& s : voiceData)
-			s.reset();
+		for (auto& u : uptime)
+			u = 0.0;
 	}
 
 	void prepare(PrepareSpecs ps)
 	{
 		sr = ps.sampleRate;
-		voiceData.prepare(ps);
-		sr = ps.sampleRate;
+		uptime.prepare(ps);
+		uptimeDelta.prepare(ps);
+		multipliers.prepare(ps);
+		phases.prepare(ps);
+		enabled.prepare(ps);
 		setFrequency(freqValue);
 		setFreqRatio(multiplier);
 	}
 	
 	template <typename ProcessDataType> void process(ProcessDataType& data)
 	{
-		currentVoiceData = &voiceData.get();
-
-		if(!currentVoiceData->enabled)
+		if(!enabled.get())
 			return;
 
+		auto& thisUptime = uptime.get();
+		const auto delta = uptimeDelta.get() * multipliers.get();
+		const auto phase = phases.get();
+
 		for (auto& s : data[0])
+			s = tick(thisUptime, delta, phase, s);
+	}
+
+	/** Renders the phasor for all voices of the batch at once. */
+	void processVoiceBatch(VoiceBatch& b)
+	{
+		constexpr int NumLanes = VoiceBatch::NumLanes;
+
+		auto up = b.gather(uptime);
+		auto delta = b.gather(uptimeDelta);
+		auto mul = b.gather(multipliers);
+		auto phase = b.gather(phases);
+		auto on = b.gather(enabled);
+
+		for (int l = 0; l < NumLanes; l++)
+			delta[l] *= mul[l];
+
+		auto frames = b.getFrames(0);
+
+		for (int i = 0; i < b.getNumSamples(); i++)
 		{
-			auto asSpan = reinterpret_cast<span<float, 1>*>(&s);
-			processFrameInternal(*asSpan);
+			auto& f = frames[i];
+
+			for (int l = 0; l < NumLanes; l++)
+			{
+				auto thisUptime = up[l];
+				auto v = tick(thisUptime, delta[l], phase[l], f[l]);
+
+				up[l] = on[l] ? thisUptime : up[l];
+				f[l] = on[l] ? v : f[l];
+			}
 		}
-		
-		currentVoiceData = nullptr;
+
+		b.scatter(uptime, up);
 	}
 
 	int64_t bitwiseOrZero(const double &t) {
 		return static_cast<int64_t>(t) | 0;
 	}
 
-	template <typename FrameDataType> void processFrameInternal(FrameDataType& data)
+	float tick(double& thisUptime, double delta, double phase, float input)
 	{
-		jassert(currentVoiceData != nullptr);
-
-		auto phase =  currentVoiceData->tick();
+		auto p = thisUptime + phase;
+		thisUptime += delta;
 
 		if constexpr (useFM)
-		{
-			double delta = currentVoiceData->uptimeDelta * currentVoiceData->multiplier;
-			delta *= (double)data[0];
-			currentVoiceData->uptime += delta;
-		}
-			
+			thisUptime += delta * (double)input;
 
-		phase -= bitwiseOrZero(phase);
-		data[0] = (float)phase;
+		p -= bitwiseOrZero(p);
+		return (float)p;
 	}
 
 	template <typename FrameDataType> void processFrame(FrameDataType& data)
 	{
-		currentVoiceData = &voiceData.get();
-		processFrameInternal(data);
-		currentVoiceData = nullptr;
+		data[0] = tick(uptime.get(), uptimeDelta.get() * multipliers.get(), phases.get(), data[0]);
 	}
 
 	void handleHiseEvent(HiseEvent& e)
@@ -1245,38 +1314,40 @@ public:
 		{
 			auto newUptimeDelta = (double)(newFrequency / sr);
 
-			for (auto& d : voiceData)
-				d.uptimeDelta = newUptimeDelta;
+			for (auto& d : uptimeDelta)
+				d = newUptimeDelta;
 		}
 	}
 
 	void setGate(double v)
 	{
 		auto shouldBeOn = (int)(v > 0.5);
+		auto u = uptime.begin();
 
-		for (auto& d : voiceData)
+		for (auto& e : enabled)
 		{
-			auto shouldReset = shouldBeOn && !d.enabled;
+			auto shouldReset = shouldBeOn && !e;
 
 			if (shouldReset)
-				d.uptime = 0.0;
+				*u = 0.0;
 
-			d.enabled = shouldBeOn;
+			e = shouldBeOn;
+			++u;
 		}
 	}
 
 	void setPhase(double v)
 	{
-		for (auto& s : voiceData)
-			s.phase = v;
+		for (auto& p : phases)
+			p = v;
 	}
 
 	void setFreqRatio(double newMultiplier)
 	{
 		multiplier = jlimit(0.001, 100.0, newMultiplier);
 
-		for (auto& d : voiceData)
-			d.multiplier = multiplier;
+		for (auto& d : multipliers)
+			d = multiplier;
 	}
 
 	DEFINE_PARAMETERS
@@ -1289,8 +1360,13 @@ public:
 	SN_PARAMETER_MEMBER_FUNCTION;
 
 	double sr = 44100.0;
-	PolyData<OscData, NumVoices> voiceData;
-	OscData* currentVoiceData = nullptr;
+
+	// The voice state is stored as structure of arrays so that the voice batch can load it directly
+	PolyDataSoA<double, NumVoices> uptime;
+	PolyDataSoA<double, NumVoices> uptimeDelta;
+	PolyDataSoA<double, NumVoices> multipliers = { 1.0 };
+	PolyDataSoA<double, NumVoices> phases;
+	PolyDataSoA<int, NumVoices> enabled = { 1 };
 
 	double freqValue = 220.0;
 	double multiplier = 1.0;
@@ -1420,6 +1496,65 @@ public:
 		currentVoiceData = nullptr;
 	}
 
+	/** Renders all voices of the batch at once. The noise mode will render each voice separately. */
+	void processVoiceBatch(VoiceBatch& b)
+	{
+		constexpr int NumLanes = VoiceBatch::NumLanes;
+
+		if (currentMode == Mode::Noise)
+		{
+			b.processEachVoice<ProcessDataDyn>(*this);
+			return;
+		}
+
+		OscData lanes[NumLanes];
+		VoiceBatch::LaneType<float> gains;
+		VoiceBatch::LaneType<int> on;
+
+		for (int l = 0; l < NumLanes; l++)
+		{
+			lanes[l] = voiceData.getWithIndex(b.getVoiceIndex(l));
+			gains[l] = lanes[l].gain * lanes[l].getNyquistAttenuationGain();
+			on[l] = lanes[l].enabled;
+		}
+
+		const int numChannelsToUse = b.getNumChannels() == 2 ? 2 : 1;
+
+		auto tickLanes = [&](const auto& tickFunction)
+		{
+			for (int i = 0; i < b.getNumSamples(); i++)
+			{
+				VoiceBatch::FrameType v;
+
+				for (int l = 0; l < NumLanes; l++)
+					v[l] = gains[l] * tickFunction(lanes[l]);
+
+				for (int c = 0; c < numChannelsToUse; c++)
+				{
+					auto& f = b.getFrames(c)[i];
+
+					for (int l = 0; l < NumLanes; l++)
+						f[l] = on[l] ? f[l] + v[l] : f[l];
+				}
+			}
+		};
+
+		switch (currentMode)
+		{
+		case Mode::Sine:	 tickLanes([this](OscData& d) { return tickSine(d); }); break;
+		case Mode::Triangle: tickLanes([this](OscData& d) { return tickTriangle(d); }); break;
+		case Mode::Saw:		 tickLanes([this](OscData& d) { return tickSaw(d); }); break;
+		case Mode::Square:	 tickLanes([this](OscData& d) { return tickSquare(d); }); break;
+		default: break;
+		}
+
+		for (int l = 0; l < b.getNumActiveLanes(); l++)
+		{
+			if (on[l])
+				voiceData.getWithIndex(b.getVoiceIndex(l)).uptime = lanes[l].uptime;
+		}
+	}
+
 	void handleHiseEvent(HiseEvent& e)
 	{
 		if (e.isNoteOn())
@@ -2038,6 +2173,41 @@ public:
 		}
 	}
 
+	/** Applies the (smoothed) gain to all voices of the batch at once. */
+	void processVoiceBatch(VoiceBatch& b)
+	{
+		constexpr int NumLanes = VoiceBatch::NumLanes;
+
+		auto value = b.gather<float>(gainer, [](const sfloat& g) { return g.value; });
+		auto delta = b.gather<float>(gainer, [](const sfloat& g) { return g.delta; });
+		auto steps = b.gather<int>(gainer, [](const sfloat& g) { return g.stepsToDo; });
+
+		for (int i = 0; i < b.getNumSamples(); i++)
+		{
+			VoiceBatch::FrameType gainFactor;
+
+			for (int l = 0; l < NumLanes; l++)
+			{
+				auto active = steps[l] > 0;
+
+				gainFactor[l] = value[l];
+				value[l] = active ? value[l] + delta[l] : value[l];
+				steps[l] = active ? steps[l] - 1 : steps[l];
+			}
+
+			for (int c = 0; c < b.getNumChannels(); c++)
+			{
+				auto& f = b.getFrames(c)[i];
+
+				for (int l = 0; l < NumLanes; l++)
+					f[l] *= gainFactor[l];
+			}
+		}
+
+		b.scatter(gainer, value, [](sfloat& g, float v) { g.value = v; });
+		b.scatter(gainer, steps, [](sfloat& g, int v) { g.stepsToDo = v; });
+	}
+
 	void reset() noexcept
 	{
 		if (sr == 0.0)
@@ -2194,6 +2364,37 @@ public:
 		smoothers.get().smoothBuffer(data[0].data, data.getNumSamples());
 	}
 
+	/** Smoothes the first channel of all voices of the batch at once. */
+	void processVoiceBatch(VoiceBatch& b)
+	{
+		constexpr int NumLanes = VoiceBatch::NumLanes;
+
+		auto on = b.gather<int>(smoothers, [](const hise::Smoother& s) { return (int)s.isActive(); });
+		auto a0 = b.gather<float>(smoothers, [](const hise::Smoother& s) { return s.getA0(); });
+		auto b0 = b.gather<float>(smoothers, [](const hise::Smoother& s) { return s.getB0(); });
+		auto prev = b.gather<float>(smoothers, [](const hise::Smoother& s) { return s.getDefaultValue(); });
+
+		auto frames = b.getFrames(0);
+
+		for (int i = 0; i < b.getNumSamples(); i++)
+		{
+			auto& f = frames[i];
+
+			for (int l = 0; l < NumLanes; l++)
+			{
+				auto v = a0[l] * f[l] - b0[l] * prev[l];
+				prev[l] = on[l] ? v : prev[l];
+				f[l] = on[l] ? v : f[l];
+			}
+		}
+
+		for (int l = 0; l < b.getNumActiveLanes(); l++)
+		{
+			if (on[l])
+				smoothers.getWithIndex(b.getVoiceIndex(l)).setCurrentValue(prev[l]);
+		}
+	}
+
 	void handleHiseEvent(HiseEvent& e)
 	{
 		if (e.isNoteOn())
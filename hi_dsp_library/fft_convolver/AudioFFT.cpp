@@ -28,6 +28,13 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if FFTCONVOLVER_USE_SSE && JUCE_INTEL
+  #include <xmmintrin.h>
+#endif
 
 #if JUCE_MAC
 #define AUDIOFFT_APPLE_ACCELERATE
@@ -1082,6 +1089,377 @@ namespace audiofft
 #endif // AUDIOFFT_FFTW3_USED
 
 
+  // ================================================================
+
+
+  /**
+   * @internal
+   * @class SimdFFT
+   * @brief Built-in vectorised FFT implementation
+   *
+   * The real FFT of size N is computed as complex FFT of size N/2 (even samples as
+   * real part, odd samples as imaginary part) followed by the usual split step.
+   *
+   * The complex FFT is a radix-2 Stockham autosort FFT that operates directly
+   * on split-complex arrays so it doesn't need a bit reversal pass and every
+   * butterfly stage can be computed with 4-wide SSE instructions (NEON through
+   * sse2neon on ARM). The first two stages have a stride of 1 and 2 so they are
+   * vectorised over the butterfly index and interleave their output with a shuffle.
+   *
+   * The twiddle factors are calculated once per FFT size and shared between all
+   * instances (the convolution engines create a lot of FFT objects with the
+   * same size).
+   */
+  class SimdFFT : public detail::AudioFFTImpl
+  {
+  public:
+
+    SimdFFT() = default;
+
+    SimdFFT(const SimdFFT&) = delete;
+    SimdFFT& operator=(const SimdFFT&) = delete;
+
+    void init(size_t size) override
+    {
+      _size = size;
+      _tables = size >= 2 ? Tables::get(size) : nullptr;
+
+      const auto halfSize = size / 2;
+
+      _re.assign(halfSize, 0.0f);
+      _im.assign(halfSize, 0.0f);
+      _tmpRe.assign(halfSize, 0.0f);
+      _tmpIm.assign(halfSize, 0.0f);
+    }
+
+    void fft(const float* data, float* re, float* im) override
+    {
+      if (_size < 2)
+      {
+        re[0] = _size == 1 ? data[0] : 0.0f;
+        im[0] = 0.0f;
+        return;
+      }
+
+      const size_t m = _size / 2;
+
+      deinterleave(data, _re.data(), _im.data(), m);
+
+      float* zr = _re.data();
+      float* zi = _im.data();
+      complexFFT<false>(zr, zi);
+
+      const float* wr = _tables->realRe.data();
+      const float* wi = _tables->realIm.data();
+
+      for (size_t k = 0; k <= m; ++k)
+      {
+        const size_t i0 = k == m ? 0 : k;
+        const size_t i1 = k == 0 ? 0 : m - k;
+
+        // Z[k] and conj(Z[m-k])
+        const float ar = zr[i0], ai = zi[i0];
+        const float br = zr[i1], bi = -zi[i1];
+
+        const float er = 0.5f * (ar + br);
+        const float ei = 0.5f * (ai + bi);
+        const float or_ = 0.5f * (ai - bi);
+        const float oi = -0.5f * (ar - br);
+
+        re[k] = er + wr[k] * or_ - wi[k] * oi;
+        im[k] = ei + wr[k] * oi + wi[k] * or_;
+      }
+
+      im[0] = 0.0f;
+      im[m] = 0.0f;
+    }
+
+    void ifft(float* data, const float* re, const float* im) override
+    {
+      if (_size < 2)
+      {
+        if (_size == 1)
+          data[0] = re[0];
+
+        return;
+      }
+
+      const size_t m = _size / 2;
+      const float scale = 1.0f / static_cast<float>(_size);
+
+      const float* wr = _tables->realRe.data();
+      const float* wi = _tables->realIm.data();
+
+      for (size_t k = 0; k < m; ++k)
+      {
+        // X[k] and conj(X[m-k])
+        const float ar = re[k], ai = im[k];
+        const float br = re[m - k], bi = -im[m - k];
+
+        const float er = ar + br;
+        const float ei = ai + bi;
+        const float dr = ar - br;
+        const float di = ai - bi;
+
+        // (X[k] - conj(X[m-k])) * conj(W^k)
+        const float or_ = dr * wr[k] + di * wi[k];
+        const float oi = di * wr[k] - dr * wi[k];
+
+        _re[k] = scale * (er - oi);
+        _im[k] = scale * (ei + or_);
+      }
+
+      float* zr = _re.data();
+      float* zi = _im.data();
+      complexFFT<true>(zr, zi);
+
+      interleave(zr, zi, data, m);
+    }
+
+  private:
+
+    struct Tables
+    {
+      Tables(size_t size)
+      {
+        const double twoPi = 6.283185307179586476925286766559;
+        const size_t m = size / 2;
+
+        // the twiddles of all stages are stored in one array (m/2 + m/4 + ... + 1 values)
+        for (size_t n = m; n > 1; n /= 2)
+        {
+          for (size_t p = 0; p < n / 2; ++p)
+          {
+            const double phase = twoPi * static_cast<double>(p) / static_cast<double>(n);
+            twiddleRe.push_back(static_cast<float>(std::cos(phase)));
+            twiddleIm.push_back(static_cast<float>(-std::sin(phase)));
+          }
+        }
+
+        for (size_t k = 0; k <= m; ++k)
+        {
+          const double phase = twoPi * static_cast<double>(k) / static_cast<double>(size);
+          realRe.push_back(static_cast<float>(std::cos(phase)));
+          realIm.push_back(static_cast<float>(-std::sin(phase)));
+        }
+
+        realRe[m] = -1.0f;
+        realIm[m] = 0.0f;
+      }
+
+      static std::shared_ptr<const Tables> get(size_t size)
+      {
+        static std::mutex lock;
+        static std::map<size_t, std::shared_ptr<const Tables>> cache;
+
+        std::lock_guard<std::mutex> sl(lock);
+
+        auto& t = cache[size];
+
+        if (t == nullptr)
+          t = std::make_shared<const Tables>(size);
+
+        return t;
+      }
+
+      std::vector<float> twiddleRe, twiddleIm;
+      std::vector<float> realRe, realIm;
+    };
+
+    /** Splits the real input into the even and odd samples. */
+    static void deinterleave(const float* data, float* re, float* im, size_t m)
+    {
+      size_t k = 0;
+
+#if FFTCONVOLVER_USE_SSE
+      for (; k + 4 <= m; k += 4)
+      {
+        const __m128 v0 = _mm_loadu_ps(data + 2 * k);
+        const __m128 v1 = _mm_loadu_ps(data + 2 * k + 4);
+        _mm_storeu_ps(re + k, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(im + k, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+      }
+#endif
+
+      for (; k < m; ++k)
+      {
+        re[k] = data[2 * k];
+        im[k] = data[2 * k + 1];
+      }
+    }
+
+    static void interleave(const float* re, const float* im, float* data, size_t m)
+    {
+      size_t k = 0;
+
+#if FFTCONVOLVER_USE_SSE
+      for (; k + 4 <= m; k += 4)
+      {
+        const __m128 r = _mm_loadu_ps(re + k);
+        const __m128 i = _mm_loadu_ps(im + k);
+        _mm_storeu_ps(data + 2 * k, _mm_unpacklo_ps(r, i));
+        _mm_storeu_ps(data + 2 * k + 4, _mm_unpackhi_ps(r, i));
+      }
+#endif
+
+      for (; k < m; ++k)
+      {
+        data[2 * k] = re[k];
+        data[2 * k + 1] = im[k];
+      }
+    }
+
+    /** Runs the complex FFT of size N/2 on the split-complex data in the working buffer.
+        The result ends up either in the working or the temp buffer, so the pointers are updated. */
+    template <bool Inverse> void complexFFT(float*& re, float*& im)
+    {
+      float* xr = re;
+      float* xi = im;
+      float* yr = _tmpRe.data();
+      float* yi = _tmpIm.data();
+
+      const float* wr = _tables->twiddleRe.data();
+      const float* wi = _tables->twiddleIm.data();
+
+      for (size_t n = _size / 2, s = 1; n > 1; n /= 2, s *= 2)
+      {
+        const size_t m = n / 2;
+
+        butterflyStage<Inverse>(xr, xi, yr, yi, wr, wi, m, s);
+
+        wr += m;
+        wi += m;
+        std::swap(xr, yr);
+        std::swap(xi, yi);
+      }
+
+      re = xr;
+      im = xi;
+    }
+
+    /** One radix-2 stage: y[q + s*2p] = a + b, y[q + s*(2p+1)] = (a - b) * w^p
+        with a = x[q + s*p] and b = x[q + s*(p+m)]. */
+    template <bool Inverse> static void butterflyStage(const float* xr, const float* xi, float* yr, float* yi,
+                                                       const float* wr, const float* wi, size_t m, size_t s)
+    {
+      const float sign = Inverse ? -1.0f : 1.0f;
+
+#if FFTCONVOLVER_USE_SSE
+      const __m128 vSign = _mm_set1_ps(sign);
+
+      auto butterfly = [](__m128 ar, __m128 ai, __m128 br, __m128 bi, __m128 vwr, __m128 vwi,
+                          __m128& sr, __m128& si, __m128& dr, __m128& di)
+      {
+        sr = _mm_add_ps(ar, br);
+        si = _mm_add_ps(ai, bi);
+        const __m128 tr = _mm_sub_ps(ar, br);
+        const __m128 ti = _mm_sub_ps(ai, bi);
+        dr = _mm_sub_ps(_mm_mul_ps(tr, vwr), _mm_mul_ps(ti, vwi));
+        di = _mm_add_ps(_mm_mul_ps(tr, vwi), _mm_mul_ps(ti, vwr));
+      };
+
+      __m128 sr, si, dr, di;
+
+      if (s >= 4)
+      {
+        for (size_t p = 0; p < m; ++p)
+        {
+          const __m128 vwr = _mm_set1_ps(wr[p]);
+          const __m128 vwi = _mm_set1_ps(sign * wi[p]);
+
+          const float* ar = xr + s * p;
+          const float* ai = xi + s * p;
+          const float* br = ar + s * m;
+          const float* bi = ai + s * m;
+          float* outR = yr + s * 2 * p;
+          float* outI = yi + s * 2 * p;
+
+          for (size_t q = 0; q < s; q += 4)
+          {
+            butterfly(_mm_loadu_ps(ar + q), _mm_loadu_ps(ai + q), _mm_loadu_ps(br + q), _mm_loadu_ps(bi + q),
+                      vwr, vwi, sr, si, dr, di);
+
+            _mm_storeu_ps(outR + q, sr);
+            _mm_storeu_ps(outI + q, si);
+            _mm_storeu_ps(outR + s + q, dr);
+            _mm_storeu_ps(outI + s + q, di);
+          }
+        }
+
+        return;
+      }
+
+      if (s == 2 && m >= 2)
+      {
+        // four lanes = (p, 0), (p, 1), (p+1, 0), (p+1, 1)
+        for (size_t p = 0; p < m; p += 2)
+        {
+          const __m128 vwr = _mm_setr_ps(wr[p], wr[p], wr[p + 1], wr[p + 1]);
+          const __m128 vwi = _mm_mul_ps(vSign, _mm_setr_ps(wi[p], wi[p], wi[p + 1], wi[p + 1]));
+
+          butterfly(_mm_loadu_ps(xr + 2 * p), _mm_loadu_ps(xi + 2 * p),
+                    _mm_loadu_ps(xr + 2 * (p + m)), _mm_loadu_ps(xi + 2 * (p + m)),
+                    vwr, vwi, sr, si, dr, di);
+
+          _mm_storeu_ps(yr + 4 * p, _mm_movelh_ps(sr, dr));
+          _mm_storeu_ps(yi + 4 * p, _mm_movelh_ps(si, di));
+          _mm_storeu_ps(yr + 4 * p + 4, _mm_movehl_ps(dr, sr));
+          _mm_storeu_ps(yi + 4 * p + 4, _mm_movehl_ps(di, si));
+        }
+
+        return;
+      }
+
+      if (s == 1 && m >= 4)
+      {
+        for (size_t p = 0; p < m; p += 4)
+        {
+          const __m128 vwr = _mm_loadu_ps(wr + p);
+          const __m128 vwi = _mm_mul_ps(vSign, _mm_loadu_ps(wi + p));
+
+          butterfly(_mm_loadu_ps(xr + p), _mm_loadu_ps(xi + p),
+                    _mm_loadu_ps(xr + p + m), _mm_loadu_ps(xi + p + m),
+                    vwr, vwi, sr, si, dr, di);
+
+          _mm_storeu_ps(yr + 2 * p, _mm_unpacklo_ps(sr, dr));
+          _mm_storeu_ps(yi + 2 * p, _mm_unpacklo_ps(si, di));
+          _mm_storeu_ps(yr + 2 * p + 4, _mm_unpackhi_ps(sr, dr));
+          _mm_storeu_ps(yi + 2 * p + 4, _mm_unpackhi_ps(si, di));
+        }
+
+        return;
+      }
+#endif
+
+      for (size_t p = 0; p < m; ++p)
+      {
+        const float vwr = wr[p];
+        const float vwi = sign * wi[p];
+
+        for (size_t q = 0; q < s; ++q)
+        {
+          const size_t a = q + s * p;
+          const size_t b = a + s * m;
+          const size_t o = q + s * 2 * p;
+
+          const float tr = xr[a] - xr[b];
+          const float ti = xi[a] - xi[b];
+
+          yr[o] = xr[a] + xr[b];
+          yi[o] = xi[a] + xi[b];
+          yr[o + s] = tr * vwr - ti * vwi;
+          yi[o + s] = tr * vwi + ti * vwr;
+        }
+      }
+    }
+
+    size_t _size = 0;
+    std::shared_ptr<const Tables> _tables;
+    std::vector<float> _re, _im;
+    std::vector<float> _tmpRe, _tmpIm;
+  };
+
+
   // =============================================================
 
 
@@ -1091,8 +1469,8 @@ namespace audiofft
 
 	  - if Apple's FFT should be used (iOS), use this.
 	  - if USE_IPP is set and the fftType is IPP, use this
-	  - if Ooura is chosen or all other implementations are not avalailable,
-	    use this (on all systems).
+	  - if Ooura is chosen, use this (on all systems).
+	  - otherwise use the built-in SIMD implementation.
 	  */
 
 	  switch (fftType)
@@ -1110,6 +1488,10 @@ namespace audiofft
 		  break;
 #endif
 	  default:
+	  case audiofft::ImplementationType::SIMD:
+		  _impl.reset(new SimdFFT());
+		  break;
+	  case audiofft::ImplementationType::Ooura:
 		  _impl.reset(new OouraFFT());
 		  break;
 	  }
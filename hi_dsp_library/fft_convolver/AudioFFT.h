@@ -30,7 +30,8 @@
 *
 * - Real-complex FFT and complex-real inverse FFT for power-of-2-sized real data.
 *
-* - Uniform interface to different FFT implementations (currently Ooura, FFTW3 and Apple Accelerate).
+* - Uniform interface to different FFT implementations (currently Ooura, FFTW3, Apple Accelerate,
+*   IPP and a built-in SIMD implementation).
 *
 * - Complex data is handled in "split-complex" format, i.e. there are separate
 *   arrays for the real and imaginary parts which can be useful for SIMD optimizations
@@ -100,6 +101,7 @@ namespace audiofft
 		AppleAccelerate,
 		Ooura,
 		FFTW3,
+		SIMD,
 		numImplementationTypes
 	};
 
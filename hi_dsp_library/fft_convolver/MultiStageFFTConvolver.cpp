@@ -0,0 +1,278 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+#include "MultiStageFFTConvolver.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace fftconvolver
+{
+
+MultiStageFFTConvolver::TailStage::TailStage(audiofft::ImplementationType fftType) :
+  blockSize(0),
+  numSegments(0),
+  convolver(fftType),
+  output(),
+  precalculated(),
+  backgroundInput()
+{
+}
+
+
+MultiStageFFTConvolver::MultiStageFFTConvolver(audiofft::ImplementationType fftType) :
+  _headBlockSize(0),
+  _headConvolver(fftType),
+  _tailStages(),
+  _numTailStages(0),
+  _tailInput(),
+  _tailInputFill(0)
+{
+  for (size_t i=0; i<MaxTailStages; ++i)
+  {
+    _tailStages.push_back(new TailStage(fftType));
+  }
+}
+
+
+MultiStageFFTConvolver::~MultiStageFFTConvolver()
+{
+  reset();
+
+  for (auto s : _tailStages)
+  {
+    delete s;
+  }
+}
+
+
+void MultiStageFFTConvolver::reset()
+{
+  _headBlockSize = 0;
+  _headConvolver.reset();
+
+  for (auto s : _tailStages)
+  {
+    s->blockSize = 0;
+    s->numSegments = 0;
+    s->convolver.reset();
+    s->output.clear();
+    s->precalculated.clear();
+    s->backgroundInput.clear();
+  }
+
+  _numTailStages = 0;
+  _tailInput.clear();
+  _tailInputFill = 0;
+}
+
+
+void MultiStageFFTConvolver::cleanPipeline()
+{
+  _headConvolver.resetInput();
+
+  for (size_t i=0; i<_numTailStages; ++i)
+  {
+    auto s = _tailStages[i];
+    s->convolver.resetInput();
+    s->output.setZero();
+    s->precalculated.setZero();
+    s->backgroundInput.setZero();
+  }
+
+  _tailInput.setZero();
+  _tailInputFill = 0;
+}
+
+
+bool MultiStageFFTConvolver::init(size_t headBlockSize,
+                                  size_t firstTailBlockSize,
+                                  const Sample* ir,
+                                  size_t irLen,
+                                  size_t maxTailBlockSize)
+{
+  reset();
+
+  if (headBlockSize == 0 || firstTailBlockSize == 0)
+  {
+    return false;
+  }
+
+  // Ignore zeros at the end of the impulse response because they only waste computation time
+  while (irLen > 0 && ::fabs(ir[irLen-1]) < 0.000001f)
+  {
+    --irLen;
+  }
+
+  if (irLen == 0)
+  {
+    return true;
+  }
+
+  _headBlockSize = NextPowerOf2(headBlockSize);
+
+  firstTailBlockSize = jmax(_headBlockSize, NextPowerOf2(firstTailBlockSize));
+  maxTailBlockSize = jmax(firstTailBlockSize, NextPowerOf2(maxTailBlockSize));
+
+  // The head covers everything until the first tail stage
+  const size_t headIrLen = jmin(irLen, 2 * firstTailBlockSize);
+  _headConvolver.init(_headBlockSize, ir, headIrLen);
+
+  size_t blockSize = firstTailBlockSize;
+  size_t offset = 2 * firstTailBlockSize;
+
+  while (offset < irLen && _numTailStages < MaxTailStages)
+  {
+    const size_t nextBlockSize = jmin(maxTailBlockSize, blockSize * GrowthFactor);
+    const bool isLastStage = _numTailStages == MaxTailStages - 1 || nextBlockSize == blockSize;
+
+    // The next stage starts at two times its block size (it needs one block to
+    // collect the input and one block to render it in the background).
+    const size_t end = isLastStage ? irLen : jmin(irLen, 2 * nextBlockSize);
+
+    auto s = _tailStages[_numTailStages++];
+    s->blockSize = blockSize;
+    s->numSegments = (end - offset + blockSize - 1) / blockSize;
+    s->convolver.init(blockSize, ir + offset, end - offset);
+    s->output.resize(blockSize);
+    s->precalculated.resize(blockSize);
+    s->backgroundInput.resize(blockSize);
+
+    offset = end;
+    blockSize = nextBlockSize;
+  }
+
+  if (_numTailStages > 0)
+  {
+    _tailInput.resize(_tailStages[_numTailStages-1]->blockSize);
+  }
+
+  _tailInputFill = 0;
+
+  return true;
+}
+
+
+size_t MultiStageFFTConvolver::getTailBlockSize(size_t stageIndex) const
+{
+  return stageIndex < _numTailStages ? _tailStages[stageIndex]->blockSize : 0;
+}
+
+
+size_t MultiStageFFTConvolver::getTailWorkload(size_t stageIndex) const
+{
+  if (stageIndex >= _numTailStages)
+  {
+    return 0;
+  }
+
+  auto s = _tailStages[stageIndex];
+
+  // two FFTs + one complex multiplication per segment
+  return s->blockSize * (s->numSegments + 2);
+}
+
+
+void MultiStageFFTConvolver::process(const Sample* input, Sample* output, size_t len)
+{
+  // Head
+  _headConvolver.process(input, output, len);
+
+  if (_numTailStages == 0)
+  {
+    return;
+  }
+
+  // All tail block sizes are multiples of the first one, so
+  // a chunk never crosses the block boundary of any stage.
+  const size_t firstBlockSize = _tailStages[0]->blockSize;
+
+  size_t processed = 0;
+
+  while (processed < len)
+  {
+    const size_t processing = jmin(len - processed, firstBlockSize - (_tailInputFill % firstBlockSize));
+
+    // Sum the precalculated output of all tail stages
+    for (size_t i=0; i<_numTailStages; ++i)
+    {
+      auto s = _tailStages[i];
+      const size_t pos = _tailInputFill % s->blockSize;
+      FloatVectorOperations::add(output + processed, s->precalculated.data() + pos, (int)processing);
+    }
+
+    ::memcpy(_tailInput.data() + _tailInputFill, input + processed, processing * sizeof(Sample));
+    _tailInputFill += processing;
+
+    for (size_t i=0; i<_numTailStages; ++i)
+    {
+      auto s = _tailStages[i];
+
+      if (_tailInputFill % s->blockSize == 0)
+      {
+        waitForBackgroundProcessing(i);
+        SampleBuffer::Swap(s->precalculated, s->output);
+        ::memcpy(s->backgroundInput.data(), _tailInput.data() + _tailInputFill - s->blockSize, s->blockSize * sizeof(Sample));
+        startBackgroundProcessing(i);
+      }
+    }
+
+    if (_tailInputFill == _tailInput.size())
+    {
+      _tailInputFill = 0;
+    }
+
+    processed += processing;
+  }
+}
+
+
+void MultiStageFFTConvolver::startBackgroundProcessing(size_t stageIndex)
+{
+  doBackgroundProcessing(stageIndex);
+}
+
+
+void MultiStageFFTConvolver::waitForBackgroundProcessing(size_t /*stageIndex*/)
+{
+}
+
+
+void MultiStageFFTConvolver::doBackgroundProcessing(size_t stageIndex)
+{
+  auto s = _tailStages[stageIndex];
+  s->convolver.process(s->backgroundInput.data(), s->output.data(), s->blockSize);
+}
+
+} // End of namespace fftconvolver
@@ -0,0 +1,165 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+#ifndef _FFTCONVOLVER_MULTISTAGEFFTCONVOLVER_H
+#define _FFTCONVOLVER_MULTISTAGEFFTCONVOLVER_H
+
+#include "FFTConvolver.h"
+#include "Utilities.h"
+
+
+namespace fftconvolver
+{
+
+/**
+* @class MultiStageFFTConvolver
+* @brief FFT convolver with a non-uniform partition of the impulse response
+*
+* The impulse response is split into a head and several tail stages:
+*
+* - The head convolver processes the first 2 * firstTailBlockSize samples of the impulse
+*   response with the (small) head block size on the audio thread.
+*
+* - Every tail stage k uses a block size B_k that is growthFactor times bigger than
+*   the one of the previous stage and covers the impulse response from 2 * B_k to
+*   2 * B_k+1. The last stage covers the rest of the impulse response.
+*
+* Every stage keeps the spectra of its past input blocks in a frequency-domain delay line,
+* so one forward FFT per block is reused for all partitions of the stage. The head also
+* covers the range that the first tail convolver of the TwoStageFFTConvolver renders on
+* the audio thread, so that range doesn't need its own forward FFT either.
+*
+* The tail stages are independent of each other. When a stage has collected a full block,
+* it will call startBackgroundProcessing() with its index and has one block of time until
+* waitForBackgroundProcessing() expects the result. This allows a subclass to render the
+* stages on different threads. Large stages are called less often and have a longer deadline.
+*
+* Just like the other convolvers, no allocations or locks take place during processing.
+*/
+class MultiStageFFTConvolver
+{
+public:
+
+  static constexpr size_t MaxTailStages = 8;
+  static constexpr size_t GrowthFactor = 4;
+
+  MultiStageFFTConvolver(audiofft::ImplementationType fftType);
+  virtual ~MultiStageFFTConvolver();
+
+  /**
+  * @brief Initialization the convolver
+  * @param headBlockSize The head block size (usually the audio buffer size)
+  * @param firstTailBlockSize The block size of the first tail stage
+  * @param ir The impulse response
+  * @param irLen Length of the impulse response in samples
+  * @param maxTailBlockSize The maximum block size of the tail stages
+  * @return true: Success - false: Failed
+  */
+  bool init(size_t headBlockSize, size_t firstTailBlockSize, const Sample* ir, size_t irLen, size_t maxTailBlockSize=32768);
+
+  /**
+  * @brief Convolves the the given input samples and immediately outputs the result
+  * @param input The input samples
+  * @param output The convolution result
+  * @param len Number of input/output samples
+  */
+  void process(const Sample* input, Sample* output, size_t len);
+
+  /**
+  * @brief Resets the convolver and discards the set impulse response
+  */
+  void reset();
+
+  /** Clears the internal buffers so that it resets the convolution pipeline. */
+  void cleanPipeline();
+
+  /** Returns the number of tail stages (excluding the head). */
+  size_t getNumTailStages() const { return _numTailStages; }
+
+  /** Returns the block size of the given tail stage. */
+  size_t getTailBlockSize(size_t stageIndex) const;
+
+  /** Returns a rough estimate of the work that the given tail stage needs per block. */
+  size_t getTailWorkload(size_t stageIndex) const;
+
+protected:
+
+  /**
+  * @brief Method called by the convolver if the given tail stage has a full block
+  *
+  * The default implementation just calls doBackgroundProcessing() on the calling thread.
+  */
+  virtual void startBackgroundProcessing(size_t stageIndex);
+
+  /**
+  * @brief Called by the convolver if it expects the result of its previous call to startBackgroundProcessing()
+  */
+  virtual void waitForBackgroundProcessing(size_t stageIndex);
+
+  /**
+  * @brief Actually performs the background processing work of the given tail stage
+  */
+  void doBackgroundProcessing(size_t stageIndex);
+
+private:
+
+  struct TailStage
+  {
+    TailStage(audiofft::ImplementationType fftType);
+
+    size_t blockSize;
+    size_t numSegments;
+    FFTConvolver convolver;
+    SampleBuffer output;
+    SampleBuffer precalculated;
+    SampleBuffer backgroundInput;
+  };
+
+  size_t _headBlockSize;
+  FFTConvolver _headConvolver;
+
+  std::vector<TailStage*> _tailStages;
+  size_t _numTailStages;
+
+  // The input of the last tail block size. The smaller stages use the end of it.
+  SampleBuffer _tailInput;
+  size_t _tailInputFill;
+
+  // Prevent uncontrolled usage
+  MultiStageFFTConvolver(const MultiStageFFTConvolver&);
+  MultiStageFFTConvolver& operator=(const MultiStageFFTConvolver&);
+};
+
+} // End of namespace fftconvolver
+
+#endif // Header guard
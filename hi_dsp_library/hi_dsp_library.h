@@ -91,6 +91,24 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #define HISE_LOG_FILTER_FREQMOD 0
 #endif
 
+/** Config: HISE_NUM_VOICE_BATCH_LANES
+
+	The number of voices that a container::voice_batch renders side by side. The default of 4
+	matches the width of a SSE / NEON float register, raise it to 8 if you compile with AVX.
+*/
+#ifndef HISE_NUM_VOICE_BATCH_LANES
+#define HISE_NUM_VOICE_BATCH_LANES 4
+#endif
+
+/** Config: HISE_NUM_CONVOLUTION_THREADS
+
+	The number of worker threads that render the tail stages of a convolution reverb
+	if the background thread is enabled. The workers are shared by all convolution effects.
+*/
+#ifndef HISE_NUM_CONVOLUTION_THREADS
+#define HISE_NUM_CONVOLUTION_THREADS 2
+#endif
+
 /** Set the max delay time for the hise delay line class in samples. It must be a power of two. 
 
 	By default this means that the max delay time at 44kHz is ~1.5 seconds, so if you have long delay times
@@ -138,6 +156,7 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #include "snex_basics/snex_FrameProcessor.cpp"
 #include "snex_basics/snex_ProcessDataTypes.h"
 #include "snex_basics/snex_ProcessDataTypes.cpp"
+#include "snex_basics/snex_VoiceBatch.h"
 
 #include "dsp_library/DspBaseModule.h"
 #include "dsp_library/BaseFactory.h"
@@ -159,6 +178,7 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #include "fft_convolver/AudioFFT.h"
 #include "fft_convolver/FFTConvolver.h"
 #include "fft_convolver/TwoStageFFTConvolver.h"
+#include "fft_convolver/MultiStageFFTConvolver.h"
 #include "dsp_basics/ConvolutionBase.h"
 
 #include "node_api/helpers/Error.h"
@@ -185,6 +205,7 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #include "node_api/nodes/Container_Chain.h"
 #include "node_api/nodes/Container_Split.h"
 #include "node_api/nodes/Container_Multi.h"
+#include "node_api/nodes/Container_VoiceBatch.h"
 
 #include "node_api/nodes/OpaqueNode.h"
 #include "node_api/nodes/processors.h"
@@ -72,6 +72,7 @@
 #include "fft_convolver/AudioFFT.cpp"
 #include "fft_convolver/FFTConvolver.cpp"
 #include "fft_convolver/TwoStageFFTConvolver.cpp"
+#include "fft_convolver/MultiStageFFTConvolver.cpp"
 
 
 #include "dsp_basics/ConvolutionBase.cpp"
@@ -80,6 +81,9 @@
 #include "unit_test/wrapper_tests.cpp"
 #include "unit_test/node_tests.cpp"
 #include "unit_test/container_tests.cpp"
+#include "unit_test/filter_tests.cpp"
+#include "unit_test/convolution_tests.cpp"
+#include "unit_test/fft_tests.cpp"
 #endif
 
 #include "dsp_nodes/CoreNodes.cpp"
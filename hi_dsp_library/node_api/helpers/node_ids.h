@@ -144,6 +144,8 @@ DECLARE_ID(CompileChannelAmount);
 DECLARE_ID(HasTail);
 DECLARE_ID(SourceId);
 DECLARE_ID(SuspendOnSilence);
+DECLARE_ID(Parallel);
+DECLARE_ID(SpecialiseDelay);
 
 struct Helpers
 {
@@ -164,7 +166,8 @@ struct Helpers
 			AllowCompilation,
 			HasTail,
 			SuspendOnSilence,
-            CompileChannelAmount
+            CompileChannelAmount,
+			SpecialiseDelay
 		};
 
 		return dIds;
@@ -188,6 +191,7 @@ struct Helpers
 		returnIfDefault(AllowCompilation, false);
 		returnIfDefault(AllowPolyphonic, false);
         returnIfDefault(CompileChannelAmount, 2);
+		returnIfDefault(SpecialiseDelay, 0);
 
         return {};
 	}
@@ -88,11 +88,18 @@ template <typename FrameType> struct Frame
 };
 }
 
-template <class ParameterClass, typename... Processors> struct multi: public container_base<ParameterClass, Processors...>
+/** Processes every child with a different slice of the channels.
+
+	If IsParallel is true, the children will be processed concurrently on the RealtimeWorkerGroup. Since
+	the channels don't overlap, this doesn't need any additional buffers. The children must not modulate
+	each other (the C++ builder uses the serial multi for these networks). Use the multi and parallel_multi
+	aliases instead of this class directly.
+*/
+template <bool IsParallel, class ParameterClass, typename... Processors> struct multi_base: public container_base<ParameterClass, Processors...>
 {
     using Type = container_base<ParameterClass, Processors...>;
     
-	SN_GET_SELF_AS_OBJECT(multi);
+	SN_GET_SELF_AS_OBJECT(multi_base);
 
 	constexpr static int NumChannels = Helpers::getSummedChannels<Processors...>();
 
@@ -101,6 +108,9 @@ template <class ParameterClass, typename... Processors> struct multi: public con
 	using FrameType = snex::Types::span<float, NumChannels>;
 	using FrameProcessor = multiprocessor::Frame<FrameType>;
 
+	static constexpr int N = sizeof...(Processors);
+	static constexpr bool ProcessParallel = IsParallel && N > 1;
+
 	static constexpr int getNumChannels()
 	{
 		return NumChannels;
@@ -109,12 +119,14 @@ template <class ParameterClass, typename... Processors> struct multi: public con
 	void prepare(PrepareSpecs ps)
 	{
 		call_tuple_iterator1(prepare, ps);
+
+		if (ProcessParallel && workers == nullptr)
+			workers.reset(new SharedResourcePointer<RealtimeWorkerGroup>());
 	}
 
 	void process(BlockType& d)
 	{
-		BlockProcessor p(d);
-		call_tuple_iterator1(process, p);
+		processInternal(d, std::integral_constant<bool, ProcessParallel>());
 	}
 
 	void processFrame(FrameType& data)
@@ -129,15 +141,66 @@ template <class ParameterClass, typename... Processors> struct multi: public con
 		call_tuple_iterator1(handleHiseEvent, copy);
 	}
 
-	
-
 private:
 
+	void processInternal(BlockType& d, std::false_type)
+	{
+		BlockProcessor p(d);
+		call_tuple_iterator1(process, p);
+	}
+
+	void processInternal(BlockType& d, std::true_type)
+	{
+		auto f = [&](int branchIndex)
+		{
+			processBranch(branchIndex, d, this->getIndexSequence());
+		};
+
+		(*workers)->execute(N, f);
+	}
+
+	template <std::size_t ...Ns> void processBranch(int branchIndex, BlockType& d, std::index_sequence<Ns...>)
+	{
+		using BranchFunction = void(*)(multi_base&, BlockType&);
+		static constexpr BranchFunction functions[] = { &multi_base::template processBranchStatic<Ns>... };
+		functions[branchIndex](*this, d);
+	}
+
+	static constexpr int getChannelOffset(int index)
+	{
+		constexpr int numChannels[] = { Processors::NumChannels... };
+
+		int offset = 0;
+
+		for (int i = 0; i < index; i++)
+			offset += numChannels[i];
+
+		return offset;
+	}
+
+	template <std::size_t Index> static void processBranchStatic(multi_base& m, BlockType& d)
+	{
+		auto& obj = std::get<Index>(m.elements);
+
+		using BranchType = typename std::tuple_element<Index, std::tuple<Processors...>>::type;
+		constexpr int NumChannelsThisTime = BranchType::NumChannels;
+		constexpr int ChannelOffset = getChannelOffset((int)Index);
+
+		ProcessData<NumChannelsThisTime> thisData(d.getRawDataPointers() + ChannelOffset, d.getNumSamples());
+		thisData.copyNonAudioDataFrom(d);
+
+		obj.process(thisData);
+	}
+
 	tuple_iterator_op (process, BlockProcessor);
 	tuple_iterator_op (processFrame, FrameProcessor);
-	
+
+	std::unique_ptr<SharedResourcePointer<RealtimeWorkerGroup>> workers;
 };
 
+template <class ParameterClass, typename... Processors> using multi = multi_base<false, ParameterClass, Processors...>;
+template <class ParameterClass, typename... Processors> using parallel_multi = multi_base<true, ParameterClass, Processors...>;
+
 }
 
 }
@@ -135,11 +135,19 @@ template <typename FrameType, int N> struct Frame
 };
 }
 
-template <class ParameterClass, typename... Processors> struct split : public container_base<ParameterClass, Processors...>
+/** Processes every child with a copy of the input signal and sums up the outputs.
+
+	If IsParallel is true, the children will be processed concurrently on the RealtimeWorkerGroup and
+	joined before the signals are summed up in order (so the result is identical to the serial
+	processing as long as the children don't modulate each other, the C++ builder uses the serial
+	split for these networks). This is only worth it if the children are heavy. Use the split and
+	parallel_split aliases instead of this class directly.
+*/
+template <bool IsParallel, class ParameterClass, typename... Processors> struct split_base : public container_base<ParameterClass, Processors...>
 {
     using Type = container_base<ParameterClass, Processors...>;
     
-	SN_GET_SELF_AS_OBJECT(split);
+	SN_GET_SELF_AS_OBJECT(split_base);
 	static constexpr int N = sizeof...(Processors);
 
 	static constexpr int NumChannels = Helpers::getNumChannelsOfFirstElement<Processors...>();
@@ -152,6 +160,8 @@ template <class ParameterClass, typename... Processors> struct split : public co
 	using FrameProcessor = splitprocessor::Frame<FrameType, N>;
 
 	using BufferType = snex::Types::heap<float>;
+
+	static constexpr bool ProcessParallel = IsParallel && N > 1;
 	
 	void prepare(PrepareSpecs ps)
 	{
@@ -162,6 +172,15 @@ template <class ParameterClass, typename... Processors> struct split : public co
             snex::Types::FrameConverters::increaseBuffer(originalBuffer, ps);
 			snex::Types::FrameConverters::increaseBuffer(workBuffer, ps);
 		}
+
+		if (ProcessParallel)
+		{
+			for (auto& b : parallelBuffers)
+				snex::Types::FrameConverters::increaseBuffer(b, ps);
+
+			if (workers == nullptr)
+				workers.reset(new SharedResourcePointer<RealtimeWorkerGroup>());
+		}
 	}
 
 	template <class ProcessDataType> void process(ProcessDataType& d)
@@ -173,8 +192,7 @@ template <class ParameterClass, typename... Processors> struct split : public co
 			jassert(!workBuffer.isEmpty());
 		}
 
-		BlockProcessor p(d, originalBuffer, workBuffer);
-		call_tuple_iterator1(process, p);
+		processInternal(d, std::integral_constant<bool, ProcessParallel>());
 	}
 
 	void processFrame(FrameType& d)
@@ -191,13 +209,81 @@ template <class ParameterClass, typename... Processors> struct split : public co
 
 private:
 
+	template <class ProcessDataType> void processInternal(ProcessDataType& d, std::false_type)
+	{
+		BlockProcessor p(d, originalBuffer, workBuffer);
+		call_tuple_iterator1(process, p);
+	}
+
+	template <class ProcessDataType> void processInternal(ProcessDataType& d, std::true_type)
+	{
+		snex::Types::dyn<float> ob(originalBuffer);
+		ProcessDataHelpers<NumChannels>::copyTo(d, ob);
+
+		auto f = [&](int branchIndex)
+		{
+			processBranch(branchIndex, d, this->getIndexSequence());
+		};
+
+		(*workers)->execute(N, f);
+
+		auto dPtr = d.getRawDataPointers();
+
+		for (int i = 1; i < N; i++)
+		{
+			auto wPtr = parallelBuffers[i].begin();
+
+			for (int c = 0; c < d.getNumChannels(); c++)
+			{
+				FloatVectorOperations::add(dPtr[c], wPtr, d.getNumSamples());
+				wPtr += d.getNumSamples();
+			}
+		}
+	}
+
+	template <class ProcessDataType, std::size_t ...Ns> void processBranch(int branchIndex, ProcessDataType& d, std::index_sequence<Ns...>)
+	{
+		using BranchFunction = void(*)(split_base&, ProcessDataType&);
+		static constexpr BranchFunction functions[] = { &split_base::template processBranchStatic<Ns, ProcessDataType>... };
+		functions[branchIndex](*this, d);
+	}
+
+	template <std::size_t Index, class ProcessDataType> static void processBranchStatic(split_base& s, ProcessDataType& d)
+	{
+		auto& obj = std::get<Index>(s.elements);
+
+		if (Index == 0)
+		{
+			obj.process(d);
+			return;
+		}
+
+		snex::Types::dyn<float> ob(s.originalBuffer);
+		snex::Types::dyn<float> wb(s.parallelBuffers[Index]);
+		ob.copyTo(wb);
+
+		auto wcd = snex::Types::ProcessDataHelpers<NumChannels>::makeChannelData(wb, d.getNumSamples());
+
+		ProcessData<NumChannels> wd(wcd.begin(), d.getNumSamples());
+		wd.copyNonAudioDataFrom(d);
+
+		obj.process(wd);
+	}
+
 	tuple_iterator_op(process, BlockProcessor);
 	tuple_iterator_op(processFrame, FrameProcessor);
 
 	BufferType originalBuffer;
 	BufferType workBuffer;
+
+	// one work buffer per child so that they can be processed concurrently (the first one is unused)
+	BufferType parallelBuffers[ProcessParallel ? N : 1];
+	std::unique_ptr<SharedResourcePointer<RealtimeWorkerGroup>> workers;
 };
 
+template <class ParameterClass, typename... Processors> using split = split_base<false, ParameterClass, Processors...>;
+template <class ParameterClass, typename... Processors> using parallel_split = split_base<true, ParameterClass, Processors...>;
+
 }
 
 }
@@ -0,0 +1,197 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+#pragma once
+
+namespace scriptnode
+{
+using namespace juce;
+using namespace hise;
+
+namespace container
+{
+
+namespace voicebatchprocessor
+{
+template <typename ProcessDataType> struct Batch
+{
+	Batch(VoiceBatch& b_) :
+		b(b_)
+	{}
+
+	template <class T> void operator()(T& obj)
+	{
+		if constexpr (prototypes::check::processVoiceBatch<T>::value)
+			obj.processVoiceBatch(b);
+		else
+			b.template processEachVoice<ProcessDataType>(obj);
+	}
+
+	VoiceBatch& b;
+};
+}
+
+/** A chain that can render multiple voices side by side.
+
+	If it's processed like a normal chain (one voice at a time), it will behave exactly 
+	like a container::chain. However if the host calls processVoices() with the audio data 
+	of multiple voices, it will interleave up to VoiceBatch::NumLanes voices into a multi-lane
+	frame buffer and call processVoiceBatch() on each child node.
+
+	Nodes with a simple per-voice state (core::phasor, core::oscillator, core::ramp, core::gain
+	and core::smoother) process all lanes at once, every other node will render each voice of 
+	the batch separately so the output is the same as with the serial voice rendering.
+
+	The C++ code generator uses this as root container of compiled polyphonic networks and
+	the scriptnode synthesiser renders all active voices with a single processVoices() call
+	if the network is frozen.
+*/
+template <class ParameterClass, typename... Processors> struct voice_batch : public chain<ParameterClass, Processors...>
+{
+	using ChainType = chain<ParameterClass, Processors...>;
+	using Type = typename ChainType::Type;
+	using BatchProcessor = voicebatchprocessor::Batch<typename ChainType::BlockType>;
+
+	static constexpr int NumLanes = VoiceBatch::NumLanes;
+
+	SN_GET_SELF_AS_OBJECT(voice_batch);
+
+	voice_batch() = default;
+
+	void prepare(PrepareSpecs ps)
+	{
+		ChainType::prepare(ps);
+
+		polyHandler = ps.voiceIndex;
+
+		auto numPerVoice = jmax(0, ps.numChannels * ps.blockSize);
+
+		batchBuffer.setSize(numPerVoice);
+		scratchBuffer.setSize(numPerVoice);
+	}
+
+	/** Renders all child nodes for the voices in the batch. */
+	void processVoiceBatch(VoiceBatch& b)
+	{
+		BatchProcessor p(b);
+		call_tuple_iterator1(processVoiceBatch, p);
+	}
+
+	/** Renders the given voices in batches of VoiceBatch::NumLanes voices.
+
+		*voiceData[i] must contain the audio data for the voice with the index voiceIndexes[i].
+		All voices of a batch must have the same amount of channels and samples, otherwise
+		they will be rendered one after another.
+	*/
+	void processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices)
+	{
+		for (int start = 0; start < numVoices; start += NumLanes)
+		{
+			auto numThisTime = jmin(NumLanes, numVoices - start);
+			auto& first = *voiceData[start];
+
+			VoiceBatch b;
+			b.frames = batchBuffer.begin();
+			b.scratch = scratchBuffer.begin();
+			b.polyHandler = polyHandler;
+			b.numSamples = first.getNumSamples();
+			b.numChannels = first.getNumChannels();
+			b.numActiveLanes = numThisTime;
+
+			bool canBatch = b.numChannels * b.numSamples <= scratchBuffer.size();
+
+			for (int l = 0; l < numThisTime; l++)
+			{
+				auto& vd = *voiceData[start + l];
+				b.voiceIndexes[l] = voiceIndexes[start + l];
+				canBatch &= vd.getNumSamples() == b.numSamples && vd.getNumChannels() == b.numChannels;
+			}
+
+			if (!canBatch)
+			{
+				for (int l = 0; l < numThisTime; l++)
+				{
+					if (polyHandler != nullptr)
+					{
+						PolyHandler::ScopedVoiceSetter svs(*polyHandler, voiceIndexes[start + l]);
+						this->process(voiceData[start + l]->template as<typename ChainType::BlockType>());
+					}
+					else
+						this->process(voiceData[start + l]->template as<typename ChainType::BlockType>());
+				}
+
+				continue;
+			}
+
+			for (int c = 0; c < b.numChannels; c++)
+			{
+				auto dst = b.getFrames(c);
+
+				for (int i = 0; i < b.numSamples; i++)
+				{
+					for (int l = 0; l < numThisTime; l++)
+						dst[i][l] = voiceData[start + l]->getRawDataPointers()[c][i];
+
+					for (int l = numThisTime; l < NumLanes; l++)
+						dst[i][l] = 0.0f;
+				}
+			}
+
+			processVoiceBatch(b);
+
+			for (int c = 0; c < b.numChannels; c++)
+			{
+				auto src = b.getFrames(c);
+
+				for (int l = 0; l < numThisTime; l++)
+				{
+					auto dst = voiceData[start + l]->getRawDataPointers()[c];
+
+					for (int i = 0; i < b.numSamples; i++)
+						dst[i] = src[i][l];
+				}
+			}
+		}
+	}
+
+private:
+
+	tuple_iterator_op(processVoiceBatch, BatchProcessor);
+
+	PolyHandler* polyHandler = nullptr;
+	heap<VoiceBatch::FrameType> batchBuffer;
+	heap<float> scratchBuffer;
+};
+
+}
+
+}
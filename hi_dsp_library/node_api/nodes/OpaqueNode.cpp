@@ -73,6 +73,12 @@ void OpaqueNode::processFrame(StereoFrame& d)
 	stereoFrame(getObjectPtr(), &d);
 }
 
+void OpaqueNode::processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices)
+{
+	jassert(canProcessVoices());
+	voicesFunc(getObjectPtr(), voiceIndexes, voiceData, numVoices);
+}
+
 void OpaqueNode::reset()
 {
 	resetFunc(getObjectPtr());
@@ -138,6 +144,7 @@ void OpaqueNode::callDestructor()
 		object.free();
 		parameters.clear();
 		destructFunc = nullptr;
+		voicesFunc = nullptr;
 	}
 }
 
@@ -171,6 +171,9 @@ struct OpaqueNode
 		else
 			numChannels = -1;
 
+		if constexpr (prototypes::check::processVoices<T>::value)
+			voicesFunc = prototypes::static_wrappers<T>::processVoices;
+
 		if constexpr (prototypes::check::handleModulation<T>::value)
 		{
 			modFunc = prototypes::static_wrappers<T>::handleModulation;
@@ -216,6 +219,12 @@ struct OpaqueNode
 
 	void processFrame(StereoFrame& d);
 
+	/** Renders multiple voices at once. Only call this if canProcessVoices() returns true. */
+	void processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices);
+
+	/** Returns true if the node can render multiple voices at once (see container::voice_batch). */
+	bool canProcessVoices() const { return voicesFunc != nullptr; }
+
 	void reset();
 
 	void handleHiseEvent(HiseEvent& e);
@@ -302,6 +311,7 @@ private:
 	prototypes::process<ProcessDataDyn> processFunc = nullptr;
 	prototypes::processFrame<MonoFrame> monoFrame = nullptr;
 	prototypes::processFrame<StereoFrame> stereoFrame = nullptr;
+	prototypes::processVoices voicesFunc = nullptr;
 	prototypes::initialise initFunc = nullptr;
 	prototypes::setExternalData externalDataFunc = nullptr;
     prototypes::connectRuntimeTarget connectRuntimeFunc = nullptr;
@@ -452,7 +462,7 @@ namespace dll
 	{
 		// This is just used to check whether the dll is deprecated and needs to be recompiled...
 		// (It will be bumped whenever a breaking change into the DLL API is introduced)...
-		static constexpr int DllUpdateCounter = 3;
+		static constexpr int DllUpdateCounter = 4;
 
 		using Ptr = ReferenceCountedObjectPtr<ProjectDll>;
 
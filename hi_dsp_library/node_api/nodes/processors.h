@@ -318,6 +318,12 @@ public:
 		this->obj.processFrame(d);
 	}
 
+	/** Forwards the voice batch to its wrapped object if it supports the batch processing. */
+	template <typename VoiceBatchType, typename ObjectType=T> auto processVoiceBatch(VoiceBatchType& b) -> decltype(std::declval<ObjectType&>().processVoiceBatch(b))
+	{
+		this->obj.processVoiceBatch(b);
+	}
+
 	/** Forwards the callback to its wrapped object. */
 	void createParameters(ParameterDataList& data)
 	{
@@ -362,6 +368,12 @@ public:
 		i.initialise(n);
 	}
 
+	/** Forwards the voice batch to its wrapped object if it supports the batch processing. */
+	template <typename VoiceBatchType, typename ObjectType=T> auto processVoiceBatch(VoiceBatchType& b) -> decltype(std::declval<ObjectType&>().processVoiceBatch(b))
+	{
+		this->obj.processVoiceBatch(b);
+	}
+
 	constexpr OPTIONAL_BOOL_CLASS_FUNCTION(isPolyphonic);
 	constexpr OPTIONAL_BOOL_CLASS_FUNCTION(isNormalisedModulation);
 	OPTIONAL_BOOL_CLASS_FUNCTION(isProcessingHiseEvent);
@@ -1685,6 +1697,13 @@ template <class T> struct node : public scriptnode::data::base
 		obj.processFrame(fd);
 	}
 
+	/** Forwards the rendering of multiple voices if the root container is a container::voice_batch. */
+	template <typename ObjectType=T> auto processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices) -> decltype(std::declval<ObjectType&>().processVoices(voiceIndexes, voiceData, numVoices))
+	{
+		jassert(numVoices == 0 || voiceData[0]->getNumChannels() == NumChannels);
+		obj.processVoices(voiceIndexes, voiceData, numVoices);
+	}
+
 	void prepare(PrepareSpecs ps)
 	{
 		if (ps.numChannels != NumChannels)
@@ -52,6 +52,7 @@ namespace prototypes
 
 	template <typename ProcessDataType> using process = void(*)(void*, ProcessDataType*);
 	template <typename FrameDataType> using processFrame = void(*)(void*, FrameDataType*);
+	typedef void(*processVoices)(void*, const int*, ProcessDataDyn**, int);
 
 	namespace check
 	{
@@ -82,6 +83,24 @@ namespace prototypes
 			enum { value = sizeof(test<T>(0)) == sizeof(char) };
 		};
 
+		template <typename T> class processVoiceBatch
+		{
+			typedef char one; struct two { char x[2]; };
+			template <typename C> static one test(decltype(std::declval<C&>().processVoiceBatch(std::declval<snex::Types::VoiceBatch&>()))*);
+			template <typename C> static two test(...);
+		public:
+			enum { value = sizeof(test<T>(0)) == sizeof(char) };
+		};
+
+		template <typename T> class processVoices
+		{
+			typedef char one; struct two { char x[2]; };
+			template <typename C> static one test(decltype(std::declval<C&>().processVoices(std::declval<const int*>(), std::declval<ProcessDataDyn**>(), 0))*);
+			template <typename C> static two test(...);
+		public:
+			enum { value = sizeof(test<T>(0)) == sizeof(char) };
+		};
+
 		template <typename T> class isPolyphonic
 		{
 			typedef char one; struct two { char x[2]; };
@@ -241,6 +260,7 @@ namespace prototypes
 
 		template <typename ProcessDataType> static void process(void* obj, ProcessDataType* data) { static_cast<T*>(obj)->process(*data); }
 		template <typename FrameDataType> static void processFrame(void* obj, FrameDataType* data) { static_cast<T*>(obj)->processFrame(*data); };
+		static void processVoices(void* obj, const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices) { static_cast<T*>(obj)->processVoices(voiceIndexes, voiceData, numVoices); }
 		static void reset(void* obj) { static_cast<T*>(obj)->reset(); }
 		static void handleHiseEvent(void* obj, HiseEvent* e) { static_cast<T*>(obj)->handleHiseEvent(*e); };
 		static void initialise(void* obj, NodeBase* n) { static_cast<T*>(obj)->initialise(n); };
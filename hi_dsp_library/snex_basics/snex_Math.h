@@ -111,10 +111,76 @@ return b1; \
         vOpBinary(vsub, FloatVectorOperations::subtract);
         vOpBinary(vmov, FloatVectorOperations::copy);
         
+        vOpBinary(vabs, FloatVectorOperations::abs);
+        
         vOpScalar(vmuls, FloatVectorOperations::multiply);
 		vOpScalar(vadds, FloatVectorOperations::add);
 		vOpScalar(vmovs, FloatVectorOperations::fill);
         
+        static forcedinline block& vsubs(block& b1, float s)
+        {
+            FloatVectorOperations::add(b1.data, -s, b1.size());
+            return b1;
+        }
+        
+        static forcedinline block& vmins(block& b1, float s) { return min(b1, s); }
+        static forcedinline block& vmaxs(block& b1, float s) { return max(b1, s); }
+        
+        /** Returns the sum of all values. */
+        static forcedinline float vsum(const block& b)
+        {
+            return vreduce(b, 0.0f, [](float a, float v) { return a + v; }, sumOp);
+        }
+        
+        /** Returns the sum of all squared values (use this for RMS calculations). */
+        static forcedinline float vsumsq(const block& b)
+        {
+            return vreduce(b, 0.0f, [](float a, float v) { return a + v * v; }, sumOp);
+        }
+        
+        /** Returns the biggest value or the lowest float number if the block is empty. */
+        static forcedinline float vmax(const block& b)
+        {
+            return vreduce(b, std::numeric_limits<float>::lowest(), maxOp, maxOp);
+        }
+        
+        /** Returns the smallest value or the biggest float number if the block is empty. */
+        static forcedinline float vmin(const block& b)
+        {
+            return vreduce(b, std::numeric_limits<float>::max(), minOp, minOp);
+        }
+        
+        /** Returns the biggest absolute value or the lowest float number if the block is empty. */
+        static forcedinline float vpeak(const block& b)
+        {
+            return vreduce(b, std::numeric_limits<float>::lowest(), [](float a, float v) { return jmax(a, std::abs(v)); }, maxOp);
+        }
+        
+        static constexpr float sumOp(float a, float b) { return a + b; }
+        static constexpr float maxOp(float a, float b) { return a > b ? a : b; }
+        static constexpr float minOp(float a, float b) { return a < b ? a : b; }
+        
+        /** Reduces the block using four independent accumulators so that the compiler can vectorise the loop. */
+        template <typename F, typename CombineF> static forcedinline float vreduce(const block& b, float init, const F& f, const CombineF& combine)
+        {
+            float acc[4] = { init, init, init, init };
+            
+            auto ptr = b.data;
+            auto numLeft = b.size();
+            
+            for (; numLeft >= 4; numLeft -= 4, ptr += 4)
+            {
+                for (int i = 0; i < 4; i++)
+                    acc[i] = f(acc[i], ptr[i]);
+            }
+            
+            for (; numLeft > 0; numLeft--)
+                acc[0] = f(acc[0], *ptr++);
+            
+            return combine(combine(acc[0], acc[1]), combine(acc[2], acc[3]));
+        }
+        
+        
         static forcedinline block& vclip(block& b1, float s1, float s2)
         {
             FloatVectorOperations::clip(b1.data, b1.data, s1, s2, b1.size());
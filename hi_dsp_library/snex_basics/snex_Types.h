@@ -1120,6 +1120,17 @@ template <typename T, int NumVoices> struct PolyData
 		return isVoiceRenderingActive();
 	}
 
+	/** Returns the data for the given voice index. */
+	T& getWithIndex(int index)
+	{
+		return *(data + getVoiceIndex(index));
+	}
+
+	const T& getWithIndex(int index) const
+	{
+		return *(data + getVoiceIndex(index));
+	}
+
 private:
 
 	
@@ -1147,24 +1158,88 @@ private:
 		return rv;
 	}
 
+private:
 
-	T& getWithIndex(int index)
+	PolyHandler* voicePtr = nullptr;
+	mutable int lastVoiceIndex = -1;
+	int unused = 0;
+
+	T data[NumVoices];
+};
+
+/** A structure-of-arrays variant of PolyData for arithmetic types.
+
+	It has the same interface as PolyData (so you can use the for-loop syntax and get() inside
+	the voice rendering), but the values of all voices are stored in a single aligned array. 
+	If a node splits its voice state into multiple PolyDataSoA members instead of using a 
+	PolyData<SomeStruct>, a VoiceBatch can load the state of multiple voices directly into the 
+	lanes of a SIMD register.
+*/
+template <typename T, int NumVoices> struct PolyDataSoA
+{
+	static_assert(std::is_arithmetic<T>::value, "PolyDataSoA only works with arithmetic types");
+
+	PolyDataSoA(T initValue = T(0))
 	{
-		return *(data + getVoiceIndex(index));
+		for (auto& d : data)
+			d = initValue;
 	}
 
-	const T& getWithIndex(int index) const
+	/** Call this method with a PrepareSpecs object and it will setup the handling of the polyphony. */
+	void prepare(const PrepareSpecs& sp)
 	{
-		return *(data + getVoiceIndex(index));
+		jassert(!isPolyphonic() || sp.voiceIndex != nullptr);
+		jassert(isPowerOfTwo(NumVoices));
+		voicePtr = sp.voiceIndex;
+	}
+
+	void setAll(T value)
+	{
+		for (auto& d : *this)
+			d = value;
+	}
+
+	/** Returns the value of the current voice. */
+	T& get() const
+	{
+		return *begin();
+	}
+
+	T* begin() const
+	{
+		if (isPolyphonic())
+		{
+			lastVoiceIndex = voicePtr != nullptr ? voicePtr->getVoiceIndex() : -1;
+			return const_cast<T*>(data) + jmax(0, lastVoiceIndex);
+		}
+		else
+			return const_cast<T*>(data);
 	}
 
+	T* end() const
+	{
+		if (isPolyphonic())
+		{
+			auto numToIterate = lastVoiceIndex == -1 ? NumVoices : 1;
+			return const_cast<T*>(data) + jmax(0, lastVoiceIndex) + numToIterate;
+		}
+		else
+			return const_cast<T*>(data) + 1;
+	}
+
+	const T& getFirst() const { return *data; }
+
+	T& getWithIndex(int index) { return data[index & (NumVoices - 1)]; }
+	const T& getWithIndex(int index) const { return data[index & (NumVoices - 1)]; }
+
 private:
 
+	static constexpr bool isPolyphonic() { return NumVoices > 1; }
+
 	PolyHandler* voicePtr = nullptr;
 	mutable int lastVoiceIndex = -1;
-	int unused = 0;
 
-	T data[NumVoices];
+	alignas(16) T data[NumVoices];
 };
 
 }
@@ -0,0 +1,178 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licences for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licencing:
+*
+*   http://www.hartinstruments.net/hise/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#pragma once
+
+namespace snex {
+namespace Types {
+using namespace juce;
+
+/** A batch of voices that are rendered side by side.
+	@ingroup snex_data_structures
+
+	The audio data of up to NumLanes voices is interleaved so that one sample of a channel
+	is a span<float, NumLanes> with the value of every voice. Nodes that implement
+
+	@code
+	void processVoiceBatch(VoiceBatch& b);
+	@endcode
+
+	can process all voices of the batch with the same instructions. The per-voice state is
+	loaded into lane arrays with gather() before the sample loop and written back with
+	scatter() afterwards, so the inner loop only operates on contiguous lanes and can be
+	vectorised by the compiler.
+
+	Lanes that are not used by the batch (if there are less active voices than lanes) use
+	the state of the first voice and are never written back.
+*/
+struct VoiceBatch
+{
+	static constexpr int NumLanes = HISE_NUM_VOICE_BATCH_LANES;
+
+	using FrameType = span<float, NumLanes>;
+	template <typename T> using LaneType = span<T, NumLanes>;
+
+	/** Returns the multi-lane samples of the given channel. */
+	FrameType* getFrames(int channelIndex) const
+	{
+		jassert(isPositiveAndBelow(channelIndex, numChannels));
+		return frames + channelIndex * numSamples;
+	}
+
+	int getNumSamples() const { return numSamples; }
+	int getNumChannels() const { return numChannels; }
+	int getNumActiveLanes() const { return numActiveLanes; }
+
+	/** Returns the voice index that is rendered in the given lane. */
+	int getVoiceIndex(int lane) const
+	{
+		return voiceIndexes[lane < numActiveLanes ? lane : 0];
+	}
+
+	/** Copies a value of the voice state of every lane into a lane array. */
+	template <typename T, typename DataType, int NV, typename GetterType>
+	LaneType<T> gather(const PolyData<DataType, NV>& d, const GetterType& f) const
+	{
+		LaneType<T> v;
+
+		for (int i = 0; i < NumLanes; i++)
+			v[i] = f(d.getWithIndex(getVoiceIndex(i)));
+
+		return v;
+	}
+
+	/** Writes back the values of the active lanes into the voice state. */
+	template <typename T, typename DataType, int NV, typename SetterType>
+	void scatter(PolyData<DataType, NV>& d, const LaneType<T>& v, const SetterType& f) const
+	{
+		for (int i = 0; i < numActiveLanes; i++)
+			f(d.getWithIndex(voiceIndexes[i]), v[i]);
+	}
+
+	/** Loads the values of the batch voices from a PolyDataSoA container. */
+	template <typename T, int NV> LaneType<T> gather(const PolyDataSoA<T, NV>& d) const
+	{
+		LaneType<T> v;
+
+		for (int i = 0; i < NumLanes; i++)
+			v[i] = d.getWithIndex(getVoiceIndex(i));
+
+		return v;
+	}
+
+	/** Writes back the values of the active lanes into a PolyDataSoA container. */
+	template <typename T, int NV> void scatter(PolyDataSoA<T, NV>& d, const LaneType<T>& v) const
+	{
+		for (int i = 0; i < numActiveLanes; i++)
+			d.getWithIndex(voiceIndexes[i]) = v[i];
+	}
+
+	/** Renders each active lane separately with the process() method of the given node.
+
+		This is used for nodes that don't support the voice batch processing. It will
+		deinterleave the lane into the scratch buffer, set the voice index of the poly handler
+		and interleave the result back into the lane. The ProcessDataType must be the type
+		that the parent container uses for its children.
+	*/
+	template <typename ProcessDataType, typename T> void processEachVoice(T& obj)
+	{
+		jassert(scratch != nullptr);
+
+		float* ptrs[NUM_MAX_CHANNELS];
+
+		for (int c = 0; c < numChannels; c++)
+			ptrs[c] = scratch + c * numSamples;
+
+		for (int l = 0; l < numActiveLanes; l++)
+		{
+			for (int c = 0; c < numChannels; c++)
+			{
+				auto src = getFrames(c);
+
+				for (int i = 0; i < numSamples; i++)
+					ptrs[c][i] = src[i][l];
+			}
+
+			ProcessDataDyn d(ptrs, numSamples, numChannels);
+			auto& pd = d.template as<ProcessDataType>();
+
+			if (polyHandler != nullptr)
+			{
+				PolyHandler::ScopedVoiceSetter svs(*polyHandler, voiceIndexes[l]);
+				obj.process(pd);
+			}
+			else
+				obj.process(pd);
+
+			for (int c = 0; c < numChannels; c++)
+			{
+				auto dst = getFrames(c);
+
+				for (int i = 0; i < numSamples; i++)
+					dst[i][l] = ptrs[c][i];
+			}
+		}
+	}
+
+	FrameType* frames = nullptr;
+	float* scratch = nullptr;
+	PolyHandler* polyHandler = nullptr;
+
+	int numSamples = 0;
+	int numChannels = 0;
+	int numActiveLanes = 0;
+
+	span<int, NumLanes> voiceIndexes;
+};
+
+}
+}
@@ -0,0 +1,177 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+namespace hise
+{
+
+namespace tests
+{
+using namespace juce;
+
+/** Compares the multi stage convolver against a direct convolution. */
+struct MultiStageConvolutionTests : public UnitTest
+{
+	MultiStageConvolutionTests() :
+		UnitTest("Testing multi stage convolution", "convolution_tests")
+	{}
+
+	void runTest() override
+	{
+		// small block sizes so that the impulse response spans all stages
+		testAgainstDirectConvolution(64, 128, 20000, 4096);
+		testAgainstDirectConvolution(64, 256, 6000, 1024);
+		testAgainstDirectConvolution(512, 512, 30000, 32768);
+		testAgainstDirectConvolution(128, 128, 100, 4096);
+
+		testSharedWorkers();
+	}
+
+	static std::vector<float> createNoise(Random& r, int numSamples)
+	{
+		std::vector<float> data((size_t)numSamples);
+
+		for (auto& s : data)
+			s = r.nextFloat() * 2.0f - 1.0f;
+
+		return data;
+	}
+
+	static double getMaxError(const std::vector<float>& input, const std::vector<float>& ir, const std::vector<float>& output)
+	{
+		const int irLength = (int)ir.size();
+		double maxError = 0.0;
+
+		for (int i = 0; i < (int)output.size(); i += 7)
+		{
+			double expected = 0.0;
+
+			for (int j = jmax(0, i - irLength + 1); j <= i; j++)
+				expected += (double)input[(size_t)j] * (double)ir[(size_t)(i - j)];
+
+			maxError = jmax(maxError, std::abs(expected - (double)output[(size_t)i]));
+		}
+
+		return maxError;
+	}
+
+	/** Renders two convolvers of different effects on the shared worker pool. */
+	void testSharedWorkers()
+	{
+		beginTest("Testing shared convolution workers");
+
+		static constexpr int NumConvolvers = 2;
+		static constexpr int BlockSize = 64;
+
+		Random r(0x5678);
+
+		auto input = createNoise(r, BlockSize * 190);
+		std::vector<float> irs[NumConvolvers] = { createNoise(r, 5000), createNoise(r, 3000) };
+		std::vector<float> outputs[NumConvolvers] = { std::vector<float>(input.size()), std::vector<float>(input.size()) };
+
+		OwnedArray<MultithreadedConvolver::BackgroundThread> threads;
+		ReferenceCountedArray<MultithreadedConvolver> convolvers;
+
+		for (int i = 0; i < NumConvolvers; i++)
+		{
+			auto c = new MultithreadedConvolver(audiofft::ImplementationType::BestAvailable);
+			c->init(BlockSize, BlockSize * 2, irs[i].data(), irs[i].size());
+			c->setUseBackgroundThread(threads.add(new MultithreadedConvolver::BackgroundThread()));
+			convolvers.add(c);
+		}
+
+		expect(&threads[0]->workerPool.get() == &threads[1]->workerPool.get(), "not the same pool");
+
+		for (int pos = 0; pos < (int)input.size(); pos += BlockSize)
+		{
+			for (int i = 0; i < NumConvolvers; i++)
+				convolvers[i]->process(input.data() + pos, outputs[i].data() + pos, BlockSize);
+		}
+
+		for (int i = 0; i < NumConvolvers; i++)
+		{
+			auto maxError = getMaxError(input, irs[i], outputs[i]);
+			expect(maxError < 0.01, "Max error of convolver " + String(i + 1) + ": " + String(maxError));
+		}
+
+		for (int i = 0; i < NumConvolvers; i++)
+		{
+			convolvers[i]->cleanPipeline();
+			convolvers[i]->setUseBackgroundThread(nullptr);
+		}
+
+		convolvers.clear();
+		threads.clear();
+	}
+
+	void testAgainstDirectConvolution(int headSize, int firstTailSize, int irLength, int maxTailSize)
+	{
+		beginTest("Testing head " + String(headSize) + ", first tail " + String(firstTailSize) + ", IR length " + String(irLength));
+
+		Random r(irLength);
+
+		auto ir = createNoise(r, irLength);
+
+		const int numSamples = irLength * 2 + 1000;
+		auto input = createNoise(r, numSamples);
+
+		fftconvolver::MultiStageFFTConvolver c(audiofft::ImplementationType::BestAvailable);
+		c.init((size_t)headSize, (size_t)firstTailSize, ir.data(), ir.size(), (size_t)maxTailSize);
+
+		expect(irLength <= 2 * firstTailSize || c.getNumTailStages() > 0, "no tail stages");
+		logMessage("Tail stages: " + String((int)c.getNumTailStages()));
+
+		std::vector<float> output((size_t)numSamples);
+
+		// odd buffer sizes to check the stage boundaries
+		int pos = 0;
+		int blockIndex = 0;
+
+		while (pos < numSamples)
+		{
+			const int blockSizes[4] = { headSize, 17, headSize / 2, 3 * headSize };
+			auto numThisTime = jmin(numSamples - pos, blockSizes[blockIndex++ % 4]);
+			c.process(input.data() + pos, output.data() + pos, (size_t)numThisTime);
+			pos += numThisTime;
+		}
+
+		auto maxError = getMaxError(input, ir, output);
+
+		expect(maxError < 0.01, "Max error: " + String(maxError));
+	}
+};
+
+static MultiStageConvolutionTests multiStageConvolutionTests;
+
+}
+
+}
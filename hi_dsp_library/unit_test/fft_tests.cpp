@@ -0,0 +1,163 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licenced for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+namespace hise
+{
+
+namespace tests
+{
+using namespace juce;
+
+/** Compares the built-in SIMD FFT against the Ooura implementation and optionally measures the speed of both. */
+struct AudioFFTTests : public UnitTest
+{
+	AudioFFTTests() :
+		UnitTest("Testing FFT implementations", "fft_tests")
+	{}
+
+	/** Set this to true in order to compare the speed of the SIMD and the Ooura FFT. */
+	static constexpr bool RunBenchmarks = false;
+
+	void runTest() override
+	{
+		for (size_t size = 2; size <= 65536; size *= 2)
+			testAgainstOoura(size);
+
+		if (RunBenchmarks)
+		{
+			beginTest("Benchmarking SIMD vs. Ooura");
+
+			for (auto size : { 128, 512, 2048, 8192, 32768 })
+				benchmark((size_t)size);
+		}
+	}
+
+	static std::vector<float> createNoise(size_t size, Random& r)
+	{
+		std::vector<float> d(size);
+
+		for (auto& s : d)
+			s = r.nextFloat() * 2.0f - 1.0f;
+
+		return d;
+	}
+
+	void testAgainstOoura(size_t size)
+	{
+		beginTest("Testing FFT size " + String((int)size));
+
+		Random r((int64)size);
+		auto input = createNoise(size, r);
+
+		const auto complexSize = audiofft::AudioFFT::ComplexSize(size);
+
+		std::vector<float> re1(complexSize), im1(complexSize), re2(complexSize), im2(complexSize);
+
+		audiofft::AudioFFT ooura(audiofft::ImplementationType::Ooura);
+		audiofft::AudioFFT simd(audiofft::ImplementationType::SIMD);
+
+		ooura.init(size);
+		simd.init(size);
+
+		ooura.fft(input.data(), re1.data(), im1.data());
+		simd.fft(input.data(), re2.data(), im2.data());
+
+		// The rounding error of a FFT grows with log2(size) relative to the energy of the spectrum
+		double errorSum = 0.0;
+		double magnitudeSum = 0.0;
+
+		for (size_t i = 0; i < complexSize; i++)
+		{
+			errorSum += std::pow((double)re1[i] - (double)re2[i], 2.0) + std::pow((double)im1[i] - (double)im2[i], 2.0);
+			magnitudeSum += std::pow((double)re1[i], 2.0) + std::pow((double)im1[i], 2.0);
+		}
+
+		auto relativeError = std::sqrt(errorSum / magnitudeSum);
+		auto tolerance = 4.0 * (double)std::numeric_limits<float>::epsilon() * std::log2((double)size);
+
+		expect(relativeError < tolerance, "Forward mismatch: " + String(relativeError) + ", tolerance: " + String(tolerance));
+
+		std::vector<float> output(size);
+		simd.ifft(output.data(), re2.data(), im2.data());
+
+		auto maxError = 0.0f;
+
+		for (size_t i = 0; i < size; i++)
+			maxError = jmax(maxError, std::abs(input[i] - output[i]));
+
+		expect(maxError < 1e-4f, "Roundtrip error: " + String(maxError));
+	}
+
+	static double measure(audiofft::ImplementationType type, size_t size, int numRuns)
+	{
+		Random r(0x5678);
+		auto input = createNoise(size, r);
+
+		const auto complexSize = audiofft::AudioFFT::ComplexSize(size);
+		std::vector<float> re(complexSize), im(complexSize), output(size);
+
+		audiofft::AudioFFT fft(type);
+		fft.init(size);
+
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numRuns; i++)
+		{
+			fft.fft(input.data(), re.data(), im.data());
+			fft.ifft(output.data(), re.data(), im.data());
+		}
+
+		return Time::getMillisecondCounterHiRes() - start;
+	}
+
+	void benchmark(size_t size)
+	{
+		auto numRuns = jmax(16, (int)(4 * 1024 * 1024 / size));
+
+		auto oouraTime = measure(audiofft::ImplementationType::Ooura, size, numRuns);
+		auto simdTime = measure(audiofft::ImplementationType::SIMD, size, numRuns);
+
+		String msg;
+		msg << "Size " << String((int)size) << ", " << String(numRuns) << " roundtrips: ";
+		msg << "Ooura: " << String(oouraTime, 2) << " ms, SIMD: " << String(simdTime, 2) << " ms, ";
+		msg << "speedup: " << String(oouraTime / jmax(0.001, simdTime), 2) << "x";
+
+		logMessage(msg);
+	}
+};
+
+static AudioFFTTests audioFFTTests;
+
+}
+
+}
@@ -0,0 +1,306 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licences for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licencing:
+*
+*   http://www.hartinstruments.net/hise/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise
+{
+
+namespace tests
+{
+using namespace juce;
+
+/** Checks the frame, block and render processing of the filter subtypes against the
+	output of the per-sample implementation that was used before the block kernels. */
+struct MultiChannelFilterTests : public UnitTest
+{
+	MultiChannelFilterTests() :
+		UnitTest("Testing multi channel filters", "filter_tests")
+	{}
+
+	static constexpr int NumChannels = 2;
+	static constexpr int NumReferenceSamples = 6;
+	static constexpr double SampleRate = 44100.0;
+
+	/** Set this to true in order to measure the frame vs. block throughput. */
+	static constexpr bool RunBenchmarks = false;
+
+	enum class ProcessType
+	{
+		Frame,
+		Block,
+		Render
+	};
+
+	struct Reference
+	{
+		const char* filterId;
+		int mode;
+		bool useRender;
+		float values[NumChannels * NumReferenceSamples];
+	};
+
+	/** The sample positions of the reference values. */
+	static constexpr int ReferenceIndexes[NumReferenceSamples] = { 12, 77, 180, 400, 650, 765 };
+
+	/** The output at ReferenceIndexes of every channel. This was recorded with the per-sample
+		processFrame() and render() methods before the block kernels were added (with the
+		fixed SVF allpass mode). The moog filter is stored as "Moog". */
+	static const Reference* getReferences(int& numReferences)
+	{
+		static const Reference references[] =
+		{
+		{ "StaticBiquad", 0, false, { -0.01678043f, -0.02188857f, -0.08731361f, -0.2402581f, -0.3198497f, -0.2386996f, 0.1428149f, -0.2218619f, -0.001000959f, -0.3344627f, -0.08003173f, 0.7539444f } },  // LowPass
+		{ "StaticBiquad", 0, true, { -0.01678043f, -0.03937819f, -0.07639202f, -0.1289647f, 0.06995247f, 0.1915361f, 0.1428149f, -0.2380726f, 0.03989689f, -0.07855057f, 0.1115539f, 0.2574527f } },  // LowPass
+		{ "StaticBiquad", 1, false, { -0.7011383f, -0.5802715f, -1.071284f, 0.7122107f, 0.3653265f, 1.111374f, -0.6928468f, -0.05346136f, 0.5273526f, 0.03081146f, 1.030549f, -0.200765f } },  // High Pass
+		{ "StaticBiquad", 1, true, { -0.7011383f, -0.5650642f, -0.9659395f, 1.06944f, -0.3372534f, 0.8761346f, -0.6928468f, -0.05398639f, 0.4113242f, -0.1957933f, 0.8662828f, -0.2519596f } },  // High Pass
+		{ "StaticBiquad", 2, false, { -0.9814628f, -0.3060257f, -1.498676f, -0.5991204f, -3.828619f, -2.072563f, 0.1805713f, -1.976842f, -0.03528941f, -2.567227f, 2.751589f, 3.626784f } },  // Low Shelf
+		{ "StaticBiquad", 2, true, { -0.9814628f, -0.3937578f, -1.668333f, 1.258869f, -0.2531035f, 2.476892f, 0.1805713f, -2.470187f, 0.2983723f, 0.2322562f, 1.052507f, 1.208913f } },  // Low Shelf
+		{ "StaticBiquad", 3, false, { -4.998583f, -2.774682f, -5.074228f, 0.2014618f, 6.210689f, 9.094021f, -4.418762f, -0.4762774f, 4.004223f, 2.091536f, 9.301495f, 0.373374f } },  // High Shelf
+		{ "StaticBiquad", 3, true, { -4.998583f, -3.157793f, -5.105395f, 6.749067f, -2.358942f, 2.670505f, -4.418762f, -0.3200598f, 3.357031f, -2.056055f, 3.67227f, -2.21105f } },  // High Shelf
+		{ "StaticBiquad", 4, false, { -0.9788799f, -0.3818522f, -0.6374817f, 1.588489f, -0.9894798f, 0.0957886f, -0.2119129f, -0.1319476f, 0.5090191f, -0.9650462f, 0.02271235f, 0.3690211f } },  // Peak
+		{ "StaticBiquad", 4, true, { -0.9788799f, -0.3686488f, -0.6106901f, 0.9577234f, -0.3739696f, 0.6432148f, -0.2119129f, -0.05791834f, 0.7828968f, -1.079703f, 0.7773856f, 0.9578201f } },  // Peak
+		{ "StaticBiquad", 5, false, { -0.02025958f, -0.1030004f, -0.1780712f, -0.5689345f, -0.5278128f, 0.01633148f, 0.2063789f, -0.5328633f, -0.1011946f, -0.4508995f, -0.6643656f, 0.8134379f } },  // Reso Low
+		{ "StaticBiquad", 5, true, { -0.02025958f, -0.2020138f, -0.1515211f, -0.1587648f, 0.03563321f, 0.2454797f, 0.2063789f, -0.4598728f, -0.123721f, -0.312889f, -0.09009364f, 0.29423f } },  // Reso Low
+		{ "StateVariableFilter", 0, false, { -0.01895725f, -0.07875665f, -0.1106124f, -0.4389456f, -0.4478792f, -0.2687997f, 0.1827832f, -0.4103407f, -0.02308554f, -0.3764594f, -0.226251f, 0.7895917f } },  // LP
+		{ "StateVariableFilter", 0, true, { -0.01895725f, -0.1077696f, -0.01688434f, -0.1532321f, 0.09062322f, 0.2500612f, 0.1827832f, -0.3734467f, -0.01116142f, -0.1538461f, 0.06735977f, 0.3341424f } },  // LP
+		{ "StateVariableFilter", 1, false, { -0.7975882f, -0.3946172f, -0.9878891f, 0.9828506f, 0.3808524f, 1.241493f, -0.6709815f, 0.1083647f, 0.6299355f, -0.01702762f, 1.353338f, -0.235613f } },  // HP
+		{ "StateVariableFilter", 1, true, { -0.7975882f, -0.3807039f, -1.063447f, 1.15737f, -0.492384f, 0.7358826f, -0.6709815f, 0.04951316f, 0.5638379f, -0.2243308f, 0.8510059f, -0.1577654f } },  // HP
+		{ "StateVariableFilter", 2, false, { -0.1417412f, 0.1344879f, 0.2876822f, 0.6569878f, -0.5206217f, -0.1637399f, 0.2125934f, 0.08291066f, 0.08023314f, -0.3808408f, -0.295481f, -0.008085407f } },  // BP
+		{ "StateVariableFilter", 2, true, { -0.1417412f, 0.1557681f, 0.2504363f, -0.05065626f, -0.03811559f, -0.1983339f, 0.2125934f, 0.1166254f, 0.1634432f, -0.4163332f, 0.007979022f, 0.584541f } },  // BP
+		{ "StateVariableFilter", 3, false, { -0.8165454f, -0.4733739f, -1.098501f, 0.543905f, -0.06702679f, 0.9726932f, -0.4881983f, -0.301976f, 0.60685f, -0.393487f, 1.127087f, 0.5539787f } },  // Notch
+		{ "StateVariableFilter", 3, true, { -0.8165454f, -0.4884735f, -1.080332f, 1.004138f, -0.4017607f, 0.9859438f, -0.4881983f, -0.3239336f, 0.5526764f, -0.3781769f, 0.9183656f, 0.176377f } },  // Notch
+		{ "StateVariableFilter", 4, false, { -0.8283346f, -0.4269202f, -1.146612f, 0.3966129f, 0.04252782f, 1.232023f, -0.4917428f, -0.3504493f, 0.6862262f, -0.3545473f, 1.373432f, 0.5932991f } },  // Allpass
+		{ "StateVariableFilter", 4, true, { -0.8283346f, -0.4467492f, -1.173321f, 1.023379f, -0.4449284f, 1.022031f, -0.4917428f, -0.3871388f, 0.5309095f, -0.29865f, 0.9205171f, 0.1578016f } },  // Allpass
+		{ "Ladder", 0, false, { -0.002408417f, -0.00876348f, -0.1754469f, 0.1959694f, -0.361695f, 0.6266646f, 0.03833625f, -0.2662772f, 0.02803611f, -0.4805271f, 0.7154336f, 0.4394053f } },  // LP24
+		{ "Ladder", 0, true, { -0.002408417f, -0.03929364f, -0.1564075f, -0.05822088f, 0.01312162f, 0.1891608f, 0.03833625f, -0.2827491f, 0.001343753f, -0.01698624f, 0.01956864f, 0.09846786f } },  // LP24
+		{ "Moog", 0, false, { -6.577317e-05f, -0.01186893f, -0.06422149f, -0.005632829f, 0.2034865f, 0.3167153f, 0.001025904f, 0.07719592f, -0.03042798f, 0.06600194f, 0.1924085f, 0.482323f } },  // One Pole
+		{ "Moog", 0, true, { -6.577317e-05f, -0.001465019f, -0.08161657f, -0.09908186f, 0.07890637f, 0.0155771f, 0.001025904f, 0.07269236f, -0.02155551f, -0.007643704f, 0.02513823f, -0.05798839f } },  // One Pole
+		{ "Moog", 1, false, { -6.577317e-05f, -0.01186893f, -0.06422149f, -0.005632829f, 0.2034865f, 0.3167153f, 0.001025904f, 0.07719592f, -0.03042798f, 0.06600194f, 0.1924085f, 0.482323f } },  // Two Poles
+		{ "Moog", 1, true, { -6.577317e-05f, -0.001465019f, -0.08161657f, -0.09908186f, 0.07890637f, 0.0155771f, 0.001025904f, 0.07269236f, -0.02155551f, -0.007643704f, 0.02513823f, -0.05798839f } },  // Two Poles
+		{ "Moog", 2, false, { -6.577317e-05f, -0.01186893f, -0.06422149f, -0.005632829f, 0.2034865f, 0.3167153f, 0.001025904f, 0.07719592f, -0.03042798f, 0.06600194f, 0.1924085f, 0.482323f } },  // Four Poles
+		{ "Moog", 2, true, { -6.577317e-05f, -0.001465019f, -0.08161657f, -0.09908186f, 0.07890637f, 0.0155771f, 0.001025904f, 0.07269236f, -0.02155551f, -0.007643704f, 0.02513823f, -0.05798839f } },  // Four Poles
+		};
+
+		numReferences = numElementsInArray(references);
+		return references;
+	}
+
+	void runTest() override
+	{
+		testAgainstReference<StaticBiquad>("StaticBiquad");
+		testAgainstReference<StateVariableFilter>("StateVariableFilter");
+		testAgainstReference<Ladder>("Ladder");
+		testAgainstReference<MultiChannelFilter<MoogFilterSubType>>("Moog");
+
+		if (RunBenchmarks)
+		{
+			beginTest("Benchmarking frame vs. block processing");
+
+			for (auto numVoices : { 1, 8, 32, 64 })
+			{
+				benchmark<StaticBiquad>(numVoices);
+				benchmark<StateVariableFilter>(numVoices);
+				benchmark<Ladder>(numVoices);
+				benchmark<MultiChannelFilter<MoogFilterSubType>>(numVoices);
+			}
+		}
+	}
+
+	template <typename FilterType> static void prepare(FilterType& f, int mode)
+	{
+		f.setSampleRate(SampleRate);
+		f.setNumChannels(NumChannels);
+		f.setType(mode);
+		f.setFrequency(800.0);
+		f.setQ(2.0);
+		f.setGain(6.0);
+		f.reset();
+	}
+
+	static void fillWithNoise(AudioSampleBuffer& b, Random& r)
+	{
+		for (int c = 0; c < b.getNumChannels(); c++)
+		{
+			auto d = b.getWritePointer(c);
+
+			for (int i = 0; i < b.getNumSamples(); i++)
+				d[i] = r.nextFloat() * 2.0f - 1.0f;
+		}
+	}
+
+	template <typename FilterType> static void processFrames(FilterType& f, AudioSampleBuffer& b, int startSample, int numSamples)
+	{
+		float frame[NumChannels];
+
+		for (int i = startSample; i < startSample + numSamples; i++)
+		{
+			for (int c = 0; c < NumChannels; c++)
+				frame[c] = b.getSample(c, i);
+
+			f.processFrame(frame, NumChannels);
+
+			for (int c = 0; c < NumChannels; c++)
+				b.setSample(c, i, frame[c]);
+		}
+	}
+
+	template <typename FilterType> static void process(FilterType& f, AudioSampleBuffer& b, ProcessType t)
+	{
+		Random r(0x1234);
+		fillWithNoise(b, r);
+
+		int pos = 0;
+
+		// odd block sizes make sure that the coefficient updates don't line up with the blocks
+		for (auto blockSize : { 13, 64, 100, 1, 511, 77 })
+		{
+			// change the parameters while the filter is running so that the smoothing kicks in
+			f.setFrequency(200.0 + (double)blockSize * 30.0);
+			f.setQ(1.0 + blockSize % 5);
+
+			if (t == ProcessType::Frame)
+				processFrames(f, b, pos, blockSize);
+			else if (t == ProcessType::Block)
+				f.processBlock(b, pos, blockSize);
+			else
+			{
+				FilterHelpers::RenderData rd(b, pos, blockSize);
+				f.render(rd);
+			}
+
+			pos += blockSize;
+		}
+	}
+
+	template <typename FilterType> void testAgainstReference(const String& filterId)
+	{
+		beginTest("Testing " + FilterType::getFilterTypeId().toString() + " against the reference output");
+
+		int numReferences = 0;
+		auto references = getReferences(numReferences);
+
+		FilterType dummy;
+		auto numModes = dummy.getModes().size();
+		int numChecked = 0;
+
+		for (int i = 0; i < numReferences; i++)
+		{
+			const auto& ref = references[i];
+
+			if (filterId != ref.filterId)
+				continue;
+
+			expect(isPositiveAndBelow(ref.mode, numModes), "Invalid mode " + String(ref.mode));
+
+			for (auto t : { ProcessType::Frame, ProcessType::Block, ProcessType::Render })
+			{
+				if ((t == ProcessType::Render) != ref.useRender)
+					continue;
+
+				FilterType f;
+				prepare(f, ref.mode);
+
+				AudioSampleBuffer b(NumChannels, 1024);
+				process(f, b, t);
+
+				auto maxError = 0.0f;
+
+				for (int c = 0; c < NumChannels; c++)
+				{
+					for (int j = 0; j < NumReferenceSamples; j++)
+					{
+						auto expected = ref.values[c * NumReferenceSamples + j];
+						auto actual = b.getSample(c, ReferenceIndexes[j]);
+						maxError = jmax(maxError, std::abs(expected - actual) / jmax(1.0f, std::abs(expected)));
+					}
+				}
+
+				String msg;
+				msg << "Mismatch in mode " << dummy.getModes()[ref.mode] << " (";
+				msg << (t == ProcessType::Frame ? "frame" : (t == ProcessType::Block ? "block" : "render"));
+				msg << "): " << String(maxError);
+
+				expect(maxError < 1e-4f, msg);
+				numChecked++;
+			}
+		}
+
+		expectEquals(numChecked, numModes * 3, "Missing reference data");
+	}
+
+	template <typename FilterType> void benchmark(int numVoices)
+	{
+		static constexpr int BlockSize = 512;
+		static constexpr int NumBlocks = 64;
+
+		OwnedArray<FilterType> filters;
+
+		for (int i = 0; i < numVoices; i++)
+			prepare(*filters.add(new FilterType()), 0);
+
+		Random r(0x4321);
+		AudioSampleBuffer b(NumChannels, BlockSize);
+		fillWithNoise(b, r);
+
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < NumBlocks; i++)
+		{
+			for (auto f : filters)
+				processFrames(*f, b, 0, BlockSize);
+		}
+
+		auto frameTime = Time::getMillisecondCounterHiRes() - start;
+
+		start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < NumBlocks; i++)
+		{
+			for (auto f : filters)
+				f->processBlock(b, 0, BlockSize);
+		}
+
+		auto blockTime = Time::getMillisecondCounterHiRes() - start;
+
+		String msg;
+		msg << FilterType::getFilterTypeId().toString() << ", " << String(numVoices) << " voices: ";
+		msg << "frame: " << String(frameTime, 2) << " ms, block: " << String(blockTime, 2) << " ms, ";
+		msg << "speedup: " << String(frameTime / jmax(0.001, blockTime), 2) << "x";
+
+		logMessage(msg);
+	}
+};
+
+static MultiChannelFilterTests multiChannelFilterTests;
+
+}
+
+}
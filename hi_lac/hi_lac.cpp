@@ -32,6 +32,12 @@
 
 #include "hi_lac.h"
 
+#if HLAC_SSE2_DECODING
+#include <emmintrin.h>
+#elif HLAC_NEON_DECODING
+#include <arm_neon.h>
+#endif
+
 #include "hlac/BitCompressors.cpp"
 #include "hlac/CompressionHelpers.cpp"
 #include "hlac/SampleBuffer.cpp"
@@ -120,6 +120,16 @@ If enabled, then the unit test suite will be compiled and added to all unit test
 #define HLAC_INCLUDE_TEST_SUITE 0
 #endif
 
+//=============================================================================
+/** Config: HLAC_PARALLEL_BLOCK_DECODING
+
+If enabled, then large reads (eg. loading the entire sample or filling the preload buffer) decode
+independent compression blocks on multiple threads.
+*/
+#ifndef HLAC_PARALLEL_BLOCK_DECODING
+#define HLAC_PARALLEL_BLOCK_DECODING 1
+#endif
+
 
 #include "hlac/BitCompressors.h"
 #include "hlac/CompressionHelpers.h"
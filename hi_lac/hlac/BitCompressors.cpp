@@ -124,29 +124,161 @@ void packArrayOfInt16(int16* d, int numValues, uint8 bitDepth)
 
 void unpackArrayOfInt16(int16* d, int /*numValues*/, uint8 bitDepth)
 {
-	jassert(reinterpret_cast<uint64>(d) % 16 == 0);
+	const int16 sub = (1 << (bitDepth - 1)) - 1;
 
-#if HI_ENABLE_LEGACY_CPU_SUPPORT || !JUCE_WINDOWS
+#if HLAC_SSE2_DECODING
+	auto d_ = _mm_loadu_si128((const __m128i*)d);
+	d_ = _mm_sub_epi16(d_, _mm_set1_epi16(sub));
+	_mm_storeu_si128((__m128i*)d, d_);
+#elif HLAC_NEON_DECODING
+	vst1q_s16(d, vsubq_s16(vld1q_s16(d), vdupq_n_s16(sub)));
+#else
 	for (int i = 0; i < 8; i++)
 	{
 		d[i] = decompressUInt16(d[i], bitDepth);
 	}
-#else
+#endif
+}
+
+/** Vectorised decoding kernels for the bit compressors.
+*
+*	The 6, 10, 12 and 14 bit compressors write groups of eight values as one continuous MSB-first bit stream
+*	of 16 bit words. Every lane of a group starts at a fixed bit offset, so it can be extracted with a
+*	per-lane shift of the word it starts in and (if it straddles a word boundary) the following word.
+*	SSE2 has no per-lane shifts, so the shifts are done with 16 bit multiplications by powers of two.
+*
+*	The 1, 2 and 4 bit compressors store sign / magnitude values and are decoded with lookup tables
+*	that expand a whole byte at once.
+*/
+struct UnpackKernels
+{
+	template <int BitDepth> struct PackedGroup
+	{
+		static_assert(BitDepth % 2 == 0 && BitDepth > 4 && BitDepth < 16, "unsupported bit depth");
 
-	// SSE 2.0 needed -> Pentium 4
+		static constexpr int NumBytes = BitDepth;
+		static constexpr int16 Offset = (1 << (BitDepth - 1)) - 1;
 
-	const int16 sub = (1 << (bitDepth - 1)) - 1;
+		static constexpr int getWord(int i) { return (i * BitDepth) / 16; }
+		static constexpr int getBitOffset(int i) { return (i * BitDepth) % 16; }
+		static constexpr bool straddles(int i) { return getBitOffset(i) + BitDepth > 16; }
+
+		/** The word that contains the remaining bits (the same word if the value doesn't straddle). */
+		static constexpr int getNextWord(int i) { return straddles(i) ? getWord(i) + 1 : getWord(i); }
+
+		/** Multiplying by this and keeping the low word shifts the value to the top of the word. */
+		static constexpr int16 getHighMultiplier(int i) { return (int16)(uint16)(1 << getBitOffset(i)); }
+
+		/** Multiplying by this and keeping the high word shifts the remaining bits into place. */
+		static constexpr int16 getLowMultiplier(int i) { return straddles(i) ? (int16)(uint16)(1 << (getBitOffset(i) + BitDepth - 16)) : 0; }
+
+		static forcedinline void unpack(int16* dst, const uint8* src) noexcept
+		{
+			const uint16* w = reinterpret_cast<const uint16*>(src);
 
-	auto sub_ = _mm_set1_epi16(sub);
+#if HLAC_SSE2_DECODING
+			const __m128i high = _mm_setr_epi16((int16)w[getWord(0)], (int16)w[getWord(1)], (int16)w[getWord(2)], (int16)w[getWord(3)],
+												(int16)w[getWord(4)], (int16)w[getWord(5)], (int16)w[getWord(6)], (int16)w[getWord(7)]);
 
-	auto d_ = _mm_load_si128((__m128i*)d);
-	d_ = _mm_sub_epi16(d_, sub_);
-	_mm_store_si128((__m128i*)d, d_);
+			const __m128i low = _mm_setr_epi16((int16)w[getNextWord(0)], (int16)w[getNextWord(1)], (int16)w[getNextWord(2)], (int16)w[getNextWord(3)],
+											   (int16)w[getNextWord(4)], (int16)w[getNextWord(5)], (int16)w[getNextWord(6)], (int16)w[getNextWord(7)]);
 
+			const __m128i highMul = _mm_setr_epi16(getHighMultiplier(0), getHighMultiplier(1), getHighMultiplier(2), getHighMultiplier(3),
+												   getHighMultiplier(4), getHighMultiplier(5), getHighMultiplier(6), getHighMultiplier(7));
+
+			const __m128i lowMul = _mm_setr_epi16(getLowMultiplier(0), getLowMultiplier(1), getLowMultiplier(2), getLowMultiplier(3),
+												  getLowMultiplier(4), getLowMultiplier(5), getLowMultiplier(6), getLowMultiplier(7));
+
+			auto v = _mm_srli_epi16(_mm_mullo_epi16(high, highMul), 16 - BitDepth);
+			v = _mm_or_si128(v, _mm_mulhi_epu16(low, lowMul));
+			v = _mm_sub_epi16(v, _mm_set1_epi16(Offset));
+
+			_mm_storeu_si128((__m128i*)dst, v);
+#elif HLAC_NEON_DECODING
+			const uint16 highWords[8] = { w[getWord(0)], w[getWord(1)], w[getWord(2)], w[getWord(3)],
+										  w[getWord(4)], w[getWord(5)], w[getWord(6)], w[getWord(7)] };
+
+			const uint16 lowWords[8] = { w[getNextWord(0)], w[getNextWord(1)], w[getNextWord(2)], w[getNextWord(3)],
+										 w[getNextWord(4)], w[getNextWord(5)], w[getNextWord(6)], w[getNextWord(7)] };
+
+			// NEON has per-lane shifts, a negative shift amount >= 16 clears the lane.
+			const int16 highShifts[8] = { (int16)getBitOffset(0), (int16)getBitOffset(1), (int16)getBitOffset(2), (int16)getBitOffset(3),
+										  (int16)getBitOffset(4), (int16)getBitOffset(5), (int16)getBitOffset(6), (int16)getBitOffset(7) };
+
+			int16 lowShifts[8];
+
+			for (int i = 0; i < 8; i++)
+				lowShifts[i] = straddles(i) ? (int16)(getBitOffset(i) + BitDepth - 32) : -16;
+
+			auto v = vshrq_n_u16(vshlq_u16(vld1q_u16(highWords), vld1q_s16(highShifts)), 16 - BitDepth);
+			v = vorrq_u16(v, vshlq_u16(vld1q_u16(lowWords), vld1q_s16(lowShifts)));
+
+			vst1q_s16(dst, vsubq_s16(vreinterpretq_s16_u16(v), vdupq_n_s16(Offset)));
+#else
+			for (int i = 0; i < 8; i++)
+			{
+				const uint32 window = ((uint32)w[getWord(i)] << 16) | (uint32)w[getNextWord(i)];
+				const uint16 value = (uint16)((window >> (32 - getBitOffset(i) - BitDepth)) & ((1 << BitDepth) - 1));
+
+				dst[i] = decompressUInt16(value, BitDepth);
+			}
 #endif
+		}
 
-}
+		/** Unpacks as many full groups as possible and returns the number of decoded values. */
+		static int unpackGroups(int16* dst, const uint8* src, int numValues) noexcept
+		{
+			const int numGroups = numValues / 8;
+
+			for (int i = 0; i < numGroups; i++)
+				unpack(dst + i * 8, src + i * NumBytes);
+
+			return numGroups * 8;
+		}
+	};
 
+	/** Expands every possible byte of a sign / magnitude compressor into its decoded values. */
+	template <int BitDepth> struct ByteTable
+	{
+		static constexpr int NumValuesPerByte = 8 / BitDepth;
+
+		ByteTable()
+		{
+			const int valueMask = BitDepth == 1 ? 1 : (1 << (BitDepth - 1)) - 1;
+			const int signMask = BitDepth == 1 ? 0 : (1 << (BitDepth - 1));
+
+			for (int byte = 0; byte < 256; byte++)
+			{
+				for (int i = 0; i < NumValuesPerByte; i++)
+				{
+					const int field = (byte >> (i * BitDepth)) & ((1 << BitDepth) - 1);
+					const int value = field & valueMask;
+
+					values[byte][i] = (int16)(((field & signMask) != 0) ? -value : value);
+				}
+			}
+		}
+
+		static const ByteTable& get()
+		{
+			static const ByteTable table;
+			return table;
+		}
+
+		/** Decodes all full bytes and returns the number of decoded values. */
+		int decodeBytes(int16* dst, const uint8* src, int numValues) const noexcept
+		{
+			const int numBytes = numValues / NumValuesPerByte;
+
+			for (int i = 0; i < numBytes; i++)
+				memcpy(dst + i * NumValuesPerByte, values[src[i]], sizeof(int16) * NumValuesPerByte);
+
+			return numBytes * NumValuesPerByte;
+		}
+
+		int16 values[256][NumValuesPerByte];
+	};
+};
 
 int BitCompressors::ZeroBit::getAllowedBitRange() const
 {
@@ -226,6 +358,12 @@ bool BitCompressors::OneBit::decompress(int16* destination, const uint8* data, i
 	const uint8 masks[8] = { 0b00000001, 0b00000010, 0b00000100, 0b00001000,
 		0b00010000, 0b00100000, 0b01000000, 0b10000000 };
 
+	const int numDecoded = UnpackKernels::ByteTable<1>::get().decodeBytes(destination, data, numValuesToDecompress);
+
+	destination += numDecoded;
+	data += numDecoded / 8;
+	numValuesToDecompress -= numDecoded;
+
 	while (numValuesToDecompress >= 8)
 	{
 		const uint8 byte = *data;
@@ -321,6 +459,12 @@ bool BitCompressors::TwoBit::decompress(int16* destination, const uint8* data, i
 	const uint8 signMasks[4] =  { 0b00000010, 0b00001000, 0b00100000, 0b10000000 };
 	const uint8 valueMasks[4] = { 0b00000001, 0b00000100, 0b00010000, 0b01000000 };
 
+	const int numDecoded = UnpackKernels::ByteTable<2>::get().decodeBytes(destination, data, numValuesToDecompress);
+
+	destination += numDecoded;
+	data += numDecoded / 4;
+	numValuesToDecompress -= numDecoded;
+
 	while (numValuesToDecompress >= 4)
 	{
 		const uint8 byte = *data;
@@ -436,6 +580,12 @@ bool BitCompressors::FourBit::decompress(int16* destination, const uint8* data,
 	const uint8 signMasks[2] =  { 0b00001000, 0b10000000 };
 	const uint8 valueMasks[2] = { 0b00000111, 0b01110000 };
 
+	const int numDecoded = UnpackKernels::ByteTable<4>::get().decodeBytes(destination, data, numValuesToDecompress);
+
+	destination += numDecoded;
+	data += numDecoded / 2;
+	numValuesToDecompress -= numDecoded;
+
 	while (numValuesToDecompress >= 2)
 	{
 		const uint8 byte = *data;
@@ -500,24 +650,6 @@ void compress6Bit(uint8* sixBytes, const int16* eightValues)
 	threeShorts[2] |= pData[7];
 }
 
-void decompress6Bit(int16* eightValues, const uint8* sixBytes)
-{
-	const uint16* dataBlock = reinterpret_cast<const uint16*>(sixBytes);
-
-	eightValues[0] = (dataBlock[0] & 0b1111110000000000) >> 10;
-	eightValues[1] = (dataBlock[0] & 0b0000001111110000) >> 4;
-	eightValues[2] = (dataBlock[0] & 0b0000000000001111) << 2;
-	eightValues[2] |= (dataBlock[1] & 0b1100000000000000) >> 14;
-	eightValues[3] = (dataBlock[1] & 0b0011111100000000) >> 8;
-	eightValues[4] = (dataBlock[1] & 0b0000000011111100) >> 2;
-	eightValues[5] = (dataBlock[1] & 0b0000000000000011) << 4;
-	eightValues[5] |= (dataBlock[2] & 0b1111000000000000) >> 12;
-	eightValues[6] = (dataBlock[2] & 0b0000111111000000) >> 6;
-	eightValues[7] = (dataBlock[2] & 0b0000000000111111);;
-
-	unpackArrayOfInt16(eightValues, 8, 6);
-}
-
 int BitCompressors::SixBit::getAllowedBitRange() const
 {
 	return 6;
@@ -543,132 +675,11 @@ bool BitCompressors::SixBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::SixBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
-#if JUCE_IOS
-	while (numValuesToDecompress >= 8)
-	{
-		decompress6Bit(destination, data);
-
-		destination += 8;
-		data += 6;
-		numValuesToDecompress -= 8;
-	}
-#else
+	const int numUnpacked = UnpackKernels::PackedGroup<6>::unpackGroups(destination, data, numValuesToDecompress);
 
-	while (numValuesToDecompress >= 64)
-	{
-		const uint16* dataBlock = reinterpret_cast<const uint16*>(data);
-
-		destination[0] = (dataBlock[0] & 0b1111110000000000) >> 10;
-		destination[1] = (dataBlock[0] & 0b0000001111110000) >> 4;
-		destination[2] = (dataBlock[0] & 0b0000000000001111) << 2;
-		destination[2] |= (dataBlock[1] & 0b1100000000000000) >> 14;
-		destination[3] = (dataBlock[1] & 0b0011111100000000) >> 8;
-		destination[4] = (dataBlock[1] & 0b0000000011111100) >> 2;
-		destination[5] = (dataBlock[1] & 0b0000000000000011) << 4;
-		destination[5] |= (dataBlock[2] & 0b1111000000000000) >> 12;
-		destination[6] = (dataBlock[2] & 0b0000111111000000) >> 6;
-		destination[7] = (dataBlock[2] & 0b0000000000111111);
-
-		destination[8 + 0] =  (dataBlock[3 + 0] & 0b1111110000000000) >> 10;
-		destination[8 + 1] =  (dataBlock[3 + 0] & 0b0000001111110000) >> 4;
-		destination[8 + 2] =  (dataBlock[3 + 0] & 0b0000000000001111) << 2;
-		destination[8 + 2] |= (dataBlock[3 + 1] & 0b1100000000000000) >> 14;
-		destination[8 + 3] =  (dataBlock[3 + 1] & 0b0011111100000000) >> 8;
-		destination[8 + 4] =  (dataBlock[3 + 1] & 0b0000000011111100) >> 2;
-		destination[8 + 5] =  (dataBlock[3 + 1] & 0b0000000000000011) << 4;
-		destination[8 + 5] |= (dataBlock[3 + 2] & 0b1111000000000000) >> 12;
-		destination[8 + 6] =  (dataBlock[3 + 2] & 0b0000111111000000) >> 6;
-		destination[8 + 7] =  (dataBlock[3 + 2] & 0b0000000000111111);
-
-		destination[16 + 0] =  (dataBlock[6 + 0] & 0b1111110000000000) >> 10;
-		destination[16 + 1] =  (dataBlock[6 + 0] & 0b0000001111110000) >> 4;
-		destination[16 + 2] =  (dataBlock[6 + 0] & 0b0000000000001111) << 2;
-		destination[16 + 2] |= (dataBlock[6 + 1] & 0b1100000000000000) >> 14;
-		destination[16 + 3] =  (dataBlock[6 + 1] & 0b0011111100000000) >> 8;
-		destination[16 + 4] =  (dataBlock[6 + 1] & 0b0000000011111100) >> 2;
-		destination[16 + 5] =  (dataBlock[6 + 1] & 0b0000000000000011) << 4;
-		destination[16 + 5] |= (dataBlock[6 + 2] & 0b1111000000000000) >> 12;
-		destination[16 + 6] =  (dataBlock[6 + 2] & 0b0000111111000000) >> 6;
-		destination[16 + 7] =  (dataBlock[6 + 2] & 0b0000000000111111);
-
-		destination[24 + 0] =  (dataBlock[9 + 0] & 0b1111110000000000) >> 10;
-		destination[24 + 1] =  (dataBlock[9 + 0] & 0b0000001111110000) >> 4;
-		destination[24 + 2] =  (dataBlock[9 + 0] & 0b0000000000001111) << 2;
-		destination[24 + 2] |= (dataBlock[9 + 1] & 0b1100000000000000) >> 14;
-		destination[24 + 3] =  (dataBlock[9 + 1] & 0b0011111100000000) >> 8;
-		destination[24 + 4] =  (dataBlock[9 + 1] & 0b0000000011111100) >> 2;
-		destination[24 + 5] =  (dataBlock[9 + 1] & 0b0000000000000011) << 4;
-		destination[24 + 5] |= (dataBlock[9 + 2] & 0b1111000000000000) >> 12;
-		destination[24 + 6] =  (dataBlock[9 + 2] & 0b0000111111000000) >> 6;
-		destination[24 + 7] =  (dataBlock[9 + 2] & 0b0000000000111111);
-
-		destination[32 + 0] =  (dataBlock[12 + 0] & 0b1111110000000000) >> 10;
-		destination[32 + 1] =  (dataBlock[12 + 0] & 0b0000001111110000) >> 4;
-		destination[32 + 2] =  (dataBlock[12 + 0] & 0b0000000000001111) << 2;
-		destination[32 + 2] |= (dataBlock[12 + 1] & 0b1100000000000000) >> 14;
-		destination[32 + 3] =  (dataBlock[12 + 1] & 0b0011111100000000) >> 8;
-		destination[32 + 4] =  (dataBlock[12 + 1] & 0b0000000011111100) >> 2;
-		destination[32 + 5] =  (dataBlock[12 + 1] & 0b0000000000000011) << 4;
-		destination[32 + 5] |= (dataBlock[12 + 2] & 0b1111000000000000) >> 12;
-		destination[32 + 6] =  (dataBlock[12 + 2] & 0b0000111111000000) >> 6;
-		destination[32 + 7] =  (dataBlock[12 + 2] & 0b0000000000111111);
-
-		destination[40 + 0] =  (dataBlock[15 + 0] & 0b1111110000000000) >> 10;
-		destination[40 + 1] =  (dataBlock[15 + 0] & 0b0000001111110000) >> 4;
-		destination[40 + 2] =  (dataBlock[15 + 0] & 0b0000000000001111) << 2;
-		destination[40 + 2] |= (dataBlock[15 + 1] & 0b1100000000000000) >> 14;
-		destination[40 + 3] =  (dataBlock[15 + 1] & 0b0011111100000000) >> 8;
-		destination[40 + 4] =  (dataBlock[15 + 1] & 0b0000000011111100) >> 2;
-		destination[40 + 5] =  (dataBlock[15 + 1] & 0b0000000000000011) << 4;
-		destination[40 + 5] |= (dataBlock[15 + 2] & 0b1111000000000000) >> 12;
-		destination[40 + 6] =  (dataBlock[15 + 2] & 0b0000111111000000) >> 6;
-		destination[40 + 7] =  (dataBlock[15 + 2] & 0b0000000000111111);
-
-		destination[48 + 0] =  (dataBlock[18 + 0] & 0b1111110000000000) >> 10;
-		destination[48 + 1] =  (dataBlock[18 + 0] & 0b0000001111110000) >> 4;
-		destination[48 + 2] =  (dataBlock[18 + 0] & 0b0000000000001111) << 2;
-		destination[48 + 2] |= (dataBlock[18 + 1] & 0b1100000000000000) >> 14;
-		destination[48 + 3] =  (dataBlock[18 + 1] & 0b0011111100000000) >> 8;
-		destination[48 + 4] =  (dataBlock[18 + 1] & 0b0000000011111100) >> 2;
-		destination[48 + 5] =  (dataBlock[18 + 1] & 0b0000000000000011) << 4;
-		destination[48 + 5] |= (dataBlock[18 + 2] & 0b1111000000000000) >> 12;
-		destination[48 + 6] =  (dataBlock[18 + 2] & 0b0000111111000000) >> 6;
-		destination[48 + 7] =  (dataBlock[18 + 2] & 0b0000000000111111);
-
-		destination[56 + 0] =  (dataBlock[21 + 0] & 0b1111110000000000) >> 10;
-		destination[56 + 1] =  (dataBlock[21 + 0] & 0b0000001111110000) >> 4;
-		destination[56 + 2] =  (dataBlock[21 + 0] & 0b0000000000001111) << 2;
-		destination[56 + 2] |= (dataBlock[21 + 1] & 0b1100000000000000) >> 14;
-		destination[56 + 3] =  (dataBlock[21 + 1] & 0b0011111100000000) >> 8;
-		destination[56 + 4] =  (dataBlock[21 + 1] & 0b0000000011111100) >> 2;
-		destination[56 + 5] =  (dataBlock[21 + 1] & 0b0000000000000011) << 4;
-		destination[56 + 5] |= (dataBlock[21 + 2] & 0b1111000000000000) >> 12;
-		destination[56 + 6] =  (dataBlock[21 + 2] & 0b0000111111000000) >> 6;
-		destination[56 + 7] =  (dataBlock[21 + 2] & 0b0000000000111111);
-
-		unpackArrayOfInt16(destination, 8, 6);
-		unpackArrayOfInt16(destination+8, 8, 6);
-		unpackArrayOfInt16(destination+16, 8, 6);
-		unpackArrayOfInt16(destination+24, 8, 6);
-		unpackArrayOfInt16(destination+32, 8, 6);
-		unpackArrayOfInt16(destination+40, 8, 6);
-		unpackArrayOfInt16(destination+48, 8, 6);
-		unpackArrayOfInt16(destination+56, 8, 6);
-		
-		destination += 64;
-		data += 48;
-		numValuesToDecompress -= 64;
-	}
-
-	while (numValuesToDecompress >= 8)
-	{
-		decompress6Bit(destination, data);
-
-		destination += 8;
-		data += 6;
-		numValuesToDecompress -= 8;
-	}
-#endif
+	destination += numUnpacked;
+	data += (numUnpacked / 8) * 6;
+	numValuesToDecompress -= numUnpacked;
 
 	memcpy(destination, data, sizeof(int16) * numValuesToDecompress);
 
@@ -703,6 +714,33 @@ bool BitCompressors::EightBit::compress(uint8* destination, const int16* data, i
 
 bool BitCompressors::EightBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+#if HLAC_SSE2_DECODING
+	while (numValuesToDecompress >= 16)
+	{
+		const __m128i bytes = _mm_loadu_si128((const __m128i*)data);
+
+		// Move the bytes to the upper half and shift them back arithmetically to sign-extend them.
+		_mm_storeu_si128((__m128i*)destination, _mm_srai_epi16(_mm_unpacklo_epi8(_mm_setzero_si128(), bytes), 8));
+		_mm_storeu_si128((__m128i*)(destination + 8), _mm_srai_epi16(_mm_unpackhi_epi8(_mm_setzero_si128(), bytes), 8));
+
+		destination += 16;
+		data += 16;
+		numValuesToDecompress -= 16;
+	}
+#elif HLAC_NEON_DECODING
+	while (numValuesToDecompress >= 16)
+	{
+		const int8x16_t bytes = vld1q_s8(reinterpret_cast<const int8*>(data));
+
+		vst1q_s16(destination, vmovl_s8(vget_low_s8(bytes)));
+		vst1q_s16(destination + 8, vmovl_s8(vget_high_s8(bytes)));
+
+		destination += 16;
+		data += 16;
+		numValuesToDecompress -= 16;
+	}
+#endif
+
     while (--numValuesToDecompress >= 0)
 	{
 		const int8 value = *reinterpret_cast<const int8*>(data++);
@@ -747,26 +785,6 @@ void compress10Bit(void* tenBytes, const int16* eightValues)
 	fiveShorts[4] |= pData[7];
 }
 
-void decompress10Bit(uint16* eightValues, void* tenBytes)
-{
-	const uint16* dataBlock = reinterpret_cast<const uint16*>(tenBytes);
-
-	eightValues[0] = (dataBlock[0] & 0b1111111111000000) >> 6;
-	eightValues[1] = (dataBlock[0] & 0b0000000000111111) << 4;
-	eightValues[1] |= (dataBlock[1] & 0b1111000000000000) >> 12;
-	eightValues[2] = (dataBlock[1] & 0b0000111111111100) >> 2;
-	eightValues[3] = (dataBlock[1] & 0b0000000000000011) << 8;
-	eightValues[3] |= (dataBlock[2] & 0b1111111100000000) >> 8;
-	eightValues[4] = (dataBlock[2] & 0b0000000011111111) << 2;
-	eightValues[4] |= (dataBlock[3] & 0b1100000000000000) >> 14;
-	eightValues[5] = (dataBlock[3] & 0b0011111111110000) >> 4;
-	eightValues[6] = (dataBlock[3] & 0b0000000000001111) << 6;
-	eightValues[6] |= (dataBlock[4] & 0b1111110000000000) >> 10;
-	eightValues[7] = (dataBlock[4] & 0b0000001111111111);
-
-	unpackArrayOfInt16(reinterpret_cast<int16*>(eightValues), 8, 10);
-}
-
 int BitCompressors::TenBit::getAllowedBitRange() const
 {
 	return 10;
@@ -790,14 +808,11 @@ bool BitCompressors::TenBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::TenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
-	while (numValuesToDecompress >= 8)
-	{
-		decompress10Bit(reinterpret_cast<uint16*>(destination), (void*)data);
+	const int numUnpacked = UnpackKernels::PackedGroup<10>::unpackGroups(destination, data, numValuesToDecompress);
 
-		destination += 8;
-		data += 10;
-		numValuesToDecompress -= 8;
-	}
+	destination += numUnpacked;
+	data += (numUnpacked / 8) * 10;
+	numValuesToDecompress -= numUnpacked;
 
 	memcpy(destination, data, sizeof(int16) * numValuesToDecompress);
 
@@ -884,7 +899,12 @@ bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data
 
 #else
 
-	int16* dst = destination;
+	const int numUnpacked = UnpackKernels::PackedGroup<12>::unpackGroups(destination, data, numValuesToDecompress);
+
+	data += (numUnpacked / 8) * 12;
+	numValuesToDecompress -= numUnpacked;
+
+	int16* dst = destination + numUnpacked;
 
 	while (numValuesToDecompress >= 4)
 	{
@@ -958,28 +978,6 @@ void compress14Bit(uint8* fourteenBytes, const int16* eightValues)
 	sevenShorts[6] |= pData[7];
 }
 
-void decompress14Bit(int16* eightValues, const uint8* fourteenBytes)
-{
-	const uint16* dataBlock = reinterpret_cast<const uint16*>(fourteenBytes);
-
-	eightValues[0] = (dataBlock[0] & 0b1111111111111100) >> 2;
-	eightValues[1] = (dataBlock[0] & 0b0000000000000011) << 12;
-	eightValues[1] |= (dataBlock[1] & 0b1111111111110000) >> 4;
-	eightValues[2] = (dataBlock[1] & 0b0000000000001111) << 10;
-	eightValues[2] |= (dataBlock[2] & 0b1111111111000000) >> 6;
-	eightValues[3] = (dataBlock[2] & 0b0000000000111111) << 8;
-	eightValues[3] |= (dataBlock[3] & 0b1111111100000000) >> 8;
-	eightValues[4] = (dataBlock[3] & 0b0000000011111111) << 6;
-	eightValues[4] |= (dataBlock[4] & 0b1111110000000000) >> 10;
-	eightValues[5] = (dataBlock[4] & 0b0000001111111111) << 4;
-	eightValues[5] |= (dataBlock[5] & 0b1111000000000000) >> 12;
-	eightValues[6] = (dataBlock[5] & 0b0000111111111111) << 2;
-	eightValues[6] |= (dataBlock[6] & 0b1100000000000000) >> 14;
-	eightValues[7] = (dataBlock[6] & 0b0011111111111111);
-
-	unpackArrayOfInt16(eightValues, 8, 14);
-}
-
 int BitCompressors::FourteenBit::getAllowedBitRange() const
 {
 	return 14;
@@ -1002,14 +1000,11 @@ bool BitCompressors::FourteenBit::compress(uint8* destination, const int16* data
 
 bool BitCompressors::FourteenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
-	while (numValuesToDecompress >= 8)
-	{
-		decompress14Bit(destination, data);
+	const int numUnpacked = UnpackKernels::PackedGroup<14>::unpackGroups(destination, data, numValuesToDecompress);
 
-		destination += 8;
-		data += 14;
-		numValuesToDecompress -= 8;
-	}
+	destination += numUnpacked;
+	data += (numUnpacked / 8) * 14;
+	numValuesToDecompress -= numUnpacked;
 
 	memcpy(destination, data, sizeof(int16) * numValuesToDecompress);
 
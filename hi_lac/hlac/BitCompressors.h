@@ -40,6 +40,20 @@ namespace hlac { using namespace juce;
 
 #define USE_SSE 0
 
+/** The vectorised decoding kernels only need SSE2 (or NEON on ARM), so they are enabled on every
+	64 bit target unless HI_ENABLE_LEGACY_CPU_SUPPORT is set. */
+#if !HI_ENABLE_LEGACY_CPU_SUPPORT && JUCE_USE_SSE_INTRINSICS
+#define HLAC_SSE2_DECODING 1
+#else
+#define HLAC_SSE2_DECODING 0
+#endif
+
+#if !HI_ENABLE_LEGACY_CPU_SUPPORT && !HLAC_SSE2_DECODING && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define HLAC_NEON_DECODING 1
+#else
+#define HLAC_NEON_DECODING 0
+#endif
+
 
 #if USE_SSE
 #include <ipp.h>
@@ -732,7 +732,21 @@ void CompressionHelpers::IntVectorOperations::sub(int16* dst, const int16* src,
 
 void CompressionHelpers::IntVectorOperations::add(int16* dst, const int16* src, int numSamples)
 {
-	for (int i = 0; i < numSamples; i++)
+	int i = 0;
+
+#if HLAC_SSE2_DECODING
+	for (; i + 8 <= numSamples; i += 8)
+	{
+		auto a = _mm_loadu_si128((const __m128i*)(dst + i));
+		auto b = _mm_loadu_si128((const __m128i*)(src + i));
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi16(a, b));
+	}
+#elif HLAC_NEON_DECODING
+	for (; i + 8 <= numSamples; i += 8)
+		vst1q_s16(dst + i, vaddq_s16(vld1q_s16(dst + i), vld1q_s16(src + i)));
+#endif
+
+	for (; i < numSamples; i++)
 	{
 		dst[i] += src[i];
 	}
@@ -917,7 +931,46 @@ void CompressionHelpers::Diff::distributeFullSamples(AudioBufferInt16& dst, cons
 
 #if HI_ENABLE_LEGACY_CPU_SUPPORT || !JUCE_WINDOWS
 
-	for (int i = 0; i < numSamples - 2; i++)
+	int i = 0;
+
+#if HLAC_SSE2_DECODING
+
+	// Computes four interpolation groups at once with the same truncating division as the scalar loop
+	// (a negative dividend is biased by divisor - 1 before the arithmetic shift).
+	for (; i + 4 <= numSamples - 2; i += 4)
+	{
+		auto a = _mm_loadl_epi64((const __m128i*)(r + i));
+		auto b = _mm_loadl_epi64((const __m128i*)(r + i + 1));
+
+		a = _mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16);
+		b = _mm_srai_epi32(_mm_unpacklo_epi16(b, b), 16);
+
+		auto divideTruncating = [](__m128i x, int shift)
+		{
+			auto bias = _mm_and_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32((1 << shift) - 1));
+			return _mm_srai_epi32(_mm_add_epi32(x, bias), shift);
+		};
+
+		auto v2 = divideTruncating(_mm_add_epi32(_mm_add_epi32(a, _mm_add_epi32(a, a)), b), 2);
+		auto v3 = divideTruncating(_mm_add_epi32(a, b), 1);
+		auto v4 = divideTruncating(_mm_add_epi32(_mm_add_epi32(b, _mm_add_epi32(b, b)), a), 2);
+
+		// 4x4 transpose from (v1, v2, v3, v4) columns to interleaved rows
+		auto p12 = _mm_packs_epi32(a, v2);
+		auto p34 = _mm_packs_epi32(v3, v4);
+
+		auto lo = _mm_unpacklo_epi16(p12, p34);
+		auto hi = _mm_unpackhi_epi16(p12, p34);
+
+		_mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi16(lo, hi));
+		_mm_storeu_si128((__m128i*)(d + 8), _mm_unpackhi_epi16(lo, hi));
+
+		d += 16;
+	}
+
+#endif
+
+	for (; i < numSamples - 2; i++)
 	{
 		thisValue = (int)r[i];
 		nextValue = (int)r[i + 1];
@@ -1027,6 +1080,31 @@ void CompressionHelpers::Diff::addErrorSignal(AudioBufferInt16& dst, const uint1
 
 #if HI_ENABLE_LEGACY_CPU_SUPPORT || !JUCE_WINDOWS
 
+#if HLAC_SSE2_DECODING
+
+	// Every group of four samples gets three error values (the first sample is a full value),
+	// so twelve error values are subtracted from sixteen samples per iteration.
+	while (numSamples >= 14)
+	{
+		counter += 16;
+
+		auto a1 = _mm_loadu_si128((const __m128i*)d);
+		auto a2 = _mm_loadu_si128((const __m128i*)(d + 8));
+
+		auto b1 = _mm_setr_epi16(0, e[0], e[1], e[2], 0, e[3], e[4], e[5]);
+		auto b2 = _mm_setr_epi16(0, e[6], e[7], e[8], 0, e[9], e[10], e[11]);
+
+		_mm_storeu_si128((__m128i*)d, _mm_sub_epi16(a1, b1));
+		_mm_storeu_si128((__m128i*)(d + 8), _mm_sub_epi16(a2, b2));
+
+		d += 16;
+		e += 12;
+
+		numSamples -= 12;
+	}
+
+#endif
+
 	while (numSamples > 2)
 	{
 		counter += 4;
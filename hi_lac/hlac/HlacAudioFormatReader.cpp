@@ -189,6 +189,8 @@ bool HlacReaderCommon::internalHlacRead(int** destSamples, int numDestChannels,
 	ignoreUnused(startSampleInFile);
 	ignoreUnused(numDestChannels);
 
+	const ScopedLock sl(decoderLock);
+
 	decoder.setHlacVersion(header.getVersion());
 
 	bool isStereo = destSamples[1] != nullptr;
@@ -222,7 +224,7 @@ bool HlacReaderCommon::internalHlacRead(int** destSamples, int numDestChannels,
 			AudioSampleBuffer b(destinationFloat, 2, numSamples);
 			HiseSampleBuffer hsb(b);
 
-			decoder.decode(hsb, true, *input, (int)startSampleInFile, numSamples);
+			decodeRange(hsb, true, startSampleInFile, numSamples);
 		}
 		else
 		{
@@ -240,7 +242,7 @@ bool HlacReaderCommon::internalHlacRead(int** destSamples, int numDestChannels,
 
 			HiseSampleBuffer hsb(destinationFixed, 2, numSamples);
 			
-			decoder.decode(hsb, true, *input, (int)startSampleInFile, numSamples);
+			decodeRange(hsb, true, startSampleInFile, numSamples);
 		}
 	}
 	else
@@ -253,7 +255,7 @@ bool HlacReaderCommon::internalHlacRead(int** destSamples, int numDestChannels,
 			HiseSampleBuffer hsb(b);
 			hsb.allocateNormalisationTables((int)startSampleInFile);
 
-			decoder.decode(hsb, false, *input, (int)startSampleInFile, numSamples);
+			decodeRange(hsb, false, startSampleInFile, numSamples);
 		}
 		else
 		{
@@ -262,7 +264,7 @@ bool HlacReaderCommon::internalHlacRead(int** destSamples, int numDestChannels,
 			HiseSampleBuffer hsb(destinationFixed, 1, numSamples);
 			hsb.allocateNormalisationTables((int)startSampleInFile);
 
-			decoder.decode(hsb, false, *input, (int)startSampleInFile, numSamples);
+			decodeRange(hsb, false, startSampleInFile, numSamples);
 		}
 	}
 
@@ -289,27 +291,286 @@ bool HlacReaderCommon::fixedBufferRead(HiseSampleBuffer& buffer, int numDestChan
 	if (numSamples == 0)
 		return true;
 
-	if (startSampleInFile != decoder.getCurrentReadPosition())
+	if (decoderLock.tryEnter())
 	{
-		auto byteOffset = header.getOffsetForReadPosition(startSampleInFile, useHeaderOffsetWhenSeeking);
+		auto ok = decodeIntoFixedBuffer(buffer, isStereo, startOffsetInBuffer, startSampleInFile, numSamples, true);
+		decoderLock.exit();
+		return ok;
+	}
 
-		decoder.seekToPosition(*input, (uint32)startSampleInFile, byteOffset);
+	// Another thread is using the decoder of this reader (eg. when multiple sounds of a monolith
+	// are loaded concurrently), so we decode the mapped data with a temporary decoder instead of waiting.
+	if (decodeIntoFixedBuffer(buffer, isStereo, startOffsetInBuffer, startSampleInFile, numSamples, false))
+		return true;
+
+	const ScopedLock sl(decoderLock);
+	return decodeIntoFixedBuffer(buffer, isStereo, startOffsetInBuffer, startSampleInFile, numSamples, true);
+}
+
+bool HlacReaderCommon::decodeIntoFixedBuffer(HiseSampleBuffer& buffer, bool isStereo, int startOffsetInBuffer, int64 startSampleInFile, int numSamples, bool useReaderDecoder)
+{
+	if (useReaderDecoder)
+	{
+		if (startSampleInFile != decoder.getCurrentReadPosition())
+		{
+			auto byteOffset = header.getOffsetForReadPosition(startSampleInFile, useHeaderOffsetWhenSeeking);
+
+			decoder.seekToPosition(*input, (uint32)startSampleInFile, byteOffset);
+		}
+
+		decoder.setHlacVersion(header.getVersion());
 	}
 
-	decoder.setHlacVersion(header.getVersion());
+	auto decodeInto = [&](HiseSampleBuffer& destination)
+	{
+		if (!useReaderDecoder)
+			return decodeRangeWithTemporaryDecoders(destination, isStereo, startSampleInFile, numSamples, false);
+
+		decodeRange(destination, isStereo, startSampleInFile, numSamples);
+		return true;
+	};
+
+	if (startOffsetInBuffer == 0)
+		return decodeInto(buffer);
+
+	HiseSampleBuffer offset(buffer, startOffsetInBuffer);
+
+	if (!decodeInto(offset))
+		return false;
+
+	buffer.copyNormalisationRanges(offset, startOffsetInBuffer);
+	return true;
+}
+
+ParallelBlockDecodingPool::ParallelBlockDecodingPool() :
+	numWorkerThreads(jlimit(0, 7, SystemStats::getNumCpus() - 1))
+{}
+
+ParallelBlockDecodingPool::~ParallelBlockDecodingPool()
+{
+	ScopedLock sl(poolLock);
+	pool = nullptr;
+}
+
+ThreadPool& ParallelBlockDecodingPool::getPool()
+{
+	ScopedLock sl(poolLock);
+
+	// The threads are only created when the first large read happens
+	if (pool == nullptr)
+		pool.reset(new ThreadPool(numWorkerThreads));
+
+	return *pool;
+}
+
+void ParallelBlockDecodingPool::processChunks(int numChunks, const std::function<void(int)>& chunkFunction)
+{
+	// Pending jobs might be picked up after this method returned, so everything
+	// they touch must be kept alive until the last job has finished.
+	struct State
+	{
+		std::function<void(int)> f;
+		int numChunks;
+		std::atomic<int> nextChunk = { 0 };
+		std::atomic<int> numFinished = { 0 };
+		WaitableEvent allFinished;
+	};
+
+	auto state = std::make_shared<State>();
+	state->f = chunkFunction;
+	state->numChunks = numChunks;
+
+	auto work = [state]()
+	{
+		for (;;)
+		{
+			auto chunkIndex = state->nextChunk.fetch_add(1);
+
+			if (chunkIndex >= state->numChunks)
+				return;
+
+			state->f(chunkIndex);
+
+			if (state->numFinished.fetch_add(1) + 1 == state->numChunks)
+				state->allFinished.signal();
+		}
+	};
+
+	const int numJobs = jmin(numWorkerThreads, numChunks - 1);
+
+	if (numJobs > 0)
+	{
+		auto& p = getPool();
+
+		for (int i = 0; i < numJobs; i++)
+			p.addJob(std::function<void()>(work));
+	}
+
+	work();
+
+	state->allFinished.wait();
+}
+
+void HlacReaderCommon::decodeRange(HiseSampleBuffer& destination, bool decodeStereo, int64 startSampleInFile, int numSamples)
+{
+#if HLAC_PARALLEL_BLOCK_DECODING
+	if (numSamples >= MinNumBlocksForParallelDecoding * COMPRESSION_BLOCK_SIZE &&
+		decodingPool->getNumThreads() > 1 &&
+		decodeRangeWithTemporaryDecoders(destination, decodeStereo, startSampleInFile, numSamples, true))
+		return;
+#endif
+
+	decoder.decode(destination, decodeStereo, *input, (int)startSampleInFile, numSamples);
+}
+
+bool HlacReaderCommon::decodeRangeWithTemporaryDecoders(HiseSampleBuffer& destination, bool decodeStereo, int64 startSampleInFile, int numSamples, bool ownsReaderDecoder)
+{
+	if (input == nullptr)
+		return false;
+
+	const int numBlocksInFile = (int)header.getBlockAmount();
+	const int firstBlock = (int)(startSampleInFile / COMPRESSION_BLOCK_SIZE);
+	const int endBlock = jmin(numBlocksInFile, (int)((startSampleInFile + numSamples + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE));
+	const int numBlocks = endBlock - firstBlock;
+
+	if (numBlocks <= 0)
+		return false;
+
+	auto getByteOffset = [&](int blockIndex)
+	{
+		if (blockIndex >= numBlocksInFile)
+			return input->getTotalLength();
+
+		return (int64)header.getOffsetForReadPosition((int64)blockIndex * COMPRESSION_BLOCK_SIZE, useHeaderOffsetWhenSeeking);
+	};
+
+	const int64 startByte = getByteOffset(firstBlock);
+	const int64 numBytes = getByteOffset(endBlock) - startByte;
 
-	if(startOffsetInBuffer == 0)
-		decoder.decode(buffer, isStereo, *input, (int)startSampleInFile, numSamples);
+	if (numBytes <= 0 || numBytes > (int64)std::numeric_limits<int>::max())
+		return false;
+
+	const uint8* compressedData = nullptr;
+	MemoryBlock compressedBuffer;
+
+	if (auto mis = dynamic_cast<MemoryInputStream*>(input))
+	{
+		// The memory mapped reader already has everything in memory
+		if (startByte + numBytes > (int64)mis->getDataSize())
+			return false;
+
+		compressedData = static_cast<const uint8*>(mis->getData()) + startByte;
+	}
 	else
 	{
-		HiseSampleBuffer offset(buffer, startOffsetInBuffer);
-		decoder.decode(offset, isStereo, *input, (int)startSampleInFile, numSamples);
-		buffer.copyNormalisationRanges(offset, startOffsetInBuffer);
+		// The input stream can only be used by the thread that owns the decoder
+		if (!ownsReaderDecoder)
+			return false;
+
+		// Fetch the compressed data with one sequential read, then decode from memory
+		compressedBuffer.setSize((size_t)numBytes);
+
+		input->setPosition(startByte);
+
+		if (input->read(compressedBuffer.getData(), (int)numBytes) != (int)numBytes)
+		{
+			resyncDecoder(firstBlock);
+			return false;
+		}
+
+		compressedData = static_cast<const uint8*>(compressedBuffer.getData());
 	}
 
+	struct Chunk
+	{
+		int64 startSample;
+		int numSamples;
+		int64 byteOffset;
+		int numBytes;
+		std::unique_ptr<HiseSampleBuffer> target;
+	};
+
+	int blocksPerChunk = numBlocks;
+
+#if HLAC_PARALLEL_BLOCK_DECODING
+	if (numBlocks >= MinNumBlocksForParallelDecoding)
+		blocksPerChunk = jmax(MinNumBlocksPerChunk, (numBlocks + 2 * decodingPool->getNumThreads() - 1) / (2 * decodingPool->getNumThreads()));
+#endif
+
+	const int numChunks = (numBlocks + blocksPerChunk - 1) / blocksPerChunk;
+
+	std::vector<Chunk> chunks((size_t)numChunks);
+
+	for (int i = 0; i < numChunks; i++)
+	{
+		auto& c = chunks[(size_t)i];
+
+		const int chunkStartBlock = firstBlock + i * blocksPerChunk;
+		const int chunkEndBlock = jmin(endBlock, chunkStartBlock + blocksPerChunk);
+
+		c.startSample = jmax(startSampleInFile, (int64)chunkStartBlock * COMPRESSION_BLOCK_SIZE);
+		c.numSamples = (int)(jmin(startSampleInFile + numSamples, (int64)chunkEndBlock * COMPRESSION_BLOCK_SIZE) - c.startSample);
+		c.byteOffset = getByteOffset(chunkStartBlock) - startByte;
+		c.numBytes = (int)(getByteOffset(chunkEndBlock) - getByteOffset(chunkStartBlock));
+
+		// Every chunk but the first one starts at a block boundary and every chunk but the last one
+		// ends at a block boundary, so the decoders never write into the range of another chunk.
+		const int offsetInBuffer = (int)(c.startSample - startSampleInFile);
+
+		if (destination.isFloatingPoint())
+		{
+			float* channels[2] = { static_cast<float*>(destination.getWritePointer(0, offsetInBuffer)),
+								   destination.getNumChannels() > 1 ? static_cast<float*>(destination.getWritePointer(1, offsetInBuffer)) : nullptr };
+
+			AudioSampleBuffer view(channels, destination.getNumChannels(), destination.getNumSamples() - offsetInBuffer);
+			c.target.reset(new HiseSampleBuffer(view));
+		}
+		else
+		{
+			c.target.reset(new HiseSampleBuffer(destination, offsetInBuffer));
+		}
+	}
+
+	const int hlacVersion = header.getVersion();
+
+	decodingPool->processChunks(numChunks, [&](int chunkIndex)
+	{
+		auto& c = chunks[(size_t)chunkIndex];
+
+		MemoryInputStream chunkInput(compressedData + c.byteOffset, (size_t)c.numBytes, false);
+
+		HlacDecoder chunkDecoder;
+		chunkDecoder.setupForDecompression();
+		chunkDecoder.setHlacVersion(hlacVersion);
+		chunkDecoder.seekToPosition(chunkInput, (uint32)c.startSample, 0);
+		chunkDecoder.decode(*c.target, decodeStereo, chunkInput, (int)c.startSample, c.numSamples);
+	});
+
+	if (!destination.isFloatingPoint() && hlacVersion > 2)
+	{
+		for (const auto& c : chunks)
+			destination.copyNormalisationRanges(*c.target, (int)(c.startSample - startSampleInFile));
+	}
+
+	if (ownsReaderDecoder)
+		resyncDecoder((int)((startSampleInFile + numSamples) / COMPRESSION_BLOCK_SIZE));
+
 	return true;
 }
 
+void HlacReaderCommon::resyncDecoder(int blockIndex)
+{
+	const int numBlocksInFile = (int)header.getBlockAmount();
+
+	if (numBlocksInFile == 0)
+		return;
+
+	blockIndex = jlimit(0, numBlocksInFile - 1, blockIndex);
+
+	const auto position = (uint32)blockIndex * COMPRESSION_BLOCK_SIZE;
+	decoder.seekToPosition(*input, position, header.getOffsetForReadPosition(position, useHeaderOffsetWhenSeeking));
+}
+
 void HiseLosslessAudioFormatReader::copySampleData(int* const* destSamples, int startOffsetInDestBuffer, int numDestChannels, const void* sourceData, int numChannels, int numSamples) noexcept
 {
 	jassert(numDestChannels == numDestChannels);
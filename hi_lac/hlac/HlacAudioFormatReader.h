@@ -76,6 +76,41 @@ private:
 	uint32 headerSize;
 };
 
+/** A shared set of worker threads that decode independent compression blocks of a HLAC file concurrently.
+*
+*	Every compression block starts with a self-contained cycle, so it can be decoded without knowing the
+*	previous block. Large reads (eg. loading the entire sample or filling the preload buffer) are split into
+*	chunks of whole blocks that are decoded by their own HlacDecoder instance.
+*/
+class ParallelBlockDecodingPool
+{
+public:
+
+	ParallelBlockDecodingPool();
+
+	~ParallelBlockDecodingPool();
+
+	/** Calls the function once for every chunk index and returns when all chunks are processed.
+	*
+	*	The calling thread takes part in the work, so this still works (serially) if all worker threads are busy.
+	*/
+	void processChunks(int numChunks, const std::function<void(int)>& chunkFunction);
+
+	/** Returns the number of threads that can decode at the same time (including the calling thread). */
+	int getNumThreads() const noexcept { return numWorkerThreads + 1; }
+
+private:
+
+	ThreadPool& getPool();
+
+	const int numWorkerThreads;
+
+	CriticalSection poolLock;
+	std::unique_ptr<ThreadPool> pool;
+
+	JUCE_DECLARE_NON_COPYABLE(ParallelBlockDecodingPool);
+};
+
 class HlacReaderCommon
 {
 public:
@@ -114,7 +149,26 @@ private:
 
 	bool fixedBufferRead(HiseSampleBuffer& buffer, int numDestChannels, int startOffsetInBuffer, int64 startSampleInFile, int numSamples);
 
-	
+	bool decodeIntoFixedBuffer(HiseSampleBuffer& buffer, bool isStereo, int startOffsetInBuffer, int64 startSampleInFile, int numSamples, bool useReaderDecoder);
+
+	/** Decodes the range with the decoder of this reader or, if it spans enough blocks, with multiple decoders in parallel. */
+	void decodeRange(HiseSampleBuffer& destination, bool decodeStereo, int64 startSampleInFile, int numSamples);
+
+	/** Decodes the range with decoders that don't share the state of this reader.
+	*
+	*	Large ranges are split into chunks of whole compression blocks which are decoded concurrently. If ownsReaderDecoder
+	*	is false, this only works if the data is mapped into memory. Returns false if the compressed data can't be accessed
+	*	in one piece. */
+	bool decodeRangeWithTemporaryDecoders(HiseSampleBuffer& destination, bool decodeStereo, int64 startSampleInFile, int numSamples, bool ownsReaderDecoder);
+
+	/** Moves the decoder to the start of the given block so that the next read position check stays valid. */
+	void resyncDecoder(int blockIndex);
+
+	/** The minimum amount of compression blocks that a read must span before it is decoded in parallel. */
+	static constexpr int MinNumBlocksForParallelDecoding = 16;
+
+	/** The minimum amount of compression blocks that a single decoder processes. */
+	static constexpr int MinNumBlocksPerChunk = 4;
 
 	friend class HiseLosslessAudioFormatReader;
 	friend class HlacMemoryMappedAudioFormatReader;
@@ -124,10 +178,14 @@ private:
 	HlacDecoder decoder;
 	HiseLosslessHeader header;
 
+	/** Guards the decoder and the input stream position. */
+	CriticalSection decoderLock;
+
 	bool usesFloatingPointData;
 
 	bool useHeaderOffsetWhenSeeking = true;
 
+	SharedResourcePointer<ParallelBlockDecodingPool> decodingPool;
 };
 
 class HiseLosslessAudioFormatReader : public AudioFormatReader
@@ -188,6 +246,15 @@ public:
 
 	void setTargetAudioDataType(AudioDataConverters::DataFormat dataType);
 
+	/** Returns a pointer to the interleaved 16 bit frames if this is an uncompressed monolith and the range is mapped. */
+	const int16* getRawMonolithData(int64 startSample, int64 numSamples) const noexcept
+	{
+		if (!isMonolith || map == nullptr || !mappedSection.contains(Range<int64>(startSample, startSample + numSamples)))
+			return nullptr;
+
+		return static_cast<const int16*>(sampleToPointer(startSample));
+	}
+
 private:
 	
 	friend class HlacSubSectionReader;
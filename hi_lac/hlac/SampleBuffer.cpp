@@ -285,6 +285,33 @@ bool HiseSampleBuffer::usesNormalisation() const noexcept
 	return normaliser.infos.size() != 0;
 }
 
+int HiseSampleBuffer::getNormalisationSegment(int sampleIndex, float& leftGain, float& rightGain) const noexcept
+{
+	leftGain = 1.0f;
+	rightGain = 1.0f;
+
+	int segmentEnd = getNumSamples();
+
+	for (const auto& i : normaliser.infos)
+	{
+		if ((i.leftNormalisation + i.rightNormalisation) == 0)
+			continue;
+
+		if (i.range.contains(sampleIndex))
+		{
+			leftGain = 1.0f / (1 << i.leftNormalisation);
+			rightGain = 1.0f / (1 << i.rightNormalisation);
+			segmentEnd = jmin(segmentEnd, i.range.getEnd());
+		}
+		else if (i.range.getStart() > sampleIndex)
+		{
+			segmentEnd = jmin(segmentEnd, i.range.getStart());
+		}
+	}
+
+	return segmentEnd;
+}
+
 void HiseSampleBuffer::burnNormalisation()
 {
 	if (isFloatingPoint())
@@ -319,6 +346,8 @@ void HiseSampleBuffer::copyNormalisationRanges(const HiseSampleBuffer& otherBuff
 
 	clearNormalisation(rangeToClear);
 
+	useNormalisationMap |= otherBuffer.useNormalisationMap;
+
 	for (const auto& i : otherBuffer.normaliser.infos)
 	{
 		Normaliser::NormalisationInfo i_copy(i);
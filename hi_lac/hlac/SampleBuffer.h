@@ -316,6 +316,11 @@ public:
 
 	bool usesNormalisation() const noexcept;
 
+	/** Writes the normalisation gain factors at the given sample index into the references and returns the 
+		index of the first sample after that position where the gain might change. 
+	*/
+	int getNormalisationSegment(int sampleIndex, float& leftGain, float& rightGain) const noexcept;
+
 	/** Bakes in the normalisation values. This is not lossless and the operation will allocate a temporary float buffer. */
 	void burnNormalisation();
 
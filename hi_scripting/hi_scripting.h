@@ -89,6 +89,28 @@ compile / debug cycle and don't need all nodes in scriptnode you might want to t
 #define HISE_CREATE_DSP_NETWORKS_FOR_HARDCODED_NODES 0
 #endif
 
+/** Config: HISE_USE_SCRIPT_BYTECODE
+
+If this is enabled, the callbacks and inline functions of a script will be compiled to bytecode
+that is executed by a register based interpreter instead of walking the syntax tree. This is only
+used by compiled plugins (in HISE you can toggle it with the EnableBytecode setting), so make sure
+that you've tested your project with the setting enabled before you add this to the extra definitions.
+*/
+#ifndef HISE_USE_SCRIPT_BYTECODE
+#define HISE_USE_SCRIPT_BYTECODE 0
+#endif
+
+/** Config: HISE_USE_TYPED_SCRIPT_ARITHMETIC
+
+If this is enabled, arithmetic and comparison operators with an operand of a known numeric type
+(a number literal or a typed reg / inline function parameter) are evaluated without boxing the
+intermediate results into a var. The results are identical, so you can disable this in order to
+compare the performance.
+*/
+#ifndef HISE_USE_TYPED_SCRIPT_ARITHMETIC
+#define HISE_USE_TYPED_SCRIPT_ARITHMETIC 1
+#endif
+
 #define MAX_SCRIPT_HEIGHT 700
 
 #include "AppConfig.h"
@@ -78,6 +78,7 @@
 #include "scripting/engine/JavascriptEngineStatements.cpp"
 #include "scripting/engine/JavascriptEngineOperators.cpp"
 #include "scripting/engine/JavascriptEngineCustom.cpp"
+#include "scripting/engine/JavascriptEngineBytecode.cpp"
 #include "scripting/engine/JavascriptEngineParser.cpp"
 #include "scripting/engine/JavascriptEngineObjects.cpp"
 #include "scripting/engine/JavascriptEngineMathObject.cpp"
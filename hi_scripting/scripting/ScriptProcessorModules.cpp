@@ -1865,6 +1865,34 @@ void JavascriptSynthesiser::prepareToPlay(double newSampleRate, int samplesPerBl
 
 
 
+void JavascriptSynthesiser::renderVoiceBatch(int startSample, int numThisTime)
+{
+	auto n = getActiveNetwork();
+
+	if (n == nullptr || activeVoices.size() < 2 || !n->canProcessVoices())
+		return;
+
+	int voiceIndexes[NUM_POLYPHONIC_VOICES];
+	scriptnode::ProcessDataDyn* voiceBuffers[NUM_POLYPHONIC_VOICES];
+	int numVoices = 0;
+
+	for (auto v : activeVoices)
+	{
+		if (numVoices == NUM_POLYPHONIC_VOICES)
+			break;
+
+		auto jv = static_cast<Voice*>(v);
+		voiceIndexes[numVoices] = jv->getVoiceIndex();
+		voiceBuffers[numVoices++] = jv->prepareBatchRendering(*n, startSample, numThisTime);
+	}
+
+	if (n->processVoices(voiceIndexes, voiceBuffers, numVoices))
+	{
+		for (int i = 0; i < numVoices; i++)
+			static_cast<Voice*>(activeVoices[i])->isRenderedInBatch = true;
+	}
+}
+
 void JavascriptSynthesiser::restoreFromValueTree(const ValueTree &v)
 {
 	ModulatorSynth::restoreFromValueTree(v); 
@@ -1887,7 +1915,8 @@ bool JavascriptSynthesiser::Sound::appliesToVelocity(int)
 
 JavascriptSynthesiser::Voice::Voice(JavascriptSynthesiser* p):
 	ModulatorSynthVoice(p),
-	synth(p)
+	synth(p),
+	batchData(batchChannels, 0, 0)
 {}
 
 void JavascriptSynthesiser::Voice::setVoiceStartDataForNextRenderCallback()
@@ -1898,9 +1927,35 @@ void JavascriptSynthesiser::Voice::setVoiceStartDataForNextRenderCallback()
 void JavascriptSynthesiser::Voice::resetVoice()
 {
 	ModulatorSynthVoice::resetVoice();
+	isRenderedInBatch = false;
 	synth->voiceData.reset(getVoiceIndex());
 }
 
+void JavascriptSynthesiser::Voice::startNetworkVoice(scriptnode::DspNetwork& n)
+{
+	if (isVoiceStart)
+	{
+		n.setVoiceKiller(synth->vk);
+		synth->voiceData.startVoice(n, *n.getPolyHandler(), getVoiceIndex(), getCurrentHiseEvent());
+		isVoiceStart = false;
+	}
+}
+
+scriptnode::ProcessDataDyn* JavascriptSynthesiser::Voice::prepareBatchRendering(scriptnode::DspNetwork& n, int startSample, int numSamples)
+{
+	startNetworkVoice(n);
+
+	voiceBuffer.clear();
+
+	int numChannels = voiceBuffer.getNumChannels();
+
+	for (int i = 0; i < numChannels; i++)
+		batchChannels[i] = voiceBuffer.getWritePointer(i, startSample);
+
+	batchData.referTo(batchChannels, numChannels, numSamples);
+	return &batchData;
+}
+
 int JavascriptSynthesiser::getNumSnippets() const
 { return (int)Callback::numCallbacks; }
 
@@ -2003,28 +2058,31 @@ void JavascriptSynthesiser::Voice::calculateBlock(int startSample, int numSample
 	
 	if (auto n = synth->getActiveNetwork())
 	{
-		if (isVoiceStart)
+		if (isRenderedInBatch)
 		{
-			n->setVoiceKiller(synth->vk);
-			synth->voiceData.startVoice(*n, *n->getPolyHandler(), getVoiceIndex(), getCurrentHiseEvent());
-			isVoiceStart = false;
+			// The voice buffer already contains the output of the network
+			isRenderedInBatch = false;
 		}
+		else
+		{
+			startNetworkVoice(*n);
 
-		float* channels[NUM_MAX_CHANNELS];
+			float* channels[NUM_MAX_CHANNELS];
 
-		voiceBuffer.clear();
+			voiceBuffer.clear();
 
-		int numChannels = voiceBuffer.getNumChannels();
-		memcpy(channels, voiceBuffer.getArrayOfWritePointers(), sizeof(float*) * numChannels);
+			int numChannels = voiceBuffer.getNumChannels();
+			memcpy(channels, voiceBuffer.getArrayOfWritePointers(), sizeof(float*) * numChannels);
 
-		for (int i = 0; i < numChannels; i++)
-			channels[i] += startSample;
+			for (int i = 0; i < numChannels; i++)
+				channels[i] += startSample;
 
-		scriptnode::ProcessDataDyn d(channels, numSamples, numChannels);
+			scriptnode::ProcessDataDyn d(channels, numSamples, numChannels);
 
-		{
-			scriptnode::DspNetwork::VoiceSetter vs(*n, getVoiceIndex());
-            n->process(d);
+			{
+				scriptnode::DspNetwork::VoiceSetter vs(*n, getVoiceIndex());
+				n->process(d);
+			}
 		}
 		
 		if (auto modValues = getOwnerSynth()->getVoiceGainValues())
@@ -809,9 +809,21 @@ public:
 
 		virtual void resetVoice() override;
 
+		/** Starts the voice in the network if it was just started. */
+		void startNetworkVoice(scriptnode::DspNetwork& n);
+
+		/** Clears the voice buffer and returns the audio data for rendering the voice in a batch. */
+		scriptnode::ProcessDataDyn* prepareBatchRendering(scriptnode::DspNetwork& n, int startSample, int numSamples);
+
 		JavascriptSynthesiser* synth;
 
 		bool isVoiceStart = false;
+
+		/** Set if the network has already rendered this voice for the current block in renderVoiceBatch(). */
+		bool isRenderedInBatch = false;
+
+		float* batchChannels[NUM_MAX_CHANNELS];
+		scriptnode::ProcessDataDyn batchData;
 	};
 	
 	SET_PROCESSOR_NAME("ScriptSynth", "Scriptnode Synthesiser", "A polyphonic scriptable synthesiser.");
@@ -850,6 +862,9 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 
+	/** Renders all active voices with a single call if the network is frozen and supports it. */
+	void renderVoiceBatch(int startSample, int numThisTime) override;
+
 	bool isPolyphonic() const override;
 
 	float getModValueForNode(int modIndex, int startSample) const;
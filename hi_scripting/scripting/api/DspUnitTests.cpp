@@ -1407,6 +1407,1216 @@ private:
 
 //static ModulationTests modulationTests;
 
+#if HISE_ENABLE_AUDIO_THREAD_VIOLATION_TRACKER
+
+class AudioThreadViolationTests : public UnitTest
+{
+public:
+
+	using ScopedProcessor = ScopedPointer<BackendProcessor>;
+
+	AudioThreadViolationTests() :
+		UnitTest("Audio thread violation tests")
+	{
+
+	}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		testTracker();
+		testWorkerTasks();
+		testPresetRendering();
+
+		// Set this environment variable to check one of your own presets.
+		auto presetPath = SystemStats::getEnvironmentVariable("HISE_AUDIO_THREAD_TEST_PRESET", {});
+
+		if (File::isAbsolutePath(presetPath) && File(presetPath).existsAsFile())
+			testPresetFile(File(presetPath));
+	}
+
+private:
+
+	void testTracker()
+	{
+		beginTest("Testing the violation tracker");
+
+		ScopedProcessor bp = new BackendProcessor(nullptr, nullptr);
+
+		auto& tracker = AudioThreadViolationTracker::getInstance();
+		tracker.clear();
+
+		{
+			AudioThreadViolationTracker::ScopedAudioThread sat;
+			AudioThreadViolationTracker::ScopedProcessor sp(bp->getMainSynthChain());
+
+			String s = "Allocation " + String(Random::getSystemRandom().nextInt());
+			ignoreUnused(s);
+
+			LockHelpers::SafeLock sl(bp, LockHelpers::Type::SampleLock);
+		}
+
+		expect(tracker.getNumViolations(AudioThreadViolationTracker::ViolationType::Allocation) > 0, "Allocation not detected");
+		expect(tracker.getNumViolations(AudioThreadViolationTracker::ViolationType::LockAcquisition) == 1, "Lock not detected");
+		expect(tracker.createReport().contains(bp->getMainSynthChain()->getId()), "Processor not reported");
+
+		tracker.clear();
+
+		{
+			String s = "Allocation " + String(Random::getSystemRandom().nextInt());
+			ignoreUnused(s);
+		}
+
+		expectEquals(tracker.getNumViolations(), 0, "Allocation outside the audio thread detected");
+	}
+
+	void testWorkerTasks()
+	{
+		beginTest("Testing allocations in realtime worker tasks");
+
+		ScopedProcessor bp = new BackendProcessor(nullptr, nullptr);
+		SharedResourcePointer<RealtimeWorkerGroup> workers;
+
+		auto& tracker = AudioThreadViolationTracker::getInstance();
+
+		std::atomic<int> numWorkerTasks = { 0 };
+
+		// Only allocate on the worker threads so that the calling thread doesn't cause the violations
+		auto f = [&numWorkerTasks](int taskIndex)
+		{
+			if (RealtimeWorkerGroup::getCurrentWorkerIndex() == 0)
+				return;
+
+			String s = "Task " + String(taskIndex);
+			ignoreUnused(s);
+			numWorkerTasks++;
+
+			for (volatile int i = 0; i < 20000; i++)
+				;
+		};
+
+		auto runTasks = [&]()
+		{
+			for (int i = 0; i < 20; i++)
+				workers->execute(workers->getNumWorkers() * 4, f);
+		};
+
+		tracker.clear();
+
+		{
+			AudioThreadViolationTracker::ScopedAudioThread sat;
+			AudioThreadViolationTracker::ScopedProcessor sp(bp->getMainSynthChain());
+
+			runTasks();
+		}
+
+		if (numWorkerTasks == 0)
+		{
+			logMessage("Skipping the worker test, no task was executed on a worker thread");
+			return;
+		}
+
+		expect(tracker.getNumViolations(AudioThreadViolationTracker::ViolationType::Allocation) > 0, "Allocation in worker task not detected");
+		expect(tracker.createReport().contains(bp->getMainSynthChain()->getId()), "Processor of the calling thread not reported");
+
+		// The workers must restore their own state after the task
+		tracker.clear();
+		runTasks();
+
+		expectEquals(tracker.getNumViolations(), 0, "Allocation in worker task outside the audio thread detected");
+	}
+
+	void testPresetRendering()
+	{
+		beginTest("Testing offline rendering of a preset");
+
+		ValueTree preset;
+
+		{
+			ScopedProcessor source = new BackendProcessor(nullptr, nullptr);
+
+			ScopedPointer<SineSynth> sine = new SineSynth(source, "Sine", NUM_POLYPHONIC_VOICES);
+			sine->addProcessorsWhenEmpty();
+
+			auto fxChain = dynamic_cast<EffectProcessorChain*>(sine->getChildProcessor(ModulatorSynth::EffectChain));
+			fxChain->getHandler()->add(new GainEffect(source, "Gain"), nullptr);
+
+			source->getMainSynthChain()->getHandler()->add(sine.release(), nullptr);
+
+			preset = source->getMainSynthChain()->exportAsValueTree();
+		}
+
+		ScopedProcessor bp = new BackendProcessor(nullptr, nullptr);
+
+		{
+			MainController::ScopedBadBabysitter sb(bp);
+			bp->loadPresetFromValueTree(preset);
+		}
+
+		auto r = AudioThreadViolationTracker::renderOfflineAndCheck(bp);
+		expect(r.wasOk(), r.getErrorMessage());
+	}
+
+	void testPresetFile(const File& presetFile)
+	{
+		beginTest("Testing offline rendering of " + presetFile.getFileName());
+
+		ScopedProcessor bp = new BackendProcessor(nullptr, nullptr);
+
+		{
+			MainController::ScopedBadBabysitter sb(bp);
+			bp->loadPresetFromFile(presetFile);
+		}
+
+		auto r = AudioThreadViolationTracker::renderOfflineAndCheck(bp);
+		expect(r.wasOk(), r.getErrorMessage());
+	}
+};
+
+static AudioThreadViolationTests audioThreadViolationTests;
+
+#endif
+
+class ScriptInterpreterTests : public UnitTest
+{
+public:
+
+	using ScopedProcessor = ScopedPointer<BackendProcessor>;
+
+	ScriptInterpreterTests() :
+		UnitTest("Script interpreter tests")
+	{
+
+	}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		testBytecode();
+		testTypedArithmetic();
+		testTypedArithmeticPerformance();
+	}
+
+private:
+
+	/** Compiles a script with an onTest(x) callback in a standalone engine. */
+	struct ScriptRunner
+	{
+		ScriptRunner(UnitTest& t, const String& code, bool useBytecode)
+		{
+			bp = new BackendProcessor(nullptr, nullptr);
+
+			// The setting is read when the engine is created
+			auto& settings = dynamic_cast<GlobalSettingManager*>(bp.get())->getSettingsObject();
+
+			for (auto c : settings.data)
+			{
+				auto prop = c.getChildWithName(HiseSettings::Scripting::EnableBytecode);
+
+				if (prop.isValid())
+					prop.setProperty("value", useBytecode ? "Yes" : "No", nullptr);
+			}
+
+			t.expect((bool)settings.getSetting(HiseSettings::Scripting::EnableBytecode) == useBytecode, "Bytecode setting not applied");
+
+			jp = new JavascriptMidiProcessor(bp, "Script");
+			engine = jp->getScriptEngine();
+
+			engine->registerCallbackName("onTest", 1, 0.0);
+
+			auto r = engine->execute(code);
+			t.expect(r.wasOk(), r.getErrorMessage());
+		}
+
+		~ScriptRunner()
+		{
+			jp = nullptr;
+			bp = nullptr;
+		}
+
+		var callTest(const var& x)
+		{
+			engine->setCallbackParameter(0, 0, x);
+			return engine->executeCallback(0, nullptr);
+		}
+
+		var callFunction(const Identifier& id, var* args, int numArgs)
+		{
+			return engine->executeInlineFunction(engine->getInlineFunction(id), args, nullptr, numArgs);
+		}
+
+		ScopedProcessor bp;
+		ScopedPointer<JavascriptMidiProcessor> jp;
+		HiseJavascriptEngine* engine = nullptr;
+	};
+
+	/** Returns true if both values have the same type and value (recursively for arrays). */
+	static bool isIdentical(const var& a, const var& b)
+	{
+		if (!a.hasSameTypeAs(b))
+			return false;
+
+		if (auto aa = a.getArray())
+		{
+			auto ba = b.getArray();
+
+			if (aa->size() != ba->size())
+				return false;
+
+			for (int i = 0; i < aa->size(); i++)
+			{
+				if (!isIdentical(aa->getReference(i), ba->getReference(i)))
+					return false;
+			}
+
+			return true;
+		}
+
+		return a.isUndefined() || a.isVoid() || a == b;
+	}
+
+	void expectIdentical(const var& treeResult, const var& bytecodeResult, const String& name)
+	{
+		expect(isIdentical(treeResult, bytecodeResult), name + ": tree: " + JSON::toString(treeResult, true) + ", bytecode: " + JSON::toString(bytecodeResult, true));
+	}
+
+	void testBytecode()
+	{
+		beginTest("Testing bytecode against the tree interpreter");
+
+		// Covers locals, loops with break / continue, nested inline functions, reg variables,
+		// int / double / string results and the nodes that the bytecode leaves to the tree interpreter
+		// (for-in loops and switch statements) which must see the same local variables.
+		const String code = R"(
+			reg counter = 0;
+			const var data = [1, 2.5, 3, 4, 5];
+
+			inline function sum(list, scale)
+			{
+				local total = 0;
+				local i = 0;
+
+				for (x in list)
+					total += x * scale;
+
+				while (i < 10)
+				{
+					i++;
+
+					if (i % 3 == 0)
+						continue;
+
+					if (i > 7)
+						break;
+
+					total += i / 2;
+				}
+
+				return total;
+			}
+
+			inline function describe(v)
+			{
+				local s = "";
+
+				switch (v % 4)
+				{
+					case 0: s = "zero"; break;
+					case 1: s = "one"; break;
+					default: s = "other";
+				}
+
+				return s + ":" + v;
+			}
+
+			inline function clip(v, lo, hi)
+			{
+				if (v < lo)
+					return lo;
+
+				return v > hi ? hi : v;
+			}
+
+			function onTest(x)
+			{
+				local a = x * 2;
+				local b = a > 10 ? a / 3 : a + 0.5;
+				local c = [];
+				local j = 0;
+
+				for (j = 0; j < 4; j++)
+					c.push(clip(a - j * 3, 0, 9) + sum(data, j));
+
+				counter += x;
+
+				return [a, b, c, describe(x), counter, a & 7, a == b, "x" + a, Math.floor(b), x > 3 && b < 20, !a];
+			}
+		)";
+
+		ScriptRunner tree(*this, code, false);
+		ScriptRunner bytecode(*this, code, true);
+
+		const Array<var> inputs = { 0, 1, 4, 7, 2.5, -3, 11 };
+
+		for (const auto& x : inputs)
+		{
+			auto name = "onTest(" + x.toString() + ")";
+			expectIdentical(tree.callTest(x), bytecode.callTest(x), name);
+		}
+
+		for (int i = 0; i < 6; i++)
+		{
+			var args[3] = { i * 1.5, 1, 5 };
+			expectIdentical(tree.callFunction("clip", args, 3), bytecode.callFunction("clip", args, 3), "clip(" + args[0].toString() + ")");
+
+			var describeArgs[1] = { i };
+			expectIdentical(tree.callFunction("describe", describeArgs, 1), bytecode.callFunction("describe", describeArgs, 1), "describe(" + String(i) + ")");
+		}
+
+		// The locals of inline functions are stored per thread, so call it from a thread that didn't compile it
+		Array<var> list = { 1, 2.5, 3, 4, 5 };
+		var args[2] = { var(list), 2 };
+
+		auto expected = tree.callFunction("sum", args, 2);
+
+		var result;
+		WaitableEvent done;
+
+		Thread::launch([&]()
+		{
+			result = bytecode.callFunction("sum", args, 2);
+			done.signal();
+		});
+
+		expect(done.wait(5000), "Timeout");
+		expectIdentical(expected, result, "sum() on another thread");
+	}
+
+	void testTypedArithmetic()
+	{
+		beginTest("Testing typed arithmetic against the boxed operators");
+
+		// Operators with a typed operand use the unboxed NumericValue path, operators with two
+		// untyped operands use the boxed getResult() path, so the typed and untyped functions
+		// must return the same types and values. mixed() has one typed operand and falls back
+		// to the boxed path for strings and undefined values.
+		const String code = R"(
+			inline function typedMath(a:number, b:number)
+			{
+				return [a + b, a - b, a * b, a / b, a % b, (a + b) * (a - b),
+						a == b, a != b, a < b, a <= b, a > b, a >= b];
+			}
+
+			inline function boxedMath(a, b)
+			{
+				return [a + b, a - b, a * b, a / b, a % b, (a + b) * (a - b),
+						a == b, a != b, a < b, a <= b, a > b, a >= b];
+			}
+
+			inline function typedBits(a:int, b:int)
+			{
+				return [a & b, a | b, a ^ b, a << b, a >> b, a >>> b, (a | b) + a];
+			}
+
+			inline function boxedBits(a, b)
+			{
+				return [a & b, a | b, a ^ b, a << b, a >> b, a >>> b, (a | b) + a];
+			}
+
+			inline function mixed(a, b:number)
+			{
+				return [a + b, a == b, a != b, a < b, a >= b];
+			}
+
+			inline function boxedMixed(a, b)
+			{
+				return [a + b, a == b, a != b, a < b, a >= b];
+			}
+
+			function onTest(x)
+			{
+				return x;
+			}
+		)";
+
+		ScriptRunner runner(*this, code, false);
+
+		auto compare = [&](const Identifier& typedId, const Identifier& boxedId, const var& a, const var& b)
+		{
+			var typedArgs[2] = { a, b };
+			var boxedArgs[2] = { a, b };
+
+			auto name = typedId.toString() + "(" + JSON::toString(a) + ", " + JSON::toString(b) + ")";
+			auto typedResult = runner.callFunction(typedId, typedArgs, 2);
+			auto boxedResult = runner.callFunction(boxedId, boxedArgs, 2);
+
+			expect(isIdentical(typedResult, boxedResult), name + ": typed: " + JSON::toString(typedResult, true) + ", boxed: " + JSON::toString(boxedResult, true));
+		};
+
+		const Array<var> numbers = { 0, 1, 7, -3, 12, 2.5, -0.75, 3.0, 127.0 };
+
+		for (const auto& a : numbers)
+		{
+			for (const auto& b : numbers)
+				compare("typedMath", "boxedMath", a, b);
+		}
+
+		const Array<var> ints = { 0, 1, 3, 5, 12, 127, 255 };
+
+		for (const auto& a : ints)
+		{
+			for (const auto& b : ints)
+			{
+				// shifting by more than 31 bits is undefined
+				if ((int)b < 32)
+					compare("typedBits", "boxedBits", a, b);
+			}
+		}
+
+		const Array<var> others = { var("12"), var("abc"), var(), 4, 0.5 };
+
+		for (const auto& a : others)
+		{
+			for (const auto& b : numbers)
+				compare("mixed", "boxedMixed", a, b);
+		}
+	}
+
+	void testTypedArithmeticPerformance()
+	{
+		beginTest("Benchmarking typed arithmetic in a MIDI processing script");
+
+		// The same note processing once without types (every operator uses the boxed path like
+		// before the typed arithmetic) and once with typed parameters and registers. Constants
+		// are stored in registers because literals would make the untyped version use the
+		// unboxed path too.
+		const String code = R"(
+			reg$I twelve = 12;
+			reg$I maxVelocity = 127;
+			reg$I fifth = 7;
+			reg$N minGain = 0.2;
+			reg$N gainRange = 0.8;
+			reg$N delayFactor = 0.25;
+
+			inline function processNote(note$I, velocity$I)
+			{
+				local degree = note % twelve;
+				local octave = (note - degree) / twelve;
+				local transposed = note + fifth - degree % 2;
+				local curved = velocity * velocity / maxVelocity;
+				local gain = curved / maxVelocity * gainRange + minGain;
+				local delay = (maxVelocity - velocity) * delayFactor + octave * fifth;
+
+				if (transposed > maxVelocity)
+					transposed -= twelve;
+
+				return (transposed * maxVelocity + curved) * gain + delay;
+			}
+
+			function onTest(x)
+			{
+				return x;
+			}
+		)";
+
+		auto createCode = [&code](bool typed)
+		{
+			return code.replace("$I", typed ? ":int" : "").replace("$N", typed ? ":number" : "");
+		};
+
+		ScriptRunner untyped(*this, createCode(false), false);
+		ScriptRunner typed(*this, createCode(true), false);
+
+		auto processEvents = [](ScriptRunner& r, double& result)
+		{
+			Random rand(42);
+			auto start = Time::getMillisecondCounterHiRes();
+
+			for (int i = 0; i < 20000; i++)
+			{
+				var args[2] = { rand.nextInt(128), 1 + rand.nextInt(127) };
+				result += (double)r.callFunction("processNote", args, 2);
+			}
+
+			return Time::getMillisecondCounterHiRes() - start;
+		};
+
+		double untypedResult = 0.0, typedResult = 0.0;
+
+		auto untypedTime = processEvents(untyped, untypedResult);
+		auto typedTime = processEvents(typed, typedResult);
+
+		expectEquals(typedResult, untypedResult, "Different results");
+
+		logMessage("Untyped: " + String(untypedTime, 2) + "ms, typed: " + String(typedTime, 2) + "ms, speedup: " + String(untypedTime / jmax(0.001, typedTime), 2) + "x");
+	}
+};
+
+static ScriptInterpreterTests scriptInterpreterTests;
+
+class ParallelVoiceRenderingTests : public UnitTest
+{
+public:
+
+	using ScopedProcessor = ScopedPointer<BackendProcessor>;
+
+	ParallelVoiceRenderingTests() :
+		UnitTest("Parallel voice rendering tests")
+	{
+
+	}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		testSynth<SineSynth>("SineSynth");
+		testSynth<WaveSynth>("WaveSynth");
+	}
+
+private:
+
+	template <class SynthType> void testSynth(const String& name)
+	{
+		beginTest("Testing parallel voice rendering of " + name);
+
+		auto serial = renderChord<SynthType>(false);
+		auto parallel = renderChord<SynthType>(true);
+
+		expect(serial.getMagnitude(0, serial.getNumSamples()) > 0.0f, "No output");
+
+		float maxError = 0.0f;
+
+		for (int c = 0; c < serial.getNumChannels(); c++)
+		{
+			for (int i = 0; i < serial.getNumSamples(); i++)
+				maxError = jmax(maxError, std::abs(serial.getSample(c, i) - parallel.getSample(c, i)));
+		}
+
+		// The worker buffers are summed in another order than the voices, so it's not bit identical
+		const auto errorDb = Decibels::gainToDecibels(maxError);
+		expect(errorDb < -90.0f, "Parallel rendering doesn't match the serial rendering: " + String(errorDb, 1) + " dB");
+	}
+
+	template <class SynthType> AudioSampleBuffer renderChord(bool useParallelRendering)
+	{
+		ScopedProcessor bp = new BackendProcessor(nullptr, nullptr);
+
+		ScopedPointer<SynthType> synth = new SynthType(bp, "Synth", NUM_POLYPHONIC_VOICES);
+		synth->addProcessorsWhenEmpty();
+		synth->setUseParallelVoiceRendering(useParallelRendering);
+
+		expect(synth->isUsingParallelVoiceRendering() == useParallelRendering, "Parallel rendering mode not set");
+
+		bp->getMainSynthChain()->getHandler()->add(synth.release(), nullptr);
+
+		auto p = dynamic_cast<AudioProcessor*>(bp.get());
+
+		const int blockSize = 512;
+		const int numBlocks = 64;
+
+		p->prepareToPlay(44100.0, blockSize);
+
+		AudioSampleBuffer buffer(jmax(2, p->getTotalNumOutputChannels()), blockSize);
+		AudioSampleBuffer output(2, blockSize * numBlocks);
+		MidiBuffer midi;
+
+		for (int i = 0; i < numBlocks; i++)
+		{
+			midi.clear();
+
+			// More voices than workers with different start offsets and velocities
+			if (i == 0)
+			{
+				for (int n = 0; n < 16; n++)
+					midi.addEvent(MidiMessage::noteOn(1, 48 + n * 2, (uint8)(40 + n * 5)), n * 17);
+			}
+			else if (i == numBlocks / 2)
+			{
+				for (int n = 0; n < 16; n += 2)
+					midi.addEvent(MidiMessage::noteOff(1, 48 + n * 2), n * 13);
+			}
+
+			buffer.clear();
+			p->processBlock(buffer, midi);
+
+			for (int c = 0; c < 2; c++)
+				output.copyFrom(c, i * blockSize, buffer, c, 0, blockSize);
+		}
+
+		bp = nullptr;
+
+		return output;
+	}
+};
+
+static ParallelVoiceRenderingTests parallelVoiceRenderingTests;
+
+class VoiceAllocatorTests : public UnitTest
+{
+public:
+
+	using ScopedProcessor = ScopedPointer<BackendProcessor>;
+	using StealingMode = VoiceAllocator::StealingMode;
+
+	VoiceAllocatorTests() :
+		UnitTest("Voice allocator tests")
+	{
+
+	}
+
+	void runTest() override
+	{
+		testVoiceLifecycle();
+		testHeapOrder();
+		testStealingModes();
+		testNoteList();
+
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		testSynthStealing(StealingMode::Oldest, "62:100");
+		testSynthStealing(StealingMode::SameNoteFirst, "60:90");
+		testSynthStealing(StealingMode::Quietest, "64:20");
+		testSiblingsAndRetrigger();
+		testVoiceAmountChange();
+	}
+
+private:
+
+	static Array<int> getVoicesForNote(const VoiceAllocator& a, int noteNumber)
+	{
+		Array<int> list;
+
+		for (auto v = a.getFirstVoiceForNote(noteNumber); v != -1; v = a.getNextVoiceForNote(v))
+			list.add(v);
+
+		list.sort();
+		return list;
+	}
+
+	void testVoiceLifecycle()
+	{
+		beginTest("Testing start, release, kill and remove");
+
+		VoiceAllocator a;
+		a.reset(8);
+
+		expectEquals(a.getNumVoices(), 8, "Voice amount");
+		expectEquals(a.getFreeVoice(), 0, "The lowest voice index is used first");
+		expectEquals(a.getNumStealableVoices(), 0, "No active voices");
+		expectEquals(a.getOldestVoice(), -1, "No oldest voice");
+
+		for (int i = 0; i < 3; i++)
+		{
+			auto v = a.getFreeVoice();
+			expectEquals(v, i, "Free voice");
+			a.voiceStarted(v, 60 + i);
+			expect(!a.isFree(v), "Started voice is not free");
+		}
+
+		expectEquals(a.getFreeVoice(), 3, "Next free voice");
+		expectEquals(a.getNumStealableVoices(), 3, "Active voices");
+		expectEquals(a.getOldestVoice(), 0, "First voice is the oldest");
+
+		a.voiceReleased(1);
+		expect(a.isReleased(1), "Voice is released");
+		expectEquals(a.getOldestVoice(), 1, "Released voices are stolen first");
+
+		a.voiceKilled(1);
+		expectEquals(a.getNumStealableVoices(), 2, "Killed voice can't be stolen");
+		expectEquals(a.getKilledVoice(true), 1, "Released killed voice");
+		expectEquals(a.getOldestVoice(), 0, "Oldest voice after kill");
+		expect(getVoicesForNote(a, 61) == Array<int>({ 1 }), "Killed voice stays in the note list");
+
+		a.voiceRemoved(1);
+		expect(a.isFree(1), "Removed voice is free");
+		expect(!a.isReleased(1), "Removed voice is not released");
+		expectEquals(a.getFreeVoice(), 1, "Removed voice is used next");
+		expectEquals(a.getKilledVoice(false), -1, "Killed list is empty");
+		expectEquals(getVoicesForNote(a, 61).size(), 0, "Removed voice isn't in the note list");
+
+		a.voiceKilled(2);
+		expectEquals(a.getKilledVoice(true), -1, "Killed voice wasn't released");
+		expectEquals(a.getKilledVoice(false), 2, "Held killed voice");
+
+		// Calling it twice or on a free voice must not change the state
+		a.voiceKilled(2);
+		a.voiceReleased(5);
+		a.voiceRemoved(5);
+		a.voiceRemoved(2);
+		a.voiceRemoved(2);
+
+		expectEquals(a.getNumStealableVoices(), 1, "Only voice 0 is active");
+		expectEquals(a.getKilledVoice(false), -1, "Killed list is empty");
+
+		// Restarting an active voice moves it to the end of the stealing order
+		a.voiceStarted(3, 70);
+		a.voiceStarted(0, 72);
+		expectEquals(a.getOldestVoice(), 3, "Restarted voice is the newest");
+		expectEquals(getVoicesForNote(a, 60).size(), 0, "Restarted voice left the old note list");
+		expect(getVoicesForNote(a, 72) == Array<int>({ 0 }), "Restarted voice is in the new note list");
+
+		a.reset(4);
+		expectEquals(a.getNumStealableVoices(), 0, "Reset clears the heap");
+		expectEquals(getVoicesForNote(a, 70).size(), 0, "Reset clears the note lists");
+
+		for (int i = 0; i < 4; i++)
+			expect(a.isFree(i), "Reset frees all voices");
+
+		expect(!a.isFree(4), "Voice index above the voice amount");
+	}
+
+	struct ModelVoice
+	{
+		bool active = false;
+		bool killed = false;
+		bool released = false;
+		uint32 startIndex = 0;
+		int noteNumber = -1;
+	};
+
+	static bool hasHigherPriority(const ModelVoice& a, const ModelVoice& b)
+	{
+		if (a.released != b.released)
+			return a.released;
+
+		return a.startIndex < b.startIndex;
+	}
+
+	void testHeapOrder()
+	{
+		beginTest("Testing heap order with random operations");
+
+		Random r(0x9182);
+
+		VoiceAllocator a;
+		const int numVoices = 48;
+		a.reset(numVoices);
+
+		ModelVoice model[numVoices];
+		uint32 startCounter = 0;
+
+		for (int op = 0; op < 4000; op++)
+		{
+			auto v = r.nextInt(numVoices);
+			auto& m = model[v];
+
+			if (!m.active)
+			{
+				m = {};
+				m.active = true;
+				m.startIndex = ++startCounter;
+				m.noteNumber = 60 + r.nextInt(12);
+				a.voiceStarted(v, m.noteNumber);
+			}
+			else
+			{
+				switch (r.nextInt(4))
+				{
+				case 0:
+					m.released = true;
+					a.voiceReleased(v);
+					break;
+				case 1:
+					m.killed = true;
+					a.voiceKilled(v);
+					break;
+				case 2:
+					m = {};
+					a.voiceRemoved(v);
+					break;
+				case 3:
+					m.killed = false;
+					m.released = false;
+					m.startIndex = ++startCounter;
+					m.noteNumber = 60 + r.nextInt(12);
+					a.voiceStarted(v, m.noteNumber);
+					break;
+				}
+			}
+
+			int expectedOldest = -1;
+			int numStealable = 0;
+			bool hasKilled = false;
+			bool hasReleasedKilled = false;
+
+			for (int i = 0; i < numVoices; i++)
+			{
+				if (a.isFree(i) == model[i].active)
+				{
+					expect(false, "Free state mismatch of voice " + String(i) + " after operation " + String(op));
+					return;
+				}
+
+				if (!model[i].active)
+					continue;
+
+				if (model[i].killed)
+				{
+					hasKilled = true;
+					hasReleasedKilled |= model[i].released;
+					continue;
+				}
+
+				numStealable++;
+
+				if (expectedOldest == -1 || hasHigherPriority(model[i], model[expectedOldest]))
+					expectedOldest = i;
+			}
+
+			if (a.getNumStealableVoices() != numStealable || a.getOldestVoice() != expectedOldest)
+			{
+				expectEquals(a.getNumStealableVoices(), numStealable, "Stealable voices after operation " + String(op));
+				expectEquals(a.getOldestVoice(), expectedOldest, "Oldest voice after operation " + String(op));
+				return;
+			}
+
+			auto killed = a.getKilledVoice(false);
+			auto releasedKilled = a.getKilledVoice(true);
+
+			expect((killed != -1) == hasKilled, "Killed voice after operation " + String(op));
+			expect((releasedKilled != -1) == hasReleasedKilled, "Released killed voice after operation " + String(op));
+
+			if (killed != -1)
+				expect(model[killed].active && model[killed].killed, "Wrong killed voice");
+
+			if (releasedKilled != -1)
+				expect(model[releasedKilled].killed && model[releasedKilled].released, "Wrong released killed voice");
+
+			auto freeVoice = a.getFreeVoice();
+
+			if (freeVoice != -1)
+				expect(!model[freeVoice].active, "Free voice is active");
+		}
+
+		for (int n = 60; n < 72; n++)
+		{
+			Array<int> expected;
+
+			for (int i = 0; i < numVoices; i++)
+			{
+				if (model[i].active && model[i].noteNumber == n)
+					expected.add(i);
+			}
+
+			expect(getVoicesForNote(a, n) == expected, "Note list of note " + String(n));
+		}
+	}
+
+	void testStealingModes()
+	{
+		beginTest("Testing SameNoteFirst and Quietest voice stealing");
+
+		VoiceAllocator a;
+		a.reset(8);
+
+		const float gains[8] = { 0.9f, 0.5f, 0.2f, 0.7f, 0.2f, 0.1f, 1.0f, 1.0f };
+		auto getGain = [&gains](int v) { return gains[v]; };
+
+		a.voiceStarted(0, 62);
+		a.voiceStarted(1, 60);
+		a.voiceStarted(2, 60);
+		a.voiceStarted(3, 64);
+		a.voiceStarted(4, 65);
+
+		expectEquals(a.getVoiceToSteal(StealingMode::Oldest, 60, getGain), 0, "Oldest");
+		expectEquals(a.getVoiceToSteal(StealingMode::SameNoteFirst, 60, getGain), 1, "Oldest voice with the same note");
+		expectEquals(a.getVoiceToSteal(StealingMode::SameNoteFirst, 64, getGain), 3, "Only voice with the same note");
+		expectEquals(a.getVoiceToSteal(StealingMode::SameNoteFirst, 70, getGain), 0, "No voice with the same note uses Oldest");
+		expectEquals(a.getVoiceToSteal(StealingMode::Quietest, 60, getGain), 2, "Quietest voice, the older one wins a tie");
+
+		a.voiceReleased(2);
+		expectEquals(a.getVoiceToSteal(StealingMode::SameNoteFirst, 60, getGain), 2, "Released voice with the same note first");
+
+		a.voiceReleased(4);
+		expectEquals(a.getVoiceToSteal(StealingMode::Quietest, 60, getGain), 2, "Quietest voice, older released voice wins a tie");
+
+		// The quietest voice is being killed, so it can't be stolen again
+		a.voiceStarted(5, 67);
+		a.voiceKilled(5);
+		a.voiceKilled(2);
+
+		expectEquals(a.getVoiceToSteal(StealingMode::Quietest, 60, getGain), 4, "Killed voices are skipped");
+		expectEquals(a.getVoiceToSteal(StealingMode::SameNoteFirst, 60, getGain), 1, "Killed voices with the same note are skipped");
+		expectEquals(a.getVoiceToSteal(StealingMode::SameNoteFirst, 67, getGain), 4, "Only killed voice with the same note uses Oldest");
+
+		VoiceAllocator empty;
+		empty.reset(4);
+
+		for (auto m : { StealingMode::Oldest, StealingMode::Quietest, StealingMode::SameNoteFirst })
+			expectEquals(empty.getVoiceToSteal(m, 60, getGain), -1, "No active voice to steal");
+	}
+
+	void testNoteList()
+	{
+		beginTest("Testing the voice list of each note");
+
+		VoiceAllocator a;
+		a.reset(8);
+
+		for (int i = 0; i < 5; i++)
+			a.voiceStarted(i, 60);
+
+		a.voiceStarted(5, 62);
+
+		expect(getVoicesForNote(a, 60) == Array<int>({ 0, 1, 2, 3, 4 }), "All voices of note 60");
+		expect(getVoicesForNote(a, 62) == Array<int>({ 5 }), "Voice of note 62");
+		expectEquals(getVoicesForNote(a, 61).size(), 0, "No voices of note 61");
+
+		// Remove the head, the tail and one in the middle of the list
+		a.voiceRemoved(4);
+		a.voiceRemoved(0);
+		a.voiceRemoved(2);
+
+		expect(getVoicesForNote(a, 60) == Array<int>({ 1, 3 }), "Remaining voices of note 60");
+
+		// Removing a voice while iterating must not break the iteration (this is what killVoiceAndSiblings() does)
+		Array<int> visited;
+
+		for (auto v = a.getFirstVoiceForNote(60); v != -1;)
+		{
+			auto next = a.getNextVoiceForNote(v);
+			visited.add(v);
+			a.voiceRemoved(v);
+			v = next;
+		}
+
+		visited.sort();
+		expect(visited == Array<int>({ 1, 3 }), "Visited voices while removing");
+		expectEquals(a.getFirstVoiceForNote(60), -1, "Note list is empty");
+
+		a.voiceStarted(0, -1);
+		a.voiceStarted(1, 128);
+
+		expect(!a.isFree(0) && !a.isFree(1), "Voices without a valid note number are active");
+		expectEquals(a.getFirstVoiceForNote(-1), -1, "Invalid note number");
+		expectEquals(a.getFirstVoiceForNote(128), -1, "Invalid note number");
+
+		a.voiceRemoved(0);
+		a.voiceRemoved(1);
+		expect(getVoicesForNote(a, 62) == Array<int>({ 5 }), "Other notes are not affected");
+	}
+
+	static BackendProcessor* createSynth(int numVoices, int numSounds)
+	{
+		ScopedProcessor bp = new BackendProcessor(nullptr, nullptr);
+
+		ScopedPointer<SineSynth> synth = new SineSynth(bp, "Synth", numVoices);
+		synth->addProcessorsWhenEmpty();
+
+		for (int i = 1; i < numSounds; i++)
+			synth->addSound(new SineWaveSound());
+
+		bp->getMainSynthChain()->getHandler()->add(synth.release(), nullptr);
+
+		dynamic_cast<AudioProcessor*>(bp.get())->prepareToPlay(44100.0, BlockSize);
+
+		return bp.release();
+	}
+
+	static ModulatorSynth* getSynth(BackendProcessor* bp)
+	{
+		return ProcessorHelpers::getFirstProcessorWithType<SineSynth>(bp->getMainSynthChain());
+	}
+
+	static void processBlock(BackendProcessor* bp, const MidiBuffer& midi)
+	{
+		AudioSampleBuffer buffer(2, BlockSize);
+		buffer.clear();
+
+		MidiBuffer m(midi);
+		dynamic_cast<AudioProcessor*>(bp)->processBlock(buffer, m);
+	}
+
+	/** Returns "note:velocity" for each voice that is playing and not being killed. */
+	static StringArray getPlayingVoices(ModulatorSynth* synth)
+	{
+		StringArray playing;
+
+		for (int i = 0; i < synth->getNumVoices(); i++)
+		{
+			auto v = static_cast<ModulatorSynthVoice*>(synth->getVoice(i));
+
+			if (!v->isInactive() && !v->isBeingKilled())
+				playing.add(String(v->getCurrentHiseEvent().getNoteNumber()) + ":" + String(v->getCurrentHiseEvent().getVelocity()));
+		}
+
+		playing.sort(false);
+		return playing;
+	}
+
+	void expectAllocatorMatchesVoices(ModulatorSynth* synth, const String& context)
+	{
+		auto& a = synth->getVoiceAllocator();
+
+		expectEquals(a.getNumVoices(), synth->getNumVoices(), context + ": voice amount");
+
+		int numStealable = 0;
+
+		for (int i = 0; i < synth->getNumVoices(); i++)
+		{
+			auto v = static_cast<ModulatorSynthVoice*>(synth->getVoice(i));
+
+			expect(a.isFree(i) == v->isInactive(), context + ": free state of voice " + String(i));
+
+			if (v->isInactive())
+				continue;
+
+			if (!v->isBeingKilled())
+				numStealable++;
+
+			auto noteVoices = getVoicesForNote(a, v->getCurrentHiseEvent().getNoteNumber());
+			expect(noteVoices.contains(i), context + ": voice " + String(i) + " is not in its note list");
+		}
+
+		expectEquals(a.getNumStealableVoices(), numStealable, context + ": stealable voices");
+	}
+
+	void testSynthStealing(StealingMode m, const String& expectedVictim)
+	{
+		beginTest("Testing voice stealing of a synth with " + VoiceAllocator::getStealingModeNames()[(int)m]);
+
+		ScopedProcessor bp = createSynth(NUM_POLYPHONIC_VOICES, 1);
+		auto synth = getSynth(bp);
+
+		// The velocity is used as gain for the Quietest mode and to identify the voices
+		auto gainChain = dynamic_cast<ModulatorChain*>(synth->getChildProcessor(ModulatorSynth::GainModulation));
+		gainChain->getHandler()->add(new VelocityModulator(bp, "Velocity", NUM_POLYPHONIC_VOICES, gainChain->getMode()), nullptr);
+
+		synth->setAttribute(ModulatorSynth::VoiceLimit, 5.0f, dontSendNotification);
+		synth->setVoiceStealingMode(m);
+		synth->setKillRetriggeredNote(false);
+
+		MidiBuffer midi;
+		midi.addEvent(MidiMessage::noteOn(1, 62, (uint8)100), 0);
+		midi.addEvent(MidiMessage::noteOn(1, 60, (uint8)90), 10);
+		midi.addEvent(MidiMessage::noteOn(1, 60, (uint8)80), 20);
+		midi.addEvent(MidiMessage::noteOn(1, 64, (uint8)20), 30);
+		processBlock(bp, midi);
+
+		midi.clear();
+		processBlock(bp, midi);
+
+		StringArray expected = { "62:100", "60:90", "60:80", "64:20" };
+		expected.sort(false);
+
+		expectEquals(getPlayingVoices(synth).joinIntoString(","), expected.joinIntoString(","), "All notes are playing");
+		expectAllocatorMatchesVoices(synth, "before stealing");
+
+		midi.addEvent(MidiMessage::noteOn(1, 60, (uint8)70), 0);
+		processBlock(bp, midi);
+
+		expected.removeString(expectedVictim);
+		expected.add("60:70");
+		expected.sort(false);
+
+		expectEquals(getPlayingVoices(synth).joinIntoString(","), expected.joinIntoString(","), "Stolen voice");
+		expectAllocatorMatchesVoices(synth, "after stealing");
+	}
+
+	void testSiblingsAndRetrigger()
+	{
+		beginTest("Testing sibling voices and retriggered notes");
+
+		// Two sounds start two sibling voices for each note
+		ScopedProcessor bp = createSynth(NUM_POLYPHONIC_VOICES, 2);
+		auto synth = getSynth(bp);
+
+		synth->setAttribute(ModulatorSynth::VoiceLimit, 8.0f, dontSendNotification);
+
+		MidiBuffer midi;
+		midi.addEvent(MidiMessage::noteOn(1, 60, (uint8)100), 0);
+		midi.addEvent(MidiMessage::noteOn(1, 62, (uint8)100), 10);
+		midi.addEvent(MidiMessage::noteOn(1, 64, (uint8)100), 20);
+		processBlock(bp, midi);
+
+		expectEquals(getPlayingVoices(synth).joinIntoString(","), String("60:100,60:100,62:100,62:100,64:100,64:100"), "Sibling voices");
+		expectAllocatorMatchesVoices(synth, "siblings");
+
+		// The voice limit is reached, so the oldest voice and its sibling are killed
+		midi.clear();
+		midi.addEvent(MidiMessage::noteOn(1, 65, (uint8)100), 0);
+		processBlock(bp, midi);
+
+		expectEquals(getPlayingVoices(synth).joinIntoString(","), String("62:100,62:100,64:100,64:100,65:100,65:100"), "Killed siblings");
+		expectAllocatorMatchesVoices(synth, "killed siblings");
+
+		// Raise the voice limit so that only the retrigger kills voices
+		synth->setAttribute(ModulatorSynth::VoiceLimit, 16.0f, dontSendNotification);
+
+		// Retriggering a note kills the voices that play the same note
+		midi.clear();
+		midi.addEvent(MidiMessage::noteOn(1, 64, (uint8)50), 0);
+		processBlock(bp, midi);
+
+		expectEquals(getPlayingVoices(synth).joinIntoString(","), String("62:100,62:100,64:50,64:50,65:100,65:100"), "Retriggered note");
+		expectAllocatorMatchesVoices(synth, "retriggered note");
+
+		// Let the killed voices fade out
+		midi.clear();
+
+		for (int i = 0; i < 8; i++)
+			processBlock(bp, midi);
+
+		expectAllocatorMatchesVoices(synth, "after fade out");
+		expectEquals(synth->getVoiceAllocator().getKilledVoice(false), -1, "No voice is being killed");
+	}
+
+	void testVoiceAmountChange()
+	{
+		beginTest("Testing the rebuild after a voice amount change");
+
+		ScopedProcessor bp = createSynth(8, 1);
+		auto synth = getSynth(bp);
+
+		// Keep the released voice playing until the voice amount has changed
+		if (auto env = ProcessorHelpers::getFirstProcessorWithType<SimpleEnvelope>(synth))
+			env->setAttribute(SimpleEnvelope::Release, 5000.0f, dontSendNotification);
+
+		MidiBuffer midi;
+		midi.addEvent(MidiMessage::noteOn(1, 60, (uint8)100), 0);
+		midi.addEvent(MidiMessage::noteOn(1, 62, (uint8)100), 10);
+		midi.addEvent(MidiMessage::noteOn(1, 64, (uint8)100), 20);
+		midi.addEvent(MidiMessage::noteOff(1, 62), 30);
+		processBlock(bp, midi);
+
+		expectAllocatorMatchesVoices(synth, "before the voice amount change");
+
+		// Add voices while the notes are playing, the allocator is rebuilt with the next note
+		for (int i = 0; i < 4; i++)
+		{
+			auto v = synth->addVoice(new SineSynthVoice(synth));
+			static_cast<ModulatorSynthVoice*>(v)->prepareToPlay(44100.0, BlockSize);
+		}
+
+		expectEquals(synth->getNumVoices(), 12, "Voices were added");
+
+		midi.clear();
+		midi.addEvent(MidiMessage::noteOn(1, 67, (uint8)100), 0);
+		processBlock(bp, midi);
+
+		auto& a = synth->getVoiceAllocator();
+
+		expectEquals(a.getNumVoices(), 12, "Allocator was rebuilt");
+		expectAllocatorMatchesVoices(synth, "after the voice amount change");
+
+		auto released = a.getFirstVoiceForNote(62);
+		expect(released != -1, "Released voice is still in its note list");
+
+		if (released != -1)
+		{
+			expect(a.isReleased(released), "Released state was restored");
+			expectEquals(a.getOldestVoice(), released, "Released voice is stolen first");
+		}
+	}
+
+	static constexpr int BlockSize = 512;
+};
+
+static VoiceAllocatorTests voiceAllocatorTests;
+
 class CustomContainerTest : public UnitTest
 {
 public:
@@ -3698,6 +3698,12 @@ struct ScriptingApi::Sampler::Wrapper
 	API_VOID_METHOD_WRAPPER_1(Sampler, setTimestretchRatio);
 	API_VOID_METHOD_WRAPPER_1(Sampler, setTimestretchOptions);
 	API_METHOD_WRAPPER_0(Sampler, getTimestretchOptions);
+	API_VOID_METHOD_WRAPPER_1(Sampler, setInterpolationMode);
+	API_METHOD_WRAPPER_0(Sampler, getInterpolationMode);
+	API_VOID_METHOD_WRAPPER_1(Sampler, setVoiceStealingMode);
+	API_METHOD_WRAPPER_0(Sampler, getVoiceStealingMode);
+	API_VOID_METHOD_WRAPPER_1(Sampler, setAdaptivePreload);
+	API_METHOD_WRAPPER_0(Sampler, getMemorySavedByAdaptivePreload);
 	API_METHOD_WRAPPER_1(Sampler, createSelection);
 	API_METHOD_WRAPPER_1(Sampler, createSelectionFromIndexes);
 	API_METHOD_WRAPPER_1(Sampler, createSelectionWithFilter);
@@ -3768,6 +3774,12 @@ sampler(sampler_)
 	ADD_API_METHOD_1(setTimestretchRatio);
 	ADD_API_METHOD_1(setTimestretchOptions);
 	ADD_API_METHOD_0(getTimestretchOptions);
+	ADD_API_METHOD_1(setInterpolationMode);
+	ADD_API_METHOD_0(getInterpolationMode);
+	ADD_API_METHOD_1(setVoiceStealingMode);
+	ADD_API_METHOD_0(getVoiceStealingMode);
+	ADD_API_METHOD_1(setAdaptivePreload);
+	ADD_API_METHOD_0(getMemorySavedByAdaptivePreload);
 
 	sampleIds.add(SampleIds::ID);
 	sampleIds.add(SampleIds::FileName);
@@ -4669,6 +4681,74 @@ void ScriptingApi::Sampler::setTimestretchOptions(var newOptions)
 	s->setTimestretchOptions(no);
 }
 
+void ScriptingApi::Sampler::setInterpolationMode(String modeName)
+{
+	ModulatorSampler* s = dynamic_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+		reportScriptError("Invalid sampler call");
+
+	if (!SamplerInterpolation::getModeNames().contains(modeName))
+		reportScriptError("Unknown interpolation mode: " + modeName);
+
+	s->setInterpolationMode(SamplerInterpolation::getModeFromName(modeName));
+}
+
+String ScriptingApi::Sampler::getInterpolationMode()
+{
+	ModulatorSampler* s = dynamic_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+		reportScriptError("Invalid sampler call");
+
+	return SamplerInterpolation::getModeNames()[(int)s->getInterpolationMode()];
+}
+
+void ScriptingApi::Sampler::setVoiceStealingMode(String modeName)
+{
+	ModulatorSampler* s = dynamic_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+		reportScriptError("Invalid sampler call");
+
+	auto modeIndex = VoiceAllocator::getStealingModeNames().indexOf(modeName);
+
+	if (modeIndex == -1)
+		reportScriptError("Unknown voice stealing mode: " + modeName);
+
+	s->setVoiceStealingMode((VoiceAllocator::StealingMode)modeIndex);
+}
+
+String ScriptingApi::Sampler::getVoiceStealingMode()
+{
+	ModulatorSampler* s = dynamic_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+		reportScriptError("Invalid sampler call");
+
+	return VoiceAllocator::getStealingModeNames()[(int)s->getVoiceStealingMode()];
+}
+
+void ScriptingApi::Sampler::setAdaptivePreload(bool shouldBeEnabled)
+{
+	ModulatorSampler* s = dynamic_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+		reportScriptError("Invalid sampler call");
+
+	s->setAdaptivePreloadEnabled(shouldBeEnabled);
+}
+
+var ScriptingApi::Sampler::getMemorySavedByAdaptivePreload()
+{
+	ModulatorSampler* s = dynamic_cast<ModulatorSampler*>(sampler.get());
+
+	if (s == nullptr)
+		reportScriptError("Invalid sampler call");
+
+	return var(s->getMemorySavedByAdaptivePreload());
+}
+
 String ScriptingApi::Sampler::getAudioWaveformContentAsBase64(var presetObj)
 {
 	auto fileName = presetObj.getProperty("data", "").toString();
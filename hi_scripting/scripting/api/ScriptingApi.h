@@ -990,6 +990,24 @@ public:
 		/** Sets the timestretching options from a JSON object. */
 		void setTimestretchOptions(var newOptions);
 
+		/** Sets the interpolation algorithm for the sample playback ("Linear", "Cubic" or "Sinc"). */
+		void setInterpolationMode(String modeName);
+
+		/** Returns the name of the current interpolation algorithm. */
+		String getInterpolationMode();
+
+		/** Sets the policy that picks the voice that is killed when the voice limit is reached ("Oldest", "Quietest" or "SameNoteFirst"). */
+		void setVoiceStealingMode(String modeName);
+
+		/** Returns the name of the current voice stealing mode. */
+		String getVoiceStealingMode();
+
+		/** Calculates the preload size of each sample from the measured disk performance. */
+		void setAdaptivePreload(bool shouldBeEnabled);
+
+		/** Returns the memory in bytes that the adaptive preloading saved compared to the PreloadSize attribute. */
+		var getMemorySavedByAdaptivePreload();
+
 		/** Converts the user preset data of a audio waveform to a base 64 samplemap. */
 		String getAudioWaveformContentAsBase64(var presetObj);
 
@@ -645,6 +645,69 @@ struct HiseJavascriptEngine::RootObject::Statement
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Statement)
 };
 
+/** A number that is passed between arithmetic expressions without boxing it into a var.
+
+	The type mirrors the var type that the expression would have returned, so converting it back
+	with toVar() yields exactly the same value. If the result is not a number, the type is Boxed and
+	the value is stored in the var that was passed into Expression::getNumericResult().
+*/
+struct HiseJavascriptEngine::RootObject::NumericValue
+{
+	enum Type : uint8
+	{
+		Boxed,
+		Integer,
+		Int64,
+		Double,
+		Bool
+	};
+
+	NumericValue() noexcept {}
+	NumericValue(int v) noexcept : type(Integer), i(v) {}
+	NumericValue(int64 v) noexcept : type(Int64), i(v) {}
+	NumericValue(double v) noexcept : type(Double), d(v) {}
+	NumericValue(bool v) noexcept : type(Bool), i(v ? 1 : 0) {}
+
+	/** Classifies the var. The value is only copied to boxedResult if it is not a number. */
+	static NumericValue fromVar(const var& v, var& boxedResult)
+	{
+		if (v.isInt())    return NumericValue((int)v);
+		if (v.isDouble()) return NumericValue((double)v);
+		if (v.isInt64())  return NumericValue((int64)v);
+		if (v.isBool())   return NumericValue((bool)v);
+
+		boxedResult = v;
+		return {};
+	}
+
+	bool isNumber() const noexcept { return type != Boxed; }
+	bool isDouble() const noexcept { return type == Double; }
+
+	double toDouble() const noexcept { return type == Double ? d : (double)i; }
+	int64 toInt64() const noexcept { return type == Double ? (int64)d : i; }
+
+	var toVar(const var& boxedResult = {}) const
+	{
+		switch (type)
+		{
+		case Integer:	return var((int)i);
+		case Int64:		return var(i);
+		case Double:	return var(d);
+		case Bool:		return var(i != 0);
+		case Boxed:
+		default:		return boxedResult;
+		}
+	}
+
+	Type type = Boxed;
+
+	union
+	{
+		int64 i = 0;
+		double d;
+	};
+};
+
 struct HiseJavascriptEngine::RootObject::Expression : public Statement
 {
 	Expression(const CodeLocation& l) noexcept : Statement(l) {}
@@ -652,6 +715,31 @@ struct HiseJavascriptEngine::RootObject::Expression : public Statement
 	virtual var getResult(const Scope&) const            { return var::undefined(); }
 	virtual void assign(const Scope&, const var&) const  { location.throwError("Cannot assign to this expression!"); }
 
+	/** Evaluates the expression without boxing a numeric result into a var.
+
+		Override this for nodes that can access their value directly (eg. registers or buffer samples).
+		If the result is not a number, the return type is NumericValue::Boxed and the value is written
+		to boxedResult.
+	*/
+	virtual NumericValue getNumericResult(const Scope& s, var& boxedResult) const
+	{
+		var v(getResult(s));
+		return NumericValue::fromVar(v, boxedResult);
+	}
+
+	/** Returns the type that this expression will most likely evaluate to.
+
+		This is deduced at parse time from literals and the declared types of registers and parameters
+		and is used to pick the unboxed arithmetic path. It's just a hint (eg. a typed register may
+		still be undefined), so the evaluation must not rely on it.
+	*/
+	virtual VarTypeChecker::VarTypes getStaticType() const { return VarTypeChecker::Undefined; }
+
+	static bool isNumericType(VarTypeChecker::VarTypes t) noexcept
+	{
+		return (t & VarTypeChecker::Number) != 0 && (t & VarTypeChecker::ComplexType) == 0;
+	}
+
 	virtual Identifier getVariableName() const { return {}; }
 
 	ResultCode perform(const Scope& s, var*) const override  { getResult(s); return ok; }
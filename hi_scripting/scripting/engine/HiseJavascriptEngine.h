@@ -471,6 +471,7 @@ public:
         
 		struct Statement;
 		struct Expression;
+		struct NumericValue;
 		
 		struct OptimizationPass
 		{
@@ -499,6 +500,10 @@ public:
 
 		struct ScriptAudioThreadGuard;
 
+		// Bytecode interpreter
+
+		struct BytecodeProgram;			struct BytecodeCompiler;
+
 		struct Error
 		{
 			static Error fromBreakpoint(const Breakpoint &bp);
@@ -524,6 +529,9 @@ public:
 		typedef ScopedPointer<Expression> ExpPtr;
 
 		struct BinaryOperatorBase;	struct BinaryOperator;
+		template <class OpType> struct NumericOperator;
+		template <class OpType> struct IntegerOperator;
+		template <class OpType> struct ComparisonOperator;
 
 		//==============================================================================
 
@@ -626,6 +634,9 @@ public:
 
 			var perform(RootObject *root);
 
+			/** Executes the statements (either with the bytecode interpreter or by walking the syntax tree). */
+			void performStatements(const Scope& s, var* returnValue) const;
+
 			void setStatements(BlockStatement *s) noexcept;
 
 			bool isDefined() const noexcept;
@@ -669,6 +680,9 @@ public:
 
 			ScopedPointer<BlockStatement> statements;
 
+			/** The compiled callback. This is owned by the HiseSpecialData object. */
+			BytecodeProgram* bytecode = nullptr;
+
 			private:
 
 			double lastExecutionTime;
@@ -798,6 +812,12 @@ public:
 
 			void registerOptimisationPasses();
 
+			/** Compiles all callbacks and inline functions to bytecode and returns a summary for the optimisation report. */
+			String compileBytecode();
+
+			/** Removes the bytecode so that all functions will be executed by walking the syntax tree. */
+			void clearBytecode();
+
 			static bool initHiddenProperties;
 
 			
@@ -815,6 +835,10 @@ public:
 
 			OwnedArray<OptimizationPass> optimizations;
 
+			OwnedArray<BytecodeProgram> bytecodePrograms;
+
+			bool useBytecode = false;
+
 			DynamicObject::Ptr globals;
 
 			DynamicObject::Ptr preparsedconstVariableNames;
@@ -588,11 +588,13 @@ root(root_)
 HiseJavascriptEngine::RootObject::HiseSpecialData::~HiseSpecialData()
 {
 	debugInformation.clear();
+	clearBytecode();
 }
 
 void HiseJavascriptEngine::RootObject::HiseSpecialData::clear()
 {
 	clearDebugInformation();
+	clearBytecode();
 	apiClasses.clear();
 	inlineFunctions.clear();
 	constObjects.clear();
@@ -1373,14 +1375,14 @@ var HiseJavascriptEngine::RootObject::Callback::perform(RootObject *root)
 
     LocalScopeCreator::ScopedSetter svs(root, this);
 
-	statements->perform(s, &returnValue);
+	performStatements(s, &returnValue);
 
 	root->removeFromCallStack(callbackName);
 
 	const double post = Time::getMillisecondCounterHiRes();
 	lastExecutionTime = post - pre;
 #else
-	statements->perform(s, &returnValue);
+	performStatements(s, &returnValue);
 #endif
 
 	return returnValue;
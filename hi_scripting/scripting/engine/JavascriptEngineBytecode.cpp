@@ -0,0 +1,848 @@
+#include <optional>
+
+namespace hise { using namespace juce;
+
+/** A callback or inline function that was compiled to bytecode.
+
+	The instructions operate on a register file that lives on the stack of the execute() call.
+	Local variables are bound to slots that point directly into the NamedValueSet that the tree
+	interpreter (and the debugger) uses, so both execution modes can be mixed: every node that the
+	compiler doesn't know is evaluated by walking its syntax tree.
+
+	The operations itself are delegated to the syntax tree nodes (eg. BinaryOperator::combine()),
+	so the results are guaranteed to be identical.
+*/
+struct HiseJavascriptEngine::RootObject::BytecodeProgram
+{
+	using ResultCode = Statement::ResultCode;
+
+	static constexpr int MaxRegisters = 64;
+	static constexpr int MaxLocals = 32;
+
+	enum class OpCode : uint8
+	{
+		LoadConstant,		// r[dst] = constants[a]
+		LoadPointer,		// r[dst] = *data
+		LoadArgument,		// r[dst] = args[a]
+		LoadLocal,			// r[dst] = *locals[a]
+		StoreLocal,			// *locals[a] = r[b]
+		Move,				// r[dst] = r[a]
+		ToBool,				// r[dst] = (bool)r[a]
+		Assign,				// node->assign(r[a])
+		Binary,				// r[dst] = node->combine(r[a], r[b])
+		Jump,				// pc = a
+		JumpIfFalse,		// if (!r[a]) pc = b
+		JumpIfTrue,			// if (r[a]) pc = b
+		CallApi,			// r[dst] = node->callWithArguments(r + a)
+		CallInline,			// r[dst] = node->getResultWithArguments(r + a)
+		Evaluate,			// r[dst] = node->getResult()
+		Perform,			// node->perform(), a and b are the jump targets for break and continue
+		CheckTimeout,
+		BeginStatement,
+		Return,				// *returnValue = r[a]
+		Exit,				// return (ResultCode)a
+		numOpCodes
+	};
+
+	struct Instruction
+	{
+		OpCode op;
+		int dst;
+		int a;
+		int b;
+		const Statement* node;
+		var* data;
+	};
+
+	BytecodeProgram(Callback* c, InlineFunction::Object* f) :
+		callback(c),
+		function(f)
+	{}
+
+	ResultCode execute(const Scope& s, var* returnValue, const var* args) const
+	{
+		if (numRegisters <= 8)  return run<8>(s, returnValue, args);
+		if (numRegisters <= 16) return run<16>(s, returnValue, args);
+		if (numRegisters <= 32) return run<32>(s, returnValue, args);
+
+		return run<MaxRegisters>(s, returnValue, args);
+	}
+
+	NamedValueSet& getLocalStorage() const
+	{
+		if (callback != nullptr)
+			return callback->localProperties;
+
+		return function->localProperties.get();
+	}
+
+	/** Creates the slots of all local variables in the storage of the current thread.
+
+		This is called after the compilation so that resolveLocals() doesn't allocate. The locals of a callback
+		are shared between all threads. The locals of an inline function are stored per thread, so another thread
+		creates them on its first call (like the tree interpreter which allocates the thread local storage too).
+	*/
+	void prepareLocals() const
+	{
+		if (!localNames.isEmpty())
+			createLocals(getLocalStorage());
+	}
+
+	void createLocals(NamedValueSet& storage) const
+	{
+		for (const auto& id : localNames)
+		{
+			if (!storage.contains(id))
+				storage.set(id, var());
+		}
+	}
+
+	int resolveLocals(NamedValueSet& storage, var** slots) const
+	{
+		for (int i = 0; i < localNames.size(); i++)
+		{
+			slots[i] = storage.getVarPointer(localNames.getReference(i));
+
+			if (slots[i] == nullptr)
+			{
+				// The callback locals must have been created by prepareLocals()
+				jassert(function != nullptr);
+
+				createLocals(storage);
+				return resolveLocals(storage, slots);
+			}
+		}
+
+		return storage.size();
+	}
+
+	template <int NumRegisters> ResultCode run(const Scope& s, var* returnValue, const var* args) const
+	{
+		var r[NumRegisters];
+		var* locals[MaxLocals];
+
+		NamedValueSet* localStorage = nullptr;
+		int numStoredLocals = 0;
+
+		if (!localNames.isEmpty())
+		{
+			localStorage = &getLocalStorage();
+			numStoredLocals = resolveLocals(*localStorage, locals);
+		}
+
+		// The tree interpreter might add variables to the storage which invalidates the slots
+		auto updateLocals = [&]()
+		{
+			if (localStorage != nullptr && localStorage->size() != numStoredLocals)
+				numStoredLocals = resolveLocals(*localStorage, locals);
+		};
+
+#if JUCE_ENABLE_AUDIO_GUARD && ENABLE_SCRIPTING_BREAKPOINTS
+		std::optional<ScriptAudioThreadGuard> guard;
+#endif
+
+		auto code = instructions.begin();
+		int pc = 0;
+
+		for (;;)
+		{
+			const auto& i = code[pc++];
+
+			switch (i.op)
+			{
+			case OpCode::LoadConstant:	r[i.dst] = constants.getReference(i.a); break;
+			case OpCode::LoadPointer:	r[i.dst] = *i.data; break;
+			case OpCode::LoadArgument:	r[i.dst] = args[i.a]; break;
+			case OpCode::LoadLocal:		r[i.dst] = *locals[i.a]; break;
+			case OpCode::StoreLocal:	*locals[i.a] = r[i.b]; break;
+			case OpCode::Move:			r[i.dst] = r[i.a]; break;
+			case OpCode::ToBool:		r[i.dst] = (bool)r[i.a]; break;
+			case OpCode::Jump:			pc = i.a; break;
+			case OpCode::JumpIfFalse:	if (!r[i.a]) pc = i.b; break;
+			case OpCode::JumpIfTrue:	if (r[i.a]) pc = i.b; break;
+			case OpCode::Binary:
+				r[i.dst] = static_cast<const BinaryOperator*>(i.node)->combine(r[i.a], r[i.b]);
+				break;
+			case OpCode::Assign:
+				static_cast<const Expression*>(i.node)->assign(s, r[i.a]);
+				updateLocals();
+				break;
+			case OpCode::CallApi:
+				r[i.dst] = static_cast<const ApiCall*>(i.node)->callWithArguments(r + i.a);
+				updateLocals();
+				break;
+			case OpCode::CallInline:
+				r[i.dst] = static_cast<const InlineFunction::FunctionCall*>(i.node)->getResultWithArguments(s, r + i.a);
+				updateLocals();
+				break;
+			case OpCode::Evaluate:
+				r[i.dst] = static_cast<const Expression*>(i.node)->getResult(s);
+				updateLocals();
+				break;
+			case OpCode::Perform:
+			{
+				auto rc = i.node->perform(s, returnValue);
+				updateLocals();
+
+				if (rc == Statement::ok)
+					break;
+
+				if (rc == Statement::breakWasHit && i.a != -1)
+				{
+					pc = i.a;
+					break;
+				}
+
+				if (rc == Statement::continueWasHit && i.b != -1)
+				{
+					pc = i.b;
+					break;
+				}
+
+				return rc;
+			}
+			case OpCode::CheckTimeout:
+				s.checkTimeOut(i.node->location);
+				break;
+			case OpCode::BeginStatement:
+#if JUCE_ENABLE_AUDIO_GUARD && ENABLE_SCRIPTING_BREAKPOINTS
+				guard.reset();
+				guard.emplace(i.node->location);
+#endif
+				break;
+			case OpCode::Return:
+				if (returnValue != nullptr)
+					*returnValue = r[i.a];
+
+				return Statement::returnWasHit;
+			case OpCode::Exit:
+				return (ResultCode)i.a;
+			case OpCode::numOpCodes:
+				jassertfalse;
+				return Statement::ok;
+			}
+		}
+	}
+
+	Callback* callback;
+	InlineFunction::Object* function;
+
+	Array<Instruction> instructions;
+	Array<var> constants;
+	Array<Identifier> localNames;
+
+	int numRegisters = 0;
+	int numInterpretedNodes = 0;
+	int numTypedExpressions = 0;
+
+	JUCE_DECLARE_NON_COPYABLE(BytecodeProgram);
+};
+
+/** Lowers the syntax tree of a callback or inline function to a BytecodeProgram. */
+struct HiseJavascriptEngine::RootObject::BytecodeCompiler
+{
+	using OpCode = BytecodeProgram::OpCode;
+
+	BytecodeCompiler(BytecodeProgram& p) :
+		program(p)
+	{}
+
+	bool compile(const BlockStatement* body)
+	{
+		compileStatement(body);
+		emit(OpCode::Exit, -1, (int)Statement::ok);
+
+		return ok && program.numRegisters <= BytecodeProgram::MaxRegisters
+				  && program.localNames.size() <= BytecodeProgram::MaxLocals;
+	}
+
+private:
+
+	struct LoopContext
+	{
+		Array<int> breaks;
+		Array<int> continues;
+	};
+
+	int here() const { return program.instructions.size(); }
+
+	int emit(OpCode op, int dst = -1, int a = -1, int b = -1, const Statement* node = nullptr, var* data = nullptr)
+	{
+		program.instructions.add({ op, dst, a, b, node, data });
+		return program.instructions.size() - 1;
+	}
+
+	int allocate()
+	{
+		auto r = nextRegister++;
+		program.numRegisters = jmax(program.numRegisters, nextRegister);
+		return r;
+	}
+
+	int addConstant(const var& v)
+	{
+		program.constants.add(v);
+		return program.constants.size() - 1;
+	}
+
+	int getLocalSlot(const Identifier& id)
+	{
+		program.localNames.addIfNotAlreadyThere(id);
+		return program.localNames.indexOf(id);
+	}
+
+	void patchJumps(const Array<int>& list, int target, bool isContinue)
+	{
+		for (auto index : list)
+		{
+			auto& ins = program.instructions.getReference(index);
+
+			if (ins.op == OpCode::Perform)
+				(isContinue ? ins.b : ins.a) = target;
+			else
+				ins.a = target;
+		}
+	}
+
+	void emitPerform(const Statement* st)
+	{
+		auto index = emit(OpCode::Perform, -1, -1, -1, st);
+		program.numInterpretedNodes++;
+
+		if (!loops.isEmpty())
+		{
+			loops.getReference(loops.size() - 1).breaks.add(index);
+			loops.getReference(loops.size() - 1).continues.add(index);
+		}
+	}
+
+	/** Returns true if the expression is typed arithmetic on constants, registers and parameters.
+
+		These are evaluated on the unboxed tree path as a whole (see BinaryOperator::getNumericResult())
+		which is faster than passing each intermediate result through the var registers.
+	*/
+	static bool isUnboxedArithmetic(const Expression* e)
+	{
+		auto bo = dynamic_cast<const BinaryOperator*>(e);
+
+		if (bo == nullptr || !bo->useNumericPath)
+			return false;
+
+		auto isDirectOperand = [](const Expression* o)
+		{
+			return dynamic_cast<const LiteralValue*>(o) != nullptr ||
+				   dynamic_cast<const ApiConstant*>(o) != nullptr ||
+				   dynamic_cast<const RegisterName*>(o) != nullptr ||
+				   dynamic_cast<const CallbackParameterReference*>(o) != nullptr ||
+				   isUnboxedArithmetic(o);
+		};
+
+		return isDirectOperand(bo->lhs.get()) && isDirectOperand(bo->rhs.get());
+	}
+
+	/** Returns the local variable slot for local references of the function that is compiled or -1. */
+	int getLocalSlotForExpression(const Expression* e)
+	{
+		if (auto cl = dynamic_cast<const CallbackLocalReference*>(e))
+		{
+			if (program.callback != nullptr && cl->parentCallback == program.callback)
+				return getLocalSlot(cl->name);
+		}
+
+		if (auto lr = dynamic_cast<const LocalReference*>(e))
+		{
+			if (program.function != nullptr && lr->parentFunction == program.function)
+				return getLocalSlot(lr->id);
+		}
+
+		return -1;
+	}
+
+	void compileStore(const Expression* target, int valueRegister)
+	{
+		auto slot = getLocalSlotForExpression(target);
+
+		if (slot != -1)
+			emit(OpCode::StoreLocal, -1, slot, valueRegister);
+		else
+			emit(OpCode::Assign, -1, valueRegister, -1, target);
+	}
+
+	void compileLocalDefinition(const Identifier& id, const Expression* initialiser)
+	{
+		auto v = compileExpression(initialiser);
+		emit(OpCode::StoreLocal, -1, getLocalSlot(id), v);
+	}
+
+	void compileStatement(const Statement* st)
+	{
+		if (st == nullptr)
+			return;
+
+		const int mark = nextRegister;
+
+		if (auto bs = dynamic_cast<const BlockStatement*>(st))
+		{
+			if (!bs->scopedBlockStatements.isEmpty())
+			{
+				emitPerform(st);
+			}
+			else
+			{
+				for (auto child : bs->statements)
+				{
+#if ENABLE_SCRIPTING_BREAKPOINTS
+					// Functions with breakpoints are always executed by the tree interpreter
+					if (child->breakpointReference.index != -1)
+						ok = false;
+
+#if JUCE_ENABLE_AUDIO_GUARD
+					emit(OpCode::BeginStatement, -1, -1, -1, child);
+#endif
+#endif
+					compileStatement(child);
+				}
+			}
+		}
+		else if (auto is = dynamic_cast<const IfStatement*>(st))
+		{
+			auto c = compileExpression(is->condition);
+			auto elseJump = emit(OpCode::JumpIfFalse, -1, c);
+			nextRegister = mark;
+
+			compileStatement(is->trueBranch);
+			auto endJump = emit(OpCode::Jump);
+
+			program.instructions.getReference(elseJump).b = here();
+			compileStatement(is->falseBranch);
+			program.instructions.getReference(endJump).a = here();
+		}
+		else if (auto ls = dynamic_cast<const LoopStatement*>(st))
+		{
+			if (ls->isIterator)
+				emitPerform(st);
+			else
+				compileLoop(ls);
+		}
+		else if (auto rs = dynamic_cast<const ReturnStatement*>(st))
+		{
+			auto v = compileExpression(rs->returnValue);
+			emit(OpCode::Return, -1, v);
+		}
+		else if (dynamic_cast<const BreakStatement*>(st) != nullptr)
+		{
+			if (loops.isEmpty())
+				emit(OpCode::Exit, -1, (int)Statement::breakWasHit);
+			else
+				loops.getReference(loops.size() - 1).breaks.add(emit(OpCode::Jump));
+		}
+		else if (dynamic_cast<const ContinueStatement*>(st) != nullptr)
+		{
+			if (loops.isEmpty())
+				emit(OpCode::Exit, -1, (int)Statement::continueWasHit);
+			else
+				loops.getReference(loops.size() - 1).continues.add(emit(OpCode::Jump));
+		}
+		else if (auto lv = dynamic_cast<const LocalVarStatement*>(st))
+		{
+			if (program.function != nullptr && lv->parentFunction == program.function)
+				compileLocalDefinition(lv->name, lv->initialiser);
+			else
+				emitPerform(st);
+		}
+		else if (auto cl = dynamic_cast<const CallbackLocalStatement*>(st))
+		{
+			if (program.callback != nullptr && cl->parentCallback == program.callback)
+				compileLocalDefinition(cl->name, cl->initialiser);
+			else
+				emitPerform(st);
+		}
+		else if (typeid(*st) == typeid(Statement))
+		{
+			// empty statement
+		}
+		else if (auto e = dynamic_cast<const Expression*>(st))
+		{
+			compileExpression(e, true);
+		}
+		else
+		{
+			emitPerform(st);
+		}
+
+		nextRegister = mark;
+	}
+
+	void compileLoop(const LoopStatement* ls)
+	{
+		const int mark = nextRegister;
+
+		compileStatement(ls->initialiser);
+
+		auto top = here();
+		int exitJump = -1;
+
+		if (!ls->isDoLoop)
+		{
+			auto c = compileExpression(ls->condition);
+			exitJump = emit(OpCode::JumpIfFalse, -1, c);
+			nextRegister = mark;
+		}
+
+		emit(OpCode::CheckTimeout, -1, -1, -1, ls);
+
+		loops.add(LoopContext());
+		compileStatement(ls->body);
+		auto context = loops.removeAndReturn(loops.size() - 1);
+
+		Array<int> exitJumps;
+
+		if (exitJump != -1)
+			exitJumps.add(exitJump);
+
+		if (ls->isDoLoop)
+		{
+			compileStatement(ls->iterator);
+
+			auto c = compileExpression(ls->condition);
+			exitJumps.add(emit(OpCode::JumpIfFalse, -1, c));
+			nextRegister = mark;
+			emit(OpCode::Jump, -1, top);
+
+			// LoopStatement::perform() skips the condition of a do loop after a continue statement
+			patchJumps(context.continues, here(), true);
+			compileStatement(ls->iterator);
+			emit(OpCode::Jump, -1, top);
+		}
+		else
+		{
+			patchJumps(context.continues, here(), true);
+			compileStatement(ls->iterator);
+			emit(OpCode::Jump, -1, top);
+		}
+
+		auto end = here();
+
+		patchJumps(context.breaks, end, false);
+
+		for (auto j : exitJumps)
+			program.instructions.getReference(j).b = end;
+	}
+
+	int compileArguments(const Expression* const* arguments, int numArguments)
+	{
+		auto first = nextRegister;
+
+		for (int i = 0; i < numArguments; i++)
+		{
+			auto r = compileExpression(arguments[i]);
+
+			if (r != first + i)
+				emit(OpCode::Move, first + i, r);
+
+			nextRegister = first + i + 1;
+		}
+
+		// make sure that there's a valid register even with no arguments
+		if (numArguments == 0)
+			allocate();
+
+		return first;
+	}
+
+	int compileExpression(const Expression* e, bool isStatement = false)
+	{
+		if (e == nullptr)
+		{
+			ok = false;
+			return 0;
+		}
+
+		if (auto lv = dynamic_cast<const LiteralValue*>(e))
+		{
+			auto d = allocate();
+			emit(OpCode::LoadConstant, d, addConstant(lv->value));
+			return d;
+		}
+
+		if (auto ac = dynamic_cast<const ApiConstant*>(e))
+		{
+			auto d = allocate();
+			emit(OpCode::LoadConstant, d, addConstant(ac->value));
+			return d;
+		}
+
+		if (typeid(*e) == typeid(Expression))
+		{
+			auto d = allocate();
+			emit(OpCode::LoadConstant, d, addConstant(var::undefined()));
+			return d;
+		}
+
+		if (auto cp = dynamic_cast<const CallbackParameterReference*>(e))
+		{
+			auto d = allocate();
+			emit(OpCode::LoadPointer, d, -1, -1, e, cp->data);
+			return d;
+		}
+
+		if (auto rn = dynamic_cast<const RegisterName*>(e))
+		{
+			auto d = allocate();
+			emit(OpCode::LoadPointer, d, -1, -1, e, rn->data);
+			return d;
+		}
+
+		auto slot = getLocalSlotForExpression(e);
+
+		if (slot != -1)
+		{
+			auto d = allocate();
+			emit(OpCode::LoadLocal, d, slot);
+			return d;
+		}
+
+		if (auto pr = dynamic_cast<const InlineFunction::ParameterReference*>(e))
+		{
+			if (program.function != nullptr && pr->f == program.function)
+			{
+				auto d = allocate();
+				emit(OpCode::LoadArgument, d, pr->index);
+				return d;
+			}
+		}
+
+		if (auto pa = dynamic_cast<const PostAssignment*>(e))
+		{
+			auto oldValue = compileExpression(pa->target);
+			auto v = compileExpression(pa->newValue);
+			compileStore(pa->target, v);
+			nextRegister = oldValue + 1;
+			return oldValue;
+		}
+
+		if (auto sa = dynamic_cast<const SelfAssignment*>(e))
+		{
+			auto v = compileExpression(sa->newValue);
+			compileStore(sa->target, v);
+			return v;
+		}
+
+		if (auto as = dynamic_cast<const Assignment*>(e))
+		{
+			auto v = compileExpression(as->newValue);
+			compileStore(as->target, v);
+			return v;
+		}
+
+		if (dynamic_cast<const LogicalAndOp*>(e) != nullptr || dynamic_cast<const LogicalOrOp*>(e) != nullptr)
+		{
+			auto bo = static_cast<const BinaryOperatorBase*>(e);
+			const bool isAnd = dynamic_cast<const LogicalAndOp*>(e) != nullptr;
+
+			auto d = compileExpression(bo->lhs);
+			auto shortCircuit = emit(isAnd ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, -1, d);
+
+			auto r = compileExpression(bo->rhs);
+			emit(OpCode::ToBool, d, r);
+			nextRegister = d + 1;
+			auto endJump = emit(OpCode::Jump);
+
+			program.instructions.getReference(shortCircuit).b = here();
+			emit(OpCode::LoadConstant, d, addConstant(var(!isAnd)));
+			program.instructions.getReference(endJump).a = here();
+
+			return d;
+		}
+
+		if (auto co = dynamic_cast<const ConditionalOp*>(e))
+		{
+			auto d = compileExpression(co->condition);
+			auto elseJump = emit(OpCode::JumpIfFalse, -1, d);
+
+			auto t = compileExpression(co->trueBranch);
+			emit(OpCode::Move, d, t);
+			nextRegister = d + 1;
+			auto endJump = emit(OpCode::Jump);
+
+			program.instructions.getReference(elseJump).b = here();
+			auto f = compileExpression(co->falseBranch);
+			emit(OpCode::Move, d, f);
+			nextRegister = d + 1;
+
+			program.instructions.getReference(endJump).a = here();
+			return d;
+		}
+
+		if (isUnboxedArithmetic(e))
+		{
+			auto d = allocate();
+			emit(OpCode::Evaluate, d, -1, -1, e);
+			program.numTypedExpressions++;
+			return d;
+		}
+
+		if (auto bo = dynamic_cast<const BinaryOperator*>(e))
+		{
+			auto l = compileExpression(bo->lhs);
+			auto r = compileExpression(bo->rhs);
+			emit(OpCode::Binary, l, l, r, bo);
+			nextRegister = l + 1;
+			return l;
+		}
+
+		if (auto ac = dynamic_cast<const ApiCall*>(e))
+		{
+			const Expression* args[5];
+
+			for (int i = 0; i < ac->expectedNumArguments; i++)
+				args[i] = ac->argumentList[i].get();
+
+			auto first = compileArguments(args, ac->expectedNumArguments);
+			emit(OpCode::CallApi, first, first, -1, ac);
+			nextRegister = first + 1;
+			return first;
+		}
+
+		if (auto fc = dynamic_cast<const InlineFunction::FunctionCall*>(e))
+		{
+			if (fc->parameterExpressions.size() == fc->numArgs)
+			{
+				auto first = compileArguments(fc->parameterExpressions.begin(), fc->numArgs);
+				emit(OpCode::CallInline, first, first, -1, fc);
+				nextRegister = first + 1;
+				return first;
+			}
+		}
+
+		// Let the tree interpreter evaluate everything else
+		auto d = allocate();
+
+		if (isStatement)
+			emitPerform(e);
+		else
+		{
+			emit(OpCode::Evaluate, d, -1, -1, e);
+			program.numInterpretedNodes++;
+		}
+
+		return d;
+	}
+
+	BytecodeProgram& program;
+	Array<LoopContext> loops;
+	int nextRegister = 0;
+	bool ok = true;
+};
+
+void HiseJavascriptEngine::RootObject::Callback::performStatements(const Scope& s, var* returnValue) const
+{
+	if (bytecode != nullptr)
+		bytecode->execute(s, returnValue, parameterValues);
+	else
+		statements->perform(s, returnValue);
+}
+
+HiseJavascriptEngine::RootObject::Statement::ResultCode HiseJavascriptEngine::RootObject::InlineFunction::Object::performBody(const Scope& s, var* returnValue, const var* args) const
+{
+	if (bytecode != nullptr)
+		return bytecode->execute(s, returnValue, args);
+
+	return body->perform(s, returnValue);
+}
+
+void HiseJavascriptEngine::RootObject::HiseSpecialData::clearBytecode()
+{
+	for (auto c : callbackNEW)
+		c->bytecode = nullptr;
+
+	auto clearFunctions = [](JavascriptNamespace* ns)
+	{
+		for (auto o : ns->inlineFunctions)
+		{
+			if (auto f = dynamic_cast<InlineFunction::Object*>(o))
+				f->bytecode = nullptr;
+		}
+	};
+
+	clearFunctions(this);
+
+	for (auto ns : namespaces)
+		clearFunctions(ns);
+
+	bytecodePrograms.clear();
+}
+
+String HiseJavascriptEngine::RootObject::HiseSpecialData::compileBytecode()
+{
+	clearBytecode();
+
+	int numCompiledCallbacks = 0;
+	int numCompiledFunctions = 0;
+	int numInterpretedNodes = 0;
+	int numTypedExpressions = 0;
+	int numSkipped = 0;
+
+	auto compile = [&](Callback* c, InlineFunction::Object* f, const BlockStatement* body)
+	{
+		if (body == nullptr)
+			return (BytecodeProgram*)nullptr;
+
+		ScopedPointer<BytecodeProgram> p = new BytecodeProgram(c, f);
+		BytecodeCompiler compiler(*p);
+
+		if (!compiler.compile(body))
+		{
+			numSkipped++;
+			return (BytecodeProgram*)nullptr;
+		}
+
+		p->prepareLocals();
+
+		numInterpretedNodes += p->numInterpretedNodes;
+		numTypedExpressions += p->numTypedExpressions;
+		return bytecodePrograms.add(p.release());
+	};
+
+	for (auto c : callbackNEW)
+	{
+		if (c->isDefined())
+		{
+			c->bytecode = compile(c, nullptr, c->statements);
+			numCompiledCallbacks += (int)(c->bytecode != nullptr);
+		}
+	}
+
+	auto compileFunctions = [&](JavascriptNamespace* ns)
+	{
+		for (auto o : ns->inlineFunctions)
+		{
+			if (auto f = dynamic_cast<InlineFunction::Object*>(o))
+			{
+				f->bytecode = compile(nullptr, f, f->body);
+				numCompiledFunctions += (int)(f->bytecode != nullptr);
+			}
+		}
+	};
+
+	compileFunctions(this);
+
+	for (auto ns : namespaces)
+		compileFunctions(ns);
+
+	String report;
+	report << "Bytecode: " << String(numCompiledCallbacks) << " callbacks, " << String(numCompiledFunctions) << " inline functions";
+	report << " (" << String(numInterpretedNodes) << " interpreted nodes";
+
+	if (numTypedExpressions > 0)
+		report << ", " << String(numTypedExpressions) << " unboxed arithmetic expressions";
+
+	if (numSkipped > 0)
+		report << ", " << String(numSkipped) << " skipped";
+
+	report << ")\n";
+
+	return report;
+}
+
+} // namespace hise
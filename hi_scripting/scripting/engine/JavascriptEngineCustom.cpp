@@ -54,9 +54,7 @@ struct HiseJavascriptEngine::RootObject::RegisterName : public Expression
 	  rootRegister(rootRegister_),
 	  indexInRegister(indexInRegister_),
       name(n),
-#if ENABLE_SCRIPTING_SAFE_CHECKS
       type(type_),
-#endif
 	  data(data_)
       
     {}
@@ -66,6 +64,13 @@ struct HiseJavascriptEngine::RootObject::RegisterName : public Expression
 		return *data;
 	}
 
+	NumericValue getNumericResult(const Scope& /*s*/, var& boxedResult) const override
+	{
+		return NumericValue::fromVar(*data, boxedResult);
+	}
+
+	VarTypeChecker::VarTypes getStaticType() const override { return type; }
+
 	void assign(const Scope& /*s*/, const var& newValue) const override
 	{
 #if ENABLE_SCRIPTING_SAFE_CHECKS
@@ -90,9 +95,7 @@ struct HiseJavascriptEngine::RootObject::RegisterName : public Expression
 	VarRegister* rootRegister;
 	int indexInRegister;
     
-#if ENABLE_SCRIPTING_SAFE_CHECKS
     VarTypeChecker::VarTypes type;
-#endif
 
 	var* data;
 
@@ -105,6 +108,9 @@ struct HiseJavascriptEngine::RootObject::ApiConstant : public Expression
 	ApiConstant(const CodeLocation& l) noexcept : Expression(l) {}
 	var getResult(const Scope&) const override   { return value; }
 
+	NumericValue getNumericResult(const Scope&, var& boxedResult) const override { return NumericValue::fromVar(value, boxedResult); }
+	VarTypeChecker::VarTypes getStaticType() const override { return VarTypeChecker::getType(value); }
+
 	Statement* getChildStatement(int) override { return nullptr; };
 
 	bool isConstant() const override { return true; }
@@ -144,20 +150,24 @@ struct HiseJavascriptEngine::RootObject::ApiCall : public Expression
 
 	var getResult(const Scope& s) const override
 	{
-#if JUCE_ENABLE_AUDIO_GUARD
-        const bool allowIllegalCalls = apiClass->allowIllegalCallsOnAudioThread(functionIndex);
-		AudioThreadGuard::Suspender suspender(allowIllegalCalls);
-#endif
-
 		var results[5];
 		for (int i = 0; i < expectedNumArguments; i++)
-		{
 			results[i] = argumentList[i]->getResult(s);
 
+		return callWithArguments(results);
+	}
+
+	/** Calls the API method with the already evaluated arguments. */
+	var callWithArguments(var* results) const
+	{
+#if JUCE_ENABLE_AUDIO_GUARD
+		AudioThreadGuard::Suspender suspender(apiClass->allowIllegalCallsOnAudioThread(functionIndex));
+#endif
+
 #if ENABLE_SCRIPTING_SAFE_CHECKS
+		for (int i = 0; i < expectedNumArguments; i++)
 			HiseJavascriptEngine::checkValidParameter(i, results[i], argumentList[i]->location, types[i]);
 #endif
-		}
 
 		CHECK_CONDITION_WITH_LOCATION(apiClass != nullptr, "API class does not exist");
 
@@ -548,6 +558,9 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 		}
 
         bool isRealtimeSafe() const override { return true; }
+
+		/** Executes the function body (either with the bytecode interpreter or by walking the syntax tree). */
+		Statement::ResultCode performBody(const Scope& s, var* returnValue, const var* args) const;
         
 		var createDynamicObjectForBreakpoint()
 		{
@@ -595,7 +608,7 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 				dynamicFunctionCall->parameterResults.setUnchecked(i, args[i]);
 			}
 
-			Statement::ResultCode c = body->perform(s, &lastReturnValue.get());
+			Statement::ResultCode c = performBody(s, &lastReturnValue.get(), dynamicFunctionCall->parameterResults.getRawDataPointer());
 
             for (int i = 0; i < numToSet; i++)
             {
@@ -672,6 +685,9 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 
 		ThreadLocalValue<NamedValueSet> localProperties;
 
+		/** The compiled body. This is owned by the HiseSpecialData object. */
+		BytecodeProgram* bytecode = nullptr;
+
 #if ENABLE_SCRIPTING_BREAKPOINTS
 		SimpleReadWriteLock debugLock;
 		var debugArgumentProperties;
@@ -727,29 +743,49 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
             LocalScopeCreator::ScopedSetter svs(s.root, f);
             
 			for (int i = 0; i < numArgs; i++)
-			{
-                auto v = parameterExpressions.getUnchecked(i)->getResult(s);
-				parameterResults.setUnchecked(i, v);
-                
+				setParameter(i, parameterExpressions.getUnchecked(i)->getResult(s));
+
+			return performFunction(s);
+		}
+
+		/** Calls the function with the already evaluated arguments. */
+		var getResultWithArguments(const Scope& s, const var* args) const
+		{
+			f->setFunctionCall(this);
+
+			LocalScopeCreator::ScopedSetter svs(s.root, f);
+
+			for (int i = 0; i < numArgs; i++)
+				setParameter(i, args[i]);
+
+			return performFunction(s);
+		}
+
+		void setParameter(int i, const var& v) const
+		{
+			parameterResults.setUnchecked(i, v);
+
 #if ENABLE_SCRIPTING_SAFE_CHECKS
-                if(auto et = f->parameterNames.getReference(i).type)
-                {
-                    auto ok = VarTypeChecker::checkType(v, f->parameterNames.getReference(i).type);
-                    
-                    if(!ok.wasOk())
-                    {
-                        f->setFunctionCall(nullptr);
-                        location.throwError("Parameter #" + String(i) + ": " + ok.getErrorMessage());
-                    }
-                }
-#endif
+			if (auto et = f->parameterNames.getReference(i).type)
+			{
+				auto ok = VarTypeChecker::checkType(v, f->parameterNames.getReference(i).type);
+
+				if (!ok.wasOk())
+				{
+					f->setFunctionCall(nullptr);
+					location.throwError("Parameter #" + String(i) + ": " + ok.getErrorMessage());
+				}
 			}
+#endif
+		}
 
+		var performFunction(const Scope& s) const
+		{
 			s.root->addToCallStack(f->name, &location);
 
 			try
 			{
-				ResultCode c = f->body->perform(s, &returnVar);
+				ResultCode c = f->performBody(s, &returnVar, parameterResults.getRawDataPointer());
 
 				s.root->removeFromCallStack(f->name);
 
@@ -849,6 +885,19 @@ struct HiseJavascriptEngine::RootObject::InlineFunction
 			}
 		}
 
+		NumericValue getNumericResult(const Scope& s, var& boxedResult) const override
+		{
+			if (auto fc = f->e.get())
+				return NumericValue::fromVar(fc->parameterResults.getReference(index), boxedResult);
+
+			return Expression::getNumericResult(s, boxedResult);
+		}
+
+		VarTypeChecker::VarTypes getStaticType() const override 
+		{ 
+			return f->parameterNames[index].type; 
+		}
+
 		Statement* getChildStatement(int) override { return nullptr; };
 
 		Object* f;
@@ -957,6 +1006,11 @@ struct HiseJavascriptEngine::RootObject::CallbackParameterReference: public Expr
 		return *data;
 	}
 
+	NumericValue getNumericResult(const Scope& /*s*/, var& boxedResult) const override
+	{
+		return NumericValue::fromVar(*data, boxedResult);
+	}
+
 	Statement* getChildStatement(int) override { return nullptr; };
 
 	var* data;
@@ -1140,8 +1194,14 @@ void HiseJavascriptEngine::RootObject::HiseSpecialData::registerOptimisationPass
 	
 	shouldOptimize = enable == "1";
 
+	useBytecode = GET_HISE_SETTING(processor->mainController->getMainSynthChain(), HiseSettings::Scripting::EnableBytecode).toString() == "1";
+
 	optimizations.add(new LocationInjector());
 
+#else
+
+	useBytecode = HISE_USE_SCRIPT_BYTECODE;
+
 #endif
 
 
@@ -5,6 +5,9 @@ struct HiseJavascriptEngine::RootObject::LiteralValue : public Expression
 	LiteralValue(const CodeLocation& l, const var& v) noexcept : Expression(l), value(v) {}
 	var getResult(const Scope&) const override   { return value; }
 
+	NumericValue getNumericResult(const Scope&, var& boxedResult) const override { return NumericValue::fromVar(value, boxedResult); }
+	VarTypeChecker::VarTypes getStaticType() const override { return VarTypeChecker::getType(value); }
+
 	bool isConstant() const override { return true; }
 
 	Statement* getChildStatement(int) override { return nullptr; };
@@ -114,9 +117,28 @@ struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
 
     
 	var getResult(const Scope& s) const override
+	{
+		return getResultFromObject(s, object->getResult(s));
+	}
+
+	NumericValue getNumericResult(const Scope& s, var& boxedResult) const override
 	{
 		var result = object->getResult(s);
 
+		// Read buffer samples directly as a double
+		if (VariantBuffer *b = result.getBuffer())
+		{
+			var boxedIndex;
+			auto i = index->getNumericResult(s, boxedIndex);
+			const int idx = i.isNumber() ? (int)i.toInt64() : (int)boxedIndex;
+			return NumericValue((double)(*b)[idx]);
+		}
+
+		return NumericValue::fromVar(getResultFromObject(s, result), boxedResult);
+	}
+
+	var getResultFromObject(const Scope& s, const var& result) const
+	{
 		if (VariantBuffer *b = result.getBuffer())
 		{
 			const int i = index->getResult(s);
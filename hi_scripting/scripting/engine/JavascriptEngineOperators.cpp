@@ -30,7 +30,10 @@ struct HiseJavascriptEngine::RootObject::BinaryOperatorBase : public Expression
 struct HiseJavascriptEngine::RootObject::BinaryOperator : public BinaryOperatorBase
 {
 	BinaryOperator(const CodeLocation& l, ExpPtr& a, ExpPtr& b, TokenType op) noexcept
-	: BinaryOperatorBase(l, a, b, op) {}
+	: BinaryOperatorBase(l, a, b, op) 
+	{
+		updateNumericPath();
+	}
 
 	virtual var getWithUndefinedArg() const                           { return var::undefined(); }
 	virtual var getWithDoubles(double, double) const                 { return throwError("Double"); }
@@ -38,10 +41,59 @@ struct HiseJavascriptEngine::RootObject::BinaryOperator : public BinaryOperatorB
 	virtual var getWithArrayOrObject(const var& a, const var&) const { return throwError(a.isArray() ? "Array" : "Object"); }
 	virtual var getWithStrings(const String&, const String&) const   { return throwError("String"); }
 
+	/** Applies the operator to two unboxed numbers. Return false if the operation is not defined 
+		for the given types so that the boxed path (and its error handling) is used instead. */
+	virtual bool getWithNumbers(const NumericValue&, const NumericValue&, NumericValue&) const { return false; }
+
 	var getResult(const Scope& s) const override
 	{
+		if (useNumericPath)
+		{
+			var boxedResult;
+			return getNumericResult(s, boxedResult).toVar(boxedResult);
+		}
+
 		var a(lhs->getResult(s)), b(rhs->getResult(s));
+		return combine(a, b);
+	}
+
+	NumericValue getNumericResult(const Scope& s, var& boxedResult) const override
+	{
+		if (!useNumericPath)
+			return Expression::getNumericResult(s, boxedResult);
+
+		var boxedA, boxedB;
+		auto a = lhs->getNumericResult(s, boxedA);
+		auto b = rhs->getNumericResult(s, boxedB);
+
+		NumericValue r;
+
+		if (a.isNumber() && b.isNumber() && getWithNumbers(a, b, r))
+			return r;
+
+		return NumericValue::fromVar(combine(a.toVar(boxedA), b.toVar(boxedB)), boxedResult);
+	}
+
+	bool replaceChildStatement(Ptr& newS, Statement* sToReplace) override
+	{
+		auto ok = BinaryOperatorBase::replaceChildStatement(newS, sToReplace);
+		updateNumericPath();
+		return ok;
+	}
 
+	/** Uses the unboxed path if at least one operand is known to be a number. */
+	void updateNumericPath()
+	{
+#if HISE_USE_TYPED_SCRIPT_ARITHMETIC
+		useNumericPath = isNumericType(lhs->getStaticType()) || isNumericType(rhs->getStaticType());
+#endif
+	}
+
+	bool useNumericPath = false;
+
+	/** Applies the operator to the already evaluated operands. */
+	var combine(const var& a, const var& b) const
+	{
 		if (isNumericOrUndefined(a) && isNumericOrUndefined(b))
 			return (a.isDouble() || b.isDouble()) ? getWithDoubles(a, b) : getWithInts(a, b);
 
@@ -64,55 +116,138 @@ struct HiseJavascriptEngine::RootObject::BinaryOperator : public BinaryOperatorB
 	}
 };
 
-struct HiseJavascriptEngine::RootObject::EqualsOp : public BinaryOperator
+/** Base class for operators that are defined for doubles and integers.
+
+	The subclass must implement the operation as static applyDoubles() and applyInts() functions which
+	are used by both the boxed and the unboxed path.
+*/
+template <class OpType> struct HiseJavascriptEngine::RootObject::NumericOperator : public BinaryOperator
+{
+	NumericOperator(const CodeLocation& l, ExpPtr& a, ExpPtr& b, TokenType op) noexcept : BinaryOperator(l, a, b, op) {}
+
+	var getWithDoubles(double a, double b) const override { return NumericValue(OpType::applyDoubles(a, b)).toVar(); }
+	var getWithInts(int64 a, int64 b) const override      { return NumericValue(OpType::applyInts(a, b)).toVar(); }
+
+	bool getWithNumbers(const NumericValue& a, const NumericValue& b, NumericValue& r) const override
+	{
+		if (a.isDouble() || b.isDouble())
+			r = NumericValue(OpType::applyDoubles(a.toDouble(), b.toDouble()));
+		else
+			r = NumericValue(OpType::applyInts(a.toInt64(), b.toInt64()));
+
+		return true;
+	}
+
+	VarTypeChecker::VarTypes getStaticType() const override
+	{
+		return OpType::getResultType(lhs->getStaticType(), rhs->getStaticType());
+	}
+
+	static VarTypeChecker::VarTypes getArithmeticType(VarTypeChecker::VarTypes a, VarTypeChecker::VarTypes b)
+	{
+		if (!isNumericType(a) || !isNumericType(b))
+			return VarTypeChecker::Undefined;
+
+		if (a == VarTypeChecker::Integer && b == VarTypeChecker::Integer)
+			return VarTypeChecker::Integer;
+
+		if (a == VarTypeChecker::Double || b == VarTypeChecker::Double)
+			return VarTypeChecker::Double;
+
+		return VarTypeChecker::Number;
+	}
+
+	static VarTypeChecker::VarTypes getResultType(VarTypeChecker::VarTypes a, VarTypeChecker::VarTypes b)
+	{
+		return getArithmeticType(a, b);
+	}
+};
+
+/** Base class for operators that are only defined for integers (the double path throws an error). */
+template <class OpType> struct HiseJavascriptEngine::RootObject::IntegerOperator : public BinaryOperator
 {
-	EqualsOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::equals) {}
+	IntegerOperator(const CodeLocation& l, ExpPtr& a, ExpPtr& b, TokenType op) noexcept : BinaryOperator(l, a, b, op) {}
+
+	var getWithInts(int64 a, int64 b) const override { return NumericValue(OpType::applyInts(a, b)).toVar(); }
+
+	bool getWithNumbers(const NumericValue& a, const NumericValue& b, NumericValue& r) const override
+	{
+		if (a.isDouble() || b.isDouble())
+			return false;
+
+		r = NumericValue(OpType::applyInts(a.toInt64(), b.toInt64()));
+		return true;
+	}
+
+	VarTypeChecker::VarTypes getStaticType() const override
+	{
+		if (isNumericType(lhs->getStaticType()) && isNumericType(rhs->getStaticType()))
+			return VarTypeChecker::Integer;
+
+		return VarTypeChecker::Undefined;
+	}
+};
+
+/** Base class for the comparison operators. */
+template <class OpType> struct HiseJavascriptEngine::RootObject::ComparisonOperator : public NumericOperator<OpType>
+{
+	ComparisonOperator(const CodeLocation& l, ExpPtr& a, ExpPtr& b, TokenType op) noexcept : NumericOperator<OpType>(l, a, b, op) {}
+
+	static VarTypeChecker::VarTypes getResultType(VarTypeChecker::VarTypes a, VarTypeChecker::VarTypes b)
+	{
+		return NumericOperator<OpType>::getArithmeticType(a, b) != VarTypeChecker::Undefined ? VarTypeChecker::Integer : VarTypeChecker::Undefined;
+	}
+};
+
+struct HiseJavascriptEngine::RootObject::EqualsOp : public ComparisonOperator<EqualsOp>
+{
+	EqualsOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : ComparisonOperator(l, a, b, TokenTypes::equals) {}
+	static bool applyDoubles(double a, double b)                          { return a == b; }
+	static bool applyInts(int64 a, int64 b)                               { return a == b; }
 	var getWithUndefinedArg() const override                               { return true; }
-	var getWithDoubles(double a, double b) const override                 { return a == b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a == b; }
 	var getWithStrings(const String& a, const String& b) const override   { return a == b; }
 	var getWithArrayOrObject(const var& a, const var& b) const override   { return a == b; }
 };
 
-struct HiseJavascriptEngine::RootObject::NotEqualsOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::NotEqualsOp : public ComparisonOperator<NotEqualsOp>
 {
-	NotEqualsOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::notEquals) {}
+	NotEqualsOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : ComparisonOperator(l, a, b, TokenTypes::notEquals) {}
+	static bool applyDoubles(double a, double b)                          { return a != b; }
+	static bool applyInts(int64 a, int64 b)                               { return a != b; }
 	var getWithUndefinedArg() const override                               { return false; }
-	var getWithDoubles(double a, double b) const override                 { return a != b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a != b; }
 	var getWithStrings(const String& a, const String& b) const override   { return a != b; }
 	var getWithArrayOrObject(const var& a, const var& b) const override   { return a != b; }
 };
 
-struct HiseJavascriptEngine::RootObject::LessThanOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::LessThanOp : public ComparisonOperator<LessThanOp>
 {
-	LessThanOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::lessThan) {}
-	var getWithDoubles(double a, double b) const override                 { return a < b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a < b; }
+	LessThanOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : ComparisonOperator(l, a, b, TokenTypes::lessThan) {}
+	static bool applyDoubles(double a, double b)                          { return a < b; }
+	static bool applyInts(int64 a, int64 b)                               { return a < b; }
 	var getWithStrings(const String& a, const String& b) const override   { return a < b; }
 };
 
-struct HiseJavascriptEngine::RootObject::LessThanOrEqualOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::LessThanOrEqualOp : public ComparisonOperator<LessThanOrEqualOp>
 {
-	LessThanOrEqualOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::lessThanOrEqual) {}
-	var getWithDoubles(double a, double b) const override                 { return a <= b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a <= b; }
+	LessThanOrEqualOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : ComparisonOperator(l, a, b, TokenTypes::lessThanOrEqual) {}
+	static bool applyDoubles(double a, double b)                          { return a <= b; }
+	static bool applyInts(int64 a, int64 b)                               { return a <= b; }
 	var getWithStrings(const String& a, const String& b) const override   { return a <= b; }
 };
 
-struct HiseJavascriptEngine::RootObject::GreaterThanOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::GreaterThanOp : public ComparisonOperator<GreaterThanOp>
 {
-	GreaterThanOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::greaterThan) {}
-	var getWithDoubles(double a, double b) const override                 { return a > b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a > b; }
+	GreaterThanOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : ComparisonOperator(l, a, b, TokenTypes::greaterThan) {}
+	static bool applyDoubles(double a, double b)                          { return a > b; }
+	static bool applyInts(int64 a, int64 b)                               { return a > b; }
 	var getWithStrings(const String& a, const String& b) const override   { return a > b; }
 };
 
-struct HiseJavascriptEngine::RootObject::GreaterThanOrEqualOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::GreaterThanOrEqualOp : public ComparisonOperator<GreaterThanOrEqualOp>
 {
-	GreaterThanOrEqualOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::greaterThanOrEqual) {}
-	var getWithDoubles(double a, double b) const override                 { return a >= b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a >= b; }
+	GreaterThanOrEqualOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : ComparisonOperator(l, a, b, TokenTypes::greaterThanOrEqual) {}
+	static bool applyDoubles(double a, double b)                          { return a >= b; }
+	static bool applyInts(int64 a, int64 b)                               { return a >= b; }
 	var getWithStrings(const String& a, const String& b) const override   { return a >= b; }
 };
 
@@ -121,11 +256,11 @@ struct HiseJavascriptEngine::RootObject::GreaterThanOrEqualOp : public BinaryOpe
 #pragma warning (disable : 4702)
 #endif
 
-struct HiseJavascriptEngine::RootObject::AdditionOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::AdditionOp : public NumericOperator<AdditionOp>
 {
-	AdditionOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::plus) {}
-	var getWithDoubles(double a, double b) const override                 { return a + b; }
-	var getWithInts(int64 a, int64 b) const override                      { return a + b; }
+	AdditionOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : NumericOperator(l, a, b, TokenTypes::plus) {}
+	static double applyDoubles(double a, double b)                        { return a + b; }
+	static int64 applyInts(int64 a, int64 b)                              { return a + b; }
 	var getWithStrings(const String& a, const String& b) const override   
 	{ 
 		WARN_IF_AUDIO_THREAD(true, IllegalAudioThreadOps::StringCreation);
@@ -164,11 +299,11 @@ struct HiseJavascriptEngine::RootObject::AdditionOp : public BinaryOperator
 
 };
 
-struct HiseJavascriptEngine::RootObject::SubtractionOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::SubtractionOp : public NumericOperator<SubtractionOp>
 {
-	SubtractionOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::minus) {}
-	var getWithDoubles(double a, double b) const override { return a - b; }
-	var getWithInts(int64 a, int64 b) const override      { return a - b; }
+	SubtractionOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : NumericOperator(l, a, b, TokenTypes::minus) {}
+	static double applyDoubles(double a, double b) { return a - b; }
+	static int64 applyInts(int64 a, int64 b)       { return a - b; }
 
 	var getWithArrayOrObject(const var &a, const var& b) const override
 	{
@@ -202,11 +337,11 @@ struct HiseJavascriptEngine::RootObject::SubtractionOp : public BinaryOperator
 };
 
 
-struct HiseJavascriptEngine::RootObject::MultiplyOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::MultiplyOp : public NumericOperator<MultiplyOp>
 {
-	MultiplyOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::times) {}
-	var getWithDoubles(double a, double b) const override { return a * b; }
-	var getWithInts(int64 a, int64 b) const override      { return a * b; }
+	MultiplyOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : NumericOperator(l, a, b, TokenTypes::times) {}
+	static double applyDoubles(double a, double b) { return a * b; }
+	static int64 applyInts(int64 a, int64 b)       { return a * b; }
 
 	var getWithArrayOrObject(const var& a, const var&b) const override
 	{
@@ -247,46 +382,56 @@ struct HiseJavascriptEngine::RootObject::MultiplyOp : public BinaryOperator
 #endif
 
 
-struct HiseJavascriptEngine::RootObject::DivideOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::DivideOp : public NumericOperator<DivideOp>
 {
-	DivideOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::divide) {}
-	var getWithDoubles(double a, double b) const override  { return b != 0 ? a / b : std::numeric_limits<double>::infinity(); }
-	var getWithInts(int64 a, int64 b) const override       { return b != 0 ? var(a / (double)b) : var(std::numeric_limits<double>::infinity()); }
+	DivideOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : NumericOperator(l, a, b, TokenTypes::divide) {}
+	static double applyDoubles(double a, double b)  { return b != 0 ? a / b : std::numeric_limits<double>::infinity(); }
+	static double applyInts(int64 a, int64 b)       { return b != 0 ? a / (double)b : std::numeric_limits<double>::infinity(); }
+
+	static VarTypeChecker::VarTypes getResultType(VarTypeChecker::VarTypes a, VarTypeChecker::VarTypes b)
+	{
+		return getArithmeticType(a, b) != VarTypeChecker::Undefined ? VarTypeChecker::Double : VarTypeChecker::Undefined;
+	}
 };
 
-struct HiseJavascriptEngine::RootObject::ModuloOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::ModuloOp : public NumericOperator<ModuloOp>
 {
-	ModuloOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::modulo) {}
-	var getWithInts(int64 a, int64 b) const override   { return b != 0 ? var(a % b) : var(std::numeric_limits<double>::infinity()); }
-    var getWithDoubles(double a, double b) const override
+	ModuloOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : NumericOperator(l, a, b, TokenTypes::modulo) {}
+	static NumericValue applyInts(int64 a, int64 b)   { return b != 0 ? NumericValue(a % b) : NumericValue(std::numeric_limits<double>::infinity()); }
+    static NumericValue applyDoubles(double a, double b)
     {
 		auto mod = roundToInt(b);
-		return mod != 0 ? var(roundToInt(a) % roundToInt(b)) : var(std::numeric_limits<double>::infinity());
+		return mod != 0 ? NumericValue(roundToInt(a) % roundToInt(b)) : NumericValue(std::numeric_limits<double>::infinity());
     }
+
+	static VarTypeChecker::VarTypes getResultType(VarTypeChecker::VarTypes a, VarTypeChecker::VarTypes b)
+	{
+		return getArithmeticType(a, b) != VarTypeChecker::Undefined ? VarTypeChecker::Number : VarTypeChecker::Undefined;
+	}
 };
 
-struct HiseJavascriptEngine::RootObject::BitwiseOrOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::BitwiseOrOp : public IntegerOperator<BitwiseOrOp>
 {
-	BitwiseOrOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::bitwiseOr) {}
-	var getWithInts(int64 a, int64 b) const override   { return a | b; }
+	BitwiseOrOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : IntegerOperator(l, a, b, TokenTypes::bitwiseOr) {}
+	static int64 applyInts(int64 a, int64 b)   { return a | b; }
 };
 
-struct HiseJavascriptEngine::RootObject::BitwiseAndOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::BitwiseAndOp : public IntegerOperator<BitwiseAndOp>
 {
-	BitwiseAndOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::bitwiseAnd) {}
-	var getWithInts(int64 a, int64 b) const override   { return a & b; }
+	BitwiseAndOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : IntegerOperator(l, a, b, TokenTypes::bitwiseAnd) {}
+	static int64 applyInts(int64 a, int64 b)   { return a & b; }
 };
 
-struct HiseJavascriptEngine::RootObject::BitwiseXorOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::BitwiseXorOp : public IntegerOperator<BitwiseXorOp>
 {
-	BitwiseXorOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::bitwiseXor) {}
-	var getWithInts(int64 a, int64 b) const override   { return a ^ b; }
+	BitwiseXorOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : IntegerOperator(l, a, b, TokenTypes::bitwiseXor) {}
+	static int64 applyInts(int64 a, int64 b)   { return a ^ b; }
 };
 
-struct HiseJavascriptEngine::RootObject::LeftShiftOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::LeftShiftOp : public IntegerOperator<LeftShiftOp>
 {
-	LeftShiftOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::leftShift) {}
-	var getWithInts(int64 a, int64 b) const override   { return ((int)a) << (int)b; }
+	LeftShiftOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : IntegerOperator(l, a, b, TokenTypes::leftShift) {}
+	static int applyInts(int64 a, int64 b)   { return ((int)a) << (int)b; }
 
 	var getWithArrayOrObject(const var& a, const var&b) const override
 	{
@@ -317,10 +462,10 @@ struct HiseJavascriptEngine::RootObject::LeftShiftOp : public BinaryOperator
 	}
 };
 
-struct HiseJavascriptEngine::RootObject::RightShiftOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::RightShiftOp : public IntegerOperator<RightShiftOp>
 {
-	RightShiftOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::rightShift) {}
-	var getWithInts(int64 a, int64 b) const override   { return ((int)a) >> (int)b; }
+	RightShiftOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : IntegerOperator(l, a, b, TokenTypes::rightShift) {}
+	static int applyInts(int64 a, int64 b)   { return ((int)a) >> (int)b; }
 	
 	var getWithArrayOrObject(const var& a, const var&b) const override
 	{
@@ -354,10 +499,10 @@ struct HiseJavascriptEngine::RootObject::RightShiftOp : public BinaryOperator
 
 };
 
-struct HiseJavascriptEngine::RootObject::RightShiftUnsignedOp : public BinaryOperator
+struct HiseJavascriptEngine::RootObject::RightShiftUnsignedOp : public IntegerOperator<RightShiftUnsignedOp>
 {
-	RightShiftUnsignedOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : BinaryOperator(l, a, b, TokenTypes::rightShiftUnsigned) {}
-	var getWithInts(int64 a, int64 b) const override   { return (int)(((uint32)a) >> (int)b); }
+	RightShiftUnsignedOp(const CodeLocation& l, ExpPtr& a, ExpPtr& b) noexcept : IntegerOperator(l, a, b, TokenTypes::rightShiftUnsigned) {}
+	static int applyInts(int64 a, int64 b)   { return (int)(((uint32)a) >> (int)b); }
 };
 
 struct HiseJavascriptEngine::RootObject::LogicalAndOp : public BinaryOperatorBase
@@ -2692,17 +2692,26 @@ void HiseJavascriptEngine::RootObject::execute(const String& code, bool allowCon
 			results.add(or_);
 	}
 	
+	String bytecodeReport;
+
+	if (hiseSpecialData.useBytecode)
+	{
+		TRACE_SCRIPTING("compile bytecode");
+		bytecodeReport = hiseSpecialData.compileBytecode();
+	}
+
 	auto after = Time::getMillisecondCounter();
 	
 	auto optimisationTimeMs = after - before;
 	
-	if (!results.isEmpty())
+	if (!results.isEmpty() || bytecodeReport.isNotEmpty())
 	{
 		String s;
 
 		for (auto r : results)
 			s << r.passName << ": " << String(r.numOptimizedStatements) << "\n";
 
+		s << bytecodeReport;
 		s << "Optimization Duration: " << String(optimisationTimeMs) << "ms";
 
 		hiseSpecialData.processor->setOptimisationReport(s);
@@ -40,6 +40,10 @@
 
 #include  "JuceHeader.h"
 
+#if HISE_INCLUDE_SNEX
+#include "snex_nodes/SnexSource.h"
+#endif
+
 namespace scriptnode
 {
 
@@ -271,6 +275,9 @@ struct ScriptNodeTests : public juce::UnitTest
 		testRangeTemplates();
 		testParameters();
 		testModWrapper();
+		testVoiceBatch();
+		testCrossBranchConnections();
+		testSpecialisation();
 	}
 
 	struct Dummy
@@ -466,6 +473,93 @@ struct ScriptNodeTests : public juce::UnitTest
 		expectEquals<double>(target.value[Dummy::Second], 0.666, "modulation connection didn't work");
 	}
 
+	template <typename T> void initVoiceBatchNetwork(T& n, PolyHandler& ph, const Array<int>& voices)
+	{
+		PrepareSpecs ps;
+		ps.numChannels = 1;
+		ps.blockSize = 64;
+		ps.sampleRate = 44100.0;
+		ps.voiceIndex = &ph;
+
+		n.prepare(ps);
+		n.reset();
+
+		for (auto v : voices)
+		{
+			PolyHandler::ScopedVoiceSetter svs(ph, v);
+
+			n.template get<0>().setFrequency(100.0 + 37.0 * v);
+			n.template get<1>().setSmoothingTime(5.0 + v);
+			n.template get<2>().setMode(1.0);
+			n.template get<2>().setFrequency(220.0 + 11.0 * v);
+			n.template get<3>().setPeriodTime(10.0 + v);
+			n.template get<3>().setGate(1.0);
+			n.template get<4>().setSmoothing(20.0);
+			n.template get<4>().setGain(-6.0 - v);
+			n.template get<5>().setValue(0.1 * v);
+		}
+	}
+
+	void testVoiceBatch()
+	{
+		beginTest("Testing voice batch rendering");
+
+		// the math node doesn't support batches and will be rendered voice by voice
+		using NodeType = container::voice_batch<parameter::empty, 
+			wrap::fix<1, core::phasor<NUM_POLYPHONIC_VOICES>>,
+			core::smoother<NUM_POLYPHONIC_VOICES>,
+			core::oscillator<NUM_POLYPHONIC_VOICES>,
+			core::ramp<NUM_POLYPHONIC_VOICES, false>,
+			core::gain<NUM_POLYPHONIC_VOICES>,
+			math::add<NUM_POLYPHONIC_VOICES>>;
+
+		// one full batch and a partial one
+		Array<int> voices = { 0, 3, 5, 6, 9 };
+		const int numSamples = 64;
+
+		PolyHandler batchHandler(true), serialHandler(true);
+		ScopedPointer<NodeType> batched = new NodeType();
+		ScopedPointer<NodeType> serial = new NodeType();
+
+		initVoiceBatchNetwork(*batched, batchHandler, voices);
+		initVoiceBatchNetwork(*serial, serialHandler, voices);
+
+		heap<float> batchData, serialData;
+		batchData.setSize(numSamples * voices.size());
+		serialData.setSize(numSamples * voices.size());
+
+		for (int block = 0; block < 3; block++)
+		{
+			float* ptrs[NUM_POLYPHONIC_VOICES];
+			OwnedArray<ProcessDataDyn> batchVoices;
+
+			for (int i = 0; i < voices.size(); i++)
+			{
+				ptrs[i] = batchData.begin() + i * numSamples;
+				batchVoices.add(new ProcessDataDyn(ptrs + i, numSamples, 1));
+
+				float* sp[1] = { serialData.begin() + i * numSamples };
+				ProcessData<1> d(sp, numSamples);
+
+				PolyHandler::ScopedVoiceSetter svs(serialHandler, voices[i]);
+				serial->process(d);
+			}
+
+			batched->processVoices(voices.begin(), batchVoices.getRawDataPointer(), voices.size());
+
+			for (int i = 0; i < batchData.size(); i++)
+			{
+				if (std::abs(batchData[i] - serialData[i]) > 1e-5f)
+				{
+					expectEquals(batchData[i], serialData[i], "Mismatch at voice " + String(voices[i / numSamples]) + ", sample " + String(i % numSamples));
+					return;
+				}
+			}
+		}
+
+		expect(serialData[numSamples * 4 + 12] != 0.0f, "no signal");
+	}
+
 	template <typename S, typename R> void initSendReceive(S& sender, R& receiver, int numChannels, int blockSize)
 	{
 		receiver.setFeedback(0.5f);
@@ -658,6 +752,149 @@ struct ScriptNodeTests : public juce::UnitTest
 		}
 	}
 
+	void testCrossBranchConnections()
+	{
+		beginTest("Testing cross branch connection detection");
+
+		auto createNode = [](const String& id)
+		{
+			ValueTree n(PropertyIds::Node);
+			n.setProperty(PropertyIds::ID, id, nullptr);
+			return n;
+		};
+
+		auto split = createNode("split");
+		ValueTree nodes(PropertyIds::Nodes);
+		split.addChild(nodes, -1, nullptr);
+
+		auto first = createNode("first");
+		auto second = createNode("second");
+		nodes.addChild(first, -1, nullptr);
+		nodes.addChild(second, -1, nullptr);
+
+		expect(!cppgen::ValueTreeIterator::hasCrossBranchConnections(split), "independent branches");
+
+		ValueTree targets(PropertyIds::ModulationTargets);
+		ValueTree c(PropertyIds::Connection);
+		c.setProperty(PropertyIds::NodeId, "second", nullptr);
+		targets.addChild(c, -1, nullptr);
+		first.addChild(targets, -1, nullptr);
+
+		expect(cppgen::ValueTreeIterator::hasCrossBranchConnections(split), "modulation into another branch");
+
+		c.setProperty(PropertyIds::NodeId, "first", nullptr);
+		expect(!cppgen::ValueTreeIterator::hasCrossBranchConnections(split), "modulation within the same branch");
+
+		ValueTree receiveProperties(PropertyIds::Properties);
+		ValueTree connection(PropertyIds::Property);
+		connection.setProperty(PropertyIds::ID, PropertyIds::Connection.toString(), nullptr);
+		connection.setProperty(PropertyIds::Value, "other_send;first", nullptr);
+		receiveProperties.addChild(connection, -1, nullptr);
+		second.addChild(receiveProperties, -1, nullptr);
+
+		expect(cppgen::ValueTreeIterator::hasCrossBranchConnections(split), "receive from another branch");
+	}
+
+	void testSpecialisation()
+	{
+#if HISE_INCLUDE_SNEX && SNEX_MIR_BACKEND
+		beginTest("Testing parameter specialisation");
+
+		using Specialiser = SnexSource::Specialiser;
+
+		auto compile = [&](const String& code, const String& gainValue, const String& sizeValue, jit::ComplexType::Ptr* structType)
+		{
+			ExternalPreprocessorDefinition gain(ExternalPreprocessorDefinition::Type::Macro);
+			gain.name = "PARAMETER_Gain(fallback)";
+			gain.value = gainValue;
+
+			ExternalPreprocessorDefinition size(ExternalPreprocessorDefinition::Type::Macro);
+			size.name = "PARAMETER_Size(fallback)";
+			size.value = sizeValue;
+
+			jit::GlobalScope s;
+			jit::Compiler c(s);
+			c.setPreprocessorDefinitions({ gain, size });
+			auto obj = c.compileJitObject(code);
+			expect(c.getCompileResult().wasOk(), c.getCompileResult().getErrorMessage());
+
+			if (structType != nullptr)
+				*structType = c.getComplexType(NamespacedIdentifier("X"));
+
+			return obj;
+		};
+
+		auto generic = compile("double gain = 0.5; double test(double input){ return input * PARAMETER_Gain(gain); }", "fallback", "fallback", nullptr);
+		auto specialised = compile("double gain = 0.5; double test(double input){ return input * PARAMETER_Gain(gain); }", "3.0", "fallback", nullptr);
+
+		auto f = generic["test"];
+		expectEquals(f.call<double>(2.0), 1.0, "regular function");
+
+		SimpleReadWriteLock lock;
+		Specialiser::Remapper remapper;
+
+		{
+			SimpleReadWriteLock::ScopedWriteLock sl(lock);
+			expect(remapper.add(&f, specialised["test"].function), "can't add function");
+			remapper.activate();
+		}
+
+		expectEquals(f.call<double>(2.0), 6.0, "specialised function");
+
+		// A parameter change reverts to the regular function
+		expect(remapper.revert(lock), "revert");
+		expect(!remapper.isActive(), "still active after revert");
+		expectEquals(f.call<double>(2.0), 1.0, "reverted function");
+		expect(!remapper.revert(lock), "second revert");
+
+		{
+			SimpleReadWriteLock::ScopedWriteLock sl(lock);
+			remapper.activate();
+		}
+
+		// A revert while another thread swaps the callbacks must not touch the pointers
+		WaitableEvent locked, release;
+
+		std::thread writer([&]()
+		{
+			SimpleReadWriteLock::ScopedWriteLock sl(lock);
+			locked.signal();
+			release.wait();
+		});
+
+		locked.wait();
+		expect(!remapper.revert(lock), "revert while locked");
+		expectEquals(f.call<double>(2.0), 6.0, "function was swapped while locked");
+		release.signal();
+		writer.join();
+
+		expect(remapper.hasPendingRevert(), "no pending revert");
+		expect(!remapper.hasPendingRevert(), "pending flag wasn't reset");
+		expect(remapper.revert(lock), "deferred revert");
+		expectEquals(f.call<double>(2.0), 1.0, "deferred reverted function");
+
+		{
+			SimpleReadWriteLock::ScopedWriteLock sl(lock);
+			remapper.activate();
+		}
+
+		remapper.clear(lock);
+		expect(!remapper.isActive(), "active after clear");
+		expectEquals(remapper.getNumRemaps(), 0, "remaps after clear");
+		expectEquals(f.call<double>(2.0), 1.0, "cleared function");
+
+		const String structCode = "struct X { span<float, PARAMETER_Size(2)> data; double gain = PARAMETER_Gain(0.5); double get() { return gain; } };";
+
+		jit::ComplexType::Ptr genericClass, sameClass, otherClass;
+		compile(structCode, "fallback", "fallback", &genericClass);
+		compile(structCode, "3.0", "2", &sameClass);
+		compile(structCode, "3.0", "4", &otherClass);
+
+		expect(Specialiser::hasSameLayout(genericClass, sameClass), "different default values must not change the layout");
+		expect(!Specialiser::hasSameLayout(genericClass, otherClass), "different span size wasn't detected");
+#endif
+	}
+
 	void testSendReceive()
 	{
 		beginTest("Testing send / receive connections");
@@ -997,6 +1234,21 @@ struct ScriptNodeTests : public juce::UnitTest
 			expectContainerWorks<NumSamples>(c, "container::split", v);
 		}
 
+		{
+			auto c = createAndConnect<container::parallel_split<PType, AddType, MulType, AddType>, NumSamples>(v1, v2, v3);
+			auto v = makeTestSpan<NumChannels, NumSamples>();
+
+			for (auto& s : v)
+			{
+				auto copy = s;
+				s =  copy + v1;
+				s += copy * v2;
+				s += copy + v3;
+			}
+
+			expectContainerWorks<NumSamples>(c, "container::parallel_split", v);
+		}
+
 		{
 			auto c = createAndConnect<container::multi<PType, AddType, MulType, AddType>, NumSamples>(v1, v2, v3);
 			auto v = makeTestSpan<NumChannels * 3, NumSamples>();
@@ -1024,6 +1276,34 @@ struct ScriptNodeTests : public juce::UnitTest
 
 			expectContainerWorks<NumSamples>(c, "container::multi", v);
 		}
+
+		{
+			auto c = createAndConnect<container::parallel_multi<PType, AddType, MulType, AddType>, NumSamples>(v1, v2, v3);
+			auto v = makeTestSpan<NumChannels * 3, NumSamples>();
+			
+			constexpr int NumMultis = 3;
+
+			for(int s = 0; s < NumSamples; s++)
+			{
+				for (int c = 0; c < NumChannels; c++)
+				{
+					int cOffset = NumSamples * c;
+
+					for (int m = 0; m < NumMultis; m++)
+					{
+						int mOffset = NumSamples * NumChannels * m;
+						int posInData = s + mOffset + cOffset;
+						auto& value = v[posInData];
+
+						if (m == 0) value += v1;
+						if (m == 1) value *= v2;
+						if (m == 2) value += v3;
+					}
+				}
+			}
+
+			expectContainerWorks<NumSamples>(c, "container::parallel_multi", v);
+		}
 	}
 
 	struct PropertyDummy
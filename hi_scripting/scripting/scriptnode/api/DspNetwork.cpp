@@ -163,7 +163,12 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 
 	loader = new DspFactory::LibraryLoader(dynamic_cast<Processor*>(p));
 
-	setRootNode(createFromValueTree(true, data.getChild(0), true));
+	{
+#if HISE_INCLUDE_SNEX
+		CodeManager::ScopedParallelCompilation spc(codeManager);
+#endif
+		setRootNode(createFromValueTree(true, data.getChild(0), true));
+	}
 	networkParameterHandler.root = getRootNode();
 
 	initialId = getId();
@@ -551,6 +556,22 @@ void DspNetwork::process(ProcessDataDyn& data)
 	}
 }
 
+bool DspNetwork::canProcessVoices() const
+{
+	return isInitialised() && projectNodeHolder.isActive() && projectNodeHolder.n.canProcessVoices();
+}
+
+bool DspNetwork::processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices)
+{
+	TRACE_DSP();
+
+	if (!canProcessVoices())
+		return false;
+
+	projectNodeHolder.processVoices(voiceIndexes, voiceData, numVoices);
+	return true;
+}
+
 bool DspNetwork::hasTail() const
 {
 	return hasTailProperty.get();
@@ -583,6 +604,10 @@ void DspNetwork::setForwardControlsToParameters(bool shouldForward)
 
 void DspNetwork::prepareToPlay(double sampleRate, double blockSize)
 {
+#if HISE_INCLUDE_SNEX
+	CodeManager::ScopedParallelCompilation spc(codeManager);
+#endif
+
 	runPostInitFunctions();
 
 	if (sampleRate > 0.0)
@@ -1799,6 +1824,10 @@ void DspNetwork::CodeManager::SnexSourceCompileHandler::postCompile(ui::Workbenc
 	}
 
 	runTestNext.store(false);
+
+	// Replace the fast compilation with the optimized version
+	if (getParent()->needsOptimizedCompilation() && !threadShouldExit())
+		getParent()->compileOptimized();
 }
 
 SimpleReadWriteLock& DspNetwork::CodeManager::SnexSourceCompileHandler::getCompileLock()
@@ -1834,9 +1863,9 @@ snex::ui::WorkbenchData::Ptr DspNetwork::CodeManager::getOrCreate(const Identifi
 	auto ef = parent.getMainController()->getExternalScriptFile(targetFile, false);
 
 	if(ef != nullptr)
-		return entries.add(new Entry(typeId, ef, parent.getScriptProcessor()))->wb;
+		return entries.add(new Entry(*this, typeId, ef, parent.getScriptProcessor()))->wb;
 	else
-		return entries.add(new Entry(typeId, targetFile, parent.getScriptProcessor()))->wb;
+		return entries.add(new Entry(*this, typeId, targetFile, parent.getScriptProcessor()))->wb;
 	
 }
 
@@ -1869,7 +1898,7 @@ StringArray DspNetwork::CodeManager::getClassList(const Identifier& id, const St
 	return sa;
 }
 
-DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp):
+DspNetwork::CodeManager::Entry::Entry(CodeManager& cm, const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp):
 	type(t),
 	parameterFile(targetFile.withFileExtension("xml")),
 	resourceType(ExternalScriptFile::ResourceType::FileBased)
@@ -1881,7 +1910,7 @@ DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const File& targetFil
 	if (auto xml = XmlDocument::parse(parameterFile))
 		pTree = ValueTree::fromXml(*xml);
 	
-	init(new snex::ui::WorkbenchData::DefaultCodeProvider(wb.get(), targetFile), pTree, sp);
+	init(cm, new snex::ui::WorkbenchData::DefaultCodeProvider(wb.get(), targetFile), pTree, sp);
 }
 
 struct EmbeddedSnippetCodeProvider: public snex::ui::WorkbenchData::CodeProvider
@@ -1910,7 +1939,7 @@ struct EmbeddedSnippetCodeProvider: public snex::ui::WorkbenchData::CodeProvider
 	ExternalScriptFile::Ptr ef;
 };
 
-DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, 
+DspNetwork::CodeManager::Entry::Entry(CodeManager& cm, const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, 
 	ProcessorWithScriptingContent* sp):
 	type(t),
     resourceType(ExternalScriptFile::ResourceType::EmbeddedInSnippet)
@@ -1922,7 +1951,7 @@ DspNetwork::CodeManager::Entry::Entry(const Identifier& t, const ExternalScriptF
 	if(auto xml = XmlDocument::parse(parameterExternalFile->getFileDocument().getAllContent()))
 		pTree = ValueTree::fromXml(*xml);
 
-	init(new EmbeddedSnippetCodeProvider(embeddedFile), pTree, sp);
+	init(cm, new EmbeddedSnippetCodeProvider(embeddedFile), pTree, sp);
 }
 
 void DspNetwork::CodeManager::Entry::parameterAddedOrRemoved(ValueTree, bool)
@@ -1950,10 +1979,11 @@ void DspNetwork::CodeManager::Entry::updateFile()
 	}
 }
 
-DspNetwork::CodeManager::SnexSourceCompileHandler::SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_) :
+DspNetwork::CodeManager::SnexSourceCompileHandler::SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_, CodeManager& manager_) :
 	Thread("SNEX Compile Thread", HISE_DEFAULT_STACK_SIZE),
 	CompileHandler(d),
 	ControlledObject(sp_->getMainController_()),
+	manager(manager_),
 	sp(sp_)
 {
 
@@ -1983,6 +2013,9 @@ bool DspNetwork::CodeManager::SnexSourceCompileHandler::triggerCompilation()
 	if (currentThread == MainController::KillStateHandler::TargetThread::SampleLoadingThread ||
 		currentThread == MainController::KillStateHandler::TargetThread::ScriptingThread)
 	{
+		if (manager.deferCompilation(getParent()))
+			return false;
+
 		getParent()->handleCompilation();
 		return true;
 	}
@@ -1990,6 +2023,102 @@ bool DspNetwork::CodeManager::SnexSourceCompileHandler::triggerCompilation()
 	startThread();
 	return false;
 }
+
+struct DspNetwork::CodeManager::CompileJob : public ThreadPoolJob
+{
+	CompileJob(snex::ui::WorkbenchData::Ptr wb_, const String& code_) :
+		ThreadPoolJob("SNEX Compile Job"),
+		wb(wb_),
+		code(code_)
+	{}
+
+	JobStatus runJob() override
+	{
+		wb->compileWithoutNotification(code);
+		return jobHasFinished;
+	}
+
+	snex::ui::WorkbenchData::Ptr wb;
+	const String code;
+};
+
+DspNetwork::CodeManager::ScopedParallelCompilation::ScopedParallelCompilation(CodeManager& cm) :
+	parent(cm)
+{
+	ScopedLock sl(parent.deferLock);
+
+	// Only one thread can defer the compilation at a time, nested scopes on other threads will compile synchronously
+	if (parent.deferDepth == 0)
+		parent.deferringThread = std::this_thread::get_id();
+
+	if (parent.deferringThread == std::this_thread::get_id())
+		parent.deferDepth++;
+}
+
+DspNetwork::CodeManager::ScopedParallelCompilation::~ScopedParallelCompilation()
+{
+	ReferenceCountedArray<snex::ui::WorkbenchData> list;
+
+	{
+		ScopedLock sl(parent.deferLock);
+
+		if (parent.deferringThread != std::this_thread::get_id() || --parent.deferDepth > 0)
+			return;
+
+		parent.deferringThread = {};
+		list.swapWith(parent.pendingWorkbenches);
+	}
+
+	// compile without holding the lock so that other threads can compile synchronously in the meantime
+	parent.compilePendingWorkbenches(list);
+}
+
+bool DspNetwork::CodeManager::deferCompilation(snex::ui::WorkbenchData::Ptr wb)
+{
+	ScopedLock sl(deferLock);
+
+	if (deferDepth > 0 && deferringThread == std::this_thread::get_id())
+	{
+		pendingWorkbenches.addIfNotAlreadyThere(wb);
+		return true;
+	}
+
+	return false;
+}
+
+void DspNetwork::CodeManager::compilePendingWorkbenches(const ReferenceCountedArray<snex::ui::WorkbenchData>& list)
+{
+	OwnedArray<CompileJob> jobs;
+
+	// The preprocessors might access the nodes, so we need to call them on this thread
+	for (auto wb : list)
+	{
+		String code;
+
+		if (wb->createCodeToCompile(code))
+			jobs.add(new CompileJob(wb, code));
+	}
+
+	if (jobs.size() > 1)
+	{
+		if (compilePool == nullptr)
+			compilePool = new ThreadPool(jlimit(1, 8, SystemStats::getNumCpus() - 1), HISE_DEFAULT_STACK_SIZE);
+
+		for (auto j : jobs)
+			compilePool->addJob(j, false);
+
+		for (auto j : jobs)
+			compilePool->waitForJobToFinish(j, -1);
+	}
+	else
+	{
+		for (auto j : jobs)
+			j->runJob();
+	}
+
+	for (auto j : jobs)
+		j->wb->sendCompileNotifications();
+}
 #endif
 
 DeprecationChecker::DeprecationChecker(DspNetwork* n_, ValueTree v_) :
@@ -2328,6 +2457,13 @@ void DspNetwork::ProjectNodeHolder::process(ProcessDataDyn& data)
 	n.process(data);
 }
 
+void DspNetwork::ProjectNodeHolder::processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices)
+{
+	NodeProfiler np(network.getRootNode(), numVoices > 0 ? voiceData[0]->getNumSamples() : 0);
+
+	n.processVoices(voiceIndexes, voiceData, numVoices);
+}
+
 void DspNetwork::ProjectNodeHolder::init(dll::ProjectDll::Ptr dllToUse)
 {
 	dll = dllToUse;
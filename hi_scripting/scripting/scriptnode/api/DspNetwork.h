@@ -326,7 +326,7 @@ public:
 				JUCE_DECLARE_WEAK_REFERENCEABLE(SnexCompileListener);
 			};
 
-			SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_);;
+			SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_, CodeManager& manager_);;
 
             ~SnexSourceCompileHandler();
 
@@ -360,6 +360,8 @@ public:
 
 			std::atomic<bool> runTestNext = false;
 
+			CodeManager& manager;
+
 			ScopedPointer<TestBase> test;
 
 			ProcessorWithScriptingContent* sp;
@@ -369,6 +371,26 @@ public:
 			Array<WeakReference<SnexCompileListener>> compileListeners;
 		};
 
+		/** Defers the compilation of all SNEX sources that are triggered on the current thread
+			and compiles them in parallel when the last scope goes out of scope. 
+			
+			This is used when a network is loaded or prepared so that multiple SNEX nodes don't 
+			block each other and nodes that share a class are only compiled once. */
+		struct ScopedParallelCompilation
+		{
+			ScopedParallelCompilation(CodeManager& cm);
+			~ScopedParallelCompilation();
+
+		private:
+
+			CodeManager& parent;
+
+			JUCE_DECLARE_NON_COPYABLE(ScopedParallelCompilation);
+		};
+
+		/** Adds the workbench to the pending compilations if the current thread is deferring the compilation. */
+		bool deferCompilation(snex::ui::WorkbenchData::Ptr wb);
+
 		snex::ui::WorkbenchData::Ptr getOrCreate(const Identifier& typeId, const Identifier& classId);
 
 		ValueTree getParameterTree(const Identifier& typeId, const Identifier& classId);
@@ -377,11 +399,22 @@ public:
 
 	private:
 
+		struct CompileJob;
+
+		void compilePendingWorkbenches(const ReferenceCountedArray<snex::ui::WorkbenchData>& list);
+
+		// guards the deferring thread, the depth and the pending workbenches
+		CriticalSection deferLock;
+		std::thread::id deferringThread;
+		int deferDepth = 0;
+		ReferenceCountedArray<snex::ui::WorkbenchData> pendingWorkbenches;
+		ScopedPointer<ThreadPool> compilePool;
+
 		struct Entry
 		{
-			Entry(const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp);
+			Entry(CodeManager& cm, const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp);
 
-			Entry(const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, ProcessorWithScriptingContent* sp);
+			Entry(CodeManager& cm, const Identifier& t, const ExternalScriptFile::Ptr& embeddedFile, ProcessorWithScriptingContent* sp);
 
 			const Identifier type;
 			const File parameterFile;
@@ -400,12 +433,13 @@ public:
 
 			ExternalScriptFile::ResourceType resourceType;
 
-			void init(snex::ui::WorkbenchData::CodeProvider* codeProvider, const ValueTree& pTree, ProcessorWithScriptingContent* sp)
+			void init(CodeManager& cm, snex::ui::WorkbenchData::CodeProvider* codeProvider, const ValueTree& pTree, ProcessorWithScriptingContent* sp)
 			{
 				cp = codeProvider;
 				wb = new snex::ui::WorkbenchData();
 				wb->setCodeProvider(cp, dontSendNotification);
-				wb->setCompileHandler(new SnexSourceCompileHandler(wb.get(), sp));
+				wb->setCompileHandler(new SnexSourceCompileHandler(wb.get(), sp, cm));
+				wb->setUseTieredCompilation(SNEX_ENABLE_TIERED_COMPILATION);
 
 				parameterTree = pTree;
 
@@ -484,6 +518,18 @@ public:
 
 	void process(AudioSampleBuffer& b, HiseEventBuffer* e);
 
+	/** Returns true if the network can render multiple voices at once.
+
+		This is the case if the network is frozen and the compiled root container is a 
+		container::voice_batch (the C++ exporter uses it for the root of polyphonic networks).
+	*/
+	bool canProcessVoices() const;
+
+	/** Renders the given voices with a single call. voiceData[i] must point to the audio data 
+		for the voice with the index voiceIndexes[i]. Returns false if the voices must be rendered
+		one by one with process(). */
+	bool processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices);
+
 	bool isPolyphonic() const { return isPoly; }
 
 	bool hasTail() const;
@@ -856,6 +902,8 @@ private:
 
 		void process(ProcessDataDyn& data);
 
+		void processVoices(const int* voiceIndexes, ProcessDataDyn** voiceData, int numVoices);
+
 		bool handleModulation(double& modValue);
 
 		void setEnabled(bool shouldBeEnabled);
@@ -493,6 +493,12 @@ String NodeBase::getCpuUsageInPercent() const
 		auto bufferDuration = (double)lastSpecs.blockSize / lastSpecs.sampleRate;
 		auto bufferRatio = secondPerBuffer / bufferDuration;
 		s << " - " << String(bufferRatio * 100.0, 1) << "%";
+
+		if (referenceCpuUsage > 0.0)
+		{
+			auto savedRatio = (referenceCpuUsage - cpuUsage) * 0.001 / bufferDuration;
+			s << " (" << String(savedRatio * 100.0, 1) << "% saved)";
+		}
 	}
 
 	return s;
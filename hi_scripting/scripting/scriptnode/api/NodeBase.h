@@ -428,6 +428,10 @@ public:
 
 	String getCpuUsageInPercent() const;
 
+	/** Sets the CPU usage before an optimisation was applied (eg. a specialised SNEX compilation)
+		so that the saved CPU is shown next to the current CPU usage. Pass 0.0 to clear it. */
+	void setReferenceCpuUsage(double referenceUsage) { referenceCpuUsage = referenceUsage; }
+
 	bool isClone() const;
 
 	void setEmbeddedNetwork(NodeBase::Holder* n);
@@ -481,6 +485,7 @@ private:
 	WeakReference<NodeBase::Holder> subHolder;
 	
 	double cpuUsage = 0.0;
+	double referenceCpuUsage = 0.0;
 
 	bool isCurrentlyMoved = false;
 
@@ -541,6 +541,25 @@ juce::Rectangle<int> ParallelNode::getPositionInCanvas(Point<int> topLeft) const
 	return getBoundsToDisplay(getContainerPosition(false, topLeft));
 }
 
+void ParallelNode::initCrossBranchCheck()
+{
+	connectionListener.setTypesToWatch({ PropertyIds::Nodes, PropertyIds::ModulationTargets, PropertyIds::Connections, PropertyIds::SwitchTargets });
+	connectionListener.setCallback(getNodeTree(), valuetree::AsyncMode::Synchronously, [this](ValueTree, bool)
+	{
+		updateCrossBranchConnections();
+	});
+
+	connectionPropertyListener.setCallback(getNodeTree(), { PropertyIds::NodeId, PropertyIds::Value }, valuetree::AsyncMode::Synchronously, [this](ValueTree v, Identifier id)
+	{
+		if (id == PropertyIds::NodeId || (v.hasType(PropertyIds::Property) && v[PropertyIds::ID].toString() == PropertyIds::Connection.toString()))
+			updateCrossBranchConnections();
+	});
+}
+
+void ParallelNode::updateCrossBranchConnections()
+{
+	crossBranchConnections.store(cppgen::ValueTreeIterator::hasCrossBranchConnections(getValueTree()));
+}
 
 NodeContainerFactory::NodeContainerFactory(DspNetwork* parent) :
 	NodeFactory(parent)
@@ -249,6 +249,25 @@ public:
 	{
 		return forEachNode(f);
 	}
+
+protected:
+
+	/** Starts watching the connections of the child nodes. Call this in the constructor of containers that
+		can process their branches concurrently. */
+	void initCrossBranchCheck();
+
+	/** Checks whether a node in one branch modulates or sends a signal to a node in another branch
+		(or whether multiple branches target the same node). */
+	void updateCrossBranchConnections();
+
+	/** Returns true if the branches depend on each other and must be processed serially. */
+	bool hasCrossBranchConnections() const noexcept { return crossBranchConnections.load(); }
+
+private:
+
+	valuetree::RecursiveTypedChildListener connectionListener;
+	valuetree::RecursivePropertyListener connectionPropertyListener;
+	std::atomic<bool> crossBranchConnections = { false };
 };
 
 class NodeContainerFactory : public NodeFactory
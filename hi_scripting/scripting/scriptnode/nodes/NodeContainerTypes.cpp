@@ -99,9 +99,15 @@ void ChainNode::handleHiseEvent(HiseEvent& e)
 }
 
 SplitNode::SplitNode(DspNetwork* root, ValueTree data) :
-	ParallelNode(root, data)
+	ParallelNode(root, data),
+	parallel(PropertyIds::Parallel, false)
 {
 	initListeners();
+
+	parallel.initialise(this);
+	parallel.setAdditionalCallback(BIND_MEMBER_FUNCTION_2(SplitNode::updateParallel));
+
+	initCrossBranchCheck();
 }
 
 void SplitNode::prepare(PrepareSpecs ps)
@@ -114,6 +120,108 @@ void SplitNode::prepare(PrepareSpecs ps)
 		DspHelpers::increaseBuffer(original, ps);
 		DspHelpers::increaseBuffer(workBuffer, ps);
 	}
+
+	prepareParallelBuffers(ps);
+	updateCrossBranchConnections();
+}
+
+void SplitNode::updateParallel(Identifier id, var newValue)
+{
+	if (id == PropertyIds::Value)
+	{
+		SimpleReadWriteLock::ScopedWriteLock sl(getRootNetwork()->getConnectionLock());
+		prepareParallelBuffers(lastSpecs);
+	}
+}
+
+void SplitNode::prepareParallelBuffers(PrepareSpecs ps)
+{
+	if (!parallel.getValue() || ps.blockSize <= 1)
+		return;
+
+	if (workers == nullptr)
+		workers = new SharedResourcePointer<RealtimeWorkerGroup>();
+
+	ps.numChannels *= jmax(1, nodes.size());
+	DspHelpers::increaseBuffer(parallelBuffers, ps);
+}
+
+bool SplitNode::processParallel(ProcessDataDyn& data)
+{
+	const int numNodes = nodes.size();
+	const int numSamples = data.getNumSamples();
+	const int numChannels = data.getNumChannels();
+	const int numPerNode = numSamples * numChannels;
+
+	// the active nodes are stored in a bitmask
+	if (workers == nullptr || !parallel.getValue() || numNodes < 2 || numNodes > 64)
+		return false;
+
+	// the branches would race if they modulate each other
+	if (hasCrossBranchConnections())
+		return false;
+
+	if (parallelBuffers.size() < numNodes * numPerNode)
+		return false;
+
+	uint64 activeNodes = 0;
+	int firstIndex = -1;
+
+	for (int i = 0; i < numNodes; i++)
+	{
+		if (!nodes.getUnchecked(i).get()->isBypassed())
+		{
+			activeNodes |= (uint64)1 << i;
+
+			if (firstIndex == -1)
+				firstIndex = i;
+		}
+	}
+
+	auto f = [&](int index)
+	{
+		if ((activeNodes & ((uint64)1 << index)) == 0)
+			return;
+
+		auto n = nodes.getUnchecked(index).get();
+
+		if (index == firstIndex)
+		{
+			n->process(data);
+			return;
+		}
+
+		float* ptrs[NUM_MAX_CHANNELS];
+		auto b = parallelBuffers.begin() + index * numPerNode;
+
+		FloatVectorOperations::copy(b, original.begin(), numPerNode);
+
+		for (int c = 0; c < numChannels; c++)
+			ptrs[c] = b + c * numSamples;
+
+		ProcessDataDyn cp(ptrs, numSamples, numChannels);
+		cp.copyNonAudioDataFrom(data);
+		n->process(cp);
+	};
+
+	(*workers)->execute(numNodes, f);
+
+	// sum up in the same order as the serial processing
+	for (int i = 0; i < numNodes; i++)
+	{
+		if (i == firstIndex || (activeNodes & ((uint64)1 << i)) == 0)
+			continue;
+
+		auto b = parallelBuffers.begin() + i * numPerNode;
+
+		for (auto& c : data)
+		{
+			FloatVectorOperations::add(c.getRawWritePointer(), b, numSamples);
+			b += numSamples;
+		}
+	}
+
+	return true;
 }
 
 void SplitNode::handleHiseEvent(HiseEvent& e)
@@ -153,6 +261,9 @@ void SplitNode::process(ProcessDataDyn& data)
 			wptr += numSamples;
 		}
 	}
+
+	if (processParallel(data))
+		return;
 	
 	int channelCounter = 0;
 
@@ -484,9 +595,58 @@ template class FixedBlockNode<128>;
 template class FixedBlockNode<256>;
 
 MultiChannelNode::MultiChannelNode(DspNetwork* root, ValueTree data) :
-	ParallelNode(root, data)
+	ParallelNode(root, data),
+	parallel(PropertyIds::Parallel, false)
 {
 	initListeners();
+
+	parallel.initialise(this);
+	parallel.setAdditionalCallback(BIND_MEMBER_FUNCTION_2(MultiChannelNode::updateParallel));
+
+	initCrossBranchCheck();
+}
+
+void MultiChannelNode::updateParallel(Identifier id, var newValue)
+{
+	if (id == PropertyIds::Value && (bool)newValue && workers == nullptr)
+	{
+		SimpleReadWriteLock::ScopedWriteLock sl(getRootNetwork()->getConnectionLock());
+		workers = new SharedResourcePointer<RealtimeWorkerGroup>();
+	}
+}
+
+bool MultiChannelNode::processParallel(ProcessDataDyn& d)
+{
+	const int numNodes = nodes.size();
+
+	if (workers == nullptr || !parallel.getValue() || numNodes < 2 || hasCrossBranchConnections())
+		return false;
+
+	auto f = [&](int index)
+	{
+		int startChannel = 0;
+
+		for (int i = 0; i < index; i++)
+			startChannel += nodes.getUnchecked(i).get()->getCurrentChannelAmount();
+
+		auto n = nodes.getUnchecked(index).get();
+		auto numChannelsThisTime = n->getCurrentChannelAmount();
+
+		if (startChannel + numChannelsThisTime > d.getNumChannels())
+			return;
+
+		float* channelData[NUM_MAX_CHANNELS];
+
+		for (int i = 0; i < numChannelsThisTime; i++)
+			channelData[i] = d[startChannel + i].data;
+
+		ProcessDataDyn td(channelData, d.getNumSamples(), numChannelsThisTime);
+		td.copyNonAudioDataFrom(d);
+		n->process(td);
+	};
+
+	(*workers)->execute(numNodes, f);
+	return true;
 }
 
 void MultiChannelNode::channelLayoutChanged(NodeBase* nodeThatCausedLayoutChange)
@@ -540,6 +700,8 @@ void MultiChannelNode::prepare(PrepareSpecs ps)
 		channelRanges[i] = { startChannel, endChannel };
 		channelIndex += numChannelsThisTime;
 	}
+
+	updateCrossBranchConnections();
 }
 
 void MultiChannelNode::reset()
@@ -579,6 +741,9 @@ void MultiChannelNode::process(ProcessDataDyn& d)
 	NodeProfiler np(this, d.getNumSamples());
     ProcessDataPeakChecker pd(this, d);
     TRACE_DSP();
+
+	if (processParallel(d))
+		return;
     
 	int channelIndex = 0;
 
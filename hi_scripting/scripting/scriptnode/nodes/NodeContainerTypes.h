@@ -819,8 +819,23 @@ public:
 	void processMonoFrame(MonoFrameType& data) final override;
 	void processStereoFrame(StereoFrameType& data) final override;
 
+	void updateParallel(Identifier id, var newValue);
+
 	heap<float> original, workBuffer;
-	
+
+private:
+
+	/** Processes the children concurrently if the Parallel property is enabled. Returns false if the children
+		must be processed serially (eg. because the buffers haven't been prepared yet). */
+	bool processParallel(ProcessDataDyn& data);
+
+	void prepareParallelBuffers(PrepareSpecs ps);
+
+	NodePropertyT<bool> parallel;
+	ScopedPointer<SharedResourcePointer<RealtimeWorkerGroup>> workers;
+
+	// one slice per child so that they can be processed concurrently
+	heap<float> parallelBuffers;
 };
 
 
@@ -842,8 +857,18 @@ public:
 
 	void channelLayoutChanged(NodeBase* nodeThatCausedLayoutChange) override;
 
+	void updateParallel(Identifier id, var newValue);
+
 	float* currentChannelData[NUM_MAX_CHANNELS];
 	Range<int> channelRanges[NUM_MAX_CHANNELS];
+
+private:
+
+	/** Processes the children concurrently if the Parallel property is enabled. */
+	bool processParallel(ProcessDataDyn& d);
+
+	NodePropertyT<bool> parallel;
+	ScopedPointer<SharedResourcePointer<RealtimeWorkerGroup>> workers;
 };
 
 class BranchNode : public ParallelNode
@@ -235,6 +235,16 @@ struct snex_node : public SnexSource
 
 		data::filter_base* getFilterDataObject() const override { return filterHandler.get(); }
 
+		Array<FunctionData*> getCompiledCallbacks() override
+		{
+			Array<FunctionData*> list;
+
+			for (auto& cf : f)
+				list.add(&cf);
+
+			return list;
+		}
+
 		double getPlotValue(bool getMagnitude, double fNorm)
 		{
 			jassert(plotDefined);
@@ -95,6 +95,8 @@ struct SnexOscillator : public SnexSource
 
 		void prepare(PrepareSpecs ps);
 
+		Array<FunctionData*> getCompiledCallbacks() override { return { &processFunction, &prepareFunction }; }
+
 		double lastDelta = 0.0;
 		//FunctionData tickFunction;
 		FunctionData processFunction;
@@ -124,6 +124,11 @@ struct dynamic : public SnexSource,
 				prepareFunc.callVoidUncheckedWithObject(&lastSpecs);
 		}
 
+		Array<FunctionData*> getCompiledCallbacks() override
+		{
+			return { &prepareFunc, &resetFunc, &processFunction, &processFrameFunction };
+		}
+
 		PrepareSpecs lastSpecs;
 
 		FunctionData prepareFunc;
@@ -48,7 +48,49 @@ void* SnexSource::SnexTestBaseHelper::getNodeWorkbench(NodeBase* node)
 
 void SnexSource::recompiled(WorkbenchData::Ptr wb)
 {
-	getCallbackHandler().reset();
+	{
+		// Hold the access locks of all handlers while swapping the compiled object so that 
+		// the audio thread either runs the old or the new callbacks but never skips a block.
+		SimpleReadWriteLock::ScopedWriteLock cl(getCallbackHandler().getAccessLock());
+		SimpleReadWriteLock::ScopedWriteLock pl(getParameterHandler().getAccessLock());
+		SimpleReadWriteLock::ScopedWriteLock dl(getComplexDataHandler().getAccessLock());
+
+		swapCompiledObject(wb);
+	}
+
+	throwScriptnodeErrorIfCompileFail();
+
+	if (!lastResult.wasOk())
+		getWorkbench()->getLastResultReference().compileResult = lastResult;
+		
+	for (auto l : compileListeners)
+	{
+		if(l != nullptr)
+			l->wasCompiled(lastResult.wasOk());
+	}
+}
+
+void SnexSource::swapCompiledObject(WorkbenchData::Ptr wb)
+{
+	// The specialised functions belong to the old code
+	specialiser.clear();
+
+	auto r = wb->getLastResult();
+
+	// The optimized version of the running code can be swapped in without resetting the object
+	if (r.optimized && !compiledOptimized && r.generation == compiledGeneration && upgradeCompiledObject(wb))
+	{
+		compiledOptimized = true;
+
+		statistics.optimized = true;
+		statistics.optimizedCompileTimeMs = r.compileTimeMs;
+
+		if (getParentNode()->getRootNetwork()->getCpuProfileFlag())
+			statistics.fastCpuUsage = getParentNode()->getCpuFlag();
+
+		return;
+	}
+
 	getParameterHandler().reset();
 	getComplexDataHandler().reset();
 
@@ -71,7 +113,14 @@ void SnexSource::recompiled(WorkbenchData::Ptr wb)
 
 	throwScriptnodeErrorIfCompileFail();
 
-	if (auto objPtr = wb->getLastResult().mainClassPtr)
+	auto objPtr = wb->getLastResult().mainClassPtr;
+
+	// The callback handler is not reset before so that the audio thread
+	// doesn't skip the callbacks until they are replaced.
+	if (!lastResult.wasOk() || objPtr == nullptr)
+		getCallbackHandler().reset();
+
+	if (objPtr != nullptr)
 	{
 		objPtr->initialiseObjectStorage(object);
 
@@ -95,19 +144,103 @@ void SnexSource::recompiled(WorkbenchData::Ptr wb)
 		if (lastResult.wasOk())
 			lastResult = getComplexDataHandler().recompiledOk(objPtr);
 
+		if (!lastResult.wasOk())
+			getCallbackHandler().reset();
+
 		lastCompiledObject = getWorkbench()->getLastJitObject();
+		compiledChannelCount = wb->getNumChannels();
+		compiledObjectSize = objPtr->getRequiredByteSize();
+		compiledGeneration = r.generation;
+		compiledOptimized = r.optimized;
+
+		statistics = {};
+		statistics.optimized = r.optimized;
+
+		if (r.optimized)
+			statistics.optimizedCompileTimeMs = r.compileTimeMs;
+		else
+			statistics.fastCompileTimeMs = r.compileTimeMs;
 	}
+}
 
-	throwScriptnodeErrorIfCompileFail();
+bool SnexSource::upgradeCompiledObject(WorkbenchData::Ptr wb)
+{
+	auto objPtr = wb->getLastResult().mainClassPtr;
+	auto newObject = wb->getLastJitObject();
 
-	if (!lastResult.wasOk())
-		getWorkbench()->getLastResultReference().compileResult = lastResult;
-		
-	for (auto l : compileListeners)
+	if (!lastResult.wasOk() || !lastCompiledObject || !newObject || objPtr == nullptr)
+		return false;
+
+	if (compiledChannelCount != wb->getNumChannels() || compiledObjectSize != objPtr->getRequiredByteSize())
+		return false;
+
+	HashMap<void*, void*> functionMap;
+
+	for (const auto& id : lastCompiledObject.getFunctionIds())
 	{
-		if(l != nullptr)
-			l->wasCompiled(lastResult.wasOk());
+		auto of = lastCompiledObject[id];
+		auto nf = newObject[id];
+
+		if (of.function != nullptr && nf.function != nullptr)
+			functionMap.set(of.function, nf.function);
+	}
+
+	Array<FunctionData*> callbacks;
+	callbacks.addArray(getCallbackHandler().getCompiledCallbacks());
+	callbacks.addArray(getParameterHandler().getCompiledCallbacks());
+	callbacks.addArray(getComplexDataHandler().getCompiledCallbacks());
+
+	// Every function must be replaced, otherwise it would call into the old code
+	for (auto f : callbacks)
+	{
+		if (f->function != nullptr && !functionMap.contains(f->function))
+			return false;
+	}
+
+	for (auto f : callbacks)
+	{
+		if (f->function != nullptr)
+			f->function = functionMap[f->function];
+	}
+
+	lastCompiledObject = newObject;
+	wb->getLastResultReference().setDataPtrForDebugging(object.getObjectPtr());
+
+	return true;
+}
+
+String SnexSource::getStatisticsText()
+{
+	String s;
+
+	s << "Compile time: ";
+
+	if (statistics.fastCompileTimeMs > 0.0)
+		s << String(statistics.fastCompileTimeMs, 1) << "ms (fast)";
+
+	if (statistics.optimized)
+	{
+		if (statistics.fastCompileTimeMs > 0.0)
+			s << " + ";
+
+		s << String(statistics.optimizedCompileTimeMs, 1) << "ms (optimized)";
+	}
+	else
+	{
+		s << ", optimizing...";
 	}
+
+	if (parentNode != nullptr && parentNode->getRootNetwork()->getCpuProfileFlag())
+	{
+		s << "\nCPU: ";
+
+		if (statistics.fastCpuUsage > 0.0)
+			s << String(statistics.fastCpuUsage, 3) << "ms (fast), ";
+
+		s << String(parentNode->getCpuFlag(), 3) << "ms" << (statistics.optimized ? " (optimized)" : " (fast)") << " per buffer";
+	}
+
+	return s;
 }
 
 void SnexSource::throwScriptnodeErrorIfCompileFail()
@@ -422,6 +555,333 @@ void SnexSource::ParameterHandler::addParameterCode(String& code)
 	code << c.toString();
 }
 
+ExternalPreprocessorDefinition::List SnexSource::ParameterHandler::createParameterDefinitions(bool useCurrentValues) const
+{
+	ExternalPreprocessorDefinition::List list;
+
+	for (const auto& p : parameterTree)
+	{
+		auto id = p[PropertyIds::ID].toString();
+		auto index = parameterTree.indexOf(p);
+
+		if (!Identifier::isValidIdentifier(id) || index >= OpaqueNode::NumMaxParameters)
+			continue;
+
+		ExternalPreprocessorDefinition d(ExternalPreprocessorDefinition::Type::Macro);
+		d.name = "PARAMETER_" + id + "(fallback)";
+		d.description = "Inserts the current value of the " + id + " parameter in a specialised compilation.";
+
+		if (useCurrentValues)
+		{
+			auto v = lastValues[index];
+
+			// Use an int literal for integral values so that they can be used for branching
+			if (v == (double)(int)v)
+				d.value = Types::Helpers::getCppValueString(VariableStorage((int)v));
+			else
+				d.value = Types::Helpers::getCppValueString(VariableStorage(v));
+		}
+		else
+		{
+			d.value = "fallback";
+		}
+
+		list.add(d);
+	}
+
+	return list;
+}
+
+void SnexSource::Specialiser::setDelay(Identifier, var newValue)
+{
+	delaySeconds = jmax(0, (int)newValue);
+
+	if (delaySeconds > 0)
+	{
+		startTimer(500);
+	}
+	else
+	{
+		stopTimer();
+		revert();
+	}
+}
+
+void SnexSource::Specialiser::parameterChanged(int index, double oldValue, double newValue)
+{
+	if (oldValue != newValue)
+		lastChange.store(Time::getMillisecondCounter());
+
+	if (remapper.isActive() && specialisedValues[index] != newValue)
+		revert();
+}
+
+void SnexSource::Specialiser::revert()
+{
+	if (remapper.revert(parent.getCallbackHandler().getAccessLock()))
+	{
+		if (auto n = parent.getParentNode())
+			n->setReferenceCpuUsage(0.0);
+	}
+}
+
+void SnexSource::Specialiser::clear()
+{
+	if (remapper.isActive())
+	{
+		if (auto n = parent.getParentNode())
+			n->setReferenceCpuUsage(0.0);
+	}
+
+	remapper.clear(parent.getCallbackHandler().getAccessLock());
+
+	hasFailedValues = false;
+	specialisedObject = {};
+}
+
+bool SnexSource::Specialiser::hasSameLayout(snex::jit::ComplexType::Ptr genericClass, snex::jit::ComplexType::Ptr specialisedClass)
+{
+	if (genericClass == nullptr || specialisedClass == nullptr)
+		return false;
+
+	return layoutsMatch(genericClass->createDataLayout(), specialisedClass->createDataLayout());
+}
+
+bool SnexSource::Specialiser::layoutsMatch(const ValueTree& g, const ValueTree& s)
+{
+	if (g.getType() != s.getType())
+		return false;
+
+	// The default values don't matter because the specialised functions use the existing object
+	for (int i = 0; i < jmax(g.getNumProperties(), s.getNumProperties()); i++)
+	{
+		auto id = g.getPropertyName(i);
+
+		if (id != s.getPropertyName(i))
+			return false;
+
+		if (id != Identifier("default") && g[id] != s[id])
+			return false;
+	}
+
+	// The member functions are not part of the object layout
+	auto isMember = [](const ValueTree& c) { return c.getType() != Identifier("Method"); };
+
+	Array<ValueTree> gc, sc;
+
+	for (auto c : g)
+		if (isMember(c)) gc.add(c);
+
+	for (auto c : s)
+		if (isMember(c)) sc.add(c);
+
+	if (gc.size() != sc.size())
+		return false;
+
+	for (int i = 0; i < gc.size(); i++)
+	{
+		if (!layoutsMatch(gc[i], sc[i]))
+			return false;
+	}
+
+	return true;
+}
+
+bool SnexSource::Specialiser::Remapper::add(FunctionData* f, void* specialisedFunction)
+{
+	if (numRemaps == NumMaxRemaps)
+		return false;
+
+	remaps[numRemaps++] = { f, f->function, specialisedFunction };
+	return true;
+}
+
+void SnexSource::Specialiser::Remapper::activate()
+{
+	for (int i = 0; i < numRemaps; i++)
+		remaps[i].f->function = remaps[i].specialised;
+
+	active = true;
+}
+
+bool SnexSource::Specialiser::Remapper::revert(SimpleReadWriteLock& lock)
+{
+	bool holdsLock = lock.enterTryReadLock();
+
+	if (holdsLock || lock.writer == std::this_thread::get_id())
+	{
+		auto wasActive = active.exchange(false);
+
+		if (wasActive)
+			revertInternal();
+
+		lock.exitReadLock(holdsLock);
+		return wasActive;
+	}
+
+	// Another thread swaps the callbacks, so it has to revert after releasing the lock
+	pending = true;
+	return false;
+}
+
+void SnexSource::Specialiser::Remapper::clear(SimpleReadWriteLock& lock)
+{
+	// This waits until a revert on another thread has released its read lock
+	SimpleReadWriteLock::ScopedWriteLock sl(lock);
+
+	if (active.exchange(false))
+		revertInternal();
+
+	numRemaps = 0;
+	pending = false;
+}
+
+void SnexSource::Specialiser::Remapper::revertInternal()
+{
+	// The regular and the specialised functions operate on the same object
+	// so we can just write back the function pointers.
+	for (int i = 0; i < numRemaps; i++)
+		remaps[i].f->function = remaps[i].generic;
+}
+
+bool SnexSource::Specialiser::valuesMatch(const double* values) const
+{
+	auto& ph = parent.getParameterHandler();
+
+	for (int i = 0; i < ph.getNumParameters(); i++)
+	{
+		if (ph.getLastValue(i) != values[i])
+			return false;
+	}
+
+	return true;
+}
+
+void SnexSource::Specialiser::timerCallback()
+{
+	// A revert from the audio thread couldn't write the function pointers
+	if (remapper.hasPendingRevert())
+		revert();
+
+	if (remapper.isActive() || delaySeconds == 0)
+		return;
+
+	auto msSinceLastChange = Time::getMillisecondCounter() - lastChange.load();
+
+	if (msSinceLastChange < (uint32)delaySeconds * 1000)
+		return;
+
+	// Don't try again until the parameters or the code change
+	if (hasFailedValues && valuesMatch(failedValues))
+		return;
+
+	auto r = specialise();
+
+	if (!r.wasOk())
+	{
+		auto& ph = parent.getParameterHandler();
+
+		for (int i = 0; i < ph.getNumParameters(); i++)
+			failedValues[i] = ph.getLastValue(i);
+
+		hasFailedValues = true;
+	}
+}
+
+Result SnexSource::Specialiser::specialise()
+{
+	auto wb = parent.getWorkbench();
+	auto& ph = parent.getParameterHandler();
+
+	if (wb == nullptr || !parent.lastResult.wasOk() || wb->getGlobalScope().isDebugModeEnabled())
+		return Result::fail("No valid compilation");
+
+	// Wait until the optimized version was swapped in
+	if (!parent.compiledOptimized)
+		return Result::ok();
+
+	auto genericClass = wb->getLastResult().mainClassPtr;
+
+	if (genericClass == nullptr || !parent.lastCompiledObject || ph.getNumParameters() == 0)
+		return Result::fail("Nothing to specialise");
+
+	String code;
+
+	if (!wb->createCodeToCompile(code))
+		return Result::fail("Can't create code");
+
+	// Store the values before compiling so that a change during the compilation is detected
+	double compiledValues[OpaqueNode::NumMaxParameters];
+
+	for (int i = 0; i < ph.getNumParameters(); i++)
+		compiledValues[i] = ph.getLastValue(i);
+
+	auto cc = wb->getCompileHandler()->createCompiler();
+	cc->setPreprocessorDefinitions(ph.createParameterDefinitions(true));
+
+	auto newObject = cc->compileJitObject(code);
+
+	if (!cc->getCompileResult().wasOk())
+		return cc->getCompileResult();
+
+	int voiceAmount = 1;
+
+	if (auto polyHandler = wb->getGlobalScope().getPolyHandler())
+		if (polyHandler->isEnabled())
+			voiceAmount = NUM_POLYPHONIC_VOICES;
+
+	auto newClass = cc->getComplexType(NamespacedIdentifier(wb->getInstanceId()), { TemplateParameter(voiceAmount) }, true);
+
+	// The specialised functions use the existing object so the layout must not change
+	if (!hasSameLayout(genericClass, newClass))
+		return Result::fail("Object layout mismatch");
+
+	HashMap<void*, void*> functionMap;
+
+	for (const auto& id : parent.lastCompiledObject.getFunctionIds())
+	{
+		auto gf = parent.lastCompiledObject[id];
+		auto sf = newObject[id];
+
+		if (gf.function != nullptr && sf.function != nullptr)
+			functionMap.set(gf.function, sf.function);
+	}
+
+	{
+		auto& cb = parent.getCallbackHandler();
+
+		SimpleReadWriteLock::ScopedWriteLock sl(cb.getAccessLock());
+
+		remapper.clear(cb.getAccessLock());
+
+		for (auto f : cb.getCompiledCallbacks())
+		{
+			if (functionMap.contains(f->function))
+				remapper.add(f, functionMap[f->function]);
+		}
+
+		if (remapper.getNumRemaps() == 0)
+			return Result::fail("No callbacks to specialise");
+
+		specialisedObject = newObject;
+
+		memcpy(specialisedValues, compiledValues, sizeof(double)*ph.getNumParameters());
+
+		auto n = parent.getParentNode();
+
+		if (n->getRootNetwork()->getCpuProfileFlag())
+			n->setReferenceCpuUsage(n->getCpuFlag());
+
+		remapper.activate();
+	}
+
+	// A parameter might have changed during the compilation or while holding the lock
+	if (remapper.hasPendingRevert() || !valuesMatch(specialisedValues))
+		revert();
+
+	return Result::ok();
+}
+
 Result SnexSource::ComplexDataHandler::recompiledOk(snex::jit::ComplexType::Ptr objectClass)
 {
 	ExternalData::forEachType([this, objectClass](ExternalData::DataType t)
@@ -1011,6 +1471,14 @@ void SnexMenuBar::parameterChanged(int snexParameterId, double newValue)
 
 }
 
+String SnexMenuBar::getTooltip()
+{
+	if (source != nullptr && source->getWorkbench() != nullptr)
+		return source->getStatisticsText();
+
+	return {};
+}
+
 SnexMenuBar::~SnexMenuBar()
 {
     if(source->getParentNode() == nullptr)
@@ -52,6 +52,19 @@ public:
 	};
 
 
+	/** The compile and run time statistics of the node. */
+	struct CompileStatistics
+	{
+		double fastCompileTimeMs = 0.0;
+		double optimizedCompileTimeMs = 0.0;
+
+		/** The CPU usage in ms per buffer before the optimized version was swapped in. 
+			This is only measured if the CPU profiling of the network is enabled. */
+		double fastCpuUsage = 0.0;
+
+		bool optimized = false;
+	};
+
     enum class ErrorLevel
     {
         Uncompiled,
@@ -106,6 +119,10 @@ public:
 
 		snex::jit::FunctionData getFunctionAsObjectCallback(const String& id, bool checkProcessFunctions=true);
 
+		/** Override this and return the compiled functions that this handler calls. 
+			Their function pointers will be replaced with the specialised or optimized functions. */
+		virtual Array<FunctionData*> getCompiledCallbacks() { return {}; }
+
 		void addObjectPtrToFunction(FunctionData& f);;
 
 		SimpleReadWriteLock& getAccessLock() { return lock; }
@@ -149,6 +166,16 @@ public:
 
 		Result recompiledOk(snex::jit::ComplexType::Ptr objectClass) override;
 
+		Array<FunctionData*> getCompiledCallbacks() override
+		{
+			Array<FunctionData*> list;
+
+			for (int i = 0; i < numParameters; i++)
+				list.add(&pFunctions[i]);
+
+			return list;
+		}
+
 		void setParameterDynamic(int index, double v)
 		{
 			lastValues[index] = v;
@@ -171,6 +198,126 @@ public:
 
 	virtual SnexTestBase* createTester() = 0;
 
+	/** Compiles a specialised version of the code with the current parameter values as
+		constants once the parameters haven't changed for the given delay.
+
+		The parameter values are inserted using a macro for each parameter:
+
+		@code
+		float process(float input) { return input * (float)PARAMETER_Gain(gain); }
+		@endcode
+
+		The regular compilation replaces the macro with the fallback expression, the specialised
+		compilation with the current value so that the optimizer can fold it. The specialised
+		functions share the object with the regular functions, so as soon as a parameter changes,
+		the regular functions are restored without a glitch.
+	*/
+	struct Specialiser : public Timer
+	{
+		/** Swaps the function pointers of the compiled callbacks with the specialised functions.
+		
+			The pointers are only written while holding a read or write lock of the callback
+			handler, so clear() (which needs the write lock) waits for a revert on another thread. 
+		*/
+		struct Remapper
+		{
+			static constexpr int NumMaxRemaps = 32;
+
+			/** Adds a callback that will be swapped with the specialised function. Call this while holding the write lock. */
+			bool add(FunctionData* f, void* specialisedFunction);
+
+			/** Writes the specialised function pointers. Call this while holding the write lock. */
+			void activate();
+
+			/** Restores the regular function pointers and returns true if they were active. 
+			
+				This is lock- and allocation-free. If another thread holds the write lock, the
+				revert is deferred until the writer calls revert() after hasPendingRevert().
+			*/
+			bool revert(SimpleReadWriteLock& lock);
+
+			/** Returns true (and resets the flag) if a revert was deferred. */
+			bool hasPendingRevert() { return pending.exchange(false); }
+
+			/** Reverts and removes all callbacks. */
+			void clear(SimpleReadWriteLock& lock);
+
+			bool isActive() const { return active; }
+
+			int getNumRemaps() const { return numRemaps; }
+
+		private:
+
+			void revertInternal();
+
+			struct Remap
+			{
+				FunctionData* f = nullptr;
+				void* generic = nullptr;
+				void* specialised = nullptr;
+			};
+
+			std::atomic<bool> active = { false };
+			std::atomic<bool> pending = { false };
+
+			Remap remaps[NumMaxRemaps];
+			int numRemaps = 0;
+		};
+
+		Specialiser(SnexSource& p) :
+			parent(p)
+		{
+			memset(specialisedValues, 0, sizeof(double)*OpaqueNode::NumMaxParameters);
+			memset(failedValues, 0, sizeof(double)*OpaqueNode::NumMaxParameters);
+		};
+
+		~Specialiser()
+		{
+			stopTimer();
+		}
+
+		/** Compares the data layout (member types, offsets and sizes) of the regular and the specialised class. */
+		static bool hasSameLayout(snex::jit::ComplexType::Ptr genericClass, snex::jit::ComplexType::Ptr specialisedClass);
+
+		/** Sets the delay in seconds after the last parameter change. 0 disables the specialisation. */
+		void setDelay(Identifier, var newValue);
+
+		/** Called whenever a parameter was set. This might be called from the audio thread. */
+		void parameterChanged(int index, double oldValue, double newValue);
+
+		/** Restores the regular functions. This is lock- and allocation-free. */
+		void revert();
+
+		/** Reverts and releases the specialised code (eg. after a recompilation). */
+		void clear();
+
+		bool isActive() const { return remapper.isActive(); }
+
+		void timerCallback() override;
+
+	private:
+
+		Result specialise();
+
+		bool valuesMatch(const double* values) const;
+
+		static bool layoutsMatch(const ValueTree& g, const ValueTree& s);
+
+		SnexSource& parent;
+
+		int delaySeconds = 0;
+		std::atomic<uint32> lastChange = { 0 };
+
+		Remapper remapper;
+
+		double specialisedValues[OpaqueNode::NumMaxParameters];
+		double failedValues[OpaqueNode::NumMaxParameters];
+		bool hasFailedValues = false;
+
+		// This keeps the specialised functions alive
+		snex::JitObject specialisedObject;
+	};
+
 	struct ParameterHandler : public ParameterHandlerLight
 	{
 		ParameterHandler(SnexSource& s, ObjectStorageType& o) :
@@ -194,6 +341,21 @@ public:
 
 		void addParameterCode(String& code);
 
+		/** Hides the base method so that the specialiser is notified about parameter changes. */
+		void setParameterDynamic(int index, double v)
+		{
+			auto oldValue = lastValues[index];
+			ParameterHandlerLight::setParameterDynamic(index, v);
+			parent.specialiser.parameterChanged(index, oldValue, v);
+		}
+
+		/** Creates a `PARAMETER_[ID](fallback)` macro for each parameter. If useCurrentValues is
+			true, the macro will be replaced with the current value, otherwise with the fallback expression. */
+		ExternalPreprocessorDefinition::List createParameterDefinitions(bool useCurrentValues) const;
+
+		int getNumParameters() const { return numParameters; }
+
+		double getLastValue(int index) const { return lastValues[index]; }
 
 	private:
 
@@ -252,6 +414,8 @@ public:
 			return r;
 		}
 
+		Array<FunctionData*> getCompiledCallbacks() override { return { &externalFunction }; }
+
 	protected:
 
 		snex::jit::FunctionData externalFunction;
@@ -419,7 +583,8 @@ public:
 					holdsLock = p.getAccessLock().enterReadLock();
 			}
 
-			operator bool() { return parent.ok && holdsLock; }
+			// The thread that swaps the callbacks holds the write lock and can call them directly
+			operator bool() { return parent.ok && (holdsLock || parent.getAccessLock().writer == std::this_thread::get_id()); }
 
 			~ScopedCallbackChecker()
 			{
@@ -563,6 +728,7 @@ public:
 
 	SnexSource() :
 		classId(PropertyIds::ClassId, ""),
+		specialiseDelay(PropertyIds::SpecialiseDelay, 0),
 		parameterHandler(*this, object),
 		dataHandler(*this, object),
 		lastResult(Result::fail("uninitialised"))
@@ -586,20 +752,37 @@ public:
 
 		classId.initialise(n);
 		classId.setAdditionalCallback(BIND_MEMBER_FUNCTION_2(SnexSource::updateClassId), true);
+
+		specialiseDelay.initialise(n);
+		specialiseDelay.setAdditionalCallback([this](Identifier id, var newValue) { specialiser.setDelay(id, newValue); }, true);
 	}
 
 	void preCompile() override
 	{
         errorLevel = ErrorLevel::Uncompiled;
-		callbackHandler->reset();
-		parameterHandler.reset();
-		getComplexDataHandler().reset();
+
+		// Keep the old callbacks running while the code is being compiled
+		// unless they were compiled for a different channel amount.
+		if (wb == nullptr || wb->getNumChannels() != compiledChannelCount)
+		{
+			callbackHandler->reset();
+			parameterHandler.reset();
+			getComplexDataHandler().reset();
+		}
 	}
 
     ErrorLevel getErrorLevel() const { return errorLevel; }
     
 	void recompiled(WorkbenchData::Ptr wb) final override;
 
+	/** Replaces the compiled object and the callbacks. This is called while the access locks are held. */
+	void swapCompiledObject(WorkbenchData::Ptr wb);
+
+	const CompileStatistics& getCompileStatistics() const { return statistics; }
+
+	/** Returns a text with the compile times and the CPU usage of both compilation tiers. */
+	String getStatisticsText();
+
 	void throwScriptnodeErrorIfCompileFail();
 
 	void logMessage(WorkbenchData::Ptr wb, int level, const String& s) override;
@@ -625,6 +808,9 @@ public:
 
 		parameterHandler.addParameterCode(code);
 
+		if (wb != nullptr)
+			wb->getGlobalScope().setPreprocessorDefinitions(parameterHandler.createParameterDefinitions(false));
+
 		return true;
 	}
 
@@ -838,14 +1024,25 @@ private:
 	ParameterHandler parameterHandler;
 	ComplexDataHandler dataHandler;
 	CallbackHandlerBase* callbackHandler = nullptr;
+	Specialiser specialiser { *this };
+
+	/** Replaces the functions of the fast compilation with the optimized version without resetting the object. */
+	bool upgradeCompiledObject(WorkbenchData::Ptr wb);
 
 	int currentChannelCount = 0;
+	int compiledChannelCount = 0;
+
+	size_t compiledObjectSize = 0;
+	int compiledGeneration = -1;
+	bool compiledOptimized = true;
+	CompileStatistics statistics;
 
 	Result lastResult;
 
 	// This keeps the function alive until recompiled
 	snex::JitObject lastCompiledObject;
 	NodePropertyT<String> classId;
+	NodePropertyT<int> specialiseDelay;
 	snex::ui::WorkbenchData::Ptr wb;
 	WeakReference<NodeBase> parentNode;
 
@@ -891,6 +1088,7 @@ struct SnexComplexDataDisplay : public Component,
 };
 
 struct SnexMenuBar : public ComponentWithMiddleMouseDrag,
+	public TooltipClient,
 	public ButtonListener,
 	public ComboBox::Listener,
 	public SnexSource::SnexSourceListener,
@@ -920,6 +1118,8 @@ struct SnexMenuBar : public ComponentWithMiddleMouseDrag,
 
 	void parameterChanged(int snexParameterId, double newValue) override;
 
+	String getTooltip() override;
+
 	~SnexMenuBar();
 
 	void debugModeChanged(bool isEnabled) override;;
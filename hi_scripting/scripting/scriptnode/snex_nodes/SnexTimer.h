@@ -217,6 +217,8 @@ struct snex_timer : public OptionalSnexSource
 			return Result::ok();
 		}
 
+		Array<FunctionData*> getCompiledCallbacks() override { return { &tc, &resetFunc, &prepareFunc }; }
+
 		PrepareSpecs lastSpecs;
 
 		FunctionData tc;
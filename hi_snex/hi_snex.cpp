@@ -103,6 +103,7 @@ using String = juce::String;
 
 #include "snex_core/snex_jit_JitCompiledFunctionClass.cpp"
 #include "snex_public/snex_jit_JitCompiler.cpp"
+#include "snex_public/snex_jit_CodeCache.cpp"
 
 #include "snex_jit/snex_jit_TemplateClassBuilder.cpp"
 #include "snex_library/snex_CallbackCollection.cpp"
@@ -123,6 +123,24 @@ Set to 1 if you want the memory address to be included in the data dump string.
 #define SNEX_INCLUDE_MEMORY_ADDRESS_IN_DUMP 0
 #endif
 
+/** Config: SNEX_ENABLE_CODE_CACHE
+
+Set to 1 to store the compiled SNEX code in a persistent cache in the app data directory so that
+unchanged nodes don't need to go through the compiler pipeline again. Only works with the MIR backend.
+*/
+#ifndef SNEX_ENABLE_CODE_CACHE
+#define SNEX_ENABLE_CODE_CACHE 0
+#endif
+
+/** Config: SNEX_ENABLE_TIERED_COMPILATION
+
+Set to 1 to compile SNEX nodes with a fast, unoptimized compilation first so that they can run immediately
+and replace them with the optimized version that is compiled in the background.
+*/
+#ifndef SNEX_ENABLE_TIERED_COMPILATION
+#define SNEX_ENABLE_TIERED_COMPILATION 1
+#endif
+
 #include "../hi_lac/hi_lac.h"
 #include "../hi_dsp_library/hi_dsp_library.h"
 
@@ -324,6 +342,7 @@ namespace snex
 #include "snex_core/snex_jit_FunctionClass.h"
 #include "snex_core/snex_jit_NamespaceHandler.h"
 #include "snex_core/snex_jit_BaseScope.h"
+#include "snex_public/snex_jit_CodeCache.h"
 #include "snex_public/snex_jit_GlobalScope.h"
 #include "snex_mir/snex_MirObject.h"
 #include "snex_core/snex_jit_JitCallableObject.h"
@@ -190,42 +190,114 @@ void ui::WorkbenchData::callAsyncWithSafeCheck(const std::function<void(Workbenc
 }
 
 bool ui::WorkbenchData::handleCompilation()
+{
+	String s;
+
+	if (createCodeToCompile(s))
+	{
+		compileWithoutNotification(s);
+		sendCompileNotifications();
+	}
+
+	return true;
+}
+
+bool ui::WorkbenchData::createCodeToCompile(String& s)
 {
 	if (getGlobalScope().getBreakpointHandler().shouldAbort())
-		return true;
+		return false;
+
+	if (compileHandler == nullptr)
+		return false;
 
+	s = getCode();
+
+	if (codeProvider != nullptr)
+		codeProvider->preprocess(s);
+
+	for (auto l : listeners)
+	{
+		if (l != nullptr)
+			l->preprocess(s);
+	}
+
+	return !getGlobalScope().getBreakpointHandler().shouldAbort();
+}
+
+void ui::WorkbenchData::compileWithoutNotification(const String& preprocessedCode)
+{
 	if (compileHandler != nullptr)
 	{
-		auto s = getCode();
+		// The debugger needs the compilation to be finished before the test runs
+		auto fast = useTieredCompilation && !getGlobalScope().isDebugModeEnabled();
 
-		if (codeProvider != nullptr)
-			codeProvider->preprocess(s);
+		auto r = fast ? compileHandler->compileWithTier(preprocessedCode, true) : 
+		                compileHandler->compile(preprocessedCode);
 
-		for (auto l : listeners)
-		{
-			if (l != nullptr)
-				l->preprocess(s);
-		}
+		ScopedLock sl(compileLock);
 
-		if (getGlobalScope().getBreakpointHandler().shouldAbort())
-			return true;
+		lastCompileResult = r;
+		lastCompileResult.generation = ++compileGeneration;
+		lastPreprocessedCode = preprocessedCode;
+	}
+}
+
+bool ui::WorkbenchData::compileOptimized()
+{
+	String code;
+	int generation = 0;
 
-		lastCompileResult = compileHandler->compile(s);
+	{
+		ScopedLock sl(compileLock);
 
-		callAsyncWithSafeCheck([](WorkbenchData* d) { d->postCompile(); });
+		if (compileHandler == nullptr || !needsOptimizedCompilation())
+			return false;
 
-		// Might get deleted in the meantime...
-		if (compileHandler != nullptr)
-		{
-            compileHandler->postCompile(lastCompileResult);
-            
-			callAsyncWithSafeCheck([](WorkbenchData* d) { d->postPostCompile(); });
-		}
+		code = lastPreprocessedCode;
+		generation = compileGeneration;
+	}
+
+	// Don't hold the lock while compiling, a new compilation stops this thread and 
+	// would deadlock if the thread is killed while holding it.
+	auto r = compileHandler->compileWithTier(code, false);
+
+	if (auto t = Thread::getCurrentThread())
+	{
+		if (t->threadShouldExit())
+			return false;
+	}
+
+	if (!r.compileResult.wasOk())
+		return false;
+
+	{
+		ScopedLock sl(compileLock);
+
+		// The code was recompiled in the meantime
+		if (generation != compileGeneration)
+			return false;
+
+		r.generation = generation;
+		lastCompileResult = r;
 	}
 
+	sendCompileNotifications();
 	return true;
 }
 
+void ui::WorkbenchData::sendCompileNotifications()
+{
+	callAsyncWithSafeCheck([](WorkbenchData* d) { d->postCompile(); });
+
+	// Might get deleted in the meantime...
+	if (compileHandler != nullptr)
+	{
+        compileHandler->postCompile(lastCompileResult);
+        
+		callAsyncWithSafeCheck([](WorkbenchData* d) { d->postPostCompile(); });
+	}
+}
+
 
 
 snex::ui::WorkbenchData::Ptr ui::WorkbenchManager::getWorkbenchDataForCodeProvider(WorkbenchData::CodeProvider* p, bool ownCodeProvider)
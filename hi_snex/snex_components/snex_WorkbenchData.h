@@ -333,6 +333,15 @@ public:
         
         ComplexType::Ptr mainClassPtr;
 
+		/** The time it took to compile the code in milliseconds. */
+		double compileTimeMs = 0.0;
+
+		/** false if this is the result of a fast compilation that will be replaced by an optimized version. */
+		bool optimized = true;
+
+		/** The number of the compilation. The optimized version of a fast compilation has the same number. */
+		int generation = 0;
+
 		scriptnode::ParameterDataList parameters;
 		JitCompiledNode::Ptr lastNode;
 
@@ -879,13 +888,26 @@ public:
 			implementation of triggerCompilation().
 		*/
 		virtual CompileResult compile(const String& codeToCompile)
+		{
+			return compileWithTier(codeToCompile, false);
+		}
+
+		/** Compiles the code with the default compiler. If fast is true, it will use Compiler::setFastCompilation().
+		
+			This is used by the tiered compilation instead of compile(), so don't enable it for 
+			compile handlers that override compile(). */
+		CompileResult compileWithTier(const String& codeToCompile, bool fast)
 		{
             Compiler::Ptr cc = createCompiler();
+			cc->setFastCompilation(fast);
+
+			auto start = Time::getMillisecondCounterHiRes();
 
 			CompileResult r;
 			r.obj = cc->compileJitObject(codeToCompile);
 			r.assembly = cc->getAssemblyCode();
 			r.compileResult = cc->getCompileResult();
+			r.optimized = cc->isOptimized();
 
 			NamespacedIdentifier mainObjectId(getParent()->getInstanceId());
 
@@ -898,6 +920,7 @@ public:
 			TemplateParameter tp(voiceAmount);
 
 			r.mainClassPtr = cc->getComplexType(mainObjectId, {tp}, true);
+			r.compileTimeMs = Time::getMillisecondCounterHiRes() - start;
 
 			return r;
 		}
@@ -1130,6 +1153,39 @@ public:
 
 	bool handleCompilation();
 
+	/** Fetches the code from the code provider and runs all preprocessors. 
+	
+		Returns false if there's nothing to compile (or the compilation was aborted). */
+	bool createCodeToCompile(String& code);
+
+	/** Compiles the code without sending any notifications. 
+	
+		This can be called on any thread, so you can compile multiple workbenches in parallel
+		and call sendCompileNotifications() afterwards. */
+	void compileWithoutNotification(const String& preprocessedCode);
+
+	/** Sends the post compile notifications after compileWithoutNotification(). */
+	void sendCompileNotifications();
+
+	/** Enables the tiered compilation. 
+	
+		If enabled, compileWithoutNotification() creates a fast compilation that can be used
+		immediately and you need to call compileOptimized() afterwards (eg. on a background thread)
+		to replace it with the optimized version. */
+	void setUseTieredCompilation(bool shouldUseTieredCompilation) { useTieredCompilation = shouldUseTieredCompilation; }
+
+	/** Returns true if the last compilation was a fast compilation that wasn't replaced yet. */
+	bool needsOptimizedCompilation() const
+	{
+		return lastCompileResult.compileResult.wasOk() && !lastCompileResult.optimized;
+	}
+
+	/** Compiles the optimized version of the last fast compilation and sends the compile notifications. 
+	
+		This can be called on any thread. Returns false if there was nothing to optimize or the code 
+		was recompiled in the meantime. */
+	bool compileOptimized();
+
 	void setUseFileAsContentSource(const File& f)
 	{
 		codeProvider = new DefaultCodeProvider(this, f);
@@ -1266,6 +1322,12 @@ private:
 	TestData currentTestData;
 	CompileResult lastCompileResult;
 
+	// Used by the tiered compilation to detect if the code was recompiled in the meantime
+	CriticalSection compileLock;
+	String lastPreprocessedCode;
+	int compileGeneration = 0;
+	bool useTieredCompilation = false;
+
 	Array<WeakReference<Listener>> listeners;
 
 	friend class WorkbenchComponent;
@@ -82,6 +82,11 @@ USE_ASMJIT_NAMESPACE;
 				for (auto o : *toUse)
 				{
 					currentOptimization = o;
+
+					// Statements might be reused by another compiler, so the number must be unique
+					static std::atomic<int> numOptimizationRuns = { 0 };
+					optimizationRun = ++numOptimizationRuns;
+
 					ptr->process(this, scope);
 				}
 
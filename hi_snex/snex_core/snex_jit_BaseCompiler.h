@@ -160,6 +160,32 @@ public:
 		verbosity = maxVerbosity;
 	}
 
+	/** Adds a note about an optimisation (eg. a vectorised loop) that will be shown above the assembly. */
+	void addAssemblyNote(const juce::String& note)
+	{
+		if (!assemblyNotes.contains(note))
+		{
+			assemblyNotes.add(note);
+			logMessage(ProcessMessage, note);
+		}
+	}
+
+	/** Returns the notes as comment lines that can be prepended to the assembly. */
+	juce::String getAssemblyNotes(juce::juce_wchar commentCharacter) const
+	{
+		juce::String s;
+
+		for (const auto& n : assemblyNotes)
+			s << commentCharacter << " " << n << "\n";
+
+		if (s.isNotEmpty())
+			s << "\n";
+
+		return s;
+	}
+
+	void clearAssemblyNotes() { assemblyNotes.clear(); }
+
 	static bool isOptimizationPass(Pass p)
 	{
 		return p == PreSymbolOptimization ||
@@ -202,6 +228,11 @@ public:
 	
 	void optimize(ReferenceCountedObject* statement, BaseScope* scope, bool useExistingPasses=true);
 
+	/** Returns the number of the current run of an optimization pass over the syntax tree. 
+	
+		This is used to skip the children that were already processed by the optimization pass. */
+	int getOptimizationRun() const { return optimizationRun; }
+
 	void addOptimization(OptimizationPassBase* newPass, const String& id = String())
 	{
 		if (newPass != nullptr)
@@ -215,6 +246,18 @@ public:
 
 	StringArray getOptimizations() const;
 
+	/** Removes all optimization passes that are not in the given list. 
+	
+		This does not change the optimization ids, so features like the object layout stay the same. */
+	void removeOptimizationPasses(const StringArray& passesToKeep)
+	{
+		for (int i = 0; i < passes.size(); i++)
+		{
+			if (!passesToKeep.contains(passes[i]->getName()))
+				passes.remove(i--);
+		}
+	}
+
 	AssemblyRegister::Ptr getRegFromPool(BaseScope* scope, TypeInfo type)
 	{
 		return registerPool.getNextFreeRegister(scope, type);
@@ -261,12 +304,15 @@ private:
 	FunctionClass::Ptr inbuildFunctions;
 
     OptimizationPassBase* currentOptimization = nullptr;
+	int optimizationRun = 0;
     
 	OwnedArray<OptimizationPassBase> passes;
 	Array<Identifier> optimisationIds;
 
 	MessageType verbosity = numMessageTypes;
 
+	StringArray assemblyNotes;
+
 	Pass currentPass;
 
 	WeakReference<DebugHandler> debugHandler;
@@ -85,6 +85,18 @@ public:
 	AsmJitRuntime* parentRuntime = nullptr;
 
 	AsmJitFunctionCollection* compileAndGetScope(const ParserHelpers::CodeLocation& classStart, int length)
+	{
+		if (!parseAndResolveSymbols(classStart, length))
+			return newScope.release();
+
+		if (parseOnly)
+			return nullptr;
+
+		return finishCompilation();
+	}
+
+	/** Runs all passes up to the type check. After this the namespace handler contains all types and symbols. */
+	bool parseAndResolveSymbols(const ParserHelpers::CodeLocation& classStart, int length)
 	{
 		ClassParser parser(this, classStart, length);
 
@@ -95,7 +107,7 @@ public:
 
 		newScope->pimpl->handler = &namespaceHandler;
 
-		try
+		return executeWithErrorHandling([&]()
 		{
 			parser.currentScope = newScope->pimpl;
 
@@ -117,11 +129,16 @@ public:
 			executePass(ResolvingSymbols, newScope->pimpl, sTree);
 			executePass(TypeCheck, newScope->pimpl, sTree);
 
-			if (parseOnly)
-			{
-				lastResult = Result::ok();
-				return nullptr;
-			}
+			lastResult = Result::ok();
+		});
+	}
+
+	/** Runs the optimisations and the function compilation on the syntax tree created by parseAndResolveSymbols(). */
+	AsmJitFunctionCollection* finishCompilation()
+	{
+		executeWithErrorHandling([&]()
+		{
+			auto sTree = dynamic_cast<SyntaxTree*>(syntaxTree.get());
 
 			executePass(PostSymbolOptimization, newScope->pimpl, sTree);
 
@@ -134,6 +151,17 @@ public:
 
 			if (lastResult.wasOk())
 				lastResult = newScope->pimpl->getRootData()->callRootConstructors();
+		});
+
+		return newScope.release();
+	}
+
+	template <typename F> bool executeWithErrorHandling(const F& f)
+	{
+		try
+		{
+			f();
+			return true;
 		}
 		catch (ParserHelpers::Error& e)
 		{
@@ -143,9 +171,8 @@ public:
 
 			logMessage(BaseCompiler::Error, m);
 			lastResult = Result::fail(m);
+			return false;
 		}
-
-		return newScope.release();
 	}
 
 	AsmJitFunctionCollection* compileAndGetScope(const juce::String& code)
@@ -157,6 +184,13 @@ public:
 		return compileAndGetScope(loc, code.length());
 	}
 
+	bool parseAndResolveSymbols(const juce::String& code)
+	{
+		ParserHelpers::CodeLocation loc(code.getCharPointer(), code.getCharPointer());
+
+		return parseAndResolveSymbols(loc, code.length());
+	}
+
 	Result getLastResult() { return lastResult; }
 
 	ScopedPointer<AsmJitFunctionCollection> newScope;
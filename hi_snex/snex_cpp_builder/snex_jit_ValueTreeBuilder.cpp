@@ -58,7 +58,7 @@ namespace FactoryIds
 
 	static bool isMulti(const NamespacedIdentifier& id)
 	{
-		return id.toString() == "container::multi";
+		return id.toString() == "container::multi" || id.toString() == "container::parallel_multi";
 	}
 };
 
@@ -441,8 +441,18 @@ Node::Ptr ValueTreeBuilder::parseNode(const ValueTree& n)
 		return existing;
 
 	auto typeId = getNodeId(n);
+	auto nodePath = getNodePath(n);
 
-	Node::Ptr newNode = createNode(n, typeId.getIdentifier(), getNodePath(n).toString());
+	// The root chain of a polyphonic network can render multiple voices at once
+	// (the scriptnode synthesiser uses this for frozen networks).
+	if (n == v && outputFormat == Format::CppDynamicLibrary &&
+		nodePath.toString() == "container::chain" &&
+		ValueTreeIterator::hasChildNodeWithProperty(v, PropertyIds::IsPolyphonic))
+	{
+		nodePath = NamespacedIdentifier::fromString("container::voice_batch");
+	}
+
+	Node::Ptr newNode = createNode(n, typeId.getIdentifier(), nodePath.toString());
 
 	if (newNode->hasProperty(PropertyIds::UncompileableNode, false))
 	{
@@ -1819,6 +1829,45 @@ bool ValueTreeIterator::hasRealParameters(const ValueTree& containerTree)
 	return false;
 }
 
+bool ValueTreeIterator::hasCrossBranchConnections(const ValueTree& containerTree)
+{
+	// Every branch collects the IDs of its nodes and of the nodes that it modulates or sends to
+	Array<StringArray> branchIds;
+
+	for (auto branch : containerTree.getChildWithName(PropertyIds::Nodes))
+	{
+		StringArray ids;
+
+		forEach(branch, [&ids](ValueTree& v)
+		{
+			if (v.hasType(PropertyIds::Node))
+				ids.add(v[PropertyIds::ID].toString());
+			else if (v.hasType(PropertyIds::Connection) || v.hasType(PropertyIds::ModulationTarget) || v.hasType(PropertyIds::SwitchTarget))
+				ids.add(v[PropertyIds::NodeId].toString());
+			else if (v.hasType(PropertyIds::Property) && v[PropertyIds::ID].toString() == PropertyIds::Connection.toString())
+				ids.addTokens(v[PropertyIds::Value].toString(), ";", "");
+
+			return false;
+		});
+
+		ids.removeEmptyStrings();
+		ids.removeDuplicates(false);
+
+		for (const auto& other : branchIds)
+		{
+			for (const auto& id : ids)
+			{
+				if (other.contains(id))
+					return true;
+			}
+		}
+
+		branchIds.add(ids);
+	}
+
+	return false;
+}
+
 bool ValueTreeIterator::hasNodeProperty(const ValueTree& nodeTree, const Identifier& id)
 {
 	auto propTree = nodeTree.getChildWithName(PropertyIds::Properties);
@@ -1976,6 +2025,11 @@ snex::NamespacedIdentifier ValueTreeIterator::getNodeFactoryPath(const ValueTree
 		{
 			return NamespacedIdentifier::fromString("container::chain");
 		}
+
+		if ((isSplit || isMulti) && (bool)getNodeProperty(n, PropertyIds::Parallel) && !hasCrossBranchConnections(n))
+		{
+			return NamespacedIdentifier::fromString(isSplit ? "container::parallel_split" : "container::parallel_multi");
+		}
 	}
 
 	return NamespacedIdentifier::fromString(s);
@@ -54,6 +54,10 @@ struct ValueTreeIterator: public valuetree::Helpers
 
 	static bool hasRealParameters(const ValueTree& containerTree);
 
+	/** Checks whether a node in one child branch of the container modulates or sends a signal to a node in another
+		branch (or whether multiple branches target the same node). These branches can't be processed concurrently. */
+	static bool hasCrossBranchConnections(const ValueTree& containerTree);
+
 	static bool hasNodeProperty(const ValueTree& nodeTree, const Identifier& id);
 
 	static var getNodeProperty(const ValueTree& nodeTree, const Identifier& id);
@@ -279,8 +279,17 @@ namespace Operations
 
 		void processAllChildren(BaseCompiler* compiler, BaseScope* scope)
 		{
+			auto isOptimization = BaseCompiler::isOptimizationPass(compiler->getCurrentPass());
+
 			for (auto s : *this)
+			{
+				// The optimization passes run before the children are processed and might have
+				// processed them already. Processing them again makes the pass exponential.
+				if (isOptimization && s->lastOptimizationRun == compiler->getOptimizationRun())
+					continue;
+
 				s->process(compiler, scope);
+			}
 		}
 
 		bool forEachRecursive(const std::function<bool(Ptr)>& f, IterationType it);
@@ -294,6 +303,7 @@ namespace Operations
 		WeakReference<BaseCompiler> currentCompiler = nullptr;
 		BaseScope* currentScope = nullptr;
 		BaseCompiler::Pass currentPass;
+		int lastOptimizationRun = -1;
 
 		WeakReference<Statement> parent;
 
@@ -327,6 +337,8 @@ namespace Operations
 
 			if (BaseCompiler::isOptimizationPass(currentPass))
 			{
+				lastOptimizationRun = compiler->getOptimizationRun();
+
 				bool found = false;
 
 				for (int i = 0; i < parent->getNumChildStatements(); i++)
@@ -464,7 +476,7 @@ namespace Operations
 	struct TernaryOp;		struct LogicalNot;				struct Cast;
 	struct Negation;		struct Compare;					struct UnaryOp;
 	struct Increment;		struct DotOperator;				struct Loop;	
-	struct VectorOp;
+	struct VectorOp;		struct VectorReduction;
 	struct IfStatement;		struct ClassStatement;			struct Subscript;				
 	struct InlinedParameter;struct ComplexTypeDefinition;	struct ControlFlowStatement;
 	struct InlinedArgument; struct MemoryReference;			struct TemplateDefinition; 
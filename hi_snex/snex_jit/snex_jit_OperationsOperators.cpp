@@ -1046,6 +1046,31 @@ juce::uint32 Operations::VectorOp::getFunctionSignatureId(const String& function
 #endif
 }
 
+void Operations::VectorReduction::process(BaseCompiler* compiler, BaseScope* scope)
+{
+	processBaseWithChildren(compiler, scope);
+
+	COMPILER_PASS(BaseCompiler::TypeCheck)
+	{
+		auto t = getSubExpr(0)->getTypeInfo();
+
+		if (auto at = t.getTypedIfComplexType<ArrayTypeBase>())
+		{
+			if (at->getElementType().getType() != Types::ID::Float)
+				throwError("Can't reduce non-float arrays");
+		}
+		else if (t.getType() != Types::ID::Block)
+			throwError("Can't reduce " + t.toString());
+	}
+
+#if SNEX_ASMJIT_BACKEND
+	COMPILER_PASS(BaseCompiler::CodeGeneration)
+	{
+		throwError("Vector reductions are not supported by this backend");
+	}
+#endif
+}
+
 void Operations::Increment::process(BaseCompiler* compiler, BaseScope* scope)
 {
 	processBaseWithChildren(compiler, scope);
@@ -100,7 +100,7 @@ struct Operations::VectorOp : public Expression
 
 		const String validOps = "*+-=";
 
-		if (!validOps.containsChar(*opType))
+		if (!validOps.containsChar(*opType) && !isFunctionOp(opType))
 		{
 			String e;
 			e << opType << ": illegal operation for vectors";
@@ -147,6 +147,14 @@ struct Operations::VectorOp : public Expression
 
 	static uint32 getFunctionSignatureId(const String& functionName, bool isSimd);
 
+	/** Checks whether the op type is one of the Math functions that can be applied to a vector
+		(min, max, abs). These ops are only created by the LoopVectoriser. */
+	static bool isFunctionOp(TokenType t)
+	{
+		static const StringArray functionOps = { "min", "max", "abs" };
+		return functionOps.contains(t);
+	}
+
 	struct SerialisedVectorOp;
 
 	void emitVectorOp(BaseCompiler* compiler, BaseScope* scope);
@@ -156,6 +164,51 @@ struct Operations::VectorOp : public Expression
 	TokenType opType;
 };
 
+/** Reduces a float array to a single value using a vectorised function.
+
+	This is created by the LoopVectoriser when it detects a loop that accumulates the
+	sum, the sum of squares, the minimum, the maximum or the peak value of an array.
+*/
+struct Operations::VectorReduction : public Expression
+{
+	VectorReduction(Location l, Ptr target, TokenType reductionType_) :
+		Expression(l),
+		reductionType(reductionType_)
+	{
+		addStatement(target);
+	}
+
+	SET_EXPRESSION_ID(VectorReduction);
+
+	Statement::Ptr clone(ParserHelpers::CodeLocation l) const override
+	{
+		return new VectorReduction(l, getSubExpr(0)->clone(l), reductionType);
+	}
+
+	TypeInfo getTypeInfo() const override
+	{
+		return TypeInfo(Types::ID::Float);
+	}
+
+	ValueTree toValueTree() const override
+	{
+		auto t = Expression::toValueTree();
+		t.setProperty("OpType", reductionType, nullptr);
+		t.setProperty("TargetType", getSubExpr(0)->getTypeInfo().toStringWithoutAlias(), nullptr);
+
+		if (auto spanType = dynamic_cast<SpanType*>(getSubExpr(0)->getTypeInfo().getComplexType().get()))
+		{
+			t.setProperty("NumElements", spanType->getNumElements(), nullptr);
+		}
+
+		return t;
+	}
+
+	void process(BaseCompiler* compiler, BaseScope* scope) override;
+
+	TokenType reductionType;
+};
+
 struct Operations::UnaryOp : public Expression
 {
 	UnaryOp(Location l, Ptr expr) :
@@ -868,7 +868,10 @@ bool BinaryOpOptimizer::processStatementInternal(BaseCompiler* compiler, BaseSco
 
 				if (auto bOp = as<BinaryOp>(a->getSubExpr(0)))
 				{
-					if (isAssignedVariable(bOp->getSubExpr(0)) && !SpanType::isSimdType(a->getSubExpr(1)->getTypeInfo()))
+					// Only fold if the left operand is the variable itself, x = (x * 2) - y must not become x -= y
+					auto leftIsTarget = as<SymbolStatement>(bOp->getSubExpr(0)) != nullptr && isAssignedVariable(bOp->getSubExpr(0));
+
+					if (leftIsTarget && !SpanType::isSimdType(a->getSubExpr(1)->getTypeInfo()))
 					{
 						a->logOptimisationMessage("Replace " + juce::String(bOp->op) + " with self assignment");
 						a->assignmentType = bOp->op;
@@ -1541,10 +1544,19 @@ bool LoopVectoriser::processStatementInternal(BaseCompiler* compiler, BaseScope*
 	{
 		COMPILER_PASS(BaseCompiler::PreSymbolOptimization)
 		{
+#if SNEX_MIR_BACKEND
+			// The MIR backend has no SIMD registers so we convert the loops
+			// into calls to the vectorised library functions instead
+			if (convertToVectorOps(compiler, l) || convertToReduction(compiler, l))
+			{
+				return true;
+			}
+#else
 			if (convertToSimd(compiler, l))
 			{
 				return true;
 			}
+#endif
 		}
 	}
 
@@ -1669,6 +1681,361 @@ bool LoopVectoriser::isUnSimdableOperation(Ptr s)
 	return false;
 }
 
+#if SNEX_MIR_BACKEND
+bool LoopVectoriser::isFloatArrayTarget(BaseCompiler* c, Operations::Loop* l)
+{
+	using namespace Operations;
+
+	auto t = l->getTarget();
+
+	if (t->getTypeInfo().isDynamic())
+		t->tryToResolveType(c);
+
+	auto type = t->getTypeInfo();
+
+	if (type.toString().contains("FrameProcessor"))
+	{
+		addNote(c, l, "interleaved frame loop over " + getTargetName(t) + " was not vectorised");
+		return false;
+	}
+
+	auto isFloatArray = type.getType() == Types::ID::Block;
+
+	if (auto at = type.getTypedIfComplexType<ArrayTypeBase>())
+		isFloatArray = at->getElementType().getType() == Types::ID::Float;
+
+	if (!isFloatArray)
+		return false;
+
+	// The target expression will be evaluated once per vector operation so
+	// we only allow expressions without side effects (and the channel access).
+	auto hasSideEffect = t->forEachRecursive([](Ptr s)
+	{
+		if (auto fc = as<FunctionCall>(s))
+			return fc->function.id.getIdentifier() != Identifier("toChannelData");
+
+		return as<Assignment>(s) != nullptr || as<Increment>(s) != nullptr;
+	}, IterationType::AllChildStatements);
+
+	if (hasSideEffect)
+		return false;
+
+	return l->getLoopBlock()->getNumChildStatements() == 1;
+}
+
+bool LoopVectoriser::isIterator(Operations::Loop* l, Ptr s)
+{
+	if (auto v = as<Operations::VariableReference>(s))
+		return l->iterator == v->id;
+
+	return false;
+}
+
+bool LoopVectoriser::isLoopInvariant(Operations::Loop* l, Ptr s)
+{
+	using namespace Operations;
+
+	if (auto v = as<VariableReference>(s))
+	{
+		auto t = v->getTypeInfo();
+		return !isIterator(l, s) && !t.isRef() && t.getType() == Types::ID::Float;
+	}
+
+	if (auto imm = as<Immediate>(s))
+		return imm->getTypeInfo().getType() == Types::ID::Float;
+
+	if (auto cast = as<Cast>(s))
+		return isLoopInvariant(l, cast->getSubExpr(0));
+
+	if (auto bo = as<BinaryOp>(s))
+	{
+		String validOps = "+-*/";
+
+		return !bo->isLogicOp() &&
+			   String(bo->op).length() == 1 &&
+			   validOps.containsChar(*bo->op) &&
+			   isLoopInvariant(l, bo->getSubExpr(0)) &&
+			   isLoopInvariant(l, bo->getSubExpr(1));
+	}
+
+	return false;
+}
+
+juce::String LoopVectoriser::getMathFunctionName(Ptr s)
+{
+	if (auto fc = as<Operations::FunctionCall>(s))
+	{
+		if (fc->getObjectExpression() == nullptr && fc->function.id.getParent() == NamespacedIdentifier("Math"))
+			return fc->function.id.getIdentifier().toString();
+	}
+
+	return {};
+}
+
+bool LoopVectoriser::getOperationChain(Operations::Loop* l, Ptr e, Array<VectorOpInfo>& ops)
+{
+	using namespace Operations;
+
+	if (isIterator(l, e))
+		return true;
+
+	if (auto bo = as<BinaryOp>(e))
+	{
+		auto op = String(bo->op);
+		auto lValue = bo->getSubExpr(0);
+		auto rValue = bo->getSubExpr(1);
+
+		TokenType token = nullptr;
+
+		if (op == JitTokens::times)
+			token = JitTokens::times;
+		else if (op == JitTokens::plus)
+			token = JitTokens::plus;
+		else if (op == JitTokens::minus)
+			token = JitTokens::minus;
+		else
+			return false;
+
+		if (isLoopInvariant(l, rValue) && getOperationChain(l, lValue, ops))
+		{
+			ops.add({ token, rValue });
+			return true;
+		}
+
+		// x - s can't be expressed with a single vector op
+		if (token != JitTokens::minus && isLoopInvariant(l, lValue) && getOperationChain(l, rValue, ops))
+		{
+			ops.add({ token, lValue });
+			return true;
+		}
+
+		return false;
+	}
+
+	auto fName = getMathFunctionName(e);
+
+	if (fName.isEmpty())
+		return false;
+
+	auto fc = as<FunctionCall>(e);
+
+	if (fName == "abs" && fc->getNumArguments() == 1)
+	{
+		if (getOperationChain(l, fc->getArgument(0), ops))
+		{
+			ops.add({ "abs", nullptr });
+			return true;
+		}
+	}
+
+	if ((fName == "max" || fName == "min") && fc->getNumArguments() == 2)
+	{
+		TokenType token = fName == "max" ? "max" : "min";
+
+		for (int i = 0; i < 2; i++)
+		{
+			Ptr other = fc->getArgument(1 - i);
+
+			if (isLoopInvariant(l, other) && getOperationChain(l, fc->getArgument(i), ops))
+			{
+				ops.add({ token, other });
+				return true;
+			}
+		}
+	}
+
+	if (fName == "range" && fc->getNumArguments() == 3)
+	{
+		Ptr lower = fc->getArgument(1);
+		Ptr upper = fc->getArgument(2);
+
+		if (isLoopInvariant(l, lower) && isLoopInvariant(l, upper) && getOperationChain(l, fc->getArgument(0), ops))
+		{
+			ops.add({ "max", lower });
+			ops.add({ "min", upper });
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool LoopVectoriser::convertToVectorOps(BaseCompiler* c, Operations::Loop* l)
+{
+	using namespace Operations;
+
+	if (!l->iterator.typeInfo.isRef() || !isFloatArrayTarget(c, l))
+		return false;
+
+	auto a = as<Assignment>(l->getLoopBlock()->getChildStatement(0));
+
+	if (a == nullptr || !isIterator(l, a->getSubExpr(1)))
+		return false;
+
+	auto value = a->getSubExpr(0);
+	auto aType = String(a->assignmentType);
+
+	Array<VectorOpInfo> ops;
+
+	// compound assignments store the binary operator as assignment type
+	if (aType == JitTokens::times && isLoopInvariant(l, value))
+		ops.add({ JitTokens::times, value });
+	else if (aType == JitTokens::plus && isLoopInvariant(l, value))
+		ops.add({ JitTokens::plus, value });
+	else if (aType == JitTokens::minus && isLoopInvariant(l, value))
+		ops.add({ JitTokens::minus, value });
+	else if (aType == JitTokens::assign_)
+	{
+		if (isLoopInvariant(l, value))
+			ops.add({ JitTokens::assign_, value });
+		else if (!getOperationChain(l, value, ops))
+			return false;
+	}
+
+	if (ops.isEmpty())
+		return false;
+
+	auto t = l->getTarget();
+	auto loc = l->location;
+	auto block = l->getLoopBlock();
+
+	StringArray opNames;
+
+	for (int i = 0; i < ops.size(); i++)
+	{
+		const auto& op = ops.getReference(i);
+
+		// Function ops without a scalar operand use the target as source
+		auto source = op.source != nullptr ? op.source->clone(loc) : t->clone(loc);
+		Ptr vop = new VectorOp(loc, t->clone(loc), op.opType, source);
+
+		if (i == 0)
+			block->replaceChildStatement(0, vop);
+		else
+			block->addStatement(vop);
+
+		opNames.add(String(op.opType) + (op.source != nullptr ? "s" : ""));
+	}
+
+	addNote(c, l, "vectorised loop over " + getTargetName(t) + " (" + opNames.joinIntoString(", ") + ")");
+
+	replaceExpression(l, block);
+	l->parent = nullptr;
+
+	return true;
+}
+
+bool LoopVectoriser::convertToReduction(BaseCompiler* c, Operations::Loop* l)
+{
+	using namespace Operations;
+
+	if (!isFloatArrayTarget(c, l))
+		return false;
+
+	auto a = as<Assignment>(l->getLoopBlock()->getChildStatement(0));
+
+	if (a == nullptr)
+		return false;
+
+	auto acc = a->getSubExpr(1);
+
+	if (as<VariableReference>(acc) == nullptr || !isLoopInvariant(l, acc))
+		return false;
+
+	auto accSymbol = as<VariableReference>(acc)->id;
+
+	auto isAccumulator = [&](Ptr e)
+	{
+		if (auto v = as<VariableReference>(e))
+			return v->id == accSymbol;
+
+		return false;
+	};
+
+	auto value = a->getSubExpr(0);
+	auto aType = String(a->assignmentType);
+	auto loc = l->location;
+	auto t = l->getTarget();
+
+	TokenType reductionType = nullptr;
+	Ptr newValue;
+
+	if (aType == JitTokens::plus)
+	{
+		if (isIterator(l, value))
+			reductionType = "sum";
+
+		if (auto bo = as<BinaryOp>(value))
+		{
+			if (String(bo->op) == JitTokens::times && isIterator(l, bo->getSubExpr(0)) && isIterator(l, bo->getSubExpr(1)))
+				reductionType = "sumsq";
+		}
+
+		if (reductionType != nullptr)
+			newValue = new VectorReduction(loc, t->clone(loc), reductionType);
+	}
+	else if (aType == JitTokens::assign_)
+	{
+		auto fName = getMathFunctionName(value);
+
+		if ((fName == "max" || fName == "min") && as<FunctionCall>(value)->getNumArguments() == 2)
+		{
+			auto fc = as<FunctionCall>(value);
+
+			for (int i = 0; i < 2; i++)
+			{
+				auto other = fc->getArgument(1 - i);
+
+				if (!isAccumulator(fc->getArgument(i)))
+					continue;
+
+				if (isIterator(l, other))
+					reductionType = fName == "max" ? "max" : "min";
+				else if (fName == "max" && getMathFunctionName(other) == "abs" &&
+						 as<FunctionCall>(other)->getNumArguments() == 1 &&
+						 isIterator(l, as<FunctionCall>(other)->getArgument(0)))
+					reductionType = "peak";
+
+				if (reductionType != nullptr)
+				{
+					// max(acc, vmax(data)) keeps the semantics of the loop if the data is empty
+					newValue = fc->clone(loc);
+					newValue->replaceChildStatement(1 - i, new VectorReduction(loc, t->clone(loc), reductionType));
+					break;
+				}
+			}
+		}
+	}
+
+	if (newValue == nullptr)
+		return false;
+
+	Ptr newAssignment = new Assignment(loc, acc->clone(loc), a->assignmentType, newValue, false);
+
+	addNote(c, l, "vectorised reduction over " + getTargetName(t) + " (v" + String(reductionType) + ")");
+
+	replaceExpression(l, newAssignment);
+	l->parent = nullptr;
+
+	return true;
+}
+
+juce::String LoopVectoriser::getTargetName(Ptr t)
+{
+	if (auto v = as<Operations::VariableReference>(t))
+		return v->id.id.getIdentifier().toString();
+
+	return t->getTypeInfo().toString();
+}
+
+void LoopVectoriser::addNote(BaseCompiler* c, Operations::Loop* l, const String& description)
+{
+	String n;
+	n << "Line " << l->location.calculateLineNumber() << ": " << description;
+	c->addAssemblyNote(n);
+}
+#endif
+
 #if SNEX_ASMJIT_BACKEND
 namespace AsmSubPasses
 {
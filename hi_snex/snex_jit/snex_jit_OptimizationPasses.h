@@ -309,6 +309,39 @@ private:
 	Result changeIteratorTargetToSimd(Operations::Loop* l);
 
 	static bool isUnSimdableOperation(Ptr s);
+
+#if SNEX_MIR_BACKEND
+
+	/** A single vectorised operation that is applied to the whole loop target. */
+	struct VectorOpInfo
+	{
+		ParserHelpers::TokenType opType;
+		Ptr source;
+	};
+
+	/** Converts loops that apply a chain of operations with loop invariant operands to each
+		element into calls to the vectorised library functions:
+
+		for(auto& s: data) s = Math.abs(s) * gain + 0.5f; => data = Math.abs(data); data *= gain; data += 0.5f;
+	*/
+	bool convertToVectorOps(BaseCompiler* c, Operations::Loop* l);
+
+	/** Converts loops that accumulate a value into a vectorised reduction:
+
+		for(auto& s: data) sum += s * s; => sum += vsumsq(data);
+	*/
+	bool convertToReduction(BaseCompiler* c, Operations::Loop* l);
+
+	static bool isFloatArrayTarget(BaseCompiler* c, Operations::Loop* l);
+	static bool isIterator(Operations::Loop* l, Ptr s);
+	static bool isLoopInvariant(Operations::Loop* l, Ptr s);
+	static bool getOperationChain(Operations::Loop* l, Ptr e, Array<VectorOpInfo>& ops);
+	static String getMathFunctionName(Ptr s);
+	static String getTargetName(Ptr t);
+
+	static void addNote(BaseCompiler* c, Operations::Loop* l, const String& description);
+
+#endif
 };
 
 
@@ -292,11 +292,23 @@ MathFunctions::MathFunctions(bool addInlinedFunctions, ComplexType::Ptr blockTyp
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmuls, void*, float, "vmuls");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vadds, void*, float, "vadds");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmovs, void*, float, "vmovs");
+	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vsubs, void*, float, "vsubs");
+	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmins, void*, float, "vmins");
+	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmaxs, void*, float, "vmaxs");
 
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)hmath::vmul, void*, void*, "vmul");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)hmath::vadd, void*, void*, "vadd");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)hmath::vsub, void*, void*, "vsub");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)hmath::vmov, void*, void*, "vmov");
+	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)static_cast<block&(*)(block&, const block&)>(hmath::vabs), void*, void*, "vabs");
+
+	using ReduceFunc = float(*)(void*);
+
+	HNODE_JIT_ADD_C_FUNCTION_1(float, (ReduceFunc)hmath::vsum, void*, "vsum");
+	HNODE_JIT_ADD_C_FUNCTION_1(float, (ReduceFunc)hmath::vsumsq, void*, "vsumsq");
+	HNODE_JIT_ADD_C_FUNCTION_1(float, (ReduceFunc)hmath::vmax, void*, "vmax");
+	HNODE_JIT_ADD_C_FUNCTION_1(float, (ReduceFunc)hmath::vmin, void*, "vmin");
+	HNODE_JIT_ADD_C_FUNCTION_1(float, (ReduceFunc)hmath::vpeak, void*, "vpeak");
 
 	for (auto f : functions)
 		f->setConst(true);
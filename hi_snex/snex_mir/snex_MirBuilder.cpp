@@ -79,6 +79,7 @@ MirBuilder::MirBuilder(MIR_context* ctx_, const ValueTree& v_) :
 	REGISTER_TYPE(MemoryReference);
 	REGISTER_TYPE(InlinedReturnValue);
 	REGISTER_TYPE(VectorOp);
+	REGISTER_TYPE(VectorReduction);
     
 
     REGISTER_INLINER(dyn_referTo_ppii);
@@ -130,6 +131,11 @@ ValueTree MirBuilder::getGlobalData()
     return currentState->dataManager.getGlobalData();
 }
 
+bool MirBuilder::isRelocatable() const
+{
+	return !currentState->containsAbsoluteAddresses;
+}
+
 String MirBuilder::getMirText() const
 {
 	auto text = currentState->toString(true);
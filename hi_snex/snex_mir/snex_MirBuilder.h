@@ -58,6 +58,9 @@ struct MirBuilder
     void setDataLayout(const Array<ValueTree>& data);
     
     ValueTree getGlobalData();
+
+	/** Returns true if the MIR text doesn't contain any absolute addresses and can be reused in another session. */
+	bool isRelocatable() const;
     
 private:
 
@@ -407,51 +407,60 @@ String snex::mir::TypeConverters::TypeInfo2MirTextType(const TypeInfo& t, bool r
 
 String snex::mir::TypeConverters::MirTypeAndToken2InstructionText(MIR_type_t type, const String& token)
 {
-	static StringPairArray intOps, fltOps, dblOps;
-
-	intOps.set(JitTokens::assign_, "MOV");
-	intOps.set(JitTokens::plus, "ADD");
-	intOps.set(JitTokens::minus, "SUB");
-	intOps.set(JitTokens::times, "MUL");
-	intOps.set(JitTokens::divide, "DIV");
-	intOps.set(JitTokens::modulo, "MOD");
-	intOps.set(JitTokens::greaterThan, "GTS");
-	intOps.set(JitTokens::greaterThanOrEqual, "GES");
-	intOps.set(JitTokens::lessThan, "LTS");
-	intOps.set(JitTokens::lessThanOrEqual, "LES");
-	intOps.set(JitTokens::equals, "EQ");
-	intOps.set(JitTokens::notEquals, "NE");
-    intOps.set(JitTokens::logicalAnd, "AND");
-    intOps.set(JitTokens::logicalOr, "OR");
-
-	fltOps.set(JitTokens::assign_, "FMOV");
-	fltOps.set(JitTokens::plus, "FADD");
-	fltOps.set(JitTokens::minus, "FSUB");
-	fltOps.set(JitTokens::times, "FMUL");
-	fltOps.set(JitTokens::divide, "FDIV");
-	fltOps.set(JitTokens::greaterThan, "FGT");
-	fltOps.set(JitTokens::greaterThanOrEqual, "FGE");
-	fltOps.set(JitTokens::lessThan, "FLT");
-	fltOps.set(JitTokens::lessThanOrEqual, "FLE");
-	fltOps.set(JitTokens::equals, "FEQ");
-	fltOps.set(JitTokens::notEquals, "FNE");
-
-	dblOps.set(JitTokens::assign_, "DMOV");
-	dblOps.set(JitTokens::plus, "DADD");
-	dblOps.set(JitTokens::minus, "DSUB");
-	dblOps.set(JitTokens::times, "DMUL");
-	dblOps.set(JitTokens::divide, "DDIV");
-	dblOps.set(JitTokens::greaterThan, "DGT");
-	dblOps.set(JitTokens::greaterThanOrEqual, "DGE");
-	dblOps.set(JitTokens::lessThan, "DLT");
-	dblOps.set(JitTokens::lessThanOrEqual, "DLE");
-	dblOps.set(JitTokens::equals, "DEQ");
-	dblOps.set(JitTokens::notEquals, "DNE");
+	// Created once so that multiple compilers can run on different threads
+	struct OpTables
+	{
+		OpTables()
+		{
+			intOps.set(JitTokens::assign_, "MOV");
+			intOps.set(JitTokens::plus, "ADD");
+			intOps.set(JitTokens::minus, "SUB");
+			intOps.set(JitTokens::times, "MUL");
+			intOps.set(JitTokens::divide, "DIV");
+			intOps.set(JitTokens::modulo, "MOD");
+			intOps.set(JitTokens::greaterThan, "GTS");
+			intOps.set(JitTokens::greaterThanOrEqual, "GES");
+			intOps.set(JitTokens::lessThan, "LTS");
+			intOps.set(JitTokens::lessThanOrEqual, "LES");
+			intOps.set(JitTokens::equals, "EQ");
+			intOps.set(JitTokens::notEquals, "NE");
+			intOps.set(JitTokens::logicalAnd, "AND");
+			intOps.set(JitTokens::logicalOr, "OR");
+
+			fltOps.set(JitTokens::assign_, "FMOV");
+			fltOps.set(JitTokens::plus, "FADD");
+			fltOps.set(JitTokens::minus, "FSUB");
+			fltOps.set(JitTokens::times, "FMUL");
+			fltOps.set(JitTokens::divide, "FDIV");
+			fltOps.set(JitTokens::greaterThan, "FGT");
+			fltOps.set(JitTokens::greaterThanOrEqual, "FGE");
+			fltOps.set(JitTokens::lessThan, "FLT");
+			fltOps.set(JitTokens::lessThanOrEqual, "FLE");
+			fltOps.set(JitTokens::equals, "FEQ");
+			fltOps.set(JitTokens::notEquals, "FNE");
+
+			dblOps.set(JitTokens::assign_, "DMOV");
+			dblOps.set(JitTokens::plus, "DADD");
+			dblOps.set(JitTokens::minus, "DSUB");
+			dblOps.set(JitTokens::times, "DMUL");
+			dblOps.set(JitTokens::divide, "DDIV");
+			dblOps.set(JitTokens::greaterThan, "DGT");
+			dblOps.set(JitTokens::greaterThanOrEqual, "DGE");
+			dblOps.set(JitTokens::lessThan, "DLT");
+			dblOps.set(JitTokens::lessThanOrEqual, "DLE");
+			dblOps.set(JitTokens::equals, "DEQ");
+			dblOps.set(JitTokens::notEquals, "DNE");
+		}
+
+		StringPairArray intOps, fltOps, dblOps;
+	};
+
+	static const OpTables t;
 
 	if (type == MIR_T_I64 ||
-        type == MIR_T_P)	return intOps.getValue(token, "").toLowerCase();
-	if (type == MIR_T_F)	return fltOps.getValue(token, "").toLowerCase();
-	if (type == MIR_T_D)	return dblOps.getValue(token, "").toLowerCase();
+        type == MIR_T_P)	return t.intOps.getValue(token, "").toLowerCase();
+	if (type == MIR_T_F)	return t.fltOps.getValue(token, "").toLowerCase();
+	if (type == MIR_T_D)	return t.dblOps.getValue(token, "").toLowerCase();
 
 	jassertfalse;
 	return "";
@@ -481,14 +490,24 @@ String snex::mir::TypeConverters::VectorOp2Signature(const ValueTree& v)
 {
 	const String vf = "pointer& Math::{FUNCTION}(pointer& Param0, pointer& Param1)";
 	const String sf = "pointer& Math::{FUNCTION}(pointer& Param0, float Param1)";
+	const String rf = "float Math::{FUNCTION}(pointer& Param0)";
+
+	auto opString = v[InstructionPropertyIds::OpType].toString();
+
+	String op = "v";
+
+	if (v.getType() == Identifier("VectorReduction"))
+	{
+		// vsum, vsumsq, vmin, vmax, vpeak
+		op << opString;
+		return rf.replace("{FUNCTION}", op);
+	}
 
 	auto isScalar = (bool)v[InstructionPropertyIds::Scalar];
 
 	auto prototypeToUse = isScalar ? sf : vf;
 
-	auto opType = v[InstructionPropertyIds::OpType].toString()[0];
-
-	String op = "v";
+	auto opType = opString[0];
 
 	switch (opType)
 	{
@@ -497,6 +516,7 @@ String snex::mir::TypeConverters::VectorOp2Signature(const ValueTree& v)
 	case '-': op << "sub"; break;
 	case '/': op << "div"; break;
 	case '=': op << "mov"; break;
+	default:  op << opString; break; // min, max, abs
 	}
 
 	if (isScalar)
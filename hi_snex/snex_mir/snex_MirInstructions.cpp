@@ -39,6 +39,7 @@ namespace InstructionIds
 	DEFINE_ID(InlinedArgument);
 	DEFINE_ID(MemoryReference);
 	DEFINE_ID(VectorOp);
+	DEFINE_ID(VectorReduction);
 }
 
 
@@ -65,7 +66,7 @@ struct InstructionParsers
 
 			TypeConverters::forEachChild(state.currentTree, [&](const ValueTree& v)
 			{
-				if (v.getType() == InstructionIds::VectorOp)
+				if (v.getType() == InstructionIds::VectorOp || v.getType() == InstructionIds::VectorReduction)
 				{
 					auto sig = TypeConverters::VectorOp2Signature(v);
 
@@ -1718,6 +1719,35 @@ struct InstructionParsers
 		return Result::ok();
 	}
 
+	static Result VectorReduction(State* state_)
+	{
+		MirCodeGenerator cc(state_);
+
+		auto& state = *state_;
+
+		state.processAllChildren();
+
+		auto fullSig = TypeConverters::VectorOp2Signature(state.currentTree);
+
+		jassert(state.functionManager.hasPrototype({}, TypeConverters::String2FunctionData(fullSig)));
+
+		auto src = state.registerManager.getOperandForChild(0, RegisterType::Pointer);
+
+		if (state.currentTree.hasProperty(InstructionPropertyIds::NumElements))
+		{
+			auto blockData = cc.alloca(16);
+			cc.mov(cc.deref<void*>(blockData, 8), src);
+			cc.mov(cc.deref<int>(blockData, 4), state[InstructionPropertyIds::NumElements]);
+			src = blockData;
+		}
+
+		auto result = cc.call<float>({}, fullSig, { src });
+
+		state.registerManager.registerCurrentTextOperand(result, MIR_T_F, RegisterType::Value);
+
+		return Result::ok();
+	}
+
 
 };
 
@@ -276,8 +276,8 @@ ValueTree MirFunctionCollection::fillLayoutWithData(const String& dataId, const
 
 
 
-void* MirCompiler::currentConsole = nullptr;
-Array<StaticFunctionPointer> MirCompiler::currentFunctions;
+thread_local void* MirCompiler::currentConsole = nullptr;
+thread_local Array<StaticFunctionPointer> MirCompiler::currentFunctions;
 
 MirCompiler::MirCompiler(jit::GlobalScope& m):
 	r(Result::fail("nothing compiled")),
@@ -304,6 +304,7 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const ValueTree&
 		auto ok = compileMirCode(code);
         
         getFunctionClass()->globalData = b.getGlobalData();
+		relocatable = b.isRelocatable();
         
         return ok;
 	}
@@ -398,7 +399,7 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const String& cod
 			getFunctionClass()->modules.add(m);
 			MIR_load_module(ctx, m);
 			MIR_gen_init(ctx);
-			MIR_gen_set_optimize_level(ctx, 3);
+			MIR_gen_set_optimize_level(ctx, optimizeLevel);
             //MIR_gen_set_debug_file(ctx, 1, dbgfile);
 			MIR_link(ctx, MIR_set_gen_interface, &MirCompiler::resolve);
             
@@ -492,6 +493,22 @@ void MirCompiler::setDataLayout(const Array<ValueTree>& data)
     dataLayout = data;
 }
 
+void MirCompiler::setGlobalData(const ValueTree& globalData)
+{
+	if (currentFunctionClass == nullptr)
+		currentFunctionClass = new MirFunctionCollection();
+
+	getFunctionClass()->globalData = globalData;
+}
+
+ValueTree MirCompiler::getGlobalData() const
+{
+	if (auto fc = dynamic_cast<MirFunctionCollection*>(currentFunctionClass.get()))
+		return fc->globalData;
+
+	return {};
+}
+
 MirCompiler::~MirCompiler()
 {
 	
@@ -55,6 +55,18 @@ struct MirCompiler
 	jit::FunctionCollectionBase* compileMirCode(const ValueTree& ast);
 
     void setDataLayout(const Array<ValueTree>& dataTree);
+
+	/** Sets the initial values of the class data. Use this when you compile MIR text that was created by a previous session. */
+	void setGlobalData(const ValueTree& globalData);
+
+	/** Returns the initial values of the class data that were created by the last call to compileMirCode(). */
+	ValueTree getGlobalData() const;
+
+	/** Returns true if the MIR text of the last compilation can be reused in another session. */
+	bool isRelocatable() const { return relocatable; }
+
+	/** Sets the optimization level of the MIR code generator (0-3). Lower levels generate the code faster. */
+	void setOptimizeLevel(int newLevel) { optimizeLevel = jlimit(0, 3, newLevel); }
     
 	Result getLastError() const;;
 
@@ -78,9 +90,12 @@ struct MirCompiler
 
     Array<ValueTree> dataLayout;
     String assembly;
+	bool relocatable = false;
+	int optimizeLevel = 3;
     
-	static Array<StaticFunctionPointer> currentFunctions;
-	static void* currentConsole;
+	// thread local so that multiple compilers can run in parallel
+	static thread_local Array<StaticFunctionPointer> currentFunctions;
+	static thread_local void* currentConsole;
 
 	Result r;
 
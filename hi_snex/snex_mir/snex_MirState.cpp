@@ -159,6 +159,8 @@ void TextLine::addImmOperand(const VariableStorage& value)
 	{
 		auto x = String(reinterpret_cast<int64>(value.getDataPointer()));
 
+		state->containsAbsoluteAddresses = true;
+
 		operands.add(x);
 	}
 	else
@@ -451,6 +451,9 @@ struct State
 
 	MIR_context_t ctx;
 	MIR_module_t currentModule = nullptr;
+
+	/** Set to true if the MIR text contains an absolute memory address as immediate value. */
+	bool containsAbsoluteAddresses = false;
 	ValueTree currentTree;
 	
 	Array<TextLine> lines;
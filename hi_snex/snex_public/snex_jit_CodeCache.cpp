@@ -0,0 +1,262 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace snex {
+namespace jit {
+using namespace juce;
+
+CodeCache::Ptr CodeCache::defaultCache;
+
+CodeCache::CodeCache(const File& cacheDirectory_, int64 maxSizeInBytes):
+	cacheDirectory(cacheDirectory_),
+	maxSize(maxSizeInBytes)
+{
+}
+
+String CodeCache::createOptionString(const GlobalScope& s)
+{
+	String options;
+
+	options << "v" << String(FormatVersion) << ";";
+
+	// The compiler itself is part of the key, so every new build starts with an empty cache
+	options << __DATE__ << " " << __TIME__ << ";";
+
+	auto passes = s.getOptimizationPassList();
+	passes.sort(false);
+	options << passes.joinIntoString(",") << ";";
+
+	options << "cpu:";
+
+	if (SystemStats::hasSSE41())
+		options << "sse41,";
+	if (SystemStats::hasAVX())
+		options << "avx,";
+	if (SystemStats::hasAVX2())
+		options << "avx2,";
+	if (SystemStats::hasNeon())
+		options << "neon,";
+
+	options << ";debug:" << (s.isDebugModeEnabled() ? "1" : "0");
+
+	return options;
+}
+
+String CodeCache::createKey(const String& preprocessedCode, const String& options)
+{
+	auto h = (preprocessedCode + "\n" + options).hashCode64();
+	return String::toHexString(h);
+}
+
+File CodeCache::getFile(const String& key) const
+{
+	return cacheDirectory.getChildFile(key).withFileExtension("snexcache");
+}
+
+Array<File> CodeCache::getAllEntryFiles() const
+{
+	return cacheDirectory.findChildFiles(File::findFiles, false, "*.snexcache");
+}
+
+CodeCache::Entry CodeCache::load(const String& preprocessedCode, const String& options)
+{
+	ScopedLock sl(lock);
+
+	auto f = getFile(createKey(preprocessedCode, options));
+
+	Entry e;
+
+	if (f.existsAsFile())
+	{
+		MemoryBlock mb;
+		f.loadFileAsData(mb);
+
+		auto v = ValueTree::readFromGZIPData(mb.getData(), mb.getSize());
+
+		// Guard against hash collisions
+		if (v.isValid() && v["Code"].toString() == preprocessedCode && v["Options"].toString() == options)
+		{
+			e.mirCode = v["MirCode"].toString();
+
+			for (auto l : v.getChildWithName("DataLayouts"))
+				e.dataLayouts.add(l.createCopy());
+
+			e.globalData = v.getChildWithName("GlobalData").getChild(0).createCopy();
+
+			f.setLastAccessTime(Time::getCurrentTime());
+		}
+	}
+
+	if (e.isValid())
+		numHits++;
+	else
+		numMisses++;
+
+	return e;
+}
+
+bool CodeCache::store(const String& preprocessedCode, const String& options, const Entry& e)
+{
+	if (!e.isValid())
+		return false;
+
+	ScopedLock sl(lock);
+
+	ValueTree v("SnexCodeCacheEntry");
+	v.setProperty("Code", preprocessedCode, nullptr);
+	v.setProperty("Options", options, nullptr);
+	v.setProperty("MirCode", e.mirCode, nullptr);
+
+	ValueTree layouts("DataLayouts");
+
+	for (auto l : e.dataLayouts)
+		layouts.addChild(l.createCopy(), -1, nullptr);
+
+	v.addChild(layouts, -1, nullptr);
+
+	ValueTree globalData("GlobalData");
+
+	if (e.globalData.isValid())
+		globalData.addChild(e.globalData.createCopy(), -1, nullptr);
+
+	v.addChild(globalData, -1, nullptr);
+
+	if (!cacheDirectory.isDirectory() && !cacheDirectory.createDirectory())
+		return false;
+
+	MemoryOutputStream mos;
+
+	{
+		GZIPCompressorOutputStream zipper(mos);
+		v.writeToStream(zipper);
+	}
+
+	auto f = getFile(createKey(preprocessedCode, options));
+
+	if (!f.replaceWithData(mos.getData(), mos.getDataSize()))
+		return false;
+
+	purge();
+
+	return f.existsAsFile();
+}
+
+void CodeCache::remove(const String& preprocessedCode, const String& options)
+{
+	ScopedLock sl(lock);
+	getFile(createKey(preprocessedCode, options)).deleteFile();
+}
+
+void CodeCache::clear()
+{
+	ScopedLock sl(lock);
+
+	for (auto f : getAllEntryFiles())
+		f.deleteFile();
+}
+
+void CodeCache::setMaxSize(int64 newMaxSizeInBytes)
+{
+	ScopedLock sl(lock);
+	maxSize = newMaxSizeInBytes;
+	purge();
+}
+
+int64 CodeCache::getTotalSize() const
+{
+	int64 numBytes = 0;
+
+	for (auto f : getAllEntryFiles())
+		numBytes += f.getSize();
+
+	return numBytes;
+}
+
+int CodeCache::getNumEntries() const
+{
+	return getAllEntryFiles().size();
+}
+
+void CodeCache::purge()
+{
+	auto files = getAllEntryFiles();
+
+	int64 numBytes = 0;
+
+	for (auto f : files)
+		numBytes += f.getSize();
+
+	if (numBytes <= maxSize)
+		return;
+
+	struct LruSorter
+	{
+		static int compareElements(const File& f1, const File& f2)
+		{
+			auto t1 = f1.getLastAccessTime();
+			auto t2 = f2.getLastAccessTime();
+
+			if (t1 < t2)
+				return -1;
+			if (t2 < t1)
+				return 1;
+
+			return 0;
+		}
+	};
+
+	LruSorter sorter;
+	files.sort(sorter);
+
+	for (auto f : files)
+	{
+		if (numBytes <= maxSize)
+			break;
+
+		numBytes -= f.getSize();
+		f.deleteFile();
+	}
+}
+
+void CodeCache::setDefaultCache(CodeCache* newDefaultCache)
+{
+	defaultCache = newDefaultCache;
+}
+
+CodeCache* CodeCache::getDefaultCache()
+{
+	return defaultCache.get();
+}
+
+}
+}
@@ -0,0 +1,139 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#pragma once
+
+namespace snex {
+namespace jit {
+using namespace juce;
+
+class GlobalScope;
+
+/** A persistent on-disk cache for compiled SNEX code.
+
+	The cache is content-addressed: the key is a hash of the preprocessed source code
+	and everything else that affects the code generation (the compiler version, the enabled
+	optimisation passes, the CPU features and the debug mode). Each entry is stored as
+	compressed file in the cache directory and contains:
+
+	- the relocatable MIR code that was created from the optimised syntax tree
+	- the data layouts of all complex types that are used by the code
+	- the initial values of the class data
+
+	Native machine code can't be persisted because it contains absolute addresses, but loading
+	the MIR code skips the entire optimisation & code generation pipeline of the SNEX compiler
+	which is by far the most expensive part.
+
+	An entry will be discarded if the source code or the options don't match exactly (in case of
+	a hash collision), if the data layouts of the current compilation do not match the stored
+	layouts or if it can't be compiled anymore. If the total size of the cache exceeds the limit,
+	the least recently used entries will be deleted.
+*/
+class CodeCache : public ReferenceCountedObject
+{
+public:
+
+	using Ptr = ReferenceCountedObjectPtr<CodeCache>;
+
+	/** Bump this whenever the syntax tree or the MIR code generation changes in a way that invalidates old entries. */
+	static constexpr int FormatVersion = 1;
+
+	struct Entry
+	{
+		bool isValid() const { return mirCode.isNotEmpty(); }
+
+		String mirCode;
+		Array<ValueTree> dataLayouts;
+		ValueTree globalData;
+	};
+
+	CodeCache(const File& cacheDirectory, int64 maxSizeInBytes = 64 * 1024 * 1024);
+
+	/** Creates a string that contains every compiler setting that affects the code generation. */
+	static String createOptionString(const GlobalScope& s);
+
+	/** Creates the hash key for the given source code and options. */
+	static String createKey(const String& preprocessedCode, const String& options);
+
+	/** Loads the entry for the given code. Returns an invalid entry if there is no match. */
+	Entry load(const String& preprocessedCode, const String& options);
+
+	/** Stores the entry and purges the least recently used entries if the size limit is exceeded. */
+	bool store(const String& preprocessedCode, const String& options, const Entry& e);
+
+	/** Removes the entry for the given code (eg. if it failed to compile). */
+	void remove(const String& preprocessedCode, const String& options);
+
+	/** Deletes all entries. */
+	void clear();
+
+	void setMaxSize(int64 newMaxSizeInBytes);
+
+	int64 getMaxSize() const { return maxSize; }
+
+	int64 getTotalSize() const;
+
+	int getNumEntries() const;
+
+	int getNumHits() const { return numHits; }
+	int getNumMisses() const { return numMisses; }
+
+	File getCacheDirectory() const { return cacheDirectory; }
+
+	/** Sets a cache that will be used by all global scopes that are created afterwards. */
+	static void setDefaultCache(CodeCache* newDefaultCache);
+
+	static CodeCache* getDefaultCache();
+
+private:
+
+	File getFile(const String& key) const;
+
+	Array<File> getAllEntryFiles() const;
+
+	void purge();
+
+	const File cacheDirectory;
+	int64 maxSize;
+
+	int numHits = 0;
+	int numMisses = 0;
+
+	CriticalSection lock;
+
+	static Ptr defaultCache;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CodeCache);
+};
+
+}
+}
@@ -103,7 +103,8 @@ GlobalScope::GlobalScope() :
 	FunctionClass({}),
 	BaseScope({}, nullptr),
 	runtimeError(Result::ok()),
-	polyHandler(false)
+	polyHandler(false),
+	codeCache(CodeCache::getDefaultCache())
 {
 	blockType = new DynType(TypeInfo(Types::ID::Float));
 	blockType->setAlias(NamespacedIdentifier("block"));
@@ -309,6 +310,8 @@ bool GlobalScope::checkRuntimeErrorAfterExecution()
 
 void GlobalScope::setPreprocessorDefinitions(var d, bool clearExisting)
 {
+	ScopedLock sl(definitionLock);
+
 	if(clearExisting)
 		preprocessorDefinitions.clear();
 
@@ -327,6 +330,8 @@ void GlobalScope::setPreprocessorDefinitions(var d, bool clearExisting)
 
 void GlobalScope::setPreprocessorDefinitions(const ExternalPreprocessorDefinition::List& d, bool clearExisting)
 {
+	ScopedLock sl(definitionLock);
+
 	if(clearExisting)
 		preprocessorDefinitions.clear();
 
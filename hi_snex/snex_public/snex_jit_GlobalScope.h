@@ -535,7 +535,11 @@ public:
 
 	void setPreprocessorDefinitions(const ExternalPreprocessorDefinition::List& d, bool clearExisting=false);
 
-	ExternalPreprocessorDefinition::List getPreprocessorDefinitions() const { return preprocessorDefinitions; }
+	ExternalPreprocessorDefinition::List getPreprocessorDefinitions() const 
+	{ 
+		ScopedLock sl(definitionLock);
+		return preprocessorDefinitions; 
+	}
 
 	static ExternalPreprocessorDefinition::List getDefaultDefinitions();
 
@@ -550,6 +554,8 @@ public:
 		{
 			polyHandler.setEnabled(shouldBePolyphonic);
 
+			ScopedLock sl(definitionLock);
+
 			for (auto& epd : preprocessorDefinitions)
 			{
 				if (epd.name == "NUM_POLYPHONIC_VOICES")
@@ -598,6 +604,13 @@ public:
     void setUseInterpreter(bool shouldUseInterpreter) { interpreterMode = shouldUseInterpreter; }
     
     bool isUsingInterpreter() const { return interpreterMode; }
+
+	/** Sets a persistent code cache that will be used by every compiler with this scope. 
+	
+		By default this uses the cache that was set with CodeCache::setDefaultCache(). */
+	void setCodeCache(CodeCache* newCache) { codeCache = newCache; }
+
+	CodeCache* getCodeCache() const { return codeCache.get(); }
     
 	void clearDebugMessages();
 
@@ -617,7 +630,11 @@ private:
 	Array<Identifier> noInliners;
 
 	Types::PolyHandler polyHandler;
+
+	CodeCache::Ptr codeCache;
 	
+	// The definitions are set by the preprocessors while another thread might compile
+	CriticalSection definitionLock;
 	ExternalPreprocessorDefinition::List preprocessorDefinitions;
 
 	ComplexType::Ptr blockType;
@@ -38,7 +38,7 @@ USE_ASMJIT_NAMESPACE;
 
 
 
-int Compiler::compileCount = 0;
+std::atomic<int> Compiler::compileCount = { 0 };
 
  void Compiler::reset()
  {
@@ -187,25 +187,38 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 {
 	compileCount++;
 	lastCode = code;
+	compiler->clearAssemblyNotes();
+
+	optimized = !fastCompilation;
+
+	if (fastCompilation)
+		compiler->removeOptimizationPasses({ OptimizationIds::Inlining });
 	
 	try
 	{
 		Preprocessor p(lastCode);
+		p.addDefinitionsFromScope(localDefinitions);
 		p.addDefinitionsFromScope(memory.getPreprocessorDefinitions());
 		preprocessedCode = p.process();
 	}
 	catch (ParserHelpers::Error& e)
 	{
 		compiler->lastResult = Result::fail(e.toString());
+		cr = compiler->lastResult;
+		return {};
 	}
 	catch (juce::String& e)
 	{
 		compiler->lastResult = Result::fail(e);
+		cr = compiler->lastResult;
 		return {};
 	}
 	
 
-	
+#if SNEX_MIR_BACKEND
+	if (auto cache = memory.getCodeCache())
+		return compileWithCodeCache(*cache);
+#endif
 
 	JitObject snexObject(compiler->compileAndGetScope(preprocessedCode));
 
@@ -220,6 +233,7 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 		mir::MirCompiler mc(memory);
 
 		mc.setDataLayout(layout);
+		mc.setOptimizeLevel(fastCompilation ? 0 : 3);
 
 		JitObject mirObject(mc.compileMirCode(getAST()));
 
@@ -241,6 +255,8 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 		assembly = mc.getAssembly();
 #endif
 
+		assembly = compiler->getAssemblyNotes(SNEX_INCLUDE_NMD_ASSEMBLY ? ';' : '#') + assembly;
+
 		return mirObject;
 	}
 	else
@@ -256,11 +272,109 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 }
 
 
+#if SNEX_MIR_BACKEND
+JitObject Compiler::compileWithCodeCache(CodeCache& cache)
+{
+	if (!compiler->parseAndResolveSymbols(preprocessedCode))
+	{
+		cr = compiler->getLastResult();
+		return {};
+	}
+
+	auto options = CodeCache::createOptionString(memory);
+	auto layout = compiler->namespaceHandler.createDataLayouts();
+
+	auto e = cache.load(preprocessedCode, options);
+
+	if (e.isValid())
+	{
+		// The layouts of all types that are known after the symbol resolution
+		// must match the stored layouts (eg. if an external type has changed)
+		auto layoutMatches = [&]()
+		{
+			for (const auto& l : layout)
+			{
+				auto found = false;
+
+				for (const auto& sl : e.dataLayouts)
+				{
+					if (sl["ID"] == l["ID"])
+					{
+						if (!sl.isEquivalentTo(l))
+							return false;
+
+						found = true;
+						break;
+					}
+				}
+
+				if (!found)
+					return false;
+			}
+
+			return true;
+		};
+
+		if (layoutMatches())
+		{
+			mir::MirCompiler mc(memory);
+
+			mc.setDataLayout(e.dataLayouts);
+			mc.setGlobalData(e.globalData);
+
+			JitObject mirObject(mc.compileMirCode(e.mirCode));
+
+			if (mc.getLastError().wasOk() && mirObject)
+			{
+				cr = Result::ok();
+				optimized = true;
+				assembly = mc.getAssembly();
+				return mirObject;
+			}
+		}
+
+		cache.remove(preprocessedCode, options);
+	}
+
+	JitObject snexObject(compiler->finishCompilation());
+
+	cr = compiler->getLastResult();
+
+	if (!cr.wasOk())
+		return {};
+
+	layout = compiler->namespaceHandler.createDataLayouts();
+
+	mir::MirCompiler mc(memory);
+	mc.setDataLayout(layout);
+	mc.setOptimizeLevel(fastCompilation ? 0 : 3);
+
+	JitObject mirObject(mc.compileMirCode(getAST()));
+
+	cr = mc.getLastError();
+	assembly = compiler->getAssemblyNotes('#') + mc.getAssembly();
+
+	// Don't store the code of a fast compilation, the optimized compilation will replace it
+	if (cr.wasOk() && mc.isRelocatable() && !fastCompilation)
+	{
+		CodeCache::Entry newEntry;
+		newEntry.mirCode = mc.getAssembly();
+		newEntry.dataLayouts = layout;
+		newEntry.globalData = mc.getGlobalData();
+
+		cache.store(preprocessedCode, options, newEntry);
+	}
+
+	return mirObject;
+}
+#endif
+
 snex::jit::NamespaceHandler& Compiler::parseWithoutCompilation(const juce::String& code)
 {
 	try
 	{
 		Preprocessor p(code);
+		p.addDefinitionsFromScope(localDefinitions);
 		p.addDefinitionsFromScope(memory.getPreprocessorDefinitions());
 		preprocessedCode = p.process();
 	}
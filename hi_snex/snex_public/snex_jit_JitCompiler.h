@@ -115,6 +115,20 @@ public:
 	juce::String dumpNamespaceTree() const;
 	juce::String getLastCompiledCode() { return lastCode; }
 
+	/** Sets preprocessor definitions for this compiler only. They take precedence over the definitions
+		of the global scope with the same name (eg. to compile a specialised version of some code). */
+	void setPreprocessorDefinitions(const ExternalPreprocessorDefinition::List& l) { localDefinitions = l; }
+
+	/** Compiles the code as fast as possible so that it can run until an optimized version is ready.
+
+		This skips all optimization passes except for the function inliner and uses the lowest 
+		optimization level of the MIR code generator. The result is not stored in the code cache, 
+		but if the cache contains an optimized version, it will be used instead. */
+	void setFastCompilation(bool shouldCompileFast) { fastCompilation = shouldCompileFast; }
+
+	/** Returns true if the last compilation created fully optimized code. */
+	bool isOptimized() const { return optimized; }
+
 	/** This registers an external object as complex type.
 
 	If a similar type already exists, it returns the pointer to this type object,
@@ -131,7 +145,7 @@ public:
 	FunctionClass::Ptr getInbuiltFunctionClass();
 	void initInbuildFunctions();
 
-	static int compileCount;
+	static std::atomic<int> compileCount;
 
 	void reset();
 
@@ -144,12 +158,20 @@ public:
 
 private:
 
+#if SNEX_MIR_BACKEND
+	/** Compiles the code using the given persistent code cache. */
+	JitObject compileWithCodeCache(CodeCache& cache);
+#endif
+
 	Result cr;
 
 	String assembly;
 	NamespaceHandler::Ptr handler;
 	juce::String lastCode;
 	juce::String preprocessedCode;
+	ExternalPreprocessorDefinition::List localDefinitions;
+	bool fastCompilation = false;
+	bool optimized = false;
 	ClassCompiler* compiler = nullptr;
 	GlobalScope& memory;
 
@@ -560,7 +560,207 @@ public:
 
 	}
 
-	
+	void testCodeCache()
+	{
+#if SNEX_MIR_BACKEND
+		beginTest("Testing persistent code cache");
+
+		auto dir = File::createTempFile("snex_code_cache");
+		CodeCache::Ptr cache = new CodeCache(dir);
+
+		const String code = "int x = 5; int test(int input){ return input * x; };";
+
+		auto compileAndCall = [&](const String& c, int input)
+		{
+			GlobalScope s;
+			s.setCodeCache(cache.get());
+
+			for (auto o : optimizations)
+				s.addOptimization(o);
+
+			Compiler compiler(s);
+			auto obj = compiler.compileJitObject(c);
+
+			expectCompileOK(&compiler);
+
+			return obj["test"].call<int>(input);
+		};
+
+		expectEquals(compileAndCall(code, 3), 15, "first compilation");
+		expectEquals(cache->getNumEntries(), 1, "entry wasn't stored");
+		expectEquals(cache->getNumHits(), 0, "hit before storing");
+
+		expectEquals(compileAndCall(code, 4), 20, "cached compilation");
+		expectEquals(cache->getNumHits(), 1, "cache wasn't used");
+
+		expectEquals(compileAndCall(code.replace("5", "6"), 4), 24, "changed source");
+		expectEquals(cache->getNumHits(), 1, "changed source used cache");
+		expectEquals(cache->getNumEntries(), 2, "changed source wasn't stored");
+
+		cache->setMaxSize(cache->getTotalSize() - 1);
+		expectEquals(cache->getNumEntries(), 1, "purge didn't remove the oldest entry");
+
+		cache->setMaxSize(0);
+		expectEquals(cache->getNumEntries(), 0, "cache not empty");
+
+		dir.deleteRecursively();
+#endif
+	}
+
+	void testLoopVectorisation()
+	{
+#if SNEX_MIR_BACKEND
+		beginTest("Testing loop vectorisation");
+
+		const String data = "span<float, 19> d = { 1.0f, -2.0f, 3.0f, 4.0f, 1.0f, 2.0f, 3.0f, 4.0f, 1.0f, 2.0f, 3.0f, -4.0f, 1.0f, -7.0f, 3.0f, 4.0f, 0.5f, 0.25f, -0.5f };\n";
+
+		auto compileAndCall = [&](const String& body, bool vectorise, String& assembly)
+		{
+			GlobalScope s;
+
+			for (auto o : optimizations)
+				s.addOptimization(o);
+
+			if (vectorise)
+				s.addOptimization(OptimizationIds::AutoVectorisation);
+
+			Compiler compiler(s);
+			Types::SnexObjectDatabase::registerObjects(compiler, 2);
+
+			auto obj = compiler.compileJitObject(data + "float test(float input){ " + body + " }");
+
+			expectCompileOK(&compiler);
+			assembly = compiler.getAssemblyCode();
+
+			return obj["test"].call<float>(2.0f);
+		};
+
+		auto expectVectorised = [&](const String& body, const String& expectedNote)
+		{
+			String scalarAssembly, vectorAssembly;
+
+			auto expected = compileAndCall(body, false, scalarAssembly);
+			auto actual = compileAndCall(body, true, vectorAssembly);
+
+			expectWithinAbsoluteError(actual, expected, 0.0001f, body);
+			expect(vectorAssembly.contains(expectedNote), "missing note for " + body);
+		};
+
+		expectVectorised("for(auto& s: d) s *= input; return d[3] + d[18];", "(*s)");
+		expectVectorised("for(auto& s: d) s = input; return d[3] + d[18];", "(=s)");
+		expectVectorised("for(auto& s: d) s = 2.0f * s - input * 0.5f; return d[1] + d[18];", "(*s, -s)");
+		expectVectorised("for(auto& s: d) s = Math.range(Math.abs(s) * input, 0.0f, 5.0f); return d[13] + d[18];", "(abs, *s, maxs, mins)");
+		expectVectorised("float x = 0.0f; for(auto& s: d) x += s; return x;", "(vsum)");
+		expectVectorised("float x = 1.0f; for(auto& s: d) x += s * s; return x;", "(vsumsq)");
+		expectVectorised("float x = -100.0f; for(auto s: d) x = Math.max(s, x); return x;", "(vmax)");
+		expectVectorised("float x = 100.0f; for(auto& s: d) x = Math.min(x, s); return x;", "(vmin)");
+		expectVectorised("float x = 0.0f; for(auto& s: d) x = Math.max(x, Math.abs(s)); return x;", "(vpeak)");
+		expectVectorised("dyn<float> b; b.referTo(d, 16, 2); for(auto& s: b) s += input; float x = 0.0f; for(auto& s: b) x += s; return x + d[0] + d[18];", "vectorised reduction over b");
+
+		// These loops must stay scalar
+		String assembly;
+		compileAndCall("for(auto& s: d) s = s * s; return d[1];", true, assembly);
+		expect(!assembly.contains("vectorised"), "non-invariant operand was vectorised");
+
+		compileAndCall("float x = 0.0f; for(auto& s: d) { x += s; s = 0.0f; } return x;", true, assembly);
+		expect(!assembly.contains("vectorised"), "multiple statements were vectorised");
+
+		{
+			GlobalScope memory;
+			memory.addOptimization(OptimizationIds::AutoVectorisation);
+
+			juce::String code;
+			ADD_CODE_LINE("int test(ProcessData<2>& d)");
+			ADD_CODE_LINE("{");
+			ADD_CODE_LINE("    for(auto& ch: d)");
+			ADD_CODE_LINE("    {");
+			ADD_CODE_LINE("        for(auto& s: d.toChannelData(ch))");
+			ADD_CODE_LINE("            s += 0.5f;");
+			ADD_CODE_LINE("    }");
+			ADD_CODE_LINE("    float sum = 0.0f;");
+			ADD_CODE_LINE("    for(auto& s: d[1])");
+			ADD_CODE_LINE("        sum += s;");
+			ADD_CODE_LINE("    return (int)sum;");
+			ADD_CODE_LINE("}");
+
+			ProcessTestCase test(this, memory, code);
+
+			expectEquals(test.data[0], 0.5f, "first channel");
+			expectEquals(test.data[127], 0.5f, "second channel");
+			expectEquals(test.v, 32, "channel sum");
+		}
+#endif
+	}
+
+	void testTieredCompilation()
+	{
+#if SNEX_MIR_BACKEND
+		beginTest("Testing tiered compilation");
+
+		auto dir = File::createTempFile("snex_tier_cache");
+		CodeCache::Ptr cache = new CodeCache(dir);
+
+		const String code = "span<float, 8> d = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f }; float test(float input){ float s = 0.0f; for(auto& v: d) s += v * 2.0f; return s + input; };";
+
+		auto compileAndCall = [&](bool fast, bool& wasOptimized)
+		{
+			GlobalScope s;
+			s.setCodeCache(cache.get());
+
+			for (auto o : optimizations)
+				s.addOptimization(o);
+
+			Compiler compiler(s);
+			compiler.setFastCompilation(fast);
+			auto obj = compiler.compileJitObject(code);
+
+			expectCompileOK(&compiler);
+			wasOptimized = compiler.isOptimized();
+
+			return obj["test"].call<float>(1.0f);
+		};
+
+		bool optimized = true;
+
+		expectEquals(compileAndCall(true, optimized), 73.0f, "fast compilation");
+		expect(!optimized, "fast compilation is optimized");
+		expectEquals(cache->getNumEntries(), 0, "fast compilation was cached");
+
+		expectEquals(compileAndCall(false, optimized), 73.0f, "optimized compilation");
+		expect(optimized, "optimized compilation is not optimized");
+		expectEquals(cache->getNumEntries(), 1, "optimized compilation wasn't cached");
+
+		expectEquals(compileAndCall(true, optimized), 73.0f, "cached fast compilation");
+		expect(optimized, "fast compilation didn't use the optimized cache entry");
+
+		cache->setMaxSize(0);
+		dir.deleteRecursively();
+#endif
+	}
+
+	void testLongOperatorChain()
+	{
+		beginTest("Testing long operator chains");
+
+		// The optimization passes used to process each operand twice, so this took hours to compile
+		StringArray terms;
+
+		for (int i = 0; i < 40; i++)
+			terms.add("x");
+
+		GlobalScope s;
+
+		for (auto o : optimizations)
+			s.addOptimization(o);
+
+		Compiler compiler(s);
+		auto obj = compiler.compileJitObject("int test(int x){ return " + terms.joinIntoString(" + ") + " + 2 * 3; };");
+
+		expectCompileOK(&compiler);
+		expectEquals(obj["test"].call<int>(2), 86, "operator chain");
+	}
+
+
 
 	void testValueTreeCodeBuilder()
 	{
@@ -752,6 +952,10 @@ public:
 		testMacOSRelocation();
 
 		testExternalFunctionCalls();
+		testCodeCache();
+		testLoopVectorisation();
+		testTieredCompilation();
+		testLongOperatorChain();
 		
 		testEvents();
 
@@ -1,11 +1,15 @@
 
 #include "hi_streaming.h"
 
+#if JUCE_MAC || JUCE_IOS || JUCE_LINUX || JUCE_ANDROID
+#include <sys/mman.h>
+#endif
 
 #include "hi_streaming/SampleThreadPool.cpp"
 #include "hi_streaming/MonolithAudioFormat.cpp"
 #include "hi_streaming/StreamingSampler.cpp"
 #include "hi_streaming/StreamingSamplerSound.cpp"
+#include "hi_streaming/SamplerInterpolation.cpp"
 #include "hi_streaming/StreamingSamplerVoice.cpp"
 
 #include "timestretch//time_stretcher.cpp"
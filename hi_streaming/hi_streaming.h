@@ -86,7 +86,8 @@ Set this to true if you add this module to your existing C++ project and don't e
 
 /** Config: HISE_SAMPLER_CUBIC_INTERPOLATION
 
-Set this to true in order to use cubic interpolation for the sample playback.
+Set this to true in order to use cubic interpolation as default mode for the sample playback. You can change
+the mode of each sampler with Sampler.setInterpolationMode().
 
 */
 #ifndef HISE_SAMPLER_CUBIC_INTERPOLATION
@@ -94,6 +95,34 @@ Set this to true in order to use cubic interpolation for the sample playback.
 #endif
 
 
+/** Config: HISE_USE_MAPPED_MONOLITH_STREAMING
+
+If enabled, the voices will read uncompressed monoliths directly from the memory mapped file instead of copying the
+data into the streaming buffers. The background thread will then only make sure that the next pages are resident.
+*/
+#ifndef HISE_USE_MAPPED_MONOLITH_STREAMING
+#define HISE_USE_MAPPED_MONOLITH_STREAMING 1
+#endif
+
+/** Config: HISE_NUM_STREAMING_THREADS
+
+The number of worker threads that are used for streaming the samples from disk. The default is one thread
+(the sample loading thread), increase this number if you're using big libraries with a lot of voices on fast drives.
+*/
+#ifndef HISE_NUM_STREAMING_THREADS
+#define HISE_NUM_STREAMING_THREADS 1
+#endif
+
+/** Config: HISE_USE_PARALLEL_PRELOADING
+
+If enabled, the preload buffers of a sample map are filled on multiple threads, starting with the samples that are
+most likely to be played (velocity layers around the middle and keys in the visible keyboard range).
+*/
+#ifndef HISE_USE_PARALLEL_PRELOADING
+#define HISE_USE_PARALLEL_PRELOADING 1
+#endif
+
+
 #include "hi_streaming/lockfree_fifo/readerwriterqueue.h"
 #include "hi_streaming/lockfree_fifo/concurrentqueue.h"
 
@@ -103,6 +132,7 @@ Set this to true in order to use cubic interpolation for the sample playback.
 #include "hi_streaming/MonolithAudioFormat.h"
 #include "hi_streaming/StreamingSampler.h"
 #include "hi_streaming/StreamingSamplerSound.h"
+#include "hi_streaming/SamplerInterpolation.h"
 #include "hi_streaming/StreamingSamplerVoice.h"
 
 
@@ -386,6 +386,27 @@ juce::AudioFormatReader* HlacMonolithInfo::createUserInterfaceReader(int sampleI
 	return nullptr;
 }
 
+const int16* HlacMonolithInfo::getMappedSampleData(int sampleIndex, int channelIndex, int& numInterleavedChannels) const
+{
+	numInterleavedChannels = 0;
+
+	if (!isPositiveAndBelow(sampleIndex, sampleInfo.size()))
+		return nullptr;
+
+	const auto& info = sampleInfo[sampleIndex];
+
+	if (auto r = memoryReaders[getFileIndex(channelIndex, sampleIndex)])
+	{
+		if (auto data = r->getRawMonolithData(info.start, info.length))
+		{
+			numInterleavedChannels = (int)r->numChannels;
+			return data;
+		}
+	}
+
+	return nullptr;
+}
+
 juce::AudioFormatReader* HlacMonolithInfo::createMonolithicReader(int sampleIndex, int channelIndex)
 {
 	if (isPositiveAndBelow(sampleIndex, sampleInfo.size()))
@@ -147,6 +147,12 @@ public:
 	/** Use this for UI rendering stuff to avoid multithreading issues. */
 	AudioFormatReader* createUserInterfaceReader(int sampleIndex, int channelIndex);
 
+	/** Returns a pointer to the first frame of the sample if the monolith is uncompressed and mapped into memory. 
+	
+		The data is interleaved, so you need to step through it with the amount of channels that is written into numInterleavedChannels.
+	*/
+	const int16* getMappedSampleData(int sampleIndex, int channelIndex, int& numInterleavedChannels) const;
+
 	using Ptr = ReferenceCountedObjectPtr<HlacMonolithInfo>;
 
 private:
@@ -35,11 +35,36 @@ namespace hise { using namespace juce;
 
 struct SampleThreadPool::Pimpl
 {
-	Pimpl() :
+	/** The measurement data for each worker thread. */
+	struct WorkerData
+	{
+		std::atomic<double> diskUsage = { 0.0 };
+		std::atomic<int64> numJobsProcessed = { 0 };
+		std::atomic<int64> numMissedDeadlines = { 0 };
+		int64 startTime = 0, endTime = 0;
+	};
+
+	/** A entry in the deadline heap. The deadline is stored by value so that the order stays valid. */
+	struct DeadlineEntry
+	{
+		bool operator<(const DeadlineEntry& other) const noexcept
+		{
+			// std::push_heap creates a max heap, so we need to invert the order
+			return deadline > other.deadline;
+		}
+
+		int64 deadline;
+		WeakReference<Job> job;
+	};
+
+	Pimpl(int numWorkerThreads) :
 		jobQueue(8192),
+		deadlineQueue(8192),
 		currentlyExecutedJob(nullptr),
-		diskUsage(0.0)
-	{};
+		workerData(jmax(1, numWorkerThreads))
+	{
+		deadlineHeap.reserve(8192);
+	};
 
 	~Pimpl()
 	{
@@ -49,46 +74,301 @@ struct SampleThreadPool::Pimpl
 		}
 	}
 
-	CriticalSection clearLock;
+	/** Moves all jobs from the lockfree queue into the heap and returns the job with the earliest deadline. */
+	WeakReference<Job> popDeadlineJob()
+	{
+		ScopedLock sl(heapLock);
+
+		WeakReference<Job> next;
+
+		while (deadlineQueue.try_dequeue(next))
+		{
+			if (next != nullptr)
+			{
+				deadlineHeap.push_back({ next->getDeadline(), next });
+				std::push_heap(deadlineHeap.begin(), deadlineHeap.end());
+			}
+		}
+
+		if (deadlineHeap.empty())
+			return nullptr;
+
+		std::pop_heap(deadlineHeap.begin(), deadlineHeap.end());
+		next = deadlineHeap.back().job;
+		deadlineHeap.pop_back();
+
+		return next;
+	}
+
+	/** Runs the job on the given thread and reschedules it if necessary. Returns false if there was nothing to do. */
+	bool runJob(const WeakReference<Job>& next, Thread* thread, int workerIndex)
+	{
+		Job* j = next.get();
+
+		if (j == nullptr)
+			return false;
+
+		const bool isDeadlineJob = j->getDeadline() != 0;
+
+		bool wasRunning = false;
+
+		if (!j->running.compare_exchange_strong(wasRunning, true))
+		{
+			// The job is currently executed by another worker. Instead of queuing it again (and
+			// spinning on it until the other worker is done), we park it and let the worker
+			// that runs the job reschedule it when it's finished.
+			j->rerunRequested.store(true);
+
+			// The other worker might have finished in the meantime without seeing the flag
+			if (!j->running.load() && j->rerunRequested.exchange(false))
+				enqueue(next, isDeadlineJob);
+
+			return true;
+		}
+
+		ScopedReadLock sl(clearLock);
+
+		auto& data = workerData[workerIndex];
+
+		const int64 jobStart = Time::getHighResolutionTicks();
+
+#if ENABLE_CPU_MEASUREMENT
+		const int64 lastEndTime = data.endTime;
+		data.startTime = Time::getHighResolutionTicks();
+
+		if (isDeadlineJob && data.startTime > j->getDeadline())
+			data.numMissedDeadlines.store(data.numMissedDeadlines.load() + 1);
+#endif
+
+		if (workerIndex == 0)
+			currentlyExecutedJob.store(j);
+
+		j->currentThread.store(thread);
+
+		Job::JobStatus status = j->runJob();
+
+		j->running.store(false);
+
+		if (j->rerunRequested.exchange(false))
+			status = Job::jobNeedsRunningAgain;
+
+		if (status == Job::jobHasFinished)
+			j->queued.store(false);
+		else if (status == Job::jobNeedsRunningAgain)
+			enqueue(next, isDeadlineJob);
+
+		if (workerIndex == 0)
+			currentlyExecutedJob.store(nullptr);
+
+		data.numJobsProcessed.store(data.numJobsProcessed.load() + 1);
+
+		if (isDeadlineJob)
+			updateThroughputStats(*j, jobStart);
+
+#if ENABLE_CPU_MEASUREMENT
+		data.endTime = Time::getHighResolutionTicks();
+
+		const int64 idleTime = data.startTime - lastEndTime;
+		const int64 busyTime = data.endTime - data.startTime;
+
+		data.diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
+#endif
+
+		return true;
+	}
+
+	void enqueue(const WeakReference<Job>& j, bool isDeadlineJob)
+	{
+		if (isDeadlineJob)
+			deadlineQueue.enqueue(j);
+		else
+			jobQueue.enqueue(j);
+	}
+
+	void updateThroughputStats(Job& j, int64 jobStart)
+	{
+		const auto numBytes = j.numBytesRead.exchange(0);
+
+		// Jobs that didn't read anything (eg. the mapped streaming) would distort the measurement
+		if (numBytes <= 0)
+			return;
+
+		const auto now = Time::getHighResolutionTicks();
+		const auto latency = Time::highResolutionTicksToSeconds(now - j.queueTime.load());
+		const auto readTime = Time::highResolutionTicksToSeconds(now - jobStart);
+
+		SpinLock::ScopedLockType sl(statsLock);
+
+		const double a = stats.numMeasurements < ThroughputStats::MinNumMeasurements ? 0.5 : 0.05;
+
+		stats.averageLatencySeconds += a * (latency - stats.averageLatencySeconds);
+		stats.peakLatencySeconds = jmax(latency, stats.peakLatencySeconds * 0.999);
+
+		if (readTime > 0.0)
+			stats.bytesPerSecond += a * ((double)numBytes / readTime - stats.bytesPerSecond);
+
+		stats.numMeasurements++;
+	}
+
+	ReadWriteLock clearLock;
+	CriticalSection heapLock;
+
+	SpinLock statsLock;
+	ThroughputStats stats;
+
+	// Jobs can be added from multiple audio threads if the child synths are rendered concurrently
+	moodycamel::ConcurrentQueue<WeakReference<Job>> jobQueue;
+	moodycamel::ConcurrentQueue<WeakReference<Job>> deadlineQueue;
+	std::vector<DeadlineEntry> deadlineHeap;
 
-	std::atomic<double> diskUsage;
-	int64 startTime, endTime;
-	moodycamel::ReaderWriterQueue<WeakReference<Job>> jobQueue;
 	std::atomic<Job*> currentlyExecutedJob;
+
+	std::vector<WorkerData> workerData;
+	OwnedArray<Worker> workers;
+
 	static const String errorMessage;
 };
 
-SampleThreadPool::SampleThreadPool() :
+/** An additional thread that only executes the jobs from the deadline queue. */
+struct SampleThreadPool::Worker : public Thread
+{
+	Worker(SampleThreadPool& parent_, int workerIndex_) :
+		Thread("Sample Streaming Thread " + String(workerIndex_), HISE_DEFAULT_STACK_SIZE),
+		parent(parent_),
+		workerIndex(workerIndex_)
+	{}
+
+	void run() override
+	{
+		while (!threadShouldExit())
+		{
+			auto next = parent.pimpl->popDeadlineJob();
+
+			if (!parent.pimpl->runJob(next, this, workerIndex))
+				wait(500);
+		}
+	}
+
+	SampleThreadPool& parent;
+	const int workerIndex;
+};
+
+SampleThreadPool::SampleThreadPool(int numWorkerThreads) :
 	Thread("Sample Loading Thread", HISE_DEFAULT_STACK_SIZE),
-	pimpl(new Pimpl())
+	pimpl(new Pimpl(numWorkerThreads))
 {
+	for (int i = 1; i < (int)pimpl->workerData.size(); i++)
+		pimpl->workers.add(new Worker(*this, i));
 
 	startThread(9);
-	
+
+	for (auto w : pimpl->workers)
+		w->startThread(9);
 }
 
 SampleThreadPool::~SampleThreadPool()
 {
+	for (auto w : pimpl->workers)
+		w->signalThreadShouldExit();
+
+	for (auto w : pimpl->workers)
+		w->stopThread(1000);
+
 	stopThread(1000);
 	pimpl = nullptr;
 }
 
 double SampleThreadPool::getDiskUsage() const noexcept
 {
-	return pimpl->diskUsage.load();
+	double sum = 0.0;
+
+	for (const auto& d : pimpl->workerData)
+		sum += d.diskUsage.load();
+
+	return sum / (double)pimpl->workerData.size();
+}
+
+double SampleThreadPool::getDiskUsage(int workerIndex) const noexcept
+{
+	if (isPositiveAndBelow(workerIndex, getNumWorkerThreads()))
+		return pimpl->workerData[workerIndex].diskUsage.load();
+
+	return 0.0;
+}
+
+SampleThreadPool::WorkerStats SampleThreadPool::getWorkerStats(int workerIndex) const noexcept
+{
+	WorkerStats s;
+
+	if (isPositiveAndBelow(workerIndex, getNumWorkerThreads()))
+	{
+		const auto& d = pimpl->workerData[workerIndex];
+		s.diskUsage = d.diskUsage.load();
+		s.numJobsProcessed = d.numJobsProcessed.load();
+		s.numMissedDeadlines = d.numMissedDeadlines.load();
+	}
+
+	return s;
+}
+
+SampleThreadPool::ThroughputStats SampleThreadPool::getThroughputStats() const noexcept
+{
+	SpinLock::ScopedLockType sl(pimpl->statsLock);
+	return pimpl->stats;
+}
+
+int SampleThreadPool::ThroughputStats::getMinimumPreloadSize(int streamingBufferSize, int bytesPerFrame, double sampleRate, double maxPitchRatio, int numVoices, int numWorkers, int blockSize) const
+{
+	if (numMeasurements < MinNumMeasurements || bytesPerSecond <= 0.0)
+		return -1;
+
+	// The time it takes to read one streaming buffer and the worst case if all voices start at the same time
+	const double readTime = (double)streamingBufferSize * (double)bytesPerFrame / bytesPerSecond;
+	const double queueTime = readTime * std::ceil((double)jmax(1, numVoices) / (double)jmax(1, numWorkers));
+
+	const double secondsToBridge = jmax(peakLatencySeconds, readTime + queueTime);
+
+	// The safety factor covers pitch modulation and the jitter of the measurement
+	const double safetyFactor = 2.0;
+
+	const double numSamples = (secondsToBridge * sampleRate + (double)blockSize) * maxPitchRatio * safetyFactor;
+
+	// Round up to a multiple of the HLAC block size so that no block is decoded partially
+	return ((int)std::ceil(numSamples) + 4095) & ~4095;
+}
+
+int SampleThreadPool::getNumWorkerThreads() const noexcept
+{
+	return (int)pimpl->workerData.size();
 }
 
 void SampleThreadPool::clearPendingTasks()
 {
-	ScopedLock sl(pimpl->clearLock);
+	ScopedWriteLock sl(pimpl->clearLock);
 		
 	WeakReference<Job> next;
 
-	while (pimpl->jobQueue.try_dequeue(next))
+	auto cancelJob = [](Job* j)
 	{
-		next->queued.store(false);
-		next->signalJobShouldExit();
-	}
+		if (j != nullptr)
+		{
+			j->queued.store(false);
+			j->signalJobShouldExit();
+		}
+	};
+
+	while (pimpl->jobQueue.try_dequeue(next))
+		cancelJob(next.get());
+
+	ScopedLock hl(pimpl->heapLock);
+
+	while (pimpl->deadlineQueue.try_dequeue(next))
+		cancelJob(next.get());
+
+	for (auto& e : pimpl->deadlineHeap)
+		cancelJob(e.job.get());
+
+	pimpl->deadlineHeap.clear();
 }
 
 void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
@@ -102,79 +382,64 @@ void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
 	}
 #endif
 
-
+	jobToAdd->deadline.store(0);
 	jobToAdd->queued.store(true);
 	pimpl->jobQueue.enqueue(jobToAdd);
 
 	notify();
 }
 
-void SampleThreadPool::run()
+void SampleThreadPool::addJobWithDeadline(Job* jobToAdd, int numSamplesUntilDeadline, double sampleRate)
 {
-	while (!threadShouldExit())
+#if ENABLE_CONSOLE_OUTPUT
+	if (jobToAdd->isQueued())
 	{
-		WeakReference<Job> next;
-
-		if (pimpl->jobQueue.try_dequeue(next))
-		{
-			ScopedLock sl(pimpl->clearLock);
-
-			Job* j = next.get();
-
-#if ENABLE_CPU_MEASUREMENT
-
-			const int64 lastEndTime = pimpl->endTime;
-			pimpl->startTime = Time::getHighResolutionTicks();
+		Logger::writeToLog(pimpl->errorMessage);
+	}
 #endif
 
-			if (j != nullptr)
-			{
-				pimpl->currentlyExecutedJob.store(j);
+	const double secondsLeft = sampleRate > 0.0 ? (double)jmax(0, numSamplesUntilDeadline) / sampleRate : 0.0;
 
-				j->currentThread.store(this);
+	// make sure that the deadline is never zero so it won't end up in the FIFO queue
+	const int64 now = Time::getHighResolutionTicks();
+	const int64 deadline = jmax((int64)1, now + Time::secondsToHighResolutionTicks(secondsLeft));
 
-				j->running.store(true);
-				
-				Job::JobStatus status = j->runJob();
-
-				j->running.store(false);
+	jobToAdd->queueTime.store(now);
+	jobToAdd->deadline.store(deadline);
+	jobToAdd->queued.store(true);
+	pimpl->deadlineQueue.enqueue(jobToAdd);
 
-				if (status == Job::jobHasFinished)
-				{
-					j->queued.store(false);
-				}
-				else if (status == Job::jobNeedsRunningAgain)
-				{
-					pimpl->jobQueue.enqueue(next);
-				}
+	notify();
 
-				pimpl->currentlyExecutedJob.store(nullptr);
-			}
-			else
-			{
-				pimpl->jobQueue.pop();
-			}
+	for (auto w : pimpl->workers)
+		w->notify();
+}
 
-#if ENABLE_CPU_MEASUREMENT
-			pimpl->endTime = Time::getHighResolutionTicks();
+void SampleThreadPool::run()
+{
+	while (!threadShouldExit())
+	{
+		WeakReference<Job> next;
 
-			const int64 idleTime = pimpl->startTime - lastEndTime;
-			const int64 busyTime = pimpl->endTime - pimpl->startTime;
+		// The FIFO queue has priority because it's used for preloading & other tasks
+		// that must be executed on this thread.
+		if (pimpl->jobQueue.try_dequeue(next))
+		{
+			if (next == nullptr)
+				continue;
 
-			pimpl->diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
-#endif
+			pimpl->runJob(next, this, 0);
+			continue;
 		}
 
 #if 0 // Set this to true to enable defective threading (for debugging purposes)
 		wait(2500);
-#else
-		else
-		{
-			wait(500);
-		}
 #endif
 
+		next = pimpl->popDeadlineJob();
 
+		if (!pimpl->runJob(next, this, 0))
+			wait(500);
 	}
 }
 
@@ -185,6 +450,7 @@ void SampleThreadPool::Job::resetJob()
 {
 	queued.store(false);
 	running.store(false);
+	rerunRequested.store(false);
 	shouldStop.store(false);
 	currentThread.store(nullptr);
 }
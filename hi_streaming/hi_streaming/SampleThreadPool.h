@@ -35,14 +35,64 @@
 
 namespace hise { using namespace juce;
 
+/** The background thread pool that loads the streaming buffers of the sampler voices.
+
+	The pool itself is a thread that processes the jobs that are added with addJob() in FIFO order
+	(this is the "Sample Loading Thread" that is used for preloading & other background tasks).
+
+	Jobs that are added with addJobWithDeadline() are put into a separate queue that is serviced by
+	all worker threads (including this one) with the job that has the earliest deadline first. This is
+	used by the SampleLoader so that one slow read operation doesn't block the other streaming voices.
+*/
 class SampleThreadPool : public Thread
 {
 public:
 
-	SampleThreadPool();
+	/** Creates a pool with the given amount of worker threads (including the sample loading thread). */
+	SampleThreadPool(int numWorkerThreads=HISE_NUM_STREAMING_THREADS);
 
 	~SampleThreadPool();
 	
+	/** The statistics for a single worker thread. */
+	struct WorkerStats
+	{
+		double diskUsage = 0.0;
+		int64 numJobsProcessed = 0;
+		int64 numMissedDeadlines = 0;
+	};
+
+	/** The measured read performance of the streaming jobs (summed over all worker threads). */
+	struct ThroughputStats
+	{
+		/** Calculates the amount of samples that a sound must preload so that the first streaming buffer is ready in time.
+		*
+		*	@param streamingBufferSize the amount of samples that are read per streaming job
+		*	@param bytesPerFrame the size of one (multichannel) sample in the streaming buffer
+		*	@param sampleRate the playback sample rate
+		*	@param maxPitchRatio the fastest speed that the sound will be played back with
+		*	@param numVoices the amount of voices that might request data at the same time
+		*	@param numWorkers the amount of threads that process the streaming jobs
+		*	@param blockSize the audio buffer size (the voice requests new data at the block borders)
+		*
+		*	Returns -1 if there are not enough measurements yet.
+		*/
+		int getMinimumPreloadSize(int streamingBufferSize, int bytesPerFrame, double sampleRate, double maxPitchRatio, int numVoices, int numWorkers, int blockSize) const;
+
+		/** The smoothed time between adding a job and its completion. */
+		double averageLatencySeconds = 0.0;
+
+		/** The slowly decaying maximum latency. */
+		double peakLatencySeconds = 0.0;
+
+		/** The smoothed read speed of the jobs (only the time spent in the job is measured). */
+		double bytesPerSecond = 0.0;
+
+		int64 numMeasurements = 0;
+
+		/** The minimum amount of measurements before the stats are considered to be valid. */
+		static constexpr int64 MinNumMeasurements = 32;
+	};
+
 
 	class Job
 	{
@@ -73,10 +123,16 @@ public:
 
 		bool isQueued() const noexcept{ return queued.load(); };
 
+		/** Returns the deadline (in high resolution ticks) of the job or 0 if it's a FIFO job. */
+		int64 getDeadline() const noexcept { return deadline.load(); }
+
 	protected:
 
 		void resetJob();
 
+		/** Call this in runJob() with the amount of bytes that were read from disk. This is used for the throughput measurement. */
+		void reportBytesRead(int64 numBytes) noexcept { numBytesRead.store(numBytesRead.load() + numBytes); }
+
 		Thread* getCurrentThread() { return currentThread.load(); }
 
 	private:
@@ -87,21 +143,50 @@ public:
 
 		std::atomic<bool> queued;
 		std::atomic<bool> running;
+		std::atomic<bool> rerunRequested = { false };
 		std::atomic<bool> shouldStop;
 		std::atomic<Thread*> currentThread;
+		std::atomic<int64> deadline = { 0 };
+		std::atomic<int64> queueTime = { 0 };
+		std::atomic<int64> numBytesRead = { 0 };
 
 		const String name;
 	};
 
+	/** Returns the average disk usage of all worker threads. */
 	double getDiskUsage() const noexcept;
 
+	/** Returns the disk usage of the given worker thread. */
+	double getDiskUsage(int workerIndex) const noexcept;
+
+	/** Returns the statistics of the given worker thread (index 0 is the sample loading thread). */
+	WorkerStats getWorkerStats(int workerIndex) const noexcept;
+
+	/** Returns the measured latency and throughput of the streaming jobs. */
+	ThroughputStats getThroughputStats() const noexcept;
+
+	int getNumWorkerThreads() const noexcept;
+
 	void clearPendingTasks();
 
+	/** Adds a job to the FIFO queue of the sample loading thread. */
 	void addJob(Job* jobToAdd, bool unused);
 
+	/** Adds a job to the deadline queue.
+
+		The deadline is the amount of samples that the caller can still play before it needs the result
+		of the job (at the given rate of samples per second). The job with the earliest deadline will
+		be executed by the next free worker thread.
+
+		This doesn't lock, so it can be called from the audio thread, but the queue might allocate a
+		new block if its capacity is exceeded.
+	*/
+	void addJobWithDeadline(Job* jobToAdd, int numSamplesUntilDeadline, double sampleRate);
+
 	void run() override;
 
 	struct Pimpl;
+	struct Worker;
 
 	
 	ScopedPointer<Pimpl> pimpl;
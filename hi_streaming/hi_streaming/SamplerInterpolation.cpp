@@ -0,0 +1,699 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#if JUCE_ARM
+#include "../../hi_tools/hi_tools/sse2neon.h"
+#endif
+
+#define HISE_SAMPLER_SIMD_KERNELS JUCE_USE_SIMD
+
+namespace hise { using namespace juce;
+
+struct SamplerInterpolation::Kernels
+{
+	static constexpr float Int16Gain = 1.0f / (float)INT16_MAX;
+
+	/** A windowed sinc table with the coefficients for equally spaced fractional read positions. */
+	struct SincTable
+	{
+		static constexpr int NumPhases = 256;
+
+		SincTable()
+		{
+			constexpr double cutoff = 0.95;
+			const double pi = MathConstants<double>::pi;
+
+			// one more phase for the interpolation between the phases
+			for (int p = 0; p <= NumPhases; p++)
+			{
+				const double fraction = (double)p / (double)NumPhases;
+
+				double values[NumSincTaps];
+				double sum = 0.0;
+
+				for (int t = 0; t < NumSincTaps; t++)
+				{
+					const double x = (double)(t - MaxSamplesBefore) - fraction;
+					const double sinc = x == 0.0 ? 1.0 : std::sin(pi * cutoff * x) / (pi * cutoff * x);
+					const double window = 0.42 + 0.5 * std::cos(pi * x / (double)MaxSamplesAfter) + 0.08 * std::cos(2.0 * pi * x / (double)MaxSamplesAfter);
+
+					values[t] = sinc * window;
+					sum += values[t];
+				}
+
+				// normalise the DC gain
+				for (int t = 0; t < NumSincTaps; t++)
+					coefficients[p * NumSincTaps + t] = (float)(values[t] / sum);
+			}
+		}
+
+		alignas(16) float coefficients[(NumPhases + 1) * NumSincTaps];
+	};
+
+	static const SincTable& getSincTable()
+	{
+		static const SincTable table;
+		return table;
+	}
+
+	// ============================================================================================ linear
+
+	template <typename T> static void linearScalar(const T* l, const T* r, float gainL, float gainR, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		for (int i = 0; i < numSamples; i++)
+		{
+			const int index = (int)pos[i];
+			const float alpha = pos[i] - (float)index;
+
+			outL[i] = Interpolator::interpolateLinear((float)l[index], (float)l[index + 1], alpha) * gainL;
+
+			if (r != nullptr)
+				outR[i] = Interpolator::interpolateLinear((float)r[index], (float)r[index + 1], alpha) * gainR;
+		}
+	}
+
+#if HISE_SAMPLER_SIMD_KERNELS
+	static forcedinline __m128 lerp(__m128 x1, __m128 x2, __m128 alpha) noexcept
+	{
+		const auto invAlpha = _mm_sub_ps(_mm_set1_ps(1.0f), alpha);
+		return _mm_add_ps(_mm_mul_ps(invAlpha, x1), _mm_mul_ps(alpha, x2));
+	}
+
+	/** Loads the sample at each index and the sample after it into the lower and upper 16 bit of a 32 bit lane. */
+	static forcedinline __m128i loadInt16Pairs(const int16* data, const int* indexes) noexcept
+	{
+		int32 v[4];
+
+		for (int k = 0; k < 4; k++)
+			memcpy(v + k, data + indexes[k], sizeof(int32));
+
+		return _mm_setr_epi32(v[0], v[1], v[2], v[3]);
+	}
+
+	static forcedinline __m128 linearInt16x4(const int16* data, const int* indexes, __m128 alpha, __m128 gain) noexcept
+	{
+		const auto v = loadInt16Pairs(data, indexes);
+		const auto x1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(v, 16), 16));
+		const auto x2 = _mm_cvtepi32_ps(_mm_srai_epi32(v, 16));
+
+		return _mm_mul_ps(lerp(x1, x2, alpha), gain);
+	}
+
+	static forcedinline __m128 linearFloatx4(const float* data, const int* i, __m128 alpha) noexcept
+	{
+		const auto x1 = _mm_setr_ps(data[i[0]], data[i[1]], data[i[2]], data[i[3]]);
+		const auto x2 = _mm_setr_ps(data[i[0] + 1], data[i[1] + 1], data[i[2] + 1], data[i[3] + 1]);
+
+		return lerp(x1, x2, alpha);
+	}
+#endif
+
+#if defined(__AVX2__)
+	static forcedinline __m256 lerp(__m256 x1, __m256 x2, __m256 alpha) noexcept
+	{
+		const auto invAlpha = _mm256_sub_ps(_mm256_set1_ps(1.0f), alpha);
+		return _mm256_add_ps(_mm256_mul_ps(invAlpha, x1), _mm256_mul_ps(alpha, x2));
+	}
+
+	static forcedinline __m256 linearInt16x8(const int16* data, __m256i indexes, __m256 alpha, __m256 gain) noexcept
+	{
+		// A 32 bit gather at the read position loads both samples at once
+		const auto v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(data), indexes, 2);
+		const auto x1 = _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16));
+		const auto x2 = _mm256_cvtepi32_ps(_mm256_srai_epi32(v, 16));
+
+		return _mm256_mul_ps(lerp(x1, x2, alpha), gain);
+	}
+
+	static forcedinline __m256 linearFloatx8(const float* data, __m256i indexes, __m256 alpha) noexcept
+	{
+		const auto x1 = _mm256_i32gather_ps(data, indexes, 4);
+		const auto x2 = _mm256_i32gather_ps(data + 1, indexes, 4);
+
+		return lerp(x1, x2, alpha);
+	}
+#endif
+
+	static void linear(const int16* l, const int16* r, float gainL, float gainR, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		int i = 0;
+
+#if defined(__AVX2__)
+		const auto gl8 = _mm256_set1_ps(gainL);
+		const auto gr8 = _mm256_set1_ps(gainR);
+
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			const auto p = _mm256_loadu_ps(pos + i);
+			const auto indexes = _mm256_cvttps_epi32(p);
+			const auto alpha = _mm256_sub_ps(p, _mm256_cvtepi32_ps(indexes));
+
+			_mm256_storeu_ps(outL + i, linearInt16x8(l, indexes, alpha, gl8));
+
+			if (r != nullptr)
+				_mm256_storeu_ps(outR + i, linearInt16x8(r, indexes, alpha, gr8));
+		}
+#endif
+
+#if HISE_SAMPLER_SIMD_KERNELS
+		const auto gl = _mm_set1_ps(gainL);
+		const auto gr = _mm_set1_ps(gainR);
+		alignas(16) int indexes[4];
+
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			const auto p = _mm_loadu_ps(pos + i);
+			const auto pi = _mm_cvttps_epi32(p);
+			const auto alpha = _mm_sub_ps(p, _mm_cvtepi32_ps(pi));
+
+			_mm_store_si128(reinterpret_cast<__m128i*>(indexes), pi);
+
+			_mm_storeu_ps(outL + i, linearInt16x4(l, indexes, alpha, gl));
+
+			if (r != nullptr)
+				_mm_storeu_ps(outR + i, linearInt16x4(r, indexes, alpha, gr));
+		}
+#endif
+
+		linearScalar(l, r, gainL, gainR, pos + i, outL + i, r != nullptr ? outR + i : nullptr, numSamples - i);
+	}
+
+	static void linear(const float* l, const float* r, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		int i = 0;
+
+#if defined(__AVX2__)
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			const auto p = _mm256_loadu_ps(pos + i);
+			const auto indexes = _mm256_cvttps_epi32(p);
+			const auto alpha = _mm256_sub_ps(p, _mm256_cvtepi32_ps(indexes));
+
+			_mm256_storeu_ps(outL + i, linearFloatx8(l, indexes, alpha));
+
+			if (r != nullptr)
+				_mm256_storeu_ps(outR + i, linearFloatx8(r, indexes, alpha));
+		}
+#endif
+
+#if HISE_SAMPLER_SIMD_KERNELS
+		alignas(16) int indexes[4];
+
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			const auto p = _mm_loadu_ps(pos + i);
+			const auto pi = _mm_cvttps_epi32(p);
+			const auto alpha = _mm_sub_ps(p, _mm_cvtepi32_ps(pi));
+
+			_mm_store_si128(reinterpret_cast<__m128i*>(indexes), pi);
+
+			_mm_storeu_ps(outL + i, linearFloatx4(l, indexes, alpha));
+
+			if (r != nullptr)
+				_mm_storeu_ps(outR + i, linearFloatx4(r, indexes, alpha));
+		}
+#endif
+
+		linearScalar(l, r, 1.0f, 1.0f, pos + i, outL + i, r != nullptr ? outR + i : nullptr, numSamples - i);
+	}
+
+	static void renderLinear(const hlac::HiseSampleBuffer& b, int offsetInBuffer, bool isStereo, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		if (b.isFloatingPoint())
+		{
+			auto l = static_cast<const float*>(b.getReadPointer(0, offsetInBuffer));
+			auto r = isStereo ? static_cast<const float*>(b.getReadPointer(1, offsetInBuffer)) : nullptr;
+
+			linear(l, r, pos, outL, outR, numSamples);
+			return;
+		}
+
+		auto l = static_cast<const int16*>(b.getReadPointer(0, offsetInBuffer));
+		auto r = isStereo ? static_cast<const int16*>(b.getReadPointer(1, offsetInBuffer)) : nullptr;
+
+		if (!b.usesNormalisation())
+		{
+			linear(l, r, Int16Gain, Int16Gain, pos, outL, outR, numSamples);
+			return;
+		}
+
+		// Split the block at the borders of the normalisation ranges so that the gain is constant for each kernel call
+		int i = 0;
+
+		while (i < numSamples)
+		{
+			const int index = (int)pos[i];
+
+			float gainL, gainR;
+			const int segmentEnd = b.getNormalisationSegment(offsetInBuffer + index, gainL, gainR) - offsetInBuffer;
+
+			int end = i;
+
+			while (end < numSamples && (int)pos[end] + 1 < segmentEnd)
+				end++;
+
+			if (end > i)
+			{
+				linear(l, r, gainL * Int16Gain, gainR * Int16Gain, pos + i, outL + i, r != nullptr ? outR + i : nullptr, end - i);
+				i = end;
+			}
+			else
+			{
+				// The two samples are in different normalisation ranges
+				float nextGainL, nextGainR;
+				b.getNormalisationSegment(offsetInBuffer + index + 1, nextGainL, nextGainR);
+
+				const float alpha = pos[i] - (float)index;
+
+				outL[i] = Interpolator::interpolateLinear((float)l[index] * gainL, (float)l[index + 1] * nextGainL, alpha) * Int16Gain;
+
+				if (r != nullptr)
+					outR[i] = Interpolator::interpolateLinear((float)r[index] * gainR, (float)r[index + 1] * nextGainR, alpha) * Int16Gain;
+
+				i++;
+			}
+		}
+	}
+
+	/** Interpolates interleaved stereo 16 bit frames (eg. from a memory mapped monolith). */
+	static void linearInterleavedStereo(const int16* data, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		int i = 0;
+
+#if HISE_SAMPLER_SIMD_KERNELS
+		const auto gain = _mm_set1_ps(Int16Gain);
+		alignas(16) int indexes[4];
+
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			const auto p = _mm_loadu_ps(pos + i);
+			const auto pi = _mm_cvttps_epi32(p);
+			const auto alpha = _mm_sub_ps(p, _mm_cvtepi32_ps(pi));
+
+			_mm_store_si128(reinterpret_cast<__m128i*>(indexes), pi);
+
+			// A 64 bit load at the read position contains both channels of both frames
+			int64 v[4];
+
+			for (int k = 0; k < 4; k++)
+				memcpy(v + k, data + indexes[k] * 2, sizeof(int64));
+
+			const auto a = _mm_castsi128_ps(_mm_set_epi64x(v[1], v[0]));
+			const auto b = _mm_castsi128_ps(_mm_set_epi64x(v[3], v[2]));
+
+			// the first and the second frame of each position with the left channel in the lower 16 bit
+			const auto f1 = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			const auto f2 = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+
+			const auto l1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(f1, 16), 16));
+			const auto l2 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(f2, 16), 16));
+			const auto r1 = _mm_cvtepi32_ps(_mm_srai_epi32(f1, 16));
+			const auto r2 = _mm_cvtepi32_ps(_mm_srai_epi32(f2, 16));
+
+			_mm_storeu_ps(outL + i, _mm_mul_ps(lerp(l1, l2, alpha), gain));
+			_mm_storeu_ps(outR + i, _mm_mul_ps(lerp(r1, r2, alpha), gain));
+		}
+#endif
+
+		for (; i < numSamples; i++)
+		{
+			const int index = (int)pos[i];
+			const float alpha = pos[i] - (float)index;
+			const auto frame = data + index * 2;
+
+			outL[i] = Interpolator::interpolateLinear((float)frame[0], (float)frame[2], alpha) * Int16Gain;
+			outR[i] = Interpolator::interpolateLinear((float)frame[1], (float)frame[3], alpha) * Int16Gain;
+		}
+	}
+
+	// ============================================================================================ cubic
+
+#if HISE_SAMPLER_SIMD_KERNELS
+	static forcedinline __m128 cubicx4(const float* data, const int* i, __m128 alpha) noexcept
+	{
+		auto x0 = _mm_loadu_ps(data + i[0] - 1);
+		auto x1 = _mm_loadu_ps(data + i[1] - 1);
+		auto x2 = _mm_loadu_ps(data + i[2] - 1);
+		auto x3 = _mm_loadu_ps(data + i[3] - 1);
+
+		// now x0 contains the samples before the read positions, x1 the samples at the read positions etc.
+		_MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+
+		const auto half = _mm_set1_ps(0.5f);
+
+		const auto a = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(3.0f), _mm_sub_ps(x1, x2)), x0), x3), half);
+		const auto b = _mm_sub_ps(_mm_add_ps(_mm_add_ps(x2, x2), x0), _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(5.0f), x1), x3), half));
+		const auto c = _mm_mul_ps(_mm_sub_ps(x2, x0), half);
+
+		return _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(a, alpha), b), alpha), c), alpha), x1);
+	}
+#endif
+
+	static void cubic(const float* l, const float* r, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		int i = 0;
+
+#if HISE_SAMPLER_SIMD_KERNELS
+		alignas(16) int indexes[4];
+
+		for (; i + 4 <= numSamples; i += 4)
+		{
+			const auto p = _mm_loadu_ps(pos + i);
+			const auto pi = _mm_cvttps_epi32(p);
+			const auto alpha = _mm_sub_ps(p, _mm_cvtepi32_ps(pi));
+
+			_mm_store_si128(reinterpret_cast<__m128i*>(indexes), pi);
+
+			_mm_storeu_ps(outL + i, cubicx4(l, indexes, alpha));
+
+			if (r != nullptr)
+				_mm_storeu_ps(outR + i, cubicx4(r, indexes, alpha));
+		}
+#endif
+
+		for (; i < numSamples; i++)
+		{
+			const int index = (int)pos[i];
+			const float alpha = pos[i] - (float)index;
+
+			outL[i] = Interpolator::interpolateCubic(l[index - 1], l[index], l[index + 1], l[index + 2], alpha);
+
+			if (r != nullptr)
+				outR[i] = Interpolator::interpolateCubic(r[index - 1], r[index], r[index + 1], r[index + 2], alpha);
+		}
+	}
+
+	// ============================================================================================ sinc
+
+	static forcedinline float sincScalar(const float* data, const float* c0, const float* c1, float fraction) noexcept
+	{
+		float sum = 0.0f;
+
+		for (int t = 0; t < NumSincTaps; t++)
+			sum += data[t] * Interpolator::interpolateLinear(c0[t], c1[t], fraction);
+
+		return sum;
+	}
+
+#if HISE_SAMPLER_SIMD_KERNELS
+	static forcedinline float dot8(const float* data, __m128 lo, __m128 hi) noexcept
+	{
+		auto sum = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(data), lo), _mm_mul_ps(_mm_loadu_ps(data + 4), hi));
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+		sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+		return _mm_cvtss_f32(sum);
+	}
+#endif
+
+	static void sinc(const float* l, const float* r, const float* pos, float* outL, float* outR, int numSamples) noexcept
+	{
+		static_assert(NumSincTaps == 8, "the SIMD kernel expects 8 taps");
+
+		const auto& table = getSincTable();
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			const int index = (int)pos[i];
+			const float phase = (pos[i] - (float)index) * (float)SincTable::NumPhases;
+			const int phaseIndex = jmin((int)phase, SincTable::NumPhases - 1);
+			const float fraction = phase - (float)phaseIndex;
+
+			const float* c0 = table.coefficients + phaseIndex * NumSincTaps;
+			const float* c1 = c0 + NumSincTaps;
+
+			const int firstTap = index - MaxSamplesBefore;
+
+#if HISE_SAMPLER_SIMD_KERNELS
+			// interpolate between the coefficients of the two adjacent phases
+			const auto f = _mm_set1_ps(fraction);
+			const auto lo = lerp(_mm_load_ps(c0), _mm_load_ps(c1), f);
+			const auto hi = lerp(_mm_load_ps(c0 + 4), _mm_load_ps(c1 + 4), f);
+
+			outL[i] = dot8(l + firstTap, lo, hi);
+
+			if (r != nullptr)
+				outR[i] = dot8(r + firstTap, lo, hi);
+#else
+			outL[i] = sincScalar(l + firstTap, c0, c1, fraction);
+
+			if (r != nullptr)
+				outR[i] = sincScalar(r + firstTap, c0, c1, fraction);
+#endif
+		}
+	}
+
+	// ============================================================================================ sources
+
+	struct SampleBufferSource
+	{
+		// a mono buffer (or a 16 bit buffer with a single normalisation map) returns the same pointer for both channels
+		bool isStereo() const noexcept { return b.getReadPointer(0, offset) != b.getReadPointer(1, offset); }
+
+		void renderLinear(const float* pos, float* l, float* r, int numSamples) const noexcept
+		{
+			Kernels::renderLinear(b, offset, isStereo(), pos, l, r, numSamples);
+		}
+
+		void convertToFloat(float* l, float* r, int numSamples) const noexcept
+		{
+			if (b.isFloatingPoint())
+			{
+				FloatVectorOperations::copy(l, static_cast<const float*>(b.getReadPointer(0, offset)), numSamples);
+
+				if (r != nullptr)
+					FloatVectorOperations::copy(r, static_cast<const float*>(b.getReadPointer(1, offset)), numSamples);
+			}
+			else
+			{
+				float* d[2] = { l, r };
+				b.convertToFloatWithNormalisation(d, r != nullptr ? 2 : 1, offset, numSamples);
+			}
+		}
+
+		const hlac::HiseSampleBuffer& b;
+		const int offset;
+	};
+
+	struct InterleavedSource
+	{
+		bool isStereo() const noexcept { return numChannels == 2; }
+
+		void renderLinear(const float* pos, float* l, float* r, int numSamples) const noexcept
+		{
+			if (isStereo())
+				linearInterleavedStereo(data, pos, l, r, numSamples);
+			else
+				linear(data, nullptr, Int16Gain, Int16Gain, pos, l, nullptr, numSamples);
+		}
+
+		void convertToFloat(float* l, float* r, int numSamples) const noexcept
+		{
+			const int stride = numChannels * (int)sizeof(int16);
+
+			AudioDataConverters::convertInt16LEToFloat(data, l, numSamples, stride);
+
+			if (r != nullptr)
+				AudioDataConverters::convertInt16LEToFloat(data + 1, r, numSamples, stride);
+		}
+
+		const int16* data;
+		const int numChannels;
+	};
+
+	template <typename SourceType> static int process(Mode m, const SourceType& source, int numAvailable, float* outL, float* outR, int numSamples, 
+		                                              double startPosition, const float* pitchData, double uptimeDelta, double numConsumed, History& history)
+	{
+		const bool isStereo = source.isStereo();
+
+		const int numBefore = getNumSamplesBefore(m);
+		const int numAfter = getNumSamplesAfter(m);
+
+		int numReadable = numAvailable;
+		float* stagedL = nullptr;
+		float* stagedR = nullptr;
+
+		if (m != Mode::Linear)
+		{
+			// Convert the samples into a float buffer that starts with the last samples of the previous block
+			const int numStaged = jlimit(0, numAvailable, (int)std::ceil(startPosition + numConsumed) + numAfter + 1);
+
+			stagedL = (float*)alloca(sizeof(float) * (numBefore + numStaged));
+			stagedR = isStereo ? (float*)alloca(sizeof(float) * (numBefore + numStaged)) : nullptr;
+
+			memcpy(stagedL, history.data[0], sizeof(float) * numBefore);
+
+			if (stagedR != nullptr)
+				memcpy(stagedR, history.data[1], sizeof(float) * numBefore);
+
+			if (numStaged > 0)
+				source.convertToFloat(stagedL + numBefore, stagedR != nullptr ? stagedR + numBefore : nullptr, numStaged);
+
+			// Store the samples before the read position of the next block
+			const int nextIndex = (int)(startPosition + numConsumed);
+
+			for (int i = 0; i < numBefore; i++)
+			{
+				const int stagedIndex = nextIndex + i;
+				const bool valid = isPositiveAndBelow(stagedIndex, numBefore + numStaged);
+
+				history.data[0][i] = valid ? stagedL[stagedIndex] : 0.0f;
+				history.data[1][i] = valid ? (stagedR != nullptr ? stagedR[stagedIndex] : stagedL[stagedIndex]) : 0.0f;
+			}
+
+			numReadable = numStaged;
+		}
+
+		constexpr int ChunkSize = 64;
+		float positions[ChunkSize];
+
+		const float positionOffset = (float)numBefore;
+		const float limit = (float)(numReadable - numAfter);
+		const float delta = (float)uptimeDelta;
+
+		float position = (float)startPosition;
+		int numRendered = 0;
+
+		while (numRendered < numSamples)
+		{
+			const int numThisTime = jmin(ChunkSize, numSamples - numRendered);
+			int numValid = 0;
+
+			// The positions are accumulated serially so that the rounding doesn't depend on the kernel
+			while (numValid < numThisTime && position < limit)
+			{
+				positions[numValid] = position + positionOffset;
+				position += pitchData != nullptr ? pitchData[numRendered + numValid] : delta;
+				numValid++;
+			}
+
+			auto l = outL + numRendered;
+			auto r = isStereo ? outR + numRendered : nullptr;
+
+			switch (m)
+			{
+			case Mode::Linear: source.renderLinear(positions, l, r, numValid); break;
+			case Mode::Cubic:  cubic(stagedL, stagedR, positions, l, r, numValid); break;
+			case Mode::Sinc:   sinc(stagedL, stagedR, positions, l, r, numValid); break;
+			default:		   jassertfalse; break;
+			}
+
+			numRendered += numValid;
+
+			if (numValid < numThisTime)
+				break;
+		}
+
+		if (numRendered < numSamples)
+		{
+			FloatVectorOperations::clear(outL + numRendered, numSamples - numRendered);
+
+			if (isStereo)
+				FloatVectorOperations::clear(outR + numRendered, numSamples - numRendered);
+		}
+
+		if (!isStereo)
+			FloatVectorOperations::copy(outR, outL, numSamples);
+
+		return numRendered;
+	}
+};
+
+StringArray SamplerInterpolation::getModeNames()
+{
+	return { "Linear", "Cubic", "Sinc" };
+}
+
+SamplerInterpolation::Mode SamplerInterpolation::getModeFromName(const String& name)
+{
+	auto index = getModeNames().indexOf(name);
+
+	if (index == -1)
+		return getDefaultMode();
+
+	return (Mode)index;
+}
+
+SamplerInterpolation::Mode SamplerInterpolation::getDefaultMode()
+{
+	return HISE_SAMPLER_CUBIC_INTERPOLATION ? Mode::Cubic : Mode::Linear;
+}
+
+int SamplerInterpolation::getNumSamplesBefore(Mode m) noexcept
+{
+	switch (m)
+	{
+	case Mode::Cubic: return 1;
+	case Mode::Sinc:  return MaxSamplesBefore;
+	default:		  return 0;
+	}
+}
+
+int SamplerInterpolation::getNumSamplesAfter(Mode m) noexcept
+{
+	switch (m)
+	{
+	case Mode::Cubic: return 2;
+	case Mode::Sinc:  return MaxSamplesAfter;
+	default:		  return 1;
+	}
+}
+
+void SamplerInterpolation::History::clear() noexcept
+{
+	memset(data, 0, sizeof(data));
+}
+
+void SamplerInterpolation::initialiseSincTable()
+{
+	Kernels::getSincTable();
+}
+
+int SamplerInterpolation::process(Mode m, const hlac::HiseSampleBuffer& b, int offsetInBuffer, int numAvailable, 
+	                              float* outL, float* outR, int numSamples, double startPosition, const float* pitchData, 
+	                              double uptimeDelta, double numConsumed, History& history)
+{
+	Kernels::SampleBufferSource source = { b, offsetInBuffer };
+	return Kernels::process(m, source, numAvailable, outL, outR, numSamples, startPosition, pitchData, uptimeDelta, numConsumed, history);
+}
+
+int SamplerInterpolation::processInterleaved(Mode m, const int16* data, int numChannels, int numAvailable, 
+	                                         float* outL, float* outR, int numSamples, double startPosition, const float* pitchData, 
+	                                         double uptimeDelta, double numConsumed, History& history)
+{
+	jassert(numChannels == 1 || numChannels == 2);
+
+	Kernels::InterleavedSource source = { data, numChannels };
+	return Kernels::process(m, source, numAvailable, outL, outR, numSamples, startPosition, pitchData, uptimeDelta, numConsumed, history);
+}
+
+} // namespace hise
@@ -0,0 +1,113 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#pragma once
+
+namespace hise { using namespace juce;
+
+/** The resampling kernels of the StreamingSamplerVoice.
+*	@ingroup sampler
+*
+*	The linear mode reads the 16 bit (or float) data directly, so the conversion, the normalisation gain and the
+*	fractional interpolation are done in a single pass that calculates four output samples at once (eight if the
+*	code is compiled with AVX2). The cubic and sinc modes need a few samples around the read position, so they convert 
+*	the data into a float buffer that also contains the last input samples of the previous block.
+*/
+struct SamplerInterpolation
+{
+	enum class Mode
+	{
+		Linear = 0,
+		Cubic,
+		Sinc,
+		numModes
+	};
+
+	/** The number of coefficients of the windowed sinc interpolation. */
+	static constexpr int NumSincTaps = 8;
+
+	/** The maximum number of samples before the read position that any mode needs. */
+	static constexpr int MaxSamplesBefore = NumSincTaps / 2 - 1;
+
+	/** The maximum number of samples after the read position that any mode needs. */
+	static constexpr int MaxSamplesAfter = NumSincTaps / 2;
+
+	static StringArray getModeNames();
+
+	static Mode getModeFromName(const String& name);
+
+	/** Returns the mode that is used by default (Cubic if HISE_SAMPLER_CUBIC_INTERPOLATION is enabled). */
+	static Mode getDefaultMode();
+
+	static int getNumSamplesBefore(Mode m) noexcept;
+
+	static int getNumSamplesAfter(Mode m) noexcept;
+
+	/** Holds the last input samples of a voice for the modes that need samples before the read position. */
+	struct History
+	{
+		History() { clear(); }
+
+		void clear() noexcept;
+
+		float data[2][MaxSamplesBefore];
+	};
+
+	/** Resamples the data from the buffer into the output arrays.
+	*
+	*	@param offsetInBuffer the index of the sample at the read position 0.0
+	*	@param numAvailable the number of samples after offsetInBuffer that can be read
+	*	@param startPosition the fractional read position of the first output sample
+	*	@param pitchData the pitch ratio for every output sample or nullptr if the pitch is constant
+	*	@param numConsumed the number of input samples the voice advances after this block (used for the history)
+	*
+	*	@returns the number of output samples that were rendered. The remaining samples are cleared.
+	*/
+	static int process(Mode m, const hlac::HiseSampleBuffer& b, int offsetInBuffer, int numAvailable, 
+		               float* outL, float* outR, int numSamples, double startPosition, const float* pitchData, 
+		               double uptimeDelta, double numConsumed, History& history);
+
+	/** Same as process(), but reads interleaved 16 bit frames (eg. from a memory mapped monolith). */
+	static int processInterleaved(Mode m, const int16* data, int numChannels, int numAvailable, 
+		                          float* outL, float* outR, int numSamples, double startPosition, const float* pitchData, 
+		                          double uptimeDelta, double numConsumed, History& history);
+
+	/** Calculates the sinc coefficients. This is done lazily, but you can call it before using the sinc mode on the audio thread. */
+	static void initialiseSincTable();
+
+private:
+
+	struct Kernels;
+};
+
+} // namespace hise
@@ -46,6 +46,30 @@ void StreamingHelpers::increaseBufferIfNeeded(hlac::HiseSampleBuffer& b, int num
 	}
 }
 
+void StreamingHelpers::adviseReadAhead(const void* data, size_t numBytes)
+{
+	if (data == nullptr || numBytes == 0)
+		return;
+
+	constexpr size_t pageSize = 4096;
+
+	const auto start = reinterpret_cast<uintptr_t>(data) & ~(uintptr_t)(pageSize - 1);
+	const auto end = reinterpret_cast<uintptr_t>(data) + numBytes;
+
+#if JUCE_MAC || JUCE_IOS || JUCE_LINUX || JUCE_ANDROID
+	// Let the kernel start reading the entire range...
+	madvise(reinterpret_cast<void*>(start), (size_t)(end - start), MADV_WILLNEED);
+#endif
+
+	// ...and wait until every page is resident
+	uint8 sum = 0;
+
+	for (auto p = start; p < end; p += pageSize)
+		sum += *reinterpret_cast<const volatile uint8*>(p);
+
+	ignoreUnused(sum);
+}
+
 bool StreamingHelpers::preloadSample(StreamingSamplerSound* s, const int preloadSize, String& errorMessage)
 {
 	try
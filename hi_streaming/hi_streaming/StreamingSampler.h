@@ -87,6 +87,10 @@ struct StreamingHelpers
 
 	static bool preloadSample(StreamingSamplerSound* s, const int preloadSize, String& errorMessage);
 
+	/** Tells the OS that the given memory mapped range will be read soon and touches its pages so that the 
+		audio thread doesn't run into a page fault. Call this only on a background thread. */
+	static void adviseReadAhead(const void* data, size_t numBytes);
+
 	/** Creates a BasicMappingData object from the given samplemap entry. */
 	static BasicMappingData getBasicMappingDataFromSample(const ValueTree& sampleData);
 };
@@ -127,7 +131,7 @@ public:
 
 private:
 
-	int numOpenFileHandles = 0;
+	std::atomic<int> numOpenFileHandles = { 0 };
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamingSamplerSoundPool);
 };
@@ -146,6 +150,11 @@ struct StereoChannelData
 {
 	hlac::HiseSampleBuffer const* b;
 	int offsetInBuffer = 0;
+
+	/** If the voice reads directly from a memory mapped monolith, this points to the interleaved frame at the read position. */
+	const int16* mappedData = nullptr;
+	int numMappedChannels = 0;
+	int numMappedSamples = 0;
 };
 
 // ==================================================================================================================================================
@@ -147,7 +147,43 @@ void StreamingSamplerSound::setCrossfadeGammaValue(float newGammaValue)
 	}
 }
 
-void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
+StreamingSamplerSound::PreloadTimings::ScopedStage::ScopedStage(PreloadTimings* t, Stage s) noexcept:
+	timings(t),
+	stage(s),
+	start(t != nullptr ? Time::getHighResolutionTicks() : 0)
+{}
+
+StreamingSamplerSound::PreloadTimings::ScopedStage::~ScopedStage()
+{
+	if (timings != nullptr)
+		timings->ticks[stage] += Time::getHighResolutionTicks() - start;
+}
+
+void StreamingSamplerSound::PreloadTimings::reset()
+{
+	for (auto& t : ticks)
+		t.store(0);
+
+	numSounds.store(0);
+}
+
+double StreamingSamplerSound::PreloadTimings::getMilliseconds(Stage s) const
+{
+	return Time::highResolutionTicksToSeconds(ticks[s].load()) * 1000.0;
+}
+
+String StreamingSamplerSound::PreloadTimings::toString() const
+{
+	String s;
+
+	s << "I/O: " << String(getMilliseconds(FileAccess), 1) << " ms, ";
+	s << "Decoding: " << String(getMilliseconds(Decoding), 1) << " ms, ";
+	s << "Normalisation & Crossfades: " << String(getMilliseconds(PostProcessing), 1) << " ms";
+
+	return s;
+}
+
+void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload, PreloadTimings* timings)
 {
     if(delayPreloadInitialisation)
     {
@@ -162,6 +198,9 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 
 	ScopedLock sl(getSampleLock());
 
+	if (timings != nullptr)
+		++timings->numSounds;
+
 	const bool sampleDeactivated = !hasActiveState() || newPreloadSize == 0;
 
 	if (sampleDeactivated)
@@ -181,6 +220,8 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 	{
 		// this hasn't been initialised, so we need to do it here...
 
+		PreloadTimings::ScopedStage st(timings, PreloadTimings::FileAccess);
+
 		fileReader.openFileHandles(dontSendNotification);
 		sampleLength = (int)fileReader.getSampleLength();
 		loopEnd = jmin<int>(loopEnd, sampleLength);
@@ -206,7 +247,10 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 
 	internalPreloadSize = jmax(preloadSize, internalPreloadSize, 2048);
 
-	fileReader.openFileHandles();
+	{
+		PreloadTimings::ScopedStage st(timings, PreloadTimings::FileAccess);
+		fileReader.openFileHandles();
+	}
 
 	auto sampleStartToUse = isReversed() ? 0 : sampleStart;
 
@@ -228,11 +272,17 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 		return;
 	}
 
-	preloadBuffer.clear();
-	preloadBuffer.allocateNormalisationTables(sampleStartToUse);
+	{
+		PreloadTimings::ScopedStage st(timings, PreloadTimings::PostProcessing);
+
+		preloadBuffer.clear();
+		preloadBuffer.allocateNormalisationTables(sampleStartToUse);
+	}
 
 	if (sampleRate <= 0.0)
 	{
+		PreloadTimings::ScopedStage st(timings, PreloadTimings::FileAccess);
+
 		if (AudioFormatReader *reader = fileReader.getReader())
 		{
 			sampleRate = reader->sampleRate;
@@ -259,7 +309,14 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 		if (isReversed())
 		{
 			int numToRead = sampleEnd - loopStart;
-			fileReader.readFromDisk(preloadBuffer, 0, numToRead, 0, true);
+
+			{
+				PreloadTimings::ScopedStage st(timings, PreloadTimings::Decoding);
+				fileReader.readFromDisk(preloadBuffer, 0, numToRead, 0, true);
+			}
+
+			PreloadTimings::ScopedStage st(timings, PreloadTimings::PostProcessing);
+
 			int numTodo = internalPreloadSize - numToRead;
 
 			int pos = numToRead;
@@ -280,8 +337,12 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 		{
 			int pos = loopEnd - sampleStart;
 
-			fileReader.readFromDisk(preloadBuffer, 0, pos, sampleStartToUse, true);
-			
+			{
+				PreloadTimings::ScopedStage st(timings, PreloadTimings::Decoding);
+				fileReader.readFromDisk(preloadBuffer, 0, pos, sampleStartToUse, true);
+			}
+
+			PreloadTimings::ScopedStage st(timings, PreloadTimings::PostProcessing);
 
 			int numTodo = internalPreloadSize - (loopEnd - sampleStartToUse);
 
@@ -300,10 +361,14 @@ void StreamingSamplerSound::setPreloadSize(int newPreloadSize, bool forceReload)
 	{
 		auto samplesToRead = jmin<int>(sampleLength, internalPreloadSize);
 
+		PreloadTimings::ScopedStage st(timings, PreloadTimings::Decoding);
+
 		if(samplesToRead > 0)
 			fileReader.readFromDisk(preloadBuffer, 0, samplesToRead, sampleStartToUse, true);
 	}
 
+	PreloadTimings::ScopedStage st(timings, PreloadTimings::PostProcessing);
+
 	rebuildCrossfadeBuffer();
 	applyCrossfadeToInternalBuffers();
 }
@@ -394,6 +459,44 @@ bool StreamingSamplerSound::isMonolithic() const
 	return fileReader.isMonolithic();
 }
 
+bool StreamingSamplerSound::canStreamFromMappedData() const
+{
+#if HISE_USE_MAPPED_MONOLITH_STREAMING
+	// The preload buffer is required to bridge the time until the first read ahead is done
+	if (loopEnabled || isReversed() || preloadBuffer.getNumSamples() == 0)
+		return false;
+
+	int numChannels;
+	return getMappedData(numChannels) != nullptr;
+#else
+	return false;
+#endif
+}
+
+const int16* StreamingSamplerSound::getMappedData(int& numInterleavedChannels) const
+{
+	if (auto data = fileReader.getMappedMonolithData(numInterleavedChannels))
+		return data + (size_t)sampleStart * (size_t)numInterleavedChannels;
+
+	return nullptr;
+}
+
+void StreamingSamplerSound::adviseReadAhead(int startSample, int numSamples) const
+{
+	numSamples = jmin(numSamples, sampleLength - startSample);
+
+	if (startSample < 0 || numSamples <= 0)
+		return;
+
+	int numChannels;
+
+	if (auto data = getMappedData(numChannels))
+	{
+		StreamingHelpers::adviseReadAhead(data + (size_t)startSample * (size_t)numChannels,
+		                                  (size_t)numSamples * (size_t)numChannels * sizeof(int16));
+	}
+}
+
 juce::AudioFormatReader* StreamingSamplerSound::createReaderForPreview()
 {
 	return fileReader.createMonolithicReaderForPreview();
@@ -1182,6 +1285,16 @@ bool StreamingSamplerSound::FileReader::isStereo() const noexcept
 	return stereo;
 }
 
+const int16* StreamingSamplerSound::FileReader::getMappedMonolithData(int& numInterleavedChannels) const
+{
+	numInterleavedChannels = 0;
+
+	if (monolithicInfo != nullptr)
+		return monolithicInfo->getMappedSampleData(monolithicIndex, monolithicChannelIndex, numInterleavedChannels);
+
+	return nullptr;
+}
+
 void StreamingSamplerSound::FileReader::closeFileHandles(NotificationType notifyPool)
 {
 	if (monolithicIndex != -1) return; // don't close the reader for monolithic files...
@@ -1249,6 +1362,9 @@ void StreamingSamplerSound::FileReader::readFromDisk(hlac::HiseSampleBuffer &buf
 	{
 		ScopedReadLock sl(fileAccessLock);
 
+		// The stream based readers keep the file position, so multiple streaming threads must not use it at the same time
+		ScopedLock rl(readerLock);
+
 		if (buffer.isFloatingPoint())
 			normalReader->read(buffer.getFloatBufferForFileReader(), startSample, numSamples, readerPosition, true, true);
 		else
@@ -74,6 +74,56 @@ public:
 		String errorDescription;
 	};
 
+	/** Accumulates the time that is spent in the different stages of setPreloadSize().
+	*
+	*	The counters are atomic, so you can pass the same object to sounds that are loaded on different threads.
+	*/
+	struct PreloadTimings
+	{
+		enum Stage
+		{
+			FileAccess = 0,	///< opening the file handles and creating the readers
+			Decoding,		///< reading and decompressing the sample data into the preload buffer
+			PostProcessing, ///< allocating the normalisation tables and building the loop & crossfade buffers
+			numStages
+		};
+
+		/** Adds the time between construction and destruction to the given stage. */
+		struct ScopedStage
+		{
+			ScopedStage(PreloadTimings* t, Stage s) noexcept;
+			~ScopedStage();
+
+		private:
+
+			PreloadTimings* timings;
+			const Stage stage;
+			const int64 start;
+
+			JUCE_DECLARE_NON_COPYABLE(ScopedStage);
+		};
+
+		PreloadTimings() { reset(); }
+
+		void reset();
+
+		/** Returns the time that was spent in the given stage (summed over all threads). */
+		double getMilliseconds(Stage s) const;
+
+		/** Returns the amount of sounds that were loaded with these timings. */
+		int getNumSounds() const { return numSounds.load(); }
+
+		/** Creates a one line summary of all stages. */
+		String toString() const;
+
+	private:
+
+		friend class StreamingSamplerSound;
+
+		std::atomic<int64> ticks[numStages];
+		std::atomic<int> numSounds;
+	};
+
 	// ==============================================================================================================================================
 
 	/** Creates a new StreamingSamplerSound.
@@ -181,9 +231,10 @@ public:
 	/** Set the preload size.
 	*
 	*	If the preload size is not changed, it will do nothing, but you can force it to reload it with 'forceReload'.
-	*	You can also tell the sound to load everything into memory by calling loadEntireSample().
+	*	You can also tell the sound to load everything into memory by calling loadEntireSample(). If you pass in a
+	*	PreloadTimings object, the time spent in the different loading stages will be added to it.
 	*/
-	void setPreloadSize(int newPreloadSizeInSamples, bool forceReload = false);
+	void setPreloadSize(int newPreloadSizeInSamples, bool forceReload = false, PreloadTimings* timings = nullptr);
 
 	/** Returns the size of the preload buffer in bytes. You can use this method to check how much memory the sound uses. It also includes the memory used for the crossfade buffer. */
 	size_t getActualPreloadSize() const;
@@ -211,6 +262,19 @@ public:
 	bool replaceAudioFile(const AudioSampleBuffer& b);
 
 	bool isMonolithic() const;
+
+	/** Checks whether the voices can read this sound directly from the memory mapped monolith.
+	*
+	*	This is only possible for uncompressed monoliths and sounds that are neither looped nor reversed.
+	*/
+	bool canStreamFromMappedData() const;
+
+	/** Returns the interleaved 16 bit data at the sample start if the sound can be played from the memory mapped monolith. */
+	const int16* getMappedData(int& numInterleavedChannels) const;
+
+	/** Prepares the mapped pages for the given range (relative to the sample start). Don't call this on the audio thread. */
+	void adviseReadAhead(int startSample, int numSamples) const;
+
 	AudioFormatReader* createReaderForPreview();
 
 	AudioFormatReader* createReaderForAnalysis();
@@ -340,6 +404,9 @@ private:
 		bool isOpened() const noexcept { return fileHandlesOpen; }
 		bool isMonolithic() const noexcept { return monolithicInfo != nullptr; }
 
+		/** Returns the interleaved data of the sample if the monolith is uncompressed and mapped into memory. */
+		const int16* getMappedMonolithData(int& numInterleavedChannels) const;
+
 		bool isStereo() const noexcept;
 
 		bool isMissing() const { return missing; }
@@ -407,6 +474,7 @@ private:
 		String monolithicName;
 
 		ReadWriteLock fileAccessLock;
+		CriticalSection readerLock;
 
 		bool stereo = true;
 
@@ -120,6 +120,9 @@ void SampleLoader::startNote(StreamingSamplerSound const *s, int startTime)
 
 	entireSampleIsLoaded = s->isEntireSampleLoaded();
 
+	// The voice reads the samples after the preload buffer directly from the mapped file
+	mappedData = !entireSampleIsLoaded && s->canStreamFromMappedData() ? s->getMappedData(numMappedChannels) : nullptr;
+
 	if (!entireSampleIsLoaded)
 	{
 		// The other buffer will be filled on the next free thread pool slot
@@ -165,6 +168,7 @@ void SampleLoader::reset()
 void SampleLoader::clearLoader()
 {
 	sound = nullptr;
+	mappedData = nullptr;
 	diskUsage = 0.0f;
 	cancelled = true;
 	resetJob();
@@ -199,6 +203,20 @@ StereoChannelData SampleLoader::fillVoiceBuffer(hlac::HiseSampleBuffer &voiceBuf
 	const int numSamplesInBuffer = localReadBuffer->getNumSamples();
 	const int maxSampleIndexForFillOperation = (int)(readIndexDouble + numSamples) + 1; // Round up the samples
 
+	if (mappedData != nullptr && maxSampleIndexForFillOperation >= numSamplesInBuffer)
+	{
+		// No need to copy anything, the mapped data contains the preloaded samples too
+		const int index = (int)readIndexDouble;
+
+		StereoChannelData returnData;
+		returnData.b = nullptr;
+		returnData.mappedData = mappedData + (size_t)index * (size_t)numMappedChannels;
+		returnData.numMappedChannels = numMappedChannels;
+		returnData.numMappedSamples = jmax(0, sound.get()->getSampleLength() - index);
+
+		return returnData;
+	}
+
 	if (maxSampleIndexForFillOperation >= numSamplesInBuffer) // Check because of preloadbuffer style
 	{
 		if (entireSampleIsLoaded)
@@ -318,6 +336,24 @@ StereoChannelData SampleLoader::fillVoiceBuffer(hlac::HiseSampleBuffer &voiceBuf
 
 bool SampleLoader::advanceReadIndex(double uptime)
 {
+	if (mappedData != nullptr)
+	{
+		// There are no buffers to swap, so the read index is the position in the sample
+		readIndexDouble = uptime;
+
+		if (readIndexDouble >= (double)positionInSampleFile)
+		{
+			positionInSampleFile += getReadAheadSize();
+
+			// If the last read ahead is still pending, the audio thread might run into a page fault, 
+			// but this is no reason to kill the voice
+			if (!isQueued())
+				requestNewData();
+		}
+
+		return true;
+	}
+
 	int numSamplesInBuffer = readBuffer.get()->getNumSamples();
 	readIndexDouble = uptime - lastSwapPosition;
 
@@ -351,6 +387,11 @@ bool SampleLoader::advanceReadIndex(double uptime)
 	return true;
 }
 
+int SampleLoader::getReadAheadSize() const
+{
+	return jmax(idealBufferSize, getNumSamplesForStreamingBuffers());
+}
+
 int SampleLoader::getNumSamplesForStreamingBuffers() const
 {
 	jassert(b1.getNumSamples() == b2.getNumSamples());
@@ -378,15 +419,24 @@ bool SampleLoader::requestNewData()
 	}
 	else
 	{
-		backgroundPool->addJob(this, false);
+		addToBackgroundPool();
 		return true;
 	}
 #else
-	backgroundPool->addJob(this, false);
+	addToBackgroundPool();
 	return true;
 #endif
 };
 
+void SampleLoader::addToBackgroundPool()
+{
+	// The deadline is the amount of samples left in the buffer that is currently played back.
+	const int numSamplesLeft = mappedData != nullptr ? positionInSampleFile - (int)readIndexDouble
+		                                             : readBuffer.get()->getNumSamples() - (int)readIndexDouble;
+
+	backgroundPool->addJobWithDeadline(this, numSamplesLeft, playbackSpeed);
+}
+
 
 SampleThreadPoolJob::JobStatus SampleLoader::runJob()
 {
@@ -414,6 +464,14 @@ SampleThreadPoolJob::JobStatus SampleLoader::runJob()
 
 	fillInactiveBuffer();
 
+	if (!nonRealtime && mappedData == nullptr)
+	{
+		auto wb = writeBuffer.get();
+		const int bytesPerSample = wb->isFloatingPoint() ? sizeof(float) : sizeof(int16);
+
+		reportBytesRead((int64)wb->getNumSamples() * (int64)wb->getNumChannels() * bytesPerSample);
+	}
+
 	writeBufferIsBeingFilled = false;
 
 	const double readStop = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks());
@@ -437,6 +495,13 @@ void SampleLoader::fillInactiveBuffer()
 
 	if (localSound == nullptr) return;
 
+	if (mappedData != nullptr)
+	{
+		// The voice reads directly from the mapped file, so we only need to make sure that the next pages are resident
+		localSound->adviseReadAhead(positionInSampleFile, getReadAheadSize());
+		return;
+	}
+
 	if (localSound != nullptr)
 	{
 		if (localSound->hasEnoughSamplesForBlock(positionInSampleFile + getNumSamplesForStreamingBuffers()))
@@ -485,11 +550,39 @@ void SampleLoader::fillInactiveBuffer()
 	}
 };
 
+void SampleLoader::setMappedStreamingOnly(bool shouldBeMappedOnly)
+{
+	if (mappedStreamingOnly != shouldBeMappedOnly)
+	{
+		ScopedLock sl(getLock());
+
+		mappedStreamingOnly = shouldBeMappedOnly;
+		refreshBufferSizes();
+	}
+}
+
 void SampleLoader::refreshBufferSizes()
 {
 	const int numSamplesToUse = jmax<int>(idealBufferSize, minimumBufferSizeForSamplesPerBlock);
 
-	if (getNumSamplesForStreamingBuffers() < numSamplesToUse)
+	// The buffers are only needed if a sound can't be played from the mapped file (eg. if the loop is enabled)
+	const bool shrinkBuffers = mappedStreamingOnly && 
+		                       minimumBufferSizeForSamplesPerBlock > 0 && 
+		                       getNumSamplesForStreamingBuffers() != minimumBufferSizeForSamplesPerBlock;
+
+	if (shrinkBuffers)
+	{
+		b1.setSize(b1.getNumChannels(), minimumBufferSizeForSamplesPerBlock);
+		b2.setSize(b2.getNumChannels(), minimumBufferSizeForSamplesPerBlock);
+		b1.clear();
+		b2.clear();
+
+		readBuffer = &b1;
+		writeBuffer = &b2;
+
+		reset();
+	}
+	else if (!mappedStreamingOnly && getNumSamplesForStreamingBuffers() < numSamplesToUse)
 	{
 		StreamingHelpers::increaseBufferIfNeeded(b1, numSamplesToUse);
 		StreamingHelpers::increaseBufferIfNeeded(b2, numSamplesToUse);
@@ -545,11 +638,14 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 
 	if (sound != nullptr && sound->getSampleLength() > 0)
 	{
+		// uptimeDelta is not yet resampled, so the speed is relative to the sample rate of the sound
+		loader.setPlaybackSpeed(uptimeDelta * sound->getSampleRate());
 		loader.startNote(sound, sampleStartModValue);
 
 		jassert(sound != nullptr);
 		
 		voiceUptime = (double)sampleStartModValue;
+		interpolationHistory.clear();
 
 		// You have to call setPitchFactor() before startNote().
 		jassert(uptimeDelta != 0.0);
@@ -578,12 +674,17 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 				auto outL = (float*)alloca(sizeof(float*) * numBeforeOutput);
 				auto outR = (float*)alloca(sizeof(float*) * numBeforeOutput);
 
+				pitchCounter = (double)numBeforeOutput;
+
 				interpolateFromStereoData(0, outL, outR, numBeforeOutput, nullptr, 1.0, 0.0, data, numBeforeOutput);
 
 				float* inp[2] = { outL, outR };
 
 				voiceUptime += stretcher.skipLatency(inp, stretchRatio);
 
+				// the read position jumps, so the samples before it are not valid anymore
+				interpolationHistory.clear();
+
 				if (!loader.advanceReadIndex(voiceUptime))
 				{
 					jassertfalse;
@@ -624,219 +725,23 @@ void StreamingSamplerVoice::setDebugLogger(DebugLogger* newLogger)
 	loader.setLogger(logger);
 }
 
-static int alignedCalls = 0;
-static int unalignedCalls = 0;
-
-#define USE_CUBIC_INTERPOLATION 0 // not there yet, need to fetch more samples to get 4 values...
-
-template <typename SignalType, bool isFloat> void interpolateMonoSamples(const SignalType* inL, const SignalType* unusedIn, const float* pitchData, float* outL, float* unusedOut, int startSample, double indexInBuffer, double uptimeDelta, int numSamples)
-{
-	ignoreUnused(unusedIn, unusedOut);
-
-	constexpr float gainFactor = isFloat ? 1.0f : (1.0f / (float)INT16_MAX);
-
-	if (pitchData != nullptr)
-	{
-		pitchData += startSample;
-
-		float indexInBufferFloat = (float)indexInBuffer;
-
-		for (int i = 0; i < numSamples; i++)
-		{
-			const int pos = int(indexInBufferFloat);
-			const float alpha = indexInBufferFloat - (float)pos;
-
-			auto l1 = (float)inL[pos];
-			auto l2 = (float)inL[pos + 1];
-			
-#if USE_CUBIC_INTERPOLATION
-			auto l0 = (float)(pos > 0 ? inL[pos - 1] : 0);
-			auto l3 = (float)inL[pos + 2];
-
-			float l = Interpolator::interpolateCubic(l0, l1, l2, l3, alpha);
-#else
-			float l = Interpolator::interpolateLinear(l1, l2, alpha);
-#endif
-
-			outL[i] = l * gainFactor;
-
-			jassert(*pitchData <= (float)MAX_SAMPLER_PITCH);
-
-			indexInBufferFloat += pitchData[i];
-		}
-	}
-	else
-	{
-		float indexInBufferFloat = (float)indexInBuffer;
-		const float uptimeDeltaFloat = (float)uptimeDelta;
-
-		while (numSamples > 0)
-		{
-			const int pos = int(indexInBufferFloat);
-			const float alpha = indexInBufferFloat - (float)pos;
-			
-			auto l1 = (float)inL[pos];
-			auto l2 = (float)inL[pos + 1];
-			
-#if USE_CUBIC_INTERPOLATION
-			auto l0 = (float)(pos > 0 ? inL[pos - 1] : 0);
-			auto l3 = (float)inL[pos + 2];
-
-			float l = Interpolator::interpolateCubic(l0, l1, l2, l3, alpha);
-#else
-			float l = Interpolator::interpolateLinear(l1, l2, alpha);
-#endif
-
-			*outL++ = l * gainFactor;
-
-			indexInBufferFloat += uptimeDeltaFloat;
-
-			numSamples--;
-		}
-	}
-}
-
-template <typename SignalType, bool isFloat> void interpolateStereoSamples(const SignalType* inL, const SignalType* inR, const float* pitchData, float* outL, float* outR, int startSample, double indexInBuffer, double uptimeDelta, int numSamples, int maxIndexInBuffer)
-{
-	constexpr float gainFactor = isFloat ? 1.0f : (1.0f / (float)INT16_MAX);
-
-	if (pitchData != nullptr)
-	{
-		pitchData += startSample;
-
-		float indexInBufferFloat = (float)indexInBuffer;
-
-		for (int i = 0; i < numSamples; i++)
-		{
-			const int pos = int(indexInBufferFloat);
-
-			if (pos >= maxIndexInBuffer)
-				return;
-
-			const float alpha = indexInBufferFloat - (float)pos;
-
-			auto l1 = (float)inL[pos];
-			auto l2 = (float)inL[pos+1];
-			auto r1 = (float)inR[pos];
-			auto r2 = (float)inR[pos + 1];
-
-#if USE_CUBIC_INTERPOLATION
-			auto l0 = (float)(pos > 0 ? inL[pos - 1] : 0);
-			auto l3 = (float)inL[pos + 2];
-			auto r0 = (float)(pos > 0 ? inR[pos - 1] : 0);
-			auto r3 = (float)inR[pos + 2];
-
-			float l = Interpolator::interpolateCubic(l0, l1, l2, l3, alpha);
-			float r = Interpolator::interpolateCubic(r0, r1, r2, r3, alpha);
-#else
-			float l = Interpolator::interpolateLinear(l1, l2, alpha);
-			float r = Interpolator::interpolateLinear(r1, r2, alpha);
-#endif
-
-			outL[i] = l * gainFactor;
-			outR[i] = r * gainFactor;
-
-			//jassert(*pitchData <= (float)MAX_SAMPLER_PITCH);
-
-			indexInBufferFloat += pitchData[i];
-		}
-	}
-	else
-	{
-		float indexInBufferFloat = (float)indexInBuffer;
-		const float uptimeDeltaFloat = (float)uptimeDelta;
-
-		auto numTargetSamples = (double)(maxIndexInBuffer - indexInBuffer);
-
-		jassert(numTargetSamples > 0.0);
-
-		numSamples = jmin(numSamples, (int)(numTargetSamples / uptimeDelta));
-
-		while (numSamples > 0)
-		{
-			const int pos = int(indexInBufferFloat);
-			const float alpha = indexInBufferFloat - (float)pos;
-			
-			auto l1 = (float)inL[pos];
-			auto l2 = (float)inL[pos + 1];
-			auto r1 = (float)inR[pos];
-			auto r2 = (float)inR[pos + 1];
-			
-#if USE_CUBIC_INTERPOLATION
-			auto l0 = (float)(pos > 0 ? inL[pos - 1] : 0);
-			auto l3 = (float)inL[pos + 2];
-			auto r0 = (float)(pos > 0 ? inR[pos - 1] : 0);
-			auto r3 = (float)inR[pos + 2];
-
-			float l = Interpolator::interpolateCubic(l0, l1, l2, l3, alpha);
-			float r = Interpolator::interpolateCubic(r0, r1, r2, r3, alpha);
-#else
-			float l = Interpolator::interpolateLinear(l1, l2, alpha);
-			float r = Interpolator::interpolateLinear(r1, r2, alpha);
-#endif
-
-			*outL++ = l * gainFactor;
-			*outR++ = r * gainFactor;
-
-			indexInBufferFloat += uptimeDeltaFloat;
-
-			numSamples--;
-		}
-	}
-}
-
-
 void StreamingSamplerVoice::interpolateFromStereoData(int startSample, float* outL, float* outR, int numSamplesToCalculate, const float* pitchDataToUse, double thisUptimeDelta, const double startAlpha, StereoChannelData data, int samplesAvailable)
 {
-	double indexInBuffer = startAlpha;
+	if (pitchDataToUse != nullptr)
+		pitchDataToUse += startSample;
 
-	if (data.b->isFloatingPoint())
+	if (data.mappedData != nullptr)
 	{
-		const float* const inL = static_cast<const float*>(data.b->getReadPointer(0, data.offsetInBuffer));
-		const float* const inR = static_cast<const float*>(data.b->getReadPointer(1, data.offsetInBuffer));
-
-		interpolateStereoSamples<float, true>(inL, inR, pitchDataToUse, outL, outR, startSample, indexInBuffer, thisUptimeDelta, numSamplesToCalculate, indexInBuffer + samplesAvailable);
+		SamplerInterpolation::processInterleaved(interpolationMode, data.mappedData, data.numMappedChannels, samplesAvailable, outL, outR, numSamplesToCalculate,
+		                                         startAlpha, pitchDataToUse, thisUptimeDelta, pitchCounter, interpolationHistory);
+		return;
 	}
-	else
-	{
-		const int16* const inL = static_cast<const int16*>(data.b->getReadPointer(0, data.offsetInBuffer));
-		const int16* const inR = static_cast<const int16*>(data.b->getReadPointer(1, data.offsetInBuffer));
-
-		bool useNormalisation = data.b->usesNormalisation();
-
-		if (useNormalisation)
-		{
-			const int numSamplesThisTime = (int)(ceil)((pitchCounter + startAlpha)) + 1;
-
-			float* inL_f = (float*)alloca(sizeof(float) * numSamplesThisTime);
-			float* d[2] = { inL_f, nullptr };
 
-			if (data.b->getNumChannels() == 2 && !data.b->useOneMap)
-			{
-				float* inR_f = (float*)alloca(sizeof(float) * numSamplesThisTime);
-
-				d[1] = inR_f;
-
-				data.b->convertToFloatWithNormalisation(d, data.b->getNumChannels(), data.offsetInBuffer, numSamplesThisTime);
-
-				interpolateStereoSamples<float, true>(inL_f, inR_f, pitchDataToUse, outL, outR, startSample, indexInBuffer, thisUptimeDelta, numSamplesToCalculate, indexInBuffer + samplesAvailable);
-			}
-			else
-			{
-				data.b->convertToFloatWithNormalisation(d, 1, data.offsetInBuffer, numSamplesThisTime);
-
-				interpolateMonoSamples<float, true>(inL_f, nullptr, pitchDataToUse, outL, nullptr, startSample, indexInBuffer, thisUptimeDelta, numSamplesToCalculate);
-
-				memcpy(outR, outL, sizeof(float) * numSamplesToCalculate);
-			}
-		}
-		else
-		{
-			interpolateStereoSamples<int16, false>(inL, inR, pitchData, outL, outR, startSample, indexInBuffer, thisUptimeDelta, numSamplesToCalculate, indexInBuffer + samplesAvailable);
-		}
-	}
+	SamplerInterpolation::process(interpolationMode, *data.b, data.offsetInBuffer, samplesAvailable, outL, outR, numSamplesToCalculate, 
+	                              startAlpha, pitchDataToUse, thisUptimeDelta, pitchCounter, interpolationHistory);
 }
 
+
 void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int startSample, int numSamples)
 {
 	const StreamingSamplerSound *sound = loader.getLoadedSound();
@@ -884,18 +789,21 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 
 		auto tempVoiceBuffer = getTemporaryVoiceBuffer();
 
+		// The higher order interpolation modes need a few more samples after the last read position
+		const double numToFetch = pitchCounter + startAlpha + (double)(SamplerInterpolation::getNumSamplesAfter(interpolationMode) - 1);
+
 		jassert(tempVoiceBuffer != nullptr);
-		if (!isPositiveAndBelow(pitchCounter + startAlpha, (double)tempVoiceBuffer->getNumSamples()))
+		if (!isPositiveAndBelow(numToFetch, (double)tempVoiceBuffer->getNumSamples()))
 		{
-			tempVoiceBuffer->setSize(tempVoiceBuffer->getNumChannels(), roundToInt((pitchCounter + startAlpha) * 1.5));
+			tempVoiceBuffer->setSize(tempVoiceBuffer->getNumChannels(), roundToInt(numToFetch * 1.5));
 		}
 
 		// Copy the not resampled values into the voice buffer.
-		StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, pitchCounter + startAlpha);
+		StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, numToFetch);
 
 		
 
-		auto samplesAvailable = data.b->getNumSamples() - data.offsetInBuffer;
+		auto samplesAvailable = data.mappedData != nullptr ? data.numMappedSamples : data.b->getNumSamples() - data.offsetInBuffer;
 
 		const int startFixed = startSample;
 		const int numSamplesFixed = numSamples;
@@ -947,6 +855,8 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
                 FloatVectorOperations::copy(out[1], out[0], numOutput);
 		}
 
+		loader.setPlaybackSpeed(pitchCounter / (double)numSamples * getSampleRate());
+
 		if (!loader.advanceReadIndex(voiceUptime))
 		{
 #if LOG_SAMPLE_RENDERING
@@ -1035,7 +945,7 @@ void StreamingSamplerVoice::initTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buf
 	// The channel amount must be set correctly in the constructor
 	jassert(bufferToUse->getNumChannels() > 0);
 
-    auto requiredSampleAmount = roundToInt((double)samplesPerBlock* maxPitchRatio);
+    auto requiredSampleAmount = roundToInt((double)samplesPerBlock* maxPitchRatio) + SamplerInterpolation::MaxSamplesAfter + 1;
     
 	if (bufferToUse->getNumSamples() < requiredSampleAmount)
 	{
@@ -136,8 +136,33 @@ public:
 		nonRealtime = shouldBeNonRealtime;
 	}
 
+	/** Set this to true if all sounds of the sampler can be played from the memory mapped monolith.
+	*
+	*	In this case the streaming buffers are only kept at the minimum size as fallback.
+	*/
+	void setMappedStreamingOnly(bool shouldBeMappedOnly);
+
+	/** Returns true if the current sound is read directly from the memory mapped monolith. */
+	bool isReadingFromMappedData() const noexcept { return mappedData != nullptr; }
+
+	/** Sets the amount of samples of the sound that are played back per second (including the pitch factor).
+	*
+	*	This is used to calculate the deadline of the streaming job.
+	*/
+	void setPlaybackSpeed(double samplesPerSecond) noexcept { playbackSpeed = samplesPerSecond; }
+
 private:
 
+	int getReadAheadSize() const;
+
+	// The interleaved data at the sample start if the current sound is played from the mapped file
+	const int16* mappedData = nullptr;
+	int numMappedChannels = 0;
+
+	bool mappedStreamingOnly = false;
+
+	double playbackSpeed = 0.0;
+
 	bool nonRealtime = false;
 
 	friend class Unmapper;
@@ -148,6 +173,8 @@ private:
 
 	bool requestNewData();
 
+	void addToBackgroundPool();
+
 	bool swapBuffers();
 
 	void fillInactiveBuffer();
@@ -320,8 +347,20 @@ public:
 		timestretchTonality = jlimit(0.0, 1.0, tonality);
 	}
 
+	/** Sets the resampling algorithm. Call this only when the voice is not playing. */
+	void setInterpolationMode(SamplerInterpolation::Mode newMode)
+	{
+		interpolationMode = newMode;
+		interpolationHistory.clear();
+	}
+
+	SamplerInterpolation::Mode getInterpolationMode() const noexcept { return interpolationMode; }
+
 private:
 
+	SamplerInterpolation::Mode interpolationMode = SamplerInterpolation::getDefaultMode();
+	SamplerInterpolation::History interpolationHistory;
+
 	double timestretchTonality = 0.0;
 
 	bool skipLatency = false;
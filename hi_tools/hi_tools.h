@@ -114,6 +114,21 @@ will break compatibility with older projects / presets because the tempo indexes
 #define HISE_USE_EXTENDED_TEMPO_VALUES 0
 #endif
 
+/** Config: HISE_NUM_REALTIME_WORKERS
+
+The number of threads (including the audio thread) that are used for processing tasks concurrently in the audio callback.
+If this is zero, it will use one thread less than the number of CPU cores so that one core is left for the other threads
+(eg. the sample streaming).
+*/
+#ifndef HISE_NUM_REALTIME_WORKERS
+#define HISE_NUM_REALTIME_WORKERS 0
+#endif
+
+/** The maximum number of realtime workers. This is used to preallocate the scratch buffers for each worker thread. */
+#ifndef HISE_MAX_REALTIME_WORKERS
+#define HISE_MAX_REALTIME_WORKERS 8
+#endif
+
 /** Reenables using the mouse wheel to control the table curve if set to 1. */
 #ifndef HISE_USE_MOUSE_WHEEL_FOR_TABLE_CURVE
 #define HISE_USE_MOUSE_WHEEL_FOR_TABLE_CURVE 0
@@ -205,6 +220,7 @@ will break compatibility with older projects / presets because the tempo indexes
 #include "hi_tools/UpdateMerger.h"
 
 #include "hi_tools/MiscToolClasses.h"
+#include "hi_tools/RealtimeWorkerGroup.h"
 
 #include "hi_tools/PathFactory.h"
 #include "hi_tools/HI_LookAndFeels.h"
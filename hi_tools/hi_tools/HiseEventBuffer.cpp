@@ -492,8 +492,15 @@ int HiseEventBuffer::EventStack::getNumUsed()
 
 HiseEventBuffer::HiseEventBuffer()
 {
-	numUsed = HISE_EVENT_BUFFER_SIZE;
-	clear();
+}
+
+void HiseEventBuffer::setOverflowPolicy(OverflowPolicy newPolicy, HiseEventBuffer* newSpillBuffer)
+{
+	// You need to supply a spill buffer for this policy...
+	jassert(newPolicy != OverflowPolicy::SpillToBuffer || (newSpillBuffer != nullptr && newSpillBuffer != this));
+
+	overflowPolicy = newPolicy;
+	spillBuffer = newSpillBuffer;
 }
 
 bool HiseEventBuffer::operator==(const HiseEventBuffer& other)
@@ -532,47 +539,116 @@ void HiseEventBuffer::clear()
 
 void HiseEventBuffer::addEvent(const HiseEvent& hiseEvent)
 {
-	if (numUsed >= HISE_EVENT_BUFFER_SIZE)
-	{
-		// Buffer full..
-		jassertfalse;
+	if (numUsed >= HISE_EVENT_BUFFER_SIZE && !makeRoomFor(hiseEvent))
 		return;
-	}
 
-	if (numUsed == 0)
+	insertEventAtPosition(hiseEvent, getInsertPosition(hiseEvent.getTimeStamp()));
+
+	jassert(timeStampsAreSorted());
+}
+
+int HiseEventBuffer::getInsertPosition(int timestamp) const noexcept
+{
+	// Fast path for events that are added in order
+	if (numUsed == 0 || buffer[numUsed - 1].getTimeStamp() <= timestamp)
+		return numUsed;
+
+	auto pos = std::upper_bound(buffer, buffer + numUsed, timestamp, [](int t, const HiseEvent& e)
 	{
-		insertEventAtPosition(hiseEvent, 0);
-		return;
-	}
+		return t < e.getTimeStamp();
+	});
 
-	jassert(numUsed < HISE_EVENT_BUFFER_SIZE);
+	return (int)(pos - buffer);
+}
 
-    const int numToLookFor = jmin<int>(numUsed, HISE_EVENT_BUFFER_SIZE);
-    
-	for (int i = 0; i < numToLookFor; i++)
+int HiseEventBuffer::getFirstIndexWithTimestamp(int timestamp) const noexcept
+{
+	auto pos = std::lower_bound(buffer, buffer + numUsed, timestamp, [](const HiseEvent& e, int t)
 	{
-		const int timestampInBuffer = buffer[i].getTimeStamp();
-		const int messageTimestamp = hiseEvent.getTimeStamp();
+		return e.getTimeStamp() < t;
+	});
 
-		if (timestampInBuffer > messageTimestamp)
-		{
-			insertEventAtPosition(hiseEvent, i);
+	return (int)(pos - buffer);
+}
+
+bool HiseEventBuffer::makeRoomFor(const HiseEvent& e)
+{
+	jassert(numUsed == HISE_EVENT_BUFFER_SIZE);
 
-#if JUCE_DEBUG
-			if (!timeStampsAreSorted())
+	switch (overflowPolicy)
+	{
+	case OverflowPolicy::KeepNoteEvents:
+	{
+		if (e.isNoteOnOrOff())
+		{
+			for (int i = numUsed - 1; i >= 0; i--)
 			{
-				for (int j = 0; j < numToLookFor; j++)
-					DBG(buffer[j].toDebugString());
+				if (!buffer[i].isNoteOnOrOff())
+				{
+					popEvent(i);
+					numDroppedEvents++;
+					return true;
+				}
 			}
-#endif
+		}
 
-			jassert(timeStampsAreSorted());
+		break;
+	}
+	case OverflowPolicy::SpillToBuffer:
+	{
+		if (spillBuffer == nullptr)
+			break;
 
-			return;
+		// The new event would be inserted after the last event, so it goes directly to the spill buffer
+		if (e.getTimeStamp() >= buffer[numUsed - 1].getTimeStamp())
+		{
+			spillBuffer->addEvent(e);
+			return false;
 		}
+
+		spillBuffer->addEvent(popEvent(numUsed - 1));
+		return true;
+	}
+	case OverflowPolicy::DropNewEvents:
+		break;
 	}
 
-	insertEventAtPosition(hiseEvent, numUsed);
+	// Buffer full..
+	numDroppedEvents++;
+	jassert_skip_unit_test(overflowPolicy != OverflowPolicy::DropNewEvents);
+	return false;
+}
+
+void HiseEventBuffer::mergeEvents(const HiseEvent* events, int numEvents)
+{
+	jassert(events < buffer || events >= buffer + HISE_EVENT_BUFFER_SIZE);
+
+	if (numEvents == 0)
+		return;
+
+	if (numUsed + numEvents > HISE_EVENT_BUFFER_SIZE)
+	{
+		// Let the overflow policy handle each event
+		for (int i = 0; i < numEvents; i++)
+			addEvent(events[i]);
+
+		return;
+	}
+
+	// merge from the back so that we can do it in place
+	int i = numUsed - 1;
+	int j = numEvents - 1;
+	int k = numUsed + numEvents - 1;
+
+	while (j >= 0)
+	{
+		if (i >= 0 && buffer[i].getTimeStamp() > events[j].getTimeStamp())
+			buffer[k--] = buffer[i--];
+		else
+			buffer[k--] = events[j--];
+	}
+
+	numUsed += numEvents;
 
 	jassert(timeStampsAreSorted());
 }
@@ -593,32 +669,18 @@ void HiseEventBuffer::addEvents(const MidiBuffer& otherBuffer)
 	MidiMessage m;
 	int samplePos;
 
-	int index = 0;
-
 	MidiBuffer::Iterator it(otherBuffer);
 
 	while (it.getNextEvent(m, samplePos))
 	{
-		jassert(index < HISE_EVENT_BUFFER_SIZE);
-
 		HiseEvent e(m);
 
 		if (e.isEmpty()) continue;
 
-		e.swapWith(buffer[index]);
-
-		buffer[index].setTimeStamp(samplePos);
-
-		numUsed++;
-
-		if (numUsed >= HISE_EVENT_BUFFER_SIZE)
-		{
-			// Buffer full..
-			jassertfalse;
-			return;
-		}
+		e.setTimeStamp(samplePos);
 
-		index++;
+		// The MidiBuffer is sorted so this will just append the event
+		addEvent(e);
 	}
 
 	jassert(timeStampsAreSorted());
@@ -627,11 +689,16 @@ void HiseEventBuffer::addEvents(const MidiBuffer& otherBuffer)
 
 void HiseEventBuffer::addEvents(const HiseEventBuffer &otherBuffer)
 {
-	Iterator iter(otherBuffer);
+	jassert(&otherBuffer != this);
 
-	while (HiseEvent* e = iter.getNextEventPointer(false, false))
+	if (otherBuffer.timeStampsAreSorted())
 	{
-		addEvent(*e);
+		mergeEvents(otherBuffer.buffer, otherBuffer.numUsed);
+	}
+	else
+	{
+		for (const auto& e : otherBuffer)
+			addEvent(e);
 	}
 
 	jassert(timeStampsAreSorted());
@@ -714,8 +781,7 @@ hise::HiseEvent HiseEventBuffer::popEvent(int index)
 	{
 		auto e = getEvent(index);
 
-		for (int i = index; i < numUsed; i++)
-			buffer[i] = buffer[i + 1];
+		std::move(buffer + index + 1, buffer + numUsed, buffer + index);
 
 		buffer[numUsed - 1] = {};
 		numUsed--;
@@ -746,30 +812,19 @@ void HiseEventBuffer::moveEventsBelow(HiseEventBuffer& targetBuffer, int highest
 {
 	if (numUsed == 0) return;
 
-	HiseEventBuffer::Iterator iter(*this);
-
-	int numCopied = 0;
-
 	jassert(targetBuffer.timeStampsAreSorted());
 	jassert(timeStampsAreSorted());
 
-	while (HiseEvent* e = iter.getNextEventPointer())
-	{
-		if (e->getTimeStamp() < highestTimestamp)
-		{
-			targetBuffer.addEvent(*e);
-			numCopied++;
-		}
-		else
-		{
-			break;
-		}
-	}
+	const int numCopied = getFirstIndexWithTimestamp(highestTimestamp);
+
+	if (numCopied == 0)
+		return;
+
+	targetBuffer.mergeEvents(buffer, numCopied);
 
 	const int numRemaining = numUsed - numCopied;
 
-	for (int i = 0; i < numRemaining; i++)
-		buffer[i] = buffer[i + numCopied];
+	std::move(buffer + numCopied, buffer + numUsed, buffer);
 
 	HiseEvent::clear(buffer + numRemaining, numCopied);
 
@@ -784,23 +839,9 @@ void HiseEventBuffer::moveEventsAbove(HiseEventBuffer& targetBuffer, int lowestT
 	if (numUsed == 0 || (buffer[numUsed - 1].getTimeStamp() < lowestTimestamp)) 
 		return; // Skip the work if no events with bigger timestamps
 
-	int indexOfFirstElementToMove = -1;
+	const int indexOfFirstElementToMove = getFirstIndexWithTimestamp(lowestTimestamp);
 
-	for (int i = 0; i < numUsed; i++)
-	{
-		if (buffer[i].getTimeStamp() >= lowestTimestamp)
-		{
-			indexOfFirstElementToMove = i;
-			break;
-		}
-	}
-
-	if (indexOfFirstElementToMove == -1) return;
-
-	for (int i = indexOfFirstElementToMove; i < numUsed; i++)
-	{
-		targetBuffer.addEvent(buffer[i]);
-	}
+	targetBuffer.mergeEvents(buffer + indexOfFirstElementToMove, numUsed - indexOfFirstElementToMove);
 
 	HiseEvent::clear(buffer + indexOfFirstElementToMove, numUsed - indexOfFirstElementToMove);
 
@@ -811,7 +852,7 @@ void HiseEventBuffer::copyFrom(const HiseEventBuffer& otherBuffer)
 {
     const int eventsToCopy = jmin<int>(otherBuffer.numUsed, HISE_EVENT_BUFFER_SIZE);
     
-	memcpy(buffer, otherBuffer.buffer, sizeof(HiseEvent) * eventsToCopy);
+	std::copy(otherBuffer.buffer, otherBuffer.buffer + eventsToCopy, buffer);
 
 	jassert(otherBuffer.numUsed < HISE_EVENT_BUFFER_SIZE);
 
@@ -826,15 +867,18 @@ index(0)
 
 }
 
+HiseEventBuffer::Iterator::Iterator(const HiseEventBuffer& b, uint32 typeMask_) :
+	buffer(const_cast<HiseEventBuffer*>(&b)),
+	index(0),
+	typeMask(typeMask_)
+{
+
+}
+
 bool HiseEventBuffer::Iterator::getNextEvent(HiseEvent& b, int &samplePosition, bool skipIgnoredEvents/*=false*/, bool skipArtificialEvents/*=false*/) const
 {
-	while (index < buffer->numUsed && 
-		  ((skipArtificialEvents && buffer->buffer[index].isArtificial()) ||
-		  (skipIgnoredEvents && buffer->buffer[index].isIgnored())))
-	{
+	while (index < buffer->numUsed && shouldSkip(buffer->buffer[index], skipIgnoredEvents, skipArtificialEvents))
 		index++;
-		jassert(index < HISE_EVENT_BUFFER_SIZE);
-	}
 		
 	if (index < buffer->numUsed)
 	{
@@ -859,13 +903,8 @@ HiseEvent* HiseEventBuffer::Iterator::getNextEventPointer(bool skipIgnoredEvents
 
 const HiseEvent* HiseEventBuffer::Iterator::getNextConstEventPointer(bool skipIgnoredEvents/*=false*/, bool skipArtificialNotes /*= false*/) const
 {
-	while (index < buffer->numUsed && 
-		  ((skipArtificialNotes && buffer->buffer[index].isArtificial()) || 
-		  (skipIgnoredEvents && buffer->buffer[index].isIgnored())))
-	{
+	while (index < buffer->numUsed && shouldSkip(buffer->buffer[index], skipIgnoredEvents, skipArtificialNotes))
 		index++;
-		jassert(index < HISE_EVENT_BUFFER_SIZE);
-	}
 
 	if (index < buffer->numUsed)
 	{
@@ -880,32 +919,17 @@ const HiseEvent* HiseEventBuffer::Iterator::getNextConstEventPointer(bool skipIg
 
 void HiseEventBuffer::insertEventAtPosition(const HiseEvent& e, int positionInBuffer)
 {
-	if (numUsed == 0)
+	if (numUsed >= HISE_EVENT_BUFFER_SIZE || !isPositiveAndNotGreaterThan(positionInBuffer, numUsed))
 	{
-		buffer[0] = HiseEvent(e);
-		numUsed = 1;
-
+		jassertfalse;
 		return;
 	}
 
 	if (numUsed > positionInBuffer)
-	{
-		for (int i = jmin<int>(numUsed-1, HISE_EVENT_BUFFER_SIZE-2); i >= positionInBuffer; i--)
-		{
-			jassert(i + 1 < HISE_EVENT_BUFFER_SIZE);
-			buffer[i + 1] = buffer[i];
-		}
-	}
+		std::move_backward(buffer + positionInBuffer, buffer + numUsed, buffer + numUsed + 1);
 
-    if(positionInBuffer < HISE_EVENT_BUFFER_SIZE)
-    {
-        buffer[positionInBuffer] = HiseEvent(e);
-        numUsed++;
-    }
-    else
-    {
-        jassertfalse;
-    }
+	buffer[positionInBuffer] = e;
+	numUsed++;
 }
 
 EventIdHandler::ChokeListener::~ChokeListener()
@@ -475,7 +475,16 @@ private:
     uint32 timestamp = 0;
 };
 
-#define HISE_EVENT_BUFFER_SIZE 256
+/** The number of events that fit into a HiseEventBuffer.
+
+	The events are stored inline so this affects the size of every HiseEventBuffer (16 bytes per event,
+	so 16 KB with the default size). The default leaves enough room for dense MIDI files and MPE streams
+	in a single buffer. Every synth and MIDI processor owns a few of these buffers, so you can lower it
+	if memory is tight and your project only deals with sparse MIDI input.
+*/
+#ifndef HISE_EVENT_BUFFER_SIZE
+#define HISE_EVENT_BUFFER_SIZE 1024
+#endif
 
 /** The buffer type for the HiseEvent.
 
@@ -515,10 +524,30 @@ public:
 		int size = 0;
 	};
 
+	/** Defines what happens if an event is added to a full buffer. */
+	enum class OverflowPolicy
+	{
+		DropNewEvents, ///< the new event is discarded (default).
+		KeepNoteEvents, ///< the last event that is not a note on / note off is removed to make room for a new note event.
+		SpillToBuffer ///< the event with the highest timestamp is moved to the spill buffer (eg. to process it in the next block).
+	};
+
+	/** A bit mask for the filtered Iterator that only contains note on and note off events. */
+	static constexpr uint32 NoteEventMask = (1u << (uint32)HiseEvent::Type::NoteOn) | (1u << (uint32)HiseEvent::Type::NoteOff);
+
+	/** Returns the bit mask for the filtered Iterator that contains the given type. */
+	static constexpr uint32 getTypeMask(HiseEvent::Type t) { return 1u << (uint32)t; }
+
 	HiseEventBuffer();
 
 	bool operator==(const HiseEventBuffer& other);
 
+	/** Sets the overflow policy. The spill buffer is required for OverflowPolicy::SpillToBuffer and must outlive this buffer. */
+	void setOverflowPolicy(OverflowPolicy newPolicy, HiseEventBuffer* spillBuffer = nullptr);
+
+	/** Returns the number of events that were discarded because the buffer was full. */
+	int getNumDroppedEvents() const noexcept { return numDroppedEvents; }
+
 	/** Clears the buffer. */
 	void clear();
 
@@ -540,11 +569,19 @@ public:
 
 	void copyFrom(const HiseEventBuffer& otherBuffer);
 
+	/** Inserts the event after all events with the same or a lower timestamp. 
+	
+		This uses a binary search (or just appends the event if it's the last one) so adding events in order is O(1).
+	*/
 	void addEvent(const HiseEvent& hiseEvent);
 
 	void addEvent(const MidiMessage& midiMessage, int sampleNumber);
 	void addEvents(const MidiBuffer& otherBuffer);
 
+	/** Merges the events of the other buffer into this buffer in a single pass. 
+	
+		The events of the other buffer are inserted after the events in this buffer with the same timestamp.
+	*/
 	void addEvents(const HiseEventBuffer &otherBuffer);
 	
 	void sortTimestamps();
@@ -585,6 +622,12 @@ public:
 		/** Creates an iterator which allows access to the HiseEvents in the buffer. */
 		Iterator(const HiseEventBuffer& b);
 
+		/** Creates an iterator which only returns the events with a type in the given bit mask. 
+		
+			Use HiseEventBuffer::NoteEventMask or combine the values of HiseEventBuffer::getTypeMask().
+		*/
+		Iterator(const HiseEventBuffer& b, uint32 typeMask);
+
 		/** Saves the next event into the given HiseEvent address. 
 		@param e - the event adress. Remember this will copy the event. If you want to alter the event in the buffer, 
 		           use the other iterator methods which return a pointer to the element in the buffer. 
@@ -602,9 +645,17 @@ public:
 
 	private:
 
+		bool shouldSkip(const HiseEvent& e, bool skipIgnoredEvents, bool skipArtificialEvents) const noexcept
+		{
+			return (skipArtificialEvents && e.isArtificial()) ||
+				   (skipIgnoredEvents && e.isIgnored()) ||
+				   (typeMask & getTypeMask(e.getType())) == 0;
+		}
+
 		HiseEventBuffer *buffer;
 
 		mutable int index;
+		uint32 typeMask = 0xFFFFFFFF;
 	};
 
 	/** compatibility for standard C++ type iterators. */
@@ -625,9 +676,25 @@ private:
 
 	void insertEventAtPosition(const HiseEvent& e, int positionInBuffer);
 
+	/** Returns the index after the last event with a timestamp lower or equal than the given one. */
+	int getInsertPosition(int timestamp) const noexcept;
+
+	/** Returns the index of the first event with a timestamp equal or higher than the given one. */
+	int getFirstIndexWithTimestamp(int timestamp) const noexcept;
+
+	/** Merges the sorted events into the buffer. */
+	void mergeEvents(const HiseEvent* events, int numEvents);
+
+	/** Applies the overflow policy for the given event and returns true if there's room to insert it. */
+	bool makeRoomFor(const HiseEvent& e);
+
 	event_alignment HiseEvent buffer[HISE_EVENT_BUFFER_SIZE];
 
 	int numUsed = 0;
+
+	OverflowPolicy overflowPolicy = OverflowPolicy::DropNewEvents;
+	HiseEventBuffer* spillBuffer = nullptr;
+	int numDroppedEvents = 0;
 };
 
 #undef event_alignment
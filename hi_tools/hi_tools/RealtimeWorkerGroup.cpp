@@ -0,0 +1,239 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise {
+using namespace juce;
+
+static int& getWorkerIndexForThisThread()
+{
+	static thread_local int workerIndex = 0;
+	return workerIndex;
+}
+
+RealtimeWorkerGroup::CaptureFunction RealtimeWorkerGroup::captureFunction = nullptr;
+RealtimeWorkerGroup::SwapFunction RealtimeWorkerGroup::swapFunction = nullptr;
+
+struct RealtimeWorkerGroup::Worker : public Thread
+{
+	Worker(RealtimeWorkerGroup& parent_, int index_) :
+		Thread("Realtime Worker " + String(index_)),
+		parent(parent_),
+		index(index_)
+	{}
+
+	void run() override
+	{
+		getWorkerIndexForThisThread() = index;
+
+		uint32 lastGeneration = 0;
+
+		while (!threadShouldExit())
+		{
+			auto generation = (uint32)(parent.state.load(std::memory_order_acquire) >> 32);
+
+			if (generation != lastGeneration)
+			{
+				lastGeneration = generation;
+				parent.runPendingTasks(generation);
+				continue;
+			}
+
+			// spin a little bit before going to sleep so that consecutive
+			// calls within one audio callback don't need to wake up the thread
+			for (int i = 0; i < 2000; i++)
+			{
+				if ((uint32)(parent.state.load(std::memory_order_acquire) >> 32) != lastGeneration)
+					break;
+
+				_mm_pause();
+			}
+
+			// This must be visible before the generation is checked again, otherwise
+			// execute() might skip the wake up call and this thread misses the tasks
+			parked.store(true);
+
+			if ((uint32)(parent.state.load() >> 32) == lastGeneration)
+				wakeUpSignal.wait(100000);
+
+			parked.store(false);
+		}
+	}
+
+	/** Wakes up the thread if it's waiting. This is lock free so it can be called from the audio thread. */
+	void wakeUp() noexcept
+	{
+		if (parked.load())
+			wakeUpSignal.signal();
+	}
+
+	RealtimeWorkerGroup& parent;
+	const int index;
+
+	std::atomic<bool> parked = { false };
+	moodycamel::spsc_sema::LightweightSemaphore wakeUpSignal;
+};
+
+RealtimeWorkerGroup::RealtimeWorkerGroup()
+{
+	const int numWorkers = jlimit(1, HISE_MAX_REALTIME_WORKERS, HISE_NUM_REALTIME_WORKERS > 0 ? HISE_NUM_REALTIME_WORKERS : SystemStats::getNumCpus() - 1);
+
+	for (int i = 1; i < numWorkers; i++)
+	{
+		workers.add(new Worker(*this, i));
+		workers.getLast()->startThread(Thread::realtimeAudioPriority);
+	}
+}
+
+RealtimeWorkerGroup::~RealtimeWorkerGroup()
+{
+	for (auto w : workers)
+		w->signalThreadShouldExit();
+
+	for (auto w : workers)
+	{
+		w->wakeUpSignal.signal();
+		w->stopThread(1000);
+	}
+}
+
+int RealtimeWorkerGroup::getCurrentWorkerIndex() noexcept
+{
+	return getWorkerIndexForThisThread();
+}
+
+int RealtimeWorkerGroup::getNumWorkers() const noexcept
+{
+	return workers.size() + 1;
+}
+
+void RealtimeWorkerGroup::setThreadStateFunctions(CaptureFunction newCaptureFunction, SwapFunction newSwapFunction) noexcept
+{
+	captureFunction = newCaptureFunction;
+	swapFunction = newSwapFunction;
+}
+
+Thread::ThreadID RealtimeWorkerGroup::getWorkerThreadId(int workerIndex) const noexcept
+{
+	if (auto w = workers[workerIndex - 1])
+		return w->getThreadId();
+
+	return nullptr;
+}
+
+bool RealtimeWorkerGroup::execute(int numTasksToExecute, TaskFunction f, void* context)
+{
+	if (numTasksToExecute <= 0)
+		return false;
+
+	bool wasBusy = false;
+
+	if (workers.isEmpty() || numTasksToExecute == 1 || !busy.compare_exchange_strong(wasBusy, true))
+	{
+		for (int i = 0; i < numTasksToExecute; i++)
+			f(context, i);
+
+		return false;
+	}
+
+	numTasks = numTasksToExecute;
+	currentFunction = f;
+	currentContext = context;
+	numFinished.store(0);
+
+	if (captureFunction != nullptr)
+		captureFunction(callerState);
+
+	auto nextGeneration = (uint32)(state.load() >> 32) + 1;
+
+	// zero is the initial generation of the workers
+	if (nextGeneration == 0)
+		nextGeneration = 1;
+
+	// This must not be reordered with the check of the parked flag in Worker::wakeUp()
+	state.store((uint64)nextGeneration << 32);
+
+	for (auto w : workers)
+		w->wakeUp();
+
+	runPendingTasks(nextGeneration);
+
+	while (numFinished.load(std::memory_order_acquire) < numTasksToExecute)
+		_mm_pause();
+
+	// Invalidate the task index of this generation before the next call can change the tasks,
+	// otherwise a worker that is still in runPendingTasks() might claim a task of the next call
+	state.store(((uint64)nextGeneration << 32) | IndexMask, std::memory_order_release);
+
+	busy.store(false);
+	return true;
+}
+
+void RealtimeWorkerGroup::runPendingTasks(uint32 generation)
+{
+	while (true)
+	{
+		auto s = state.load(std::memory_order_acquire);
+
+		// The tasks of this generation are already done
+		if ((uint32)(s >> 32) != generation)
+			return;
+
+		auto taskIndex = (uint32)(s & IndexMask);
+
+		// The generation check must come first, numTasks might already belong to the next call
+		if (taskIndex >= (uint32)numTasks.load(std::memory_order_acquire))
+			return;
+
+		if (state.compare_exchange_weak(s, s + 1, std::memory_order_acq_rel))
+		{
+			// A successful claim means that the caller is still waiting for this task,
+			// so the function, the context and the caller state can't change until it's finished
+			if (swapFunction != nullptr && getWorkerIndexForThisThread() != 0)
+			{
+				auto s = callerState;
+
+				swapFunction(s);
+				currentFunction(currentContext, (int)taskIndex);
+				swapFunction(s);
+			}
+			else
+			{
+				currentFunction(currentContext, (int)taskIndex);
+			}
+
+			numFinished.fetch_add(1, std::memory_order_release);
+		}
+	}
+}
+
+}
@@ -0,0 +1,137 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#pragma once
+
+namespace hise {
+using namespace juce;
+
+/** A group of high priority threads that can be used to process independent tasks concurrently on the audio thread.
+
+	The calling thread will also work on the tasks and returns when all tasks are finished. If the group is already
+	busy (eg. because it's called from one of its own worker threads or from another audio thread), the tasks will be 
+	executed serially on the calling thread, so it's always safe to call execute().
+
+	Use it with a SharedResourcePointer so that all instances share the same threads:
+
+		SharedResourcePointer<RealtimeWorkerGroup> workers;
+
+		auto f = [&](int taskIndex)
+		{
+			// use getCurrentWorkerIndex() to pick the scratch buffer for this thread
+			renderVoice(taskIndex, scratchBuffers[RealtimeWorkerGroup::getCurrentWorkerIndex()]);
+		};
+
+		workers->execute(numVoices, f);
+*/
+class RealtimeWorkerGroup
+{
+public:
+
+	using TaskFunction = void(*)(void* context, int taskIndex);
+
+	/** A copy of a thread local state of the thread that calls execute(). */
+	struct ThreadState
+	{
+		alignas(void*) uint8 data[32];
+	};
+
+	/** Stores the thread local state of the current thread into the given object. */
+	using CaptureFunction = void(*)(ThreadState& state);
+
+	/** Exchanges the thread local state of the current thread with the given object. */
+	using SwapFunction = void(*)(ThreadState& state);
+
+	RealtimeWorkerGroup();
+	~RealtimeWorkerGroup();
+
+	/** Returns the index of the worker that calls this method (0 for any thread that's not part of a worker group). 
+	
+		The index is always below HISE_MAX_REALTIME_WORKERS, so you can use it to pick a preallocated scratch buffer.
+	*/
+	static int getCurrentWorkerIndex() noexcept;
+
+	/** Returns the number of threads that work on the tasks (including the calling thread). */
+	int getNumWorkers() const noexcept;
+
+	/** Returns the thread ID of the given worker (or nullptr for the index 0, which is the calling thread). */
+	Thread::ThreadID getWorkerThreadId(int workerIndex) const noexcept;
+
+	/** Executes the given function for every task index and returns when all tasks are done. 
+	
+		Returns true if the tasks were executed concurrently, or false if they were executed on the calling thread.
+	*/
+	bool execute(int numTasks, TaskFunction f, void* context);
+
+	/** Sets the functions that forward a thread local state of the calling thread to the workers.
+
+		execute() captures the state of the calling thread and every worker swaps it in before it runs
+		a task and swaps its own state back afterwards. hi_core uses this to report the allocations of
+		the tasks in the AudioThreadViolationTracker. Call this once before any worker group is used.
+	*/
+	static void setThreadStateFunctions(CaptureFunction newCaptureFunction, SwapFunction newSwapFunction) noexcept;
+
+	/** Executes the given lambda with the signature void(int taskIndex) for every task index. */
+	template <typename F> bool execute(int numTasks, F& f)
+	{
+		return execute(numTasks, [](void* obj, int taskIndex) { (*static_cast<F*>(obj))(taskIndex); }, &f);
+	}
+
+private:
+
+	struct Worker;
+
+	void runPendingTasks(uint32 generation);
+
+	static constexpr uint64 IndexMask = 0xFFFFFFFF;
+
+	std::atomic<bool> busy = { false };
+
+	// the upper 32 bit contain the generation, the lower 32 bit the next task index
+	std::atomic<uint64> state = { 0 };
+	std::atomic<int> numFinished = { 0 };
+
+	std::atomic<int> numTasks = { 0 };
+	TaskFunction currentFunction = nullptr;
+	void* currentContext = nullptr;
+	ThreadState callerState;
+
+	static CaptureFunction captureFunction;
+	static SwapFunction swapFunction;
+
+	OwnedArray<Worker> workers;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeWorkerGroup);
+};
+
+}
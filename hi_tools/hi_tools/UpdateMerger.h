@@ -448,6 +448,16 @@ public:
     }
     
     float getA0() const noexcept { return a0; }
+    float getB0() const noexcept { return b0; }
+
+    bool isActive() const noexcept { return active; }
+
+    /** Sets the filter state after the samples have been smoothed externally using getA0() and getB0(). */
+    void setCurrentValue(float v) noexcept
+    {
+        currentValue = v;
+        prevValue = v;
+    }
     
     
 	/** smooth the next sample. */
@@ -48,6 +48,8 @@
 #include <limits.h>
 #include <regex>
 
+#include "../hi_streaming/hi_streaming/lockfree_fifo/atomicops.h"
+
 #include "hi_tools.h"
 
 #if !HISE_NO_GUI_TOOLS
@@ -62,6 +64,7 @@
 #include "hi_tools/HiseEventBuffer.cpp"
 
 #include "hi_tools/MiscToolClasses.cpp"
+#include "hi_tools/RealtimeWorkerGroup.cpp"
 #include "hi_dispatch/hi_dispatch.cpp"
 
 #include "hi_tools/PathFactory.cpp"
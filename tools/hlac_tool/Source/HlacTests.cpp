@@ -843,6 +843,9 @@ public:
 
 		testHiseSampleBufferReadWithOffset();
 
+		testParallelBulkDecoding(1);
+		testParallelBulkDecoding(2);
+
 		testHeader();
 
 		testArchiver();
@@ -1212,6 +1215,62 @@ public:
 		expectEquals<int>(error, 0, "Buffer read with offset doesn't work");
 	}
 
+	void testParallelBulkDecoding(int numChannels)
+	{
+		beginTest("Test decoding large ranges with " + String(numChannels) + " channels");
+
+		const int numSamples = 400000;
+
+		auto signal = createTestBuffer(numChannels, numSamples);
+
+		Array<AudioSampleBuffer> buffers;
+		buffers.add(signal);
+
+		auto mb = writeIntoMemory(buffers);
+
+		ScopedPointer<HiseLosslessAudioFormatReader> reader = createReader(mb, false);
+
+		// Starts in the middle of a block so that the first and last chunk are partial
+		const int offset = 1234;
+		const int numToRead = numSamples - 2 * offset;
+
+		HlacSubSectionReader sub(reader, 0, numSamples);
+		HiseSampleBuffer b(false, numChannels, numSamples);
+
+		sub.readIntoFixedBuffer(b, offset, numToRead, offset);
+
+		auto getExpected = [&](int start, int num)
+		{
+			AudioSampleBuffer e(numChannels, num);
+
+			for (int i = 0; i < numChannels; i++)
+				e.copyFrom(i, 0, signal, i, start, num);
+
+			return e;
+		};
+
+		auto expected = getExpected(offset, numToRead);
+		AudioSampleBuffer result(numChannels, numToRead);
+
+		b.convertToFloatWithNormalisation(result.getArrayOfWritePointers(), numChannels, offset, numToRead);
+
+		expectEquals<int>((int)CompressionHelpers::checkBuffersEqual(result, expected), 0, "Fixed buffer read");
+
+		AudioSampleBuffer floatResult(numChannels, numToRead);
+		reader->read(&floatResult, 0, numToRead, offset, true, true);
+
+		// checkBuffersEqual() subtracts the reference from the work buffer
+		expected = getExpected(offset, numToRead);
+		expectEquals<int>((int)CompressionHelpers::checkBuffersEqual(floatResult, expected), 0, "Float buffer read");
+
+		// The decoder must continue at the right position after a bulk read
+		AudioSampleBuffer tail(numChannels, offset);
+		reader->read(&tail, 0, offset, offset + numToRead, true, true);
+
+		auto expectedTail = getExpected(offset + numToRead, offset);
+		expectEquals<int>((int)CompressionHelpers::checkBuffersEqual(tail, expectedTail), 0, "Read after bulk read");
+	}
+
 	void testSeeking(int numChannels)
 	{
 		beginTest("Test seeking with " + String(numChannels) + " channels");